@@ -378,6 +378,17 @@ public final class Screen {
         // Get the new screens
         initScreens();
 
+        // Platforms report settings changes that leave every screen as it
+        // was (e.g. switching virtual desktops on X11); keep the existing
+        // instances then, rather than updating every window and listener
+        if (oldScreens != null && isSameConfiguration(oldScreens, screens)) {
+            for (Screen screen : screens) {
+                screen.dispose();
+            }
+            screens = oldScreens;
+            return;
+        }
+
         if (eventHandler != null) {
             eventHandler.handleSettingsChanged();
         }
@@ -405,6 +416,43 @@ public final class Screen {
         }
     }
 
+    private static boolean isSameConfiguration(List<Screen> oldScreens, List<Screen> newScreens) {
+        if (oldScreens.size() != newScreens.size()) {
+            return false;
+        }
+        for (int i = 0; i < oldScreens.size(); i++) {
+            if (!oldScreens.get(i).isSameConfiguration(newScreens.get(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Like equals(), but ignores the adapter, which is only assigned once
+    // the screens are reported to the toolkit
+    private boolean isSameConfiguration(Screen screen) {
+        return ptr == screen.ptr
+                && depth == screen.depth
+                && x == screen.x
+                && y == screen.y
+                && width == screen.width
+                && height == screen.height
+                && platformX == screen.platformX
+                && platformY == screen.platformY
+                && platformWidth == screen.platformWidth
+                && platformHeight == screen.platformHeight
+                && visibleX == screen.visibleX
+                && visibleY == screen.visibleY
+                && visibleWidth == screen.visibleWidth
+                && visibleHeight == screen.visibleHeight
+                && resolutionX == screen.resolutionX
+                && resolutionY == screen.resolutionY
+                && Float.compare(screen.platformScaleX, platformScaleX) == 0
+                && Float.compare(screen.platformScaleY, platformScaleY) == 0
+                && Float.compare(screen.outputScaleX, outputScaleX) == 0
+                && Float.compare(screen.outputScaleY, outputScaleY) == 0;
+    }
+
     static void initScreens() {
         Application.checkEventThread();
         Screen[] newScreens = Application.GetApplication().staticScreen_getScreens();
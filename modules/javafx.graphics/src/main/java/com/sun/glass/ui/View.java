@@ -779,6 +779,25 @@ public abstract class View {
         }
     }
 
+    protected void _uploadPixels(long ptr, Pixels pixels, int x, int y, int width, int height) {
+        _uploadPixels(ptr, pixels);
+    }
+    /**
+     * This method dumps the pixels on to the view, where only the given
+     * area (in pixels) changed since the previous upload.  Platforms that
+     * cannot update part of a view upload all of the pixels.
+     */
+    public void uploadPixels(Pixels pixels, int x, int y, int width, int height) {
+        Application.checkEventThread();
+        checkNotClosed();
+        lock();
+        try {
+            _uploadPixels(this.ptr, pixels, x, y, width, height);
+        } finally {
+            unlock();
+        }
+    }
+
 
     //-------- FULLSCREEN --------//
 
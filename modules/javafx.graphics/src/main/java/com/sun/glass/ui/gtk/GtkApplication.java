@@ -157,6 +157,7 @@ final class GtkApplication extends Application implements
             overrideUIScale = -1.0f;
         }
 
+        long startTime = System.nanoTime();
         int libraryToLoad = _queryLibrary(gtkVersion, gtkVersionVerbose);
 
         @SuppressWarnings("removal")
@@ -178,7 +179,14 @@ final class GtkApplication extends Application implements
             return null;
         });
 
+        long loadTime = System.nanoTime();
         _initGTK(gtkVersion, gtkVersionVerbose, overrideUIScale);
+        if (gtkVersionVerbose) {
+            long initTime = System.nanoTime();
+            System.out.println("Glass GTK library loaded in "
+                    + (loadTime - startTime) / 1000000 + " ms, initialized in "
+                    + (initTime - loadTime) / 1000000 + " ms");
+        }
 
         // Embedded in SWT, with shared event thread
         @SuppressWarnings("removal")
@@ -558,9 +558,35 @@ class EPDFrameBuffer {
      * from the JavaFX Application Thread.</p>
      */
     void sync() {
+        sync(0, 0, xres, yres);
+    }
+
+    /**
+     * Sends the updated contents of the given region of the Linux frame buffer
+     * to the EPDC driver, optionally synchronizing with the driver by first
+     * waiting for the previous update to complete. The region is clipped to
+     * the visible resolution of the frame buffer.
+     * <p>
+     * <strong>This method is not thread safe</strong>, but it is invoked only
+     * from the JavaFX Application Thread.</p>
+     *
+     * @param x the left edge of the region
+     * @param y the top edge of the region
+     * @param width the width of the region
+     * @param height the height of the region
+     */
+    void sync(int x, int y, int width, int height) {
+        int left = Math.max(x, 0);
+        int top = Math.max(y, 0);
+        int right = Math.min(x + width, xres);
+        int bottom = Math.min(y + height, yres);
+        if (right <= left || bottom <= top) {
+            return;
+        }
         if (!settings.noWait) {
             waitForUpdateComplete(lastMarker);
         }
+        syncUpdate.setUpdateRegion(syncUpdate.p, top, left, right - left, bottom - top);
         lastMarker = sendUpdate(syncUpdate, settings.waveformMode);
     }
 
@@ -664,6 +690,17 @@ class EPDFrameBuffer {
         system.close(fd);
     }
 
+    /**
+     * Indicates whether updates should cover only the region that changed
+     * since the previous update.
+     *
+     * @return {@code true} to send updates of changed regions; otherwise
+     * {@code false}
+     */
+    boolean isRegionUpdates() {
+        return settings.regionUpdates;
+    }
+
     /**
      * Gets the native handle to the Linux frame buffer device.
      *
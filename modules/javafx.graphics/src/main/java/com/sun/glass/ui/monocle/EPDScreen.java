@@ -31,6 +31,7 @@ import java.io.IOException;
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.nio.IntBuffer;
 import java.nio.channels.FileChannel;
 import java.nio.file.FileSystems;
 import java.nio.file.Path;
@@ -38,6 +39,7 @@ import java.nio.file.StandardOpenOption;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.text.MessageFormat;
+import java.util.Arrays;
 
 /**
  * A native screen for an electrophoretic display, also called an e-paper
@@ -84,6 +86,15 @@ class EPDScreen implements NativeScreen {
 
     private boolean isShutdown;
 
+    /**
+     * The pixels of the last frame sent to the display, used to find the
+     * region that changed, or {@code null} when every update covers the whole
+     * screen.
+     */
+    private final int[] lastFrame;
+    private final int[] lineBuffer;
+    private boolean needsFullUpdate = true;
+
     /**
      * Creates a native screen for the electrophoretic display.
      *
@@ -141,6 +152,13 @@ class EPDScreen implements NativeScreen {
         ByteBuffer buffer = fbMapping != null ? fbMapping : fbDevice.getOffscreenBuffer();
         buffer.order(ByteOrder.nativeOrder());
         pixels = new FramebufferY8(buffer, width, height, bitDepth, true);
+        if (fbDevice.isRegionUpdates()) {
+            lastFrame = new int[width * height];
+            lineBuffer = new int[width];
+        } else {
+            lastFrame = null;
+            lineBuffer = null;
+        }
         clearScreen();
     }
 
@@ -179,6 +197,47 @@ class EPDScreen implements NativeScreen {
         }
     }
 
+    /**
+     * Sends only the bounding rectangle of the pixels that changed since the
+     * last frame, and nothing if no pixel changed. The first frame is sent in
+     * full.
+     */
+    private void syncChangedRegion() {
+        IntBuffer frame = pixels.getBuffer().asIntBuffer();
+        if (needsFullUpdate) {
+            frame.get(lastFrame);
+            fbDevice.sync();
+            needsFullUpdate = false;
+            return;
+        }
+        int minX = width;
+        int maxX = -1;
+        int minY = -1;
+        int maxY = -1;
+        for (int y = 0, offset = 0; y < height; y++, offset += width) {
+            frame.position(offset);
+            frame.get(lineBuffer);
+            int first = Arrays.mismatch(lineBuffer, 0, width, lastFrame, offset, offset + width);
+            if (first < 0) {
+                continue;
+            }
+            int last = width - 1;
+            while (lineBuffer[last] == lastFrame[offset + last]) {
+                last--;
+            }
+            System.arraycopy(lineBuffer, first, lastFrame, offset + first, last - first + 1);
+            minX = Math.min(minX, first);
+            maxX = Math.max(maxX, last);
+            if (minY < 0) {
+                minY = y;
+            }
+            maxY = y;
+        }
+        if (maxY >= 0) {
+            fbDevice.sync(minX, minY, maxX - minX + 1, maxY - minY + 1);
+        }
+    }
+
     /**
      * Clears the screen.
      */
@@ -240,7 +299,11 @@ class EPDScreen implements NativeScreen {
     public synchronized void swapBuffers() {
         if (!isShutdown && pixels.hasReceivedData()) {
             writeBuffer();
-            fbDevice.sync();
+            if (lastFrame != null) {
+                syncChangedRegion();
+            } else {
+                fbDevice.sync();
+            }
             pixels.reset();
         }
     }
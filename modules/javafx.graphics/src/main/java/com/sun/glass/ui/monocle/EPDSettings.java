@@ -160,6 +160,22 @@ class EPDSettings {
      */
     private static final String FIX_WIDTH_Y8UR = "monocle.epd.fixWidthY8UR";
 
+    /**
+     * Indicates whether to send only the region that changed since the
+     * previous update: {@code true} to compare each frame with the last one
+     * sent and update only the bounding rectangle of the changed pixels,
+     * skipping updates that change nothing; otherwise {@code false} to update
+     * the whole screen on every frame. The default is {@code false}.
+     * <p>
+     * Smaller regions complete sooner, and with {@link #NO_WAIT} updates to
+     * disjoint regions can proceed concurrently. The comparison keeps a copy
+     * of the last frame, which costs 4 bytes per pixel of the screen.</p>
+     *
+     * @implNote Corresponds to the {@code update_region} field of
+     * {@code mxcfb_update_data} in <i>linux/mxcfb.h</i>.
+     */
+    private static final String REGION_UPDATES = "monocle.epd.regionUpdates";
+
     private static final String[] EPD_PROPERTIES = {
         BITS_PER_PIXEL,
         ROTATE,
@@ -170,7 +186,8 @@ class EPDSettings {
         FLAG_FORCE_MONOCHROME,
         FLAG_USE_DITHERING_Y1,
         FLAG_USE_DITHERING_Y4,
-        FIX_WIDTH_Y8UR
+        FIX_WIDTH_Y8UR,
+        REGION_UPDATES
     };
 
     private static final int BITS_PER_PIXEL_DEFAULT = Integer.SIZE;
@@ -226,6 +243,7 @@ class EPDSettings {
     final int grayscale;
     final int flags;
     final boolean getWidthVisible;
+    final boolean regionUpdates;
 
     /**
      * Creates a new EPDSettings, capturing the current values of the EPD system
@@ -271,6 +289,8 @@ class EPDSettings {
         fixWidthY8UR = Boolean.getBoolean(FIX_WIDTH_Y8UR);
         getWidthVisible = fixWidthY8UR && grayscale == EPDSystem.GRAYSCALE_8BIT
                 && rotate == EPDSystem.FB_ROTATE_UR;
+
+        regionUpdates = Boolean.getBoolean(REGION_UPDATES);
     }
 
     /**
@@ -300,9 +320,9 @@ class EPDSettings {
     public String toString() {
         return MessageFormat.format("{0}[bitsPerPixel={1} rotate={2} "
                 + "noWait={3} waveformMode={4} grayscale={5} flags=0x{6} "
-                + "getWidthVisible={7}]",
+                + "getWidthVisible={7} regionUpdates={8}]",
                 getClass().getName(), bitsPerPixel, rotate,
                 noWait, waveformMode, grayscale, Integer.toHexString(flags),
-                getWidthVisible);
+                getWidthVisible, regionUpdates);
     }
 }
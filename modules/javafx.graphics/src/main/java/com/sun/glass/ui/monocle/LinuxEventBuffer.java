@@ -91,16 +91,18 @@ class LinuxEventBuffer {
      * Adds a raw Linux event to the buffer. Blocks if the buffer is full.
      * Checks whether this is a SYN SYN_REPORT event terminator.
      *
-     * @param event A ByteBuffer containing the event to be added.
+     * @param event A ByteBuffer whose remaining bytes are the event to be
+     *              added.
      * @return true if the event was "SYN SYN_REPORT", false otherwise
      * @throws InterruptedException if our thread was interrupted while waiting
      *                              for the buffer to empty.
      */
     synchronized boolean put(ByteBuffer event) throws
             InterruptedException {
-        boolean isSync = event.getShort(eventStruct.getTypeIndex()) == 0
-                && event.getInt(eventStruct.getValueIndex()) == 0;
-        while (bb.limit() - bb.position() < event.limit()) {
+        int start = event.position();
+        boolean isSync = event.getShort(start + eventStruct.getTypeIndex()) == 0
+                && event.getInt(start + eventStruct.getValueIndex()) == 0;
+        while (bb.limit() - bb.position() < event.remaining()) {
             // Block if bb is full. This should be the
             // only time this thread waits for anything
             // except for more event lines.
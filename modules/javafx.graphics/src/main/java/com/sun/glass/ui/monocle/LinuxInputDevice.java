@@ -50,6 +50,13 @@ import java.util.Map;
  */
 class LinuxInputDevice implements Runnable, InputDevice {
 
+    /**
+     * The number of events fetched per read. evdev returns as many whole
+     * events as are queued, so that a multi-touch frame usually arrives in
+     * a single read and is added to the buffer under a single lock.
+     */
+    private static final int EVENTS_PER_READ = 64;
+
     private LinuxInputProcessor inputProcessor;
     private ReadableByteChannel in;
     private long fd = -1;
@@ -78,7 +85,7 @@ class LinuxInputDevice implements Runnable, InputDevice {
             File sysPath,
             Map<String, String> udevManifest) throws IOException {
         this.buffer = new LinuxEventBuffer(LinuxArch.getBits());
-        this.event = ByteBuffer.allocateDirect(buffer.getEventSize());
+        this.event = ByteBuffer.allocateDirect(buffer.getEventSize() * EVENTS_PER_READ);
         this.devNode = devNode;
         this.sysPath = sysPath;
         this.udevManifest = udevManifest;
@@ -112,7 +119,7 @@ class LinuxInputDevice implements Runnable, InputDevice {
             Map<String, String> udevManifest,
             Map<String, String> uevent) {
         this.buffer = new LinuxEventBuffer(32);
-        this.event = ByteBuffer.allocateDirect(buffer.getEventSize());
+        this.event = ByteBuffer.allocateDirect(buffer.getEventSize() * EVENTS_PER_READ);
         this.capabilities = capabilities;
         this.absCaps = absCaps;
         this.in = in;
@@ -146,18 +153,29 @@ class LinuxInputDevice implements Runnable, InputDevice {
             System.err.println("Error: no input processor set on " + devNode);
             return;
         }
+        int eventSize = buffer.getEventSize();
         while (true) {
             try {
                 readToEventBuffer();
-                if (event.position() == event.limit()) {
-                    event.flip();
+                int filled = event.position();
+                int end = filled - filled % eventSize;
+                if (end > 0) {
                     synchronized (buffer) {
-                        if (buffer.put(event) && !processor.scheduled) {
-                            runnableProcessor.invokeLater(processor);
-                            processor.scheduled = true;
+                        for (int i = 0; i < end; i += eventSize) {
+                            event.limit(i + eventSize);
+                            event.position(i);
+                            // schedule as soon as a frame is complete, put()
+                            // may have to wait for the processor to make room
+                            if (buffer.put(event) && !processor.scheduled) {
+                                runnableProcessor.invokeLater(processor);
+                                processor.scheduled = true;
+                            }
                         }
                     }
-                    event.rewind();
+                    // keep a partially read event for the next read
+                    event.limit(filled);
+                    event.position(end);
+                    event.compact();
                 }
             } catch (IOException | InterruptedException e) {
                 // the device is disconnected
@@ -41,6 +41,7 @@ import java.util.Map;
 final class WinApplication extends Application implements InvokeLaterDispatcher.InvokeLaterSubmitter {
 
     static float overrideUIScale;
+    private static boolean vsyncTimer;
 
     private static boolean getBoolean(String propname, boolean defval, String description) {
         String str = System.getProperty(propname);
@@ -101,6 +102,8 @@ final class WinApplication extends Application implements InvokeLaterDispatcher.
                 } else {
                     overrideUIScale = 1.0f;
                 }
+                vsyncTimer = getBoolean("glass.win.vsyncTimer", false,
+                                        "using DWM composition to time pulses");
                 // Load required Microsoft runtime DLLs on Windows platforms
                 Toolkit.loadMSWindowsLibraries();
                 Application.loadNativeLibrary();
@@ -276,6 +279,10 @@ final class WinApplication extends Application implements InvokeLaterDispatcher.
     }
 
     @Override protected double staticScreen_getVideoRefreshPeriod() {
+        if (vsyncTimer) {
+            // pulses follow DWM composition when it is available
+            return WinTimer.getVsyncPeriod_impl();
+        }
         return 0.0;     // indicate millisecond resolution
     }
 
@@ -42,8 +42,13 @@ final class WinTimer extends Timer {
         super(runnable);
     }
 
+    // true while the timer is driven by DWM composition rather than by a
+    // multimedia timer
+    private boolean vsync;
+
     native private static int _getMinPeriod();
     native private static int _getMaxPeriod();
+    native private static double _getVsyncPeriod();
 
     static int getMinPeriod_impl() {
         return minPeriod;
@@ -53,12 +58,45 @@ final class WinTimer extends Timer {
         return maxPeriod;
     }
 
+    /**
+     * Returns the display refresh period in milliseconds, or 0.0 if the
+     * pulse cannot be synchronized with DWM composition.
+     */
+    static double getVsyncPeriod_impl() {
+        return _getVsyncPeriod();
+    }
+
     @Override protected long _start(Runnable runnable) {
-        throw new RuntimeException("vsync timer not supported");
+        vsync = true;
+        return _startVsync(runnable);
+    }
+    @Override protected long _start(Runnable runnable, int period) {
+        vsync = false;
+        return _startPeriodic(runnable, period);
     }
-    @Override native protected long _start(Runnable runnable, int period);
-    @Override native protected void _stop(long timer);
-    @Override protected void _pause(long timer) {}
-    @Override protected void _resume(long timer) {}
+    @Override protected void _stop(long timer) {
+        if (vsync) {
+            _stopVsync(timer);
+        } else {
+            _stopPeriodic(timer);
+        }
+    }
+    @Override protected void _pause(long timer) {
+        if (vsync) {
+            _pauseVsync(timer);
+        }
+    }
+    @Override protected void _resume(long timer) {
+        if (vsync) {
+            _resumeVsync(timer);
+        }
+    }
+
+    native private long _startPeriodic(Runnable runnable, int period);
+    native private void _stopPeriodic(long timer);
+    native private long _startVsync(Runnable runnable);
+    native private void _stopVsync(long timer);
+    native private void _pauseVsync(long timer);
+    native private void _resumeVsync(long timer);
 }
 
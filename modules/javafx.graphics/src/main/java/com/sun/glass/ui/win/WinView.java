@@ -83,6 +83,10 @@ final class WinView extends View {
     @Override native protected void _begin(long ptr);
     @Override native protected void _end(long ptr);
     @Override native protected void _uploadPixels(long ptr, Pixels pixels);
+    native private void _uploadPixelsDirty(long ptr, Pixels pixels, int x, int y, int width, int height);
+    @Override protected void _uploadPixels(long ptr, Pixels pixels, int x, int y, int width, int height) {
+        _uploadPixelsDirty(ptr, pixels, x, y, width, height);
+    }
     @Override native protected boolean _enterFullscreen(long ptr, boolean animate, boolean keepRatio, boolean hideCursor);
     @Override native protected void _exitFullscreen(long ptr, boolean animate);
 
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.font;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.LinkedHashSet;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Set;
+
+/**
+ * Persistent copy of the fontconfig font enumeration, so that startup does
+ * not have to list every installed font again.  Enabled with
+ * {@code -Dprism.fontcache=true|<directory>}.
+ * <p>
+ * An entry records the modification time of every directory holding one
+ * of the listed fonts, of the standard font directories and of the
+ * fontconfig configuration directories.  Fontconfig relies on the same
+ * directory times to validate its own caches, so a font being installed,
+ * removed or reconfigured invalidates the entry.  Any failure to read or
+ * write an entry falls back to the full enumeration.
+ */
+final class FontCatalogCache {
+
+    private static final int MAGIC = 0x4a464643; // "JFFC"
+    private static final int VERSION = 1;
+
+    private FontCatalogCache() {
+    }
+
+    private static Path getFile(String cacheDir, Locale locale) {
+        return new File(cacheDir, "fontcatalog-" + locale.toLanguageTag() + ".bin").toPath();
+    }
+
+    /* Directories whose contents decide what fontconfig enumerates, beyond
+     * the ones that hold the listed fonts.
+     */
+    private static Set<String> getWatchedDirs(Map<String,String> fontToFileMap) {
+        Set<String> dirs = new LinkedHashSet<>();
+        String home = System.getProperty("user.home");
+        String configHome = System.getenv("XDG_CONFIG_HOME");
+        if (configHome == null || configHome.isEmpty()) {
+            configHome = home + "/.config";
+        }
+        String dataHome = System.getenv("XDG_DATA_HOME");
+        if (dataHome == null || dataHome.isEmpty()) {
+            dataHome = home + "/.local/share";
+        }
+        dirs.add("/etc/fonts");
+        dirs.add("/etc/fonts/conf.d");
+        dirs.add(configHome + "/fontconfig");
+        dirs.add(configHome + "/fontconfig/conf.d");
+        dirs.add("/usr/share/fonts");
+        dirs.add("/usr/local/share/fonts");
+        dirs.add(dataHome + "/fonts");
+        dirs.add(home + "/.fonts");
+        for (String file : fontToFileMap.values()) {
+            String parent = new File(file).getParent();
+            if (parent != null) {
+                dirs.add(parent);
+            }
+        }
+        return dirs;
+    }
+
+    private static long lastModified(String dir) {
+        File f = new File(dir);
+        return f.isDirectory() ? f.lastModified() : -1L;
+    }
+
+    /**
+     * Fills the maps from the cache entry for the locale.  Returns false,
+     * leaving the maps untouched, if there is no valid entry.
+     */
+    static boolean load(String cacheDir,
+                        HashMap<String,String> fontToFileMap,
+                        HashMap<String,String> fontToFamilyNameMap,
+                        HashMap<String,ArrayList<String>> familyToFontListMap,
+                        Locale locale) {
+        Path file = getFile(cacheDir, locale);
+        if (!Files.isRegularFile(file)) {
+            return false;
+        }
+        HashMap<String,String> files = new HashMap<>();
+        HashMap<String,String> families = new HashMap<>();
+        HashMap<String,ArrayList<String>> familyFonts = new HashMap<>();
+        try (DataInputStream in = new DataInputStream(
+                 new BufferedInputStream(Files.newInputStream(file)))) {
+            if (in.readInt() != MAGIC || in.readInt() != VERSION) {
+                return false;
+            }
+            int count = in.readInt();
+            for (int i = 0; i < count; i++) {
+                String dir = in.readUTF();
+                if (lastModified(dir) != in.readLong()) {
+                    return false;
+                }
+            }
+            count = in.readInt();
+            for (int i = 0; i < count; i++) {
+                files.put(in.readUTF(), in.readUTF());
+            }
+            count = in.readInt();
+            for (int i = 0; i < count; i++) {
+                families.put(in.readUTF(), in.readUTF());
+            }
+            count = in.readInt();
+            for (int i = 0; i < count; i++) {
+                String family = in.readUTF();
+                int n = in.readInt();
+                ArrayList<String> fonts = new ArrayList<>(n);
+                for (int j = 0; j < n; j++) {
+                    fonts.add(in.readUTF());
+                }
+                familyFonts.put(family, fonts);
+            }
+        } catch (IOException | RuntimeException e) {
+            return false;
+        }
+        if (files.isEmpty()) {
+            return false;
+        }
+        fontToFileMap.putAll(files);
+        fontToFamilyNameMap.putAll(families);
+        familyToFontListMap.putAll(familyFonts);
+        return true;
+    }
+
+    /**
+     * Stores the enumerated maps as the cache entry for the locale.
+     */
+    static void store(String cacheDir,
+                      HashMap<String,String> fontToFileMap,
+                      HashMap<String,String> fontToFamilyNameMap,
+                      HashMap<String,ArrayList<String>> familyToFontListMap,
+                      Locale locale) {
+        if (fontToFileMap.isEmpty()) {
+            return;
+        }
+        Path file = getFile(cacheDir, locale);
+        try {
+            Path dir = file.getParent();
+            Files.createDirectories(dir);
+            // write to a temporary file first so that a concurrent launch
+            // never sees a partially written entry
+            Path tmp = Files.createTempFile(dir, "fontcatalog", ".tmp");
+            try {
+                write(tmp, fontToFileMap, fontToFamilyNameMap, familyToFontListMap);
+                Files.move(tmp, file, StandardCopyOption.REPLACE_EXISTING);
+            } finally {
+                Files.deleteIfExists(tmp);
+            }
+        } catch (IOException | RuntimeException e) {
+            if (PrismFontFactory.debugFonts) {
+                System.err.println("FontCatalogCache: unable to store " + file + ": " + e);
+            }
+        }
+    }
+
+    private static void write(Path tmp,
+                              HashMap<String,String> fontToFileMap,
+                              HashMap<String,String> fontToFamilyNameMap,
+                              HashMap<String,ArrayList<String>> familyToFontListMap)
+        throws IOException {
+        try (DataOutputStream out = new DataOutputStream(
+                 new BufferedOutputStream(Files.newOutputStream(tmp)))) {
+            out.writeInt(MAGIC);
+            out.writeInt(VERSION);
+            Set<String> dirs = getWatchedDirs(fontToFileMap);
+            out.writeInt(dirs.size());
+            for (String d : dirs) {
+                out.writeUTF(d);
+                out.writeLong(lastModified(d));
+            }
+            out.writeInt(fontToFileMap.size());
+            for (Map.Entry<String,String> e : fontToFileMap.entrySet()) {
+                out.writeUTF(e.getKey());
+                out.writeUTF(e.getValue());
+            }
+            out.writeInt(fontToFamilyNameMap.size());
+            for (Map.Entry<String,String> e : fontToFamilyNameMap.entrySet()) {
+                out.writeUTF(e.getKey());
+                out.writeUTF(e.getValue());
+            }
+            out.writeInt(familyToFontListMap.size());
+            for (Map.Entry<String,ArrayList<String>> e : familyToFontListMap.entrySet()) {
+                out.writeUTF(e.getKey());
+                out.writeInt(e.getValue().size());
+                for (String font : e.getValue()) {
+                    out.writeUTF(font);
+                }
+            }
+        }
+    }
+}
@@ -42,6 +42,7 @@ public class FontConfigManager {
     static boolean useFontConfig = true;
     static boolean fontConfigFailed = false;
     static boolean useEmbeddedFontSupport = false;
+    static String fontCacheDir = null;
 
     static {
         @SuppressWarnings("removal")
@@ -53,6 +54,16 @@ public class FontConfigManager {
                     useFontConfig = "true".equals(ufc);
                     String emb = System.getProperty("prism.embeddedfonts", "");
                     useEmbeddedFontSupport = "true".equals(emb);
+                    /* Font catalog cache: "true" for the default location
+                     * in the user's openjfx cache, or the path of the cache
+                     * directory */
+                    String cache = System.getProperty("prism.fontcache", "");
+                    if ("true".equalsIgnoreCase(cache)) {
+                        fontCacheDir = System.getProperty("user.home")
+                                + "/.openjfx/cache/fonts";
+                    } else if (!cache.isEmpty() && !"false".equalsIgnoreCase(cache)) {
+                        fontCacheDir = cache;
+                    }
                     return null;
                 }
         );
@@ -237,10 +248,34 @@ public class FontConfigManager {
          Locale locale) {
 
         boolean pnm = false;
+        if (useFontConfig && !fontConfigFailed && !useEmbeddedFontSupport &&
+            fontCacheDir != null)
+        {
+            @SuppressWarnings("removal")
+            boolean cached = AccessController.doPrivileged(
+                    (PrivilegedAction<Boolean>) () -> FontCatalogCache.load(
+                            fontCacheDir, fontToFileMap, fontToFamilyNameMap,
+                            familyToFontListMap, locale));
+            if (cached) {
+                if (debugFonts) {
+                    System.err.println("Loaded font catalog from " + fontCacheDir);
+                }
+                return;
+            }
+        }
         if (useFontConfig && !fontConfigFailed) {
             pnm = populateMapsNative(fontToFileMap, fontToFamilyNameMap,
                                 familyToFontListMap, locale);
-
+            if (pnm && !useEmbeddedFontSupport && fontCacheDir != null) {
+                @SuppressWarnings("removal")
+                var dummy = AccessController.doPrivileged(
+                        (PrivilegedAction<Void>) () -> {
+                            FontCatalogCache.store(fontCacheDir, fontToFileMap,
+                                    fontToFamilyNameMap, familyToFontListMap,
+                                    locale);
+                            return null;
+                        });
+            }
         }
 
         if (fontConfigFailed ||
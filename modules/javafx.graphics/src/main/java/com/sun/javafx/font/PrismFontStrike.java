@@ -39,6 +39,7 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
     private DisposerRecord disposer;
     private T fontResource;
     private Map<Integer,Glyph> glyphMap = new HashMap<>();
+    private Map<Integer,Path2D> outlineMap;
     private PrismMetrics metrics;
     protected boolean drawShapes = false;
     private float size;
@@ -186,6 +187,24 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
 
     protected abstract Path2D createGlyphOutline(int glyphCode);
 
+    /**
+     * Returns the outline of the glyph at the size of this strike.  The
+     * outlines are kept for the life of the strike since text rendered
+     * as shapes asks for the same glyphs again on every frame.  The
+     * returned path is shared and must not be modified.
+     */
+    public Path2D getGlyphOutline(int glyphCode) {
+        if (outlineMap == null) {
+            outlineMap = new HashMap<>();
+        }
+        Path2D outline = outlineMap.get(glyphCode);
+        if (outline == null && !outlineMap.containsKey(glyphCode)) {
+            outline = createGlyphOutline(glyphCode);
+            outlineMap.put(glyphCode, outline);
+        }
+        return outline;
+    }
+
     @Override
     public Shape getOutline(GlyphList gl, BaseTransform transform) {
         Path2D result = new Path2D();
@@ -205,7 +224,7 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
         for (int i = 0; i < gl.getGlyphCount(); i++) {
             int glyphCode = gl.getGlyphCode(i);
             if (glyphCode != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
-                Shape gp = createGlyphOutline(glyphCode);
+                Shape gp = getGlyphOutline(glyphCode);
                 if (gp != null) {
                     t.setTransform(transform);
                     t.translate(gl.getPosX(i), gl.getPosY(i));
@@ -119,7 +119,7 @@ class CTGlyph implements Glyph {
     }
 
     @Override public Shape getShape() {
-        return strike.createGlyphOutline(glyphCode);
+        return strike.getGlyphOutline(glyphCode);
     }
 
     private long createContext(boolean lcd, int width, int height) {
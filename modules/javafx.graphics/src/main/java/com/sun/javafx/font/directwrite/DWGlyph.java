@@ -322,7 +322,7 @@ public class DWGlyph implements Glyph {
 
     @Override
     public Shape getShape() {
-        return strike.createGlyphOutline(run.glyphIndices & SHORTMASK);
+        return strike.getGlyphOutline(run.glyphIndices & SHORTMASK);
     }
 
     @Override
@@ -32,11 +32,30 @@ class IDWriteFontFace extends IUnknown {
         super(ptr);
     }
 
-    /* Based on GetDesignGlyphMetrics but only handles a single codePoint,
-     * as opposite of taking in an array and returing an array.
-     * - performance and simplicity based on JavaFX needs */
+    /* Number of values stored per glyph by GetDesignGlyphMetrics, in the
+     * order of the DWRITE_GLYPH_METRICS fields */
+    static final int GLYPH_METRICS_SIZE = 7;
+
+    /* Fills metrics with GLYPH_METRICS_SIZE values for each of the first
+     * glyphCount glyphs, returning the HRESULT. */
+    int GetDesignGlyphMetrics(short[] glyphIndices, int glyphCount,
+                              boolean isSideways, int[] metrics) {
+        return OS.GetDesignGlyphMetrics(ptr, glyphIndices, glyphCount, isSideways, metrics);
+    }
+
     DWRITE_GLYPH_METRICS GetDesignGlyphMetrics(short glyphIndex, boolean isSideways) {
-        return OS.GetDesignGlyphMetrics(ptr, glyphIndex, isSideways);
+        int[] m = new int[GLYPH_METRICS_SIZE];
+        int hr = GetDesignGlyphMetrics(new short[] {glyphIndex}, 1, isSideways, m);
+        if (hr != OS.S_OK) return null;
+        DWRITE_GLYPH_METRICS metrics = new DWRITE_GLYPH_METRICS();
+        metrics.leftSideBearing = m[0];
+        metrics.advanceWidth = m[1];
+        metrics.rightSideBearing = m[2];
+        metrics.topSideBearing = m[3];
+        metrics.advanceHeight = m[4];
+        metrics.bottomSideBearing = m[5];
+        metrics.verticalOriginY = m[6];
+        return metrics;
     }
 
     Path2D GetGlyphRunOutline(float emSize, short glyphIndex, boolean isSideways) {
@@ -227,7 +227,7 @@ class OS {
     static final native int JFXTextRendererGetClusterMap(long ptr, short[] clusterMap, int textStart, int glyphStart);
 
     //IDWriteFontFace
-    static final native DWRITE_GLYPH_METRICS GetDesignGlyphMetrics(long ptr, short glyphIndex, boolean isSideways);
+    static final native int GetDesignGlyphMetrics(long ptr, short[] glyphIndices, int glyphCount, boolean isSideways, int[] metrics);
     static final native Path2D GetGlyphRunOutline(long ptr, float emSize, short glyphIndex, boolean isSideways);
 
     //IDWriteFont
@@ -144,7 +144,9 @@ class FTFontFile extends PrismFontFile {
         }
 
         int glyphCode = glyph.getGlyphCode();
-        int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
+        int[] metrics = new int[OSFreetype.GLYPH_METRICS_LENGTH];
+        byte[] buffer = OSFreetype.renderGlyph(face, glyphCode, flags, metrics);
+        int error = metrics[OSFreetype.GLYPH_ERROR];
         if (error != 0) {
             if (PrismFontFactory.debugFonts) {
                 System.err.println("FT_Load_Glyph failed " + error +
@@ -154,14 +156,7 @@ class FTFontFile extends PrismFontFile {
             return;
         }
 
-        FT_GlyphSlotRec glyphRec = OSFreetype.getGlyphSlot(face);
-        if (glyphRec == null) return;
-        FT_Bitmap bitmap = glyphRec.bitmap;
-        if (bitmap == null) return;
-        int pixelMode = bitmap.pixel_mode;
-        int width = bitmap.width;
-        int height = bitmap.rows;
-        int pitch = bitmap.pitch;
+        int pixelMode = metrics[OSFreetype.GLYPH_PIXEL_MODE];
         if (pixelMode != OSFreetype.FT_PIXEL_MODE_GRAY && pixelMode != OSFreetype.FT_PIXEL_MODE_LCD) {
             /* This procedure only requests FT_RENDER_MODE_NORMAL and FT_RENDER_MODE_LCD,
              * and for its output is expects FT_PIXEL_MODE_GRAY and FT_PIXEL_MODE_LCD, respectively.
@@ -176,34 +171,19 @@ class FTFontFile extends PrismFontFile {
             }
             return;
         }
-        byte[] buffer;
-        if (width != 0 && height != 0) {
-            buffer = OSFreetype.getBitmapData(face);
-            if (buffer != null && pitch != width) {
-                /* Common for LCD glyphs */
-                byte[] newBuffer = new byte[width * height];
-                int src = 0, dst = 0;
-                for (int y = 0; y < height; y++) {
-                    for (int x = 0; x < width; x++) {
-                        newBuffer[dst + x] = buffer[src + x];
-                    }
-                    dst += width;
-                    src += pitch;
-                }
-                buffer = newBuffer;
-            }
-        } else {
-            /* white space */
-            buffer = new byte[0];
-        }
+        FT_Bitmap bitmap = new FT_Bitmap();
+        bitmap.pixel_mode = (byte)pixelMode;
+        bitmap.width = metrics[OSFreetype.GLYPH_WIDTH];
+        bitmap.rows = metrics[OSFreetype.GLYPH_ROWS];
+        bitmap.pitch = bitmap.width; /* the returned data is packed */
 
         glyph.buffer = buffer;
         glyph.bitmap = bitmap;
-        glyph.bitmap_left = glyphRec.bitmap_left;
-        glyph.bitmap_top = glyphRec.bitmap_top;
-        glyph.advanceX = glyphRec.advance_x / 64f;    /* Fixed 26.6*/
-        glyph.advanceY = glyphRec.advance_y / 64f;
-        glyph.userAdvance = glyphRec.linearHoriAdvance / 65536.0f; /* Fixed 16.16 */
+        glyph.bitmap_left = metrics[OSFreetype.GLYPH_BITMAP_LEFT];
+        glyph.bitmap_top = metrics[OSFreetype.GLYPH_BITMAP_TOP];
+        glyph.advanceX = metrics[OSFreetype.GLYPH_ADVANCE_X] / 64f;    /* Fixed 26.6*/
+        glyph.advanceY = metrics[OSFreetype.GLYPH_ADVANCE_Y] / 64f;
+        glyph.userAdvance = metrics[OSFreetype.GLYPH_LINEAR_HORI_ADVANCE] / 65536.0f; /* Fixed 16.16 */
         glyph.lcd = lcd;
     }
 }
@@ -72,7 +72,7 @@ class FTGlyph implements Glyph {
 
     @Override
     public Shape getShape() {
-        return strike.createGlyphOutline(glyphCode);
+        return strike.getGlyphOutline(glyphCode);
     }
 
     @Override
@@ -111,6 +111,26 @@ class OSFreetype {
     static final native void FT_Set_Transform(long face, FT_Matrix matrix, long delta_x, long delta_y);
     static final native FT_GlyphSlotRec getGlyphSlot(long face);
     static final native byte[] getBitmapData(long face);
+
+    /* Indices of the glyph slot fields returned by renderGlyph */
+    static final int GLYPH_ERROR               = 0;
+    static final int GLYPH_PIXEL_MODE          = 1;
+    static final int GLYPH_WIDTH               = 2;
+    static final int GLYPH_ROWS                = 3;
+    static final int GLYPH_BITMAP_LEFT         = 4;
+    static final int GLYPH_BITMAP_TOP          = 5;
+    static final int GLYPH_ADVANCE_X           = 6;
+    static final int GLYPH_ADVANCE_Y           = 7;
+    static final int GLYPH_LINEAR_HORI_ADVANCE = 8;
+    static final int GLYPH_METRICS_LENGTH      = 9;
+
+    /**
+     * Loads and renders a glyph, storing the slot fields in metrics and
+     * returning the bitmap packed to its width.  This replaces the
+     * FT_Load_Glyph, getGlyphSlot and getBitmapData sequence with a single
+     * call and no intermediate objects.
+     */
+    static final native byte[] renderGlyph(long face, int glyph_index, int load_flags, int[] metrics);
     static final native boolean isPangoEnabled();
     static final native boolean isHarfbuzzEnabled();
 }
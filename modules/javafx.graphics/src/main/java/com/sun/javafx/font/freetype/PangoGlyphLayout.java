@@ -45,6 +45,70 @@ class PangoGlyphLayout extends GlyphLayout {
         fontmap = OSPango.pango_ft2_font_map_new();
     }
 
+    /* Most recently shaped runs, so that unchanged text does not go back
+     * through pango_itemize and pango_shape on every layout pass.
+     */
+    private static final int SHAPE_CACHE_SIZE = 256;
+    private static final Map<ShapeKey, ShapeResult> shapeCache =
+        new LinkedHashMap<>(SHAPE_CACHE_SIZE, 0.75f, true) {
+            @Override
+            protected boolean removeEldestEntry(Map.Entry<ShapeKey, ShapeResult> eldest) {
+                return size() > SHAPE_CACHE_SIZE;
+            }
+        };
+
+    private static final class ShapeKey {
+        private final char[] text;
+        private final FontResource fr;
+        private final float size;
+        private final boolean rtl;
+        private final int hash;
+
+        ShapeKey(char[] text, FontResource fr, float size, boolean rtl) {
+            this.text = text;
+            this.fr = fr;
+            this.size = size;
+            this.rtl = rtl;
+            int h = Arrays.hashCode(text);
+            h = 31 * h + fr.hashCode();
+            h = 31 * h + Float.floatToIntBits(size);
+            this.hash = rtl ? ~h : h;
+        }
+
+        @Override
+        public int hashCode() {
+            return hash;
+        }
+
+        @Override
+        public boolean equals(Object obj) {
+            if (!(obj instanceof ShapeKey)) return false;
+            ShapeKey other = (ShapeKey)obj;
+            return hash == other.hash && rtl == other.rtl &&
+                   size == other.size && fr == other.fr &&
+                   Arrays.equals(text, other.text);
+        }
+    }
+
+    private static final class ShapeResult {
+        final int glyphCount;
+        final int[] glyphs;
+        final float[] pos;
+        final int[] indices;
+
+        ShapeResult(int glyphCount, int[] glyphs, float[] pos, int[] indices) {
+            this.glyphCount = glyphCount;
+            this.glyphs = glyphs;
+            this.pos = pos;
+            this.indices = indices;
+        }
+
+        /* TextRun may adjust the positions it is given, so hand out copies */
+        void shape(TextRun run) {
+            run.shape(glyphCount, glyphs.clone(), pos.clone(), indices.clone());
+        }
+    }
+
     private int getSlot(PGFont font, PangoGlyphString glyphString) {
         CompositeFontResource fr = (CompositeFontResource)font.getFontResource();
         long fallbackFont = glyphString.font;
@@ -87,6 +151,18 @@ class PangoGlyphLayout extends GlyphLayout {
     private Map<TextRun, Long> runUtf8 = new LinkedHashMap<>();
     @Override
     public void layout(TextRun run, PGFont font, FontStrike strike, char[] text) {
+        boolean rtl = (run.getLevel() & 1) != 0;
+        ShapeKey key = new ShapeKey(Arrays.copyOfRange(text, run.getStart(), run.getEnd()),
+                                    font.getFontResource(), font.getSize(), rtl);
+        ShapeResult cached;
+        synchronized (shapeCache) {
+            cached = shapeCache.get(key);
+        }
+        if (cached != null) {
+            cached.shape(run);
+            return;
+        }
+
         /* Create the pango font and attribute list */
         FontResource fr = font.getFontResource();
         boolean composite = fr instanceof CompositeFontResource;
@@ -100,7 +176,6 @@ class PangoGlyphLayout extends GlyphLayout {
         if (check(context, "Failed allocating PangoContext.", 0, 0, 0)) {
             return;
         }
-        boolean rtl = (run.getLevel() & 1) != 0;
         if (rtl) {
             OSPango.pango_context_set_base_dir(context, OSPango.PANGO_DIRECTION_RTL);
         }
@@ -132,8 +207,7 @@ class PangoGlyphLayout extends GlyphLayout {
 
         Long str = runUtf8.get(run);
         if (str == null) {
-            char[] rtext = Arrays.copyOfRange(text, run.getStart(), run.getEnd());
-            str = OSPango.g_utf16_to_utf8(rtext);
+            str = OSPango.g_utf16_to_utf8(key.text);
             if (check(str, "Failed allocating UTF-8 buffer.", context, desc, attrList)) {
                 return;
             }
@@ -197,7 +271,11 @@ class PangoGlyphLayout extends GlyphLayout {
                     gi += g.num_glyphs;
                 }
             }
-            run.shape(glyphCount, glyphs, pos, indices);
+            ShapeResult result = new ShapeResult(glyphCount, glyphs, pos, indices);
+            synchronized (shapeCache) {
+                shapeCache.put(key, result);
+            }
+            result.shape(run);
         }
 
         check(0, null, context, desc, attrList);
@@ -44,10 +44,12 @@ public class NGSubScene extends NGNode {
     // The scaled dimensions last used in the rtt
     private double lastScaledW, lastScaledH;
     private RTTexture rtt;
-    // ressolveRTT is a temporary render target to "resolve" a msaa render buffer
-    // into a normal color render target.
-    // REMIND: resolveRTT could be a single shared scratch rtt
-    private RTTexture resolveRTT = null;
+    // resolveRTT is a temporary render target to "resolve" a msaa render buffer
+    // into a normal color render target.  It is only used for the duration of
+    // a single renderContent call, so one scratch rtt is shared by all
+    // SubScenes and grown to fit the largest of them.
+    private static RTTexture resolveRTT = null;
+    private static ResourceFactory resolveFactory = null;
     private NGNode root = null;
     private boolean renderSG = true;
     // Depth and msaa are immutable states
@@ -259,13 +261,24 @@ public class NGSubScene extends NGNode {
                 g.blit(rtt, null, x0, y0, x1 + dX, y1 + dY,
                             dstX0, dstY0, dstX1 + dX, dstY1 + dY);
             } else {
-                if (resolveRTT != null &&
-                        (resolveRTT.getContentWidth() < rtWidth ||
-                        (resolveRTT.getContentHeight() < rtHeight)))
-                {
-                    // If msaa rtt is larger than resolve buffer, then dispose
-                    resolveRTT.dispose();
-                    resolveRTT = null;
+                ResourceFactory factory = g.getResourceFactory();
+                int resolveW = rtWidth;
+                int resolveH = rtHeight;
+                if (resolveRTT != null) {
+                    if (resolveFactory != factory) {
+                        resolveRTT.dispose();
+                        resolveRTT = null;
+                    } else if (resolveRTT.getContentWidth() < rtWidth ||
+                            resolveRTT.getContentHeight() < rtHeight)
+                    {
+                        // If msaa rtt is larger than resolve buffer, then
+                        // dispose and grow it so it also fits the SubScenes
+                        // it served before
+                        resolveW = Math.max(resolveW, resolveRTT.getContentWidth());
+                        resolveH = Math.max(resolveH, resolveRTT.getContentHeight());
+                        resolveRTT.dispose();
+                        resolveRTT = null;
+                    }
                 }
                 if (resolveRTT != null) {
                     resolveRTT.lock();
@@ -274,8 +287,9 @@ public class NGSubScene extends NGNode {
                     }
                 }
                 if (resolveRTT == null) {
-                    resolveRTT = g.getResourceFactory().createRTTexture(rtWidth, rtHeight,
+                    resolveRTT = factory.createRTTexture(resolveW, resolveH,
                             Texture.WrapMode.CLAMP_TO_ZERO, false);
+                    resolveFactory = factory;
                 }
                 // We could potentially reuse g, but any transform in g would
                 // affect the blit...
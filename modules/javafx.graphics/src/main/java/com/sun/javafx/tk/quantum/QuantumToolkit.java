@@ -229,6 +229,7 @@ public final class QuantumToolkit extends Toolkit {
     final int                       PULSE_INTERVAL = (int)(TimeUnit.SECONDS.toMillis(1L) / getRefreshRate());
     final int                       FULLSPEED_INTERVAL = 1;     // ms
     boolean                         nativeSystemVsync = false;
+    private volatile int            displayHZ = 0;
     private long                    firstPauseRequestTime = 0;
     private boolean                 pauseRequested = false;
     private static final long       PAUSE_THRESHOLD_DURATION = 250;
@@ -409,8 +410,12 @@ public final class QuantumToolkit extends Toolkit {
                  */
                 pulseTimer.start(FULLSPEED_INTERVAL);
             } else {
-                nativeSystemVsync = Screen.getVideoRefreshPeriod() != 0.0;
+                double refreshPeriod = Screen.getVideoRefreshPeriod();
+                nativeSystemVsync = refreshPeriod != 0.0;
                 if (nativeSystemVsync) {
+                    // pulses follow the display, so report its real rate
+                    // (e.g. 120 Hz) rather than the nominal 60 Hz
+                    displayHZ = (int) Math.round(1000.0 / refreshPeriod);
                     // system supports vsync
                     pulseTimer.start();
                 } else {
@@ -911,10 +916,12 @@ public final class QuantumToolkit extends Toolkit {
     }
 
     @Override public int getRefreshRate() {
-        if (pulseHZ == null) {
-            return 60;
-        } else {
+        if (pulseHZ != null) {
             return pulseHZ;
+        } else if (displayHZ > 0) {
+            return displayHZ;
+        } else {
+            return 60;
         }
     }
 
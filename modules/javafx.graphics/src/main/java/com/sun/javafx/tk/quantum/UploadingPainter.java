@@ -27,6 +27,7 @@ package com.sun.javafx.tk.quantum;
 
 import java.nio.IntBuffer;
 import com.sun.glass.ui.Pixels;
+import com.sun.javafx.geom.Rectangle;
 import com.sun.prism.Graphics;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.prism.RTTexture;
@@ -148,8 +149,14 @@ final class UploadingPainter extends ViewPainter {
             float outScaleX = sceneState.getOutputScaleX();
             float outScaleY = sceneState.getOutputScaleY();
             RTTexture rtt;
+            // Only the painted area needs to be presented, unless the
+            // frame is scaled to its output size
+            Rectangle dirty = getPaintedRect();
             if (rttexture.isMSAA() || outWidth != bufWidth || outHeight != bufHeight) {
                 rtt = resolveRenderTarget(g, outWidth, outHeight);
+                if (outWidth != bufWidth || outHeight != bufHeight) {
+                    dirty = null;
+                }
             } else {
                 rtt = rttexture;
             }
@@ -178,7 +185,7 @@ final class UploadingPainter extends ViewPainter {
                 /* transparent pixels created and ready for upload */
                 // Copy references, which are volatile, used by upload. Thus
                 // ensure they still exist once event queue is consumed.
-                pixelSource.enqueuePixels(pix);
+                pixelSource.enqueuePixels(pix, dirty);
                 sceneState.uploadPixels(pixelSource);
             }
 
@@ -103,6 +103,10 @@ abstract class ViewPainter implements Runnable {
     private RectBounds dirtyRegionTemp;
     private DirtyRegionPool dirtyRegionPool;
     private DirtyRegionContainer dirtyRegionContainer;
+
+    // The area in device pixels painted by the last call to paintImpl, or
+    // null if everything was painted
+    private Rectangle paintedRect = null;
     private Affine3D tx;
     private Affine3D scaleTx;
     private GeneralTransform3D viewProjTx;
@@ -162,9 +166,18 @@ abstract class ViewPainter implements Runnable {
         }
     }
 
+    /**
+     * Returns the area in device pixels painted by the last call to
+     * {@link #paintImpl(Graphics)}, or null if the whole scene was painted.
+     */
+    protected Rectangle getPaintedRect() {
+        return paintedRect;
+    }
+
     protected void paintImpl(final Graphics backBufferGraphics) {
         // We should not be painting anything with a width / height
         // that is <= 0, so we might as well bail right off.
+        paintedRect = null;
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
             root.renderForcedContent(backBufferGraphics);
             return;
@@ -259,6 +272,9 @@ abstract class ViewPainter implements Runnable {
         final int dirtyRegionSize = status == DirtyRegionContainer.DTR_OK ? dirtyRegionContainer.size() : 0;
 
         if (dirtyRegionSize > 0) {
+            if (!showDirtyOpts) {
+                paintedRect = new Rectangle(0, 0, -1, -1);
+            }
             // We set this flag on Graphics so that subsequent code in the render paths of
             // NGNode know whether they ought to be paying attention to dirty region
             // culling bits.
@@ -317,6 +333,9 @@ abstract class ViewPainter implements Runnable {
                     dirtyRect.width  = (int) Math.ceil (dirtyRegion.getMaxX() * pixelScaleX) - x0;
                     dirtyRect.height = (int) Math.ceil (dirtyRegion.getMaxY() * pixelScaleY) - y0;
                     g.setClipRect(dirtyRect);
+                    if (paintedRect != null) {
+                        paintedRect.add(dirtyRect);
+                    }
                     g.setClipRectIndex(i);
                     doPaint(g, getRootPath(i));
                     getRootPath(i).clear();
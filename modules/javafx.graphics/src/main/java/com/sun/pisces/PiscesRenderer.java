@@ -361,6 +361,31 @@ public final class PiscesRenderer {
     private native void emitAndClearAlphaRowImpl(byte[] alphaMap, int[] alphaDeltas, int pix_y, int pix_x_from, int pix_x_to,
         int pix_x_off, int rowNum);
 
+    /**
+     * Emits several alpha rows in one call.  {@code rows} holds
+     * {@code rowCount} records of {@code (pix_y, pix_x_from, pix_x_to, pix_x_off)}
+     * that are interpreted as in
+     * {@link #emitAndClearAlphaRow(byte[], int[], int, int, int, int, int)},
+     * numbering the rows from {@code rowNum}.
+     */
+    public void emitAndClearAlphaRows(byte[] alphaMap, int[] alphaDeltas, int[] rows, int rowCount,
+        int rowNum)
+    {
+        if (rowCount < 0 || rowCount * 4 > rows.length) {
+            throw new IllegalArgumentException("row count exceeds length of rows");
+        }
+        for (int i = 0; i < rowCount * 4; i += 4) {
+            final int pix_x_off = rows[i + 3];
+            if (pix_x_off < 0 || (pix_x_off + (rows[i + 2] - rows[i + 1])) > alphaDeltas.length) {
+                throw new IllegalArgumentException("rendering range exceeds length of data");
+            }
+        }
+        this.emitAndClearAlphaRowsImpl(alphaMap, alphaDeltas, rows, rowCount, rowNum);
+    }
+
+    private native void emitAndClearAlphaRowsImpl(byte[] alphaMap, int[] alphaDeltas, int[] rows, int rowCount,
+        int rowNum);
+
     public void fillAlphaMask(byte[] mask, int x, int y, int width, int height, int offset, int stride) {
         if (mask == null) {
             throw new NullPointerException("Mask is NULL");
@@ -26,6 +26,7 @@
 package com.sun.prism;
 
 import com.sun.glass.ui.Pixels;
+import com.sun.javafx.geom.Rectangle;
 
 /**
  * An interface to facilitate the asynchronous delivery of frames of pixels
@@ -67,4 +68,15 @@ public interface PixelSource {
      * This call is equivalent to {@code doneWithPixels(getLatestPixels())}.
      */
     public void skipLatestPixels();
+
+    /**
+     * Returns the area of the {@code Pixels} most recently obtained from
+     * {@link #getLatestPixels()} that changed since the last set of pixels
+     * that was processed, or null if the whole set must be processed.
+     *
+     * @return the changed area in pixels, or null if everything changed
+     */
+    public default Rectangle getLatestDirtyRect() {
+        return null;
+    }
 }
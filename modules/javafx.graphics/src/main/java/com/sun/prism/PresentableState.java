@@ -30,6 +30,7 @@ import com.sun.glass.ui.Pixels;
 import com.sun.glass.ui.Screen;
 import com.sun.glass.ui.View;
 import com.sun.glass.ui.Window;
+import com.sun.javafx.geom.Rectangle;
 
 /**
  * PresentableState is intended to provide for a shadow copy of View/Window
@@ -305,7 +306,12 @@ public abstract class PresentableState {
         Pixels pixels = source.getLatestPixels();
         if (pixels != null) {
             try {
-                view.uploadPixels(pixels);
+                Rectangle dirty = source.getLatestDirtyRect();
+                if (dirty == null) {
+                    view.uploadPixels(pixels);
+                } else if (!dirty.isEmpty()) {
+                    view.uploadPixels(pixels, dirty.x, dirty.y, dirty.width, dirty.height);
+                }
             } finally {
                 source.doneWithPixels(pixels);
             }
@@ -208,8 +208,10 @@ class D3DContext extends BaseShaderContext {
             setLost();
 
             // Reinitialize the D3DPipeline. This will dispose and recreate
-            // the resource factory and context for each adapter.
-            D3DPipeline.getInstance().reinitialize();
+            // the resource factory and context for this adapter, or for
+            // each adapter if the adapter configuration has changed.
+            D3DPipeline.getInstance().reinitialize(
+                    getAssociatedScreen().getAdapterOrdinal());
         }
 
         return !FAILED(hr);
@@ -460,6 +462,8 @@ class D3DContext extends BaseShaderContext {
             float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
     private static native boolean nBuildNativeGeometryInt(long pContext, long nativeHandle,
             float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+    private static native boolean nUpdateNativeVertexBuffer(long pContext, long nativeHandle,
+            float[] vertexBuffer, int vertexBufferOffset, int vertexBufferLength);
     private static native long nCreateD3DPhongMaterial(long pContext);
     private static native void nReleaseD3DPhongMaterial(long pContext, long nativeHandle);
     private static native void nSetDiffuseColor(long pContext, long nativePhongMaterial,
@@ -554,6 +558,12 @@ class D3DContext extends BaseShaderContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertexBuffer(long nativeHandle, float[] vertexBuffer,
+            int vertexBufferOffset, int vertexBufferLength) {
+        return nUpdateNativeVertexBuffer(pContext, nativeHandle, vertexBuffer,
+                vertexBufferOffset, vertexBufferLength);
+    }
+
     long createD3DPhongMaterial() {
         return nCreateD3DPhongMaterial(pContext);
     }
@@ -35,6 +35,10 @@ class D3DFrameStats {
     public int numSetTexture;
     public int numSetPixelShader;
     public int numRenderTargetSwitch;
+    public int numStateChanges;
+    public int numRedundantStateChanges;
+    public int numGpuFrames;
+    public int gpuTimeMicros;
 
     static int divr(int x, int d) {
         return (x + d / 2) / d;
@@ -49,6 +53,11 @@ class D3DFrameStats {
                 + ", numTextureTransferKBytes=" + divr(numTextureTransferBytes / 1024, nFrames)
                 + "\n\tnumRenderTargetSwitch=" + divr(numRenderTargetSwitch, nFrames)
                 + ", numSetTexture=" + divr(numSetTexture, nFrames)
-                + ", numSetPixelShader=" + divr(numSetPixelShader, nFrames);
+                + ", numSetPixelShader=" + divr(numSetPixelShader, nFrames)
+                + "\n\tnumStateChanges=" + divr(numStateChanges, nFrames)
+                + ", numRedundantStateChanges=" + divr(numRedundantStateChanges, nFrames)
+                + "\n\tgpuFrameTimeMicros="
+                + (numGpuFrames > 0 ? String.valueOf(divr(gpuTimeMicros, numGpuFrames)) : "n/a")
+                + " (" + numGpuFrames + " timed frame(s))";
     }
 }
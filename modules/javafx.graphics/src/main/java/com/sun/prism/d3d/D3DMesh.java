@@ -83,6 +83,13 @@ class D3DMesh extends BaseMesh {
                 vertexBufferLength, indexBufferShort, indexBufferLength);
     }
 
+    @Override
+    public boolean updateNativeVertexBuffer(float[] vertexBuffer,
+            int vertexBufferOffset, int vertexBufferLength) {
+        return context.updateNativeVertexBuffer(nativeHandle, vertexBuffer,
+                vertexBufferOffset, vertexBufferLength);
+    }
+
     static class D3DMeshDisposerRecord implements Disposer.Record {
 
         private final D3DContext context;
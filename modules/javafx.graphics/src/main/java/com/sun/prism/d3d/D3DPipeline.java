@@ -149,6 +149,8 @@ public final class D3DPipeline extends GraphicsPipeline {
 
     private static native int nGetAdapterOrdinal(long hMonitor);
     private static native int nGetAdapterCount();
+    private static native boolean nAdaptersUnchanged();
+    private static native int nReleaseContext(int adapterOrdinal);
 
     /*
      * This method fill object with data and return an argument
@@ -207,6 +209,31 @@ public final class D3DPipeline extends GraphicsPipeline {
         }
     }
 
+    // Reinitialize only the given adapter when the other adapters are
+    // unaffected, so that windows on other GPUs keep their resources
+    void reinitialize(int adapterOrdinal) {
+        if (!d3dInitialized || adapterOrdinal < 0 ||
+                adapterOrdinal >= factories.length || !nAdaptersUnchanged()) {
+            reinitialize();
+            return;
+        }
+
+        if (PrismSettings.verbose) {
+            System.err.println("D3DPipeline: reinitialize adapter " + adapterOrdinal +
+                               " after device was removed");
+        }
+
+        D3DResourceFactory factory = factories[adapterOrdinal];
+        if (factory != null) {
+            factory.dispose();
+            factories[adapterOrdinal] = null;
+            if (_default == factory) {
+                _default = null;
+            }
+        }
+        nReleaseContext(adapterOrdinal);
+    }
+
     @Override
     public void dispose() {
         reset(true);
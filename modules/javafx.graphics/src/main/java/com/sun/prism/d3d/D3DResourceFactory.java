@@ -373,7 +373,8 @@ class D3DResourceFactory extends BaseShaderFactory {
 
         long pResource = nCreateSwapChain(context.getContextHandle(),
                                           pState.getNativeView(),
-                                          PrismSettings.isVsyncEnabled);
+                                          PrismSettings.isVsyncEnabled,
+                                          PrismSettings.isFlipModelEnabled);
 
         if (pResource != 0L) {
             int width = pState.getRenderWidth();
@@ -552,7 +553,8 @@ class D3DResourceFactory extends BaseShaderFactory {
                                       int width, int height, int samples,
                                       boolean useMipmap);
     static native long nCreateSwapChain(long pContext, long hwnd,
-                                        boolean isVsyncEnabled);
+                                        boolean isVsyncEnabled,
+                                        boolean isFlipModelEnabled);
     static native int nReleaseResource(long pContext, long resource);
     static native int nGetMaximumTextureSize(long pContext);
     static native int nGetTextureWidth(long pResource);
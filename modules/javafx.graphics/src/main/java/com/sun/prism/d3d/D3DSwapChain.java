@@ -32,6 +32,7 @@ import com.sun.prism.Graphics;
 import com.sun.prism.Presentable;
 import com.sun.prism.PresentableState;
 import com.sun.prism.RTTexture;
+import com.sun.prism.impl.PrismSettings;
 
 class D3DSwapChain
     extends D3DResource
@@ -124,6 +125,7 @@ class D3DSwapChain
     }
 
     private static native int nPresent(long context, long pSwapChain);
+    private static native int nWaitForPresentQueue(long context, long pSwapChain);
 
     @Override
     public D3DContext getContext() {
@@ -139,6 +141,16 @@ class D3DSwapChain
         {
             return true;
         }
+        if (PrismSettings.isFlipModelEnabled && PrismSettings.isVsyncEnabled) {
+            // Wait for the previous frame to reach the screen before
+            // rendering this one, so Present doesn't block with a frame
+            // that is already stale by the time it is displayed.
+            D3DContext context = getContext();
+            if (!context.isDisposed()) {
+                nWaitForPresentQueue(context.getContextHandle(),
+                                     d3dResRecord.getResource());
+            }
+        }
         texBackBuffer.lock();
         return texBackBuffer.isSurfaceLost();
     }
@@ -147,6 +147,7 @@ class ES2Context extends BaseShaderContext {
             drawable = dummyGLDrawable;
         }
         if (drawable != currentDrawable) {
+            glContext.flushCommands();
             glContext.makeCurrent(drawable);
             // Need to restore FBO to on screen framebuffer
             glContext.bindFBO(0);
@@ -403,6 +404,12 @@ class ES2Context extends BaseShaderContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertexBuffer(long nativeHandle, float[] vertexBuffer,
+            int vertexBufferOffset, int vertexBufferLength) {
+        return glContext.updateNativeVertexBuffer(nativeHandle, vertexBuffer,
+                vertexBufferOffset, vertexBufferLength);
+    }
+
     long createES2PhongMaterial() {
         return glContext.createES2PhongMaterial();
     }
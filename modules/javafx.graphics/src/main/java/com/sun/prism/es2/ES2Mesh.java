@@ -78,6 +78,13 @@ class ES2Mesh extends BaseMesh {
                 vertexBufferLength, indexBufferShort, indexBufferLength);
     }
 
+    @Override
+    public boolean updateNativeVertexBuffer(float[] vertexBuffer,
+            int vertexBufferOffset, int vertexBufferLength) {
+        return context.updateNativeVertexBuffer(nativeHandle, vertexBuffer,
+                vertexBufferOffset, vertexBufferLength);
+    }
+
     static class ES2MeshDisposerRecord implements Disposer.Record {
 
         private final ES2Context context;
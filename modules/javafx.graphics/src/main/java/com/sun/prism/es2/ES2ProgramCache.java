@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.es2;
+
+import com.sun.prism.impl.PrismSettings;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.security.AccessController;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.security.PrivilegedAction;
+
+/**
+ * Persistent cache of linked shader program binaries, so that the GLSL
+ * sources do not have to be compiled again on the next launch.  Enabled with
+ * {@code -Dprism.es2.programcache=true|<directory>}.
+ * <p>
+ * Each entry is keyed by a hash of the driver signature and the shader
+ * sources, and also records the driver signature so that a stale entry is
+ * detected and replaced.  Any failure to read, write or load an entry falls
+ * back to compiling from source.
+ */
+final class ES2ProgramCache {
+
+    private static final int MAGIC = 0x4a465850; // "JFXP"
+    private static final int MAX_BINARY_SIZE = 16 * 1024 * 1024;
+    private static final Path cacheDir = PrismSettings.programCacheDir != null
+            ? Paths.get(PrismSettings.programCacheDir) : null;
+
+    private static String driverSignature;
+
+    private ES2ProgramCache() {
+    }
+
+    private static String getDriverSignature() {
+        if (driverSignature == null) {
+            driverSignature = ES2Pipeline.glFactory.getDriverSignature();
+        }
+        return driverSignature;
+    }
+
+    /**
+     * Returns the cache key for the given program, or null if the cache is
+     * disabled.
+     */
+    static String getKey(String vert, String[] frag, String[] attrs, int[] indexs) {
+        if (cacheDir == null) {
+            return null;
+        }
+        try {
+            MessageDigest md = MessageDigest.getInstance("SHA-256");
+            update(md, getDriverSignature());
+            update(md, vert);
+            for (String f : frag) {
+                update(md, f);
+            }
+            for (int i = 0; i < attrs.length; i++) {
+                update(md, attrs[i] + "=" + indexs[i]);
+            }
+            StringBuilder sb = new StringBuilder();
+            for (byte b : md.digest()) {
+                sb.append(String.format("%02x", b & 0xff));
+            }
+            return sb.toString();
+        } catch (NoSuchAlgorithmException e) {
+            return null;
+        }
+    }
+
+    private static void update(MessageDigest md, String s) {
+        md.update(s.getBytes(StandardCharsets.UTF_8));
+        md.update((byte) 0);
+    }
+
+    /**
+     * Creates the program stored under the given key.  Returns 0 if there
+     * is no usable entry.
+     */
+    static int loadProgram(GLContext glCtx, String key) {
+        if (key == null) {
+            return 0;
+        }
+        byte[][] binary = new byte[1][];
+        int[] format = new int[1];
+        @SuppressWarnings("removal")
+        boolean found = AccessController.doPrivileged((PrivilegedAction<Boolean>) () -> {
+            Path file = cacheDir.resolve(key + ".bin");
+            if (!Files.isRegularFile(file)) {
+                return false;
+            }
+            try (DataInputStream in = new DataInputStream(Files.newInputStream(file))) {
+                if (in.readInt() != MAGIC
+                        || !getDriverSignature().equals(in.readUTF())) {
+                    return false;
+                }
+                format[0] = in.readInt();
+                int length = in.readInt();
+                if (length <= 0 || length > MAX_BINARY_SIZE) {
+                    return false;
+                }
+                binary[0] = new byte[length];
+                in.readFully(binary[0]);
+                return true;
+            } catch (IOException | RuntimeException e) {
+                return false;
+            }
+        });
+        if (!found) {
+            return 0;
+        }
+        int programID = glCtx.createProgramFromBinary(format[0], binary[0]);
+        if (programID == 0 && PrismSettings.verbose) {
+            System.err.println("ES2ProgramCache: stale program binary " + key);
+        }
+        return programID;
+    }
+
+    /**
+     * Stores the binary of the given linked program under the given key.
+     */
+    static void storeProgram(GLContext glCtx, String key, int programID) {
+        if (key == null) {
+            return;
+        }
+        int[] format = new int[1];
+        byte[] binary = glCtx.getProgramBinary(programID, format);
+        if (binary == null) {
+            return;
+        }
+        String signature = getDriverSignature();
+        @SuppressWarnings("removal")
+        var dummy = AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
+            try {
+                Files.createDirectories(cacheDir);
+                // write to a temporary file first so that a concurrent launch
+                // never sees a partially written entry
+                Path tmp = Files.createTempFile(cacheDir, key, ".tmp");
+                try (DataOutputStream out = new DataOutputStream(Files.newOutputStream(tmp))) {
+                    out.writeInt(MAGIC);
+                    out.writeUTF(signature);
+                    out.writeInt(format[0]);
+                    out.writeInt(binary.length);
+                    out.write(binary);
+                }
+                Files.move(tmp, cacheDir.resolve(key + ".bin"),
+                        StandardCopyOption.REPLACE_EXISTING);
+            } catch (IOException | RuntimeException e) {
+                if (PrismSettings.verbose) {
+                    System.err.println("ES2ProgramCache: unable to store " + key + ": " + e);
+                }
+            }
+            return null;
+        });
+    }
+}
@@ -230,6 +230,11 @@ class ES2RTTexture extends ES2Texture<ES2RTTextureData>
 
         ES2VramPool pool = ES2VramPool.instance;
         long size = pool.estimateRTTextureSize(texWidth, texHeight, false);
+        if (msaa) {
+            // the multisample color buffer holds one pixel per sample, which
+            // is what actually occupies vram for this render target
+            size *= Math.max(glContext.getSampleSize(), 1);
+        }
         if (!pool.prepareForAllocation(size)) {
             return null;
         }
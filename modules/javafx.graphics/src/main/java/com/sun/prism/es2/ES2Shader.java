@@ -127,13 +127,31 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
                     + "must be specified");
         }
 
+        String[] attrs = new String[attributes.size()];
+        int[] indexs = new int[attrs.length];
+        int i = 0;
+        for (String attr : attributes.keySet()) {
+            attrs[i] = attr;
+            indexs[i] = attributes.get(attr);
+            i++;
+        }
+
+        String cacheKey = ES2ProgramCache.getKey(vert, frag, attrs, indexs);
+        int cachedProgramID = ES2ProgramCache.loadProgram(glCtx, cacheKey);
+        if (cachedProgramID != 0) {
+            // there are no shader objects to dispose for a program binary
+            return new ES2Shader(context,
+                    cachedProgramID, 0, new int[0],
+                    samplers, maxTexCoordIndex, isPixcoordUsed);
+        }
+
         int vertexShaderID = glCtx.compileShader(vert, true);
         if (vertexShaderID == 0) {
             throw new RuntimeException("Error creating vertex shader");
         }
 
         int[] fragmentShaderID = new int[frag.length];
-        for (int i = 0; i < frag.length; i++) {
+        for (i = 0; i < frag.length; i++) {
             fragmentShaderID[i] = glCtx.compileShader(frag[i], false);
             if (fragmentShaderID[i] == 0) {
                 glCtx.deleteShader(vertexShaderID);
@@ -142,14 +160,6 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             }
         }
 
-        String[] attrs = new String[attributes.size()];
-        int[] indexs = new int[attrs.length];
-        int i = 0;
-        for (String attr : attributes.keySet()) {
-            attrs[i] = attr;
-            indexs[i] = attributes.get(attr);
-            i++;
-        }
         int programID = glCtx.createProgram(vertexShaderID, fragmentShaderID,
                 attrs, indexs);
         if (programID == 0) {
@@ -157,6 +167,7 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             // vertexShader and fragmentShader resources
             throw new RuntimeException("Error creating shader program");
         }
+        ES2ProgramCache.storeProgram(glCtx, cacheKey, programID);
 
         return new ES2Shader(context,
                 programID, vertexShaderID, fragmentShaderID,
@@ -129,6 +129,26 @@ abstract class GLContext {
     private boolean depthTest = false;
     private boolean msaa = false;
     private int maxSampleSize = -1;
+    // last value set for GL_UNPACK_ALIGNMENT, ROW_LENGTH, SKIP_PIXELS and
+    // SKIP_ROWS (indexed from GL_UNPACK_ALIGNMENT); -1 means unknown
+    private final int[] unpackParams = { -1, -1, -1, -1 };
+
+    // glUseProgram and the scalar glUniform calls are queued here and
+    // replayed by a single nFlushCommands call before the next draw, so
+    // that setting shader parameters doesn't cost a JNI transition each.
+    // The command values match the CMD_* defines in GLContext.c.
+    private static final int CMD_USE_PROGRAM = 1;
+    private static final int CMD_UNIFORM1F   = 2;
+    private static final int CMD_UNIFORM2F   = 3;
+    private static final int CMD_UNIFORM3F   = 4;
+    private static final int CMD_UNIFORM4F   = 5;
+    private static final int CMD_UNIFORM1I   = 6;
+    private static final int CMD_UNIFORM2I   = 7;
+    private static final int CMD_UNIFORM3I   = 8;
+    private static final int CMD_UNIFORM4I   = 9;
+    private static final int CMD_QUEUE_SIZE  = 512;
+    private final int[] cmdQueue = new int[CMD_QUEUE_SIZE];
+    private int cmdQueueLength;
 
     private static final int FBO_ID_UNSET = -1;
     private static final int FBO_ID_NOCACHE = -2;
@@ -151,10 +171,14 @@ abstract class GLContext {
     private static native int nCreateProgram(long nativeCtxInfo,
             int vertexShaderID, int[] fragmentShaderID,
             int numAttrs, String[] attrs, int[] indexs);
+    private static native int nCreateProgramFromBinary(long nativeCtxInfo,
+            int format, byte[] binary);
     private static native int nCreateTexture(long nativeCtxInfo, int width,
             int height);
     private static native void nDeleteRenderBuffer(long nativeCtxInfo, int rbID);
     private static native void nDeleteFBO(long nativeCtxInfo, int fboID);
+    private static native byte[] nGetProgramBinary(long nativeCtxInfo,
+            int programID, int[] format);
     private static native void nDeleteShader(long nativeCtxInfo, int shadeID);
     private static native void nDeleteTexture(long nativeCtxInfo, int tID);
     private static native void nDisposeShaders(long nativeCtxInfo,
@@ -190,35 +214,22 @@ abstract class GLContext {
             int type, Object pixels, int pixelsByteOffset);
     private static native void nUpdateViewport(long nativeCtxInfo, int x, int y,
             int w, int h);
-    private static native void nUniform1f(long nativeCtxInfo, int location, float v0);
-    private static native void nUniform2f(long nativeCtxInfo, int location, float v0,
-            float v1);
-    private static native void nUniform3f(long nativeCtxInfo, int location, float v0,
-            float v1, float v2);
-    private static native void nUniform4f(long nativeCtxInfo, int location, float v0,
-            float v1, float v2, float v3);
     private static native void nUniform4fv0(long nativeCtxInfo, int location, int count,
             Object value, int valueByteOffset);
     private static native void nUniform4fv1(long nativeCtxInfo, int location, int count,
             Object value, int valueByteOffset);
-    private static native void nUniform1i(long nativeCtxInfo, int location, int v0);
-    private static native void nUniform2i(long nativeCtxInfo, int location, int v0,
-            int v1);
-    private static native void nUniform3i(long nativeCtxInfo, int location, int v0,
-            int v1, int v2);
-    private static native void nUniform4i(long nativeCtxInfo, int location, int v0,
-            int v1, int v2, int v3);
     private static native void nUniform4iv0(long nativeCtxInfo, int location, int count,
             Object value, int valueByteOffset);
     private static native void nUniform4iv1(long nativeCtxInfo, int location, int count,
             Object value, int valueByteOffset);
+    private static native void nFlushCommands(long nativeCtxInfo, int[] commands,
+            int length);
     private static native void nUniformMatrix4fv(long nativeCtxInfo, int location,
             boolean transpose, float values[]);
     private static native void nUpdateFilterState(long nativeCtxInfo, int texID,
             boolean linearFilter);
     private static native void nUpdateWrapState(long nativeCtxInfo, int texID,
             int wrapMode);
-    private static native void nUseProgram(long nativeCtxInfo, int pID);
 
     private static native void nEnableVertexAttributes(long nativeCtxInfo);
     private static native void nDisableVertexAttributes(long nativeCtxInfo);
@@ -235,6 +246,8 @@ abstract class GLContext {
             float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
     private static native boolean nBuildNativeGeometryInt(long nativeCtxInfo, long nativeHandle,
             float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+    private static native boolean nUpdateNativeVertexBuffer(long nativeCtxInfo, long nativeHandle,
+            float[] vertexBuffer, int vertexBufferOffset, int vertexBufferLength);
     private static native long nCreateES2PhongMaterial(long nativeCtxInfo);
     private static native void nReleaseES2PhongMaterial(long nativeCtxInfo, long nativeHandle);
     private static native void nSetSolidColor(long nativeCtxInfo, long nativePhongMaterial,
@@ -386,6 +399,24 @@ abstract class GLContext {
                 attrs.length, attrs, indexs);
     }
 
+    /**
+     * Creates a new shader program from a binary previously returned by
+     * {@link #getProgramBinary}.  Returns 0 if the driver rejects the binary,
+     * for example after a driver update.
+     */
+    int createProgramFromBinary(int format, byte[] binary) {
+        return nCreateProgramFromBinary(nativeCtxInfo, format, binary);
+    }
+
+    /**
+     * Returns the driver specific binary of a linked shader program, or null
+     * if program binaries are not supported.  The binary format is stored in
+     * {@code format[0]}.
+     */
+    byte[] getProgramBinary(int programID, int[] format) {
+        return nGetProgramBinary(nativeCtxInfo, programID, format);
+    }
+
     int createTexture(int width, int height) {
         return nCreateTexture(nativeCtxInfo, width, height);
     }
@@ -416,10 +447,12 @@ abstract class GLContext {
     }
 
     void disposeShaders(int pID, int vID, int[] fID) {
+        flushCommands();
         nDisposeShaders(nativeCtxInfo, pID, vID, fID);
     }
 
     void finish() {
+        flushCommands();
         nFinish();
     }
 
@@ -530,6 +563,15 @@ abstract class GLContext {
     abstract void makeCurrent(GLDrawable drawable);
 
     void pixelStorei(int pname, int param) {
+        // Texture uploads reset the unpack parameters on every call, so skip
+        // the JNI transition and the GL call when the value is unchanged.
+        int index = pname - GL_UNPACK_ALIGNMENT;
+        if (index >= 0 && index < unpackParams.length) {
+            if (unpackParams[index] == param) {
+                return;
+            }
+            unpackParams[index] = param;
+        }
         nPixelStorei(pname, param);
     }
 
@@ -561,7 +603,7 @@ abstract class GLContext {
     }
 
     void setShaderProgram(int progid) {
-        nUseProgram(nativeCtxInfo, progid);
+        queueCommand(CMD_USE_PROGRAM, progid, 0);
     }
 
     void texParamsMinMax(int pname, boolean useMipmap) {
@@ -654,23 +696,61 @@ abstract class GLContext {
         nUpdateWrapState(nativeCtxInfo, texID, wm);
     }
 
+    /**
+     * Appends a command with the given argument to the queue and returns
+     * the index of its {@code n} further values.
+     */
+    private int queueCommand(int cmd, int arg, int n) {
+        if (cmdQueueLength + 2 + n > CMD_QUEUE_SIZE) {
+            flushCommands();
+        }
+        int i = cmdQueueLength;
+        cmdQueue[i] = cmd;
+        cmdQueue[i + 1] = arg;
+        cmdQueueLength = i + 2 + n;
+        return i + 2;
+    }
+
+    /**
+     * Issues the queued program and uniform commands.  It must be called
+     * before any GL call that relies on them and before another context is
+     * made current.
+     */
+    void flushCommands() {
+        if (cmdQueueLength > 0) {
+            nFlushCommands(nativeCtxInfo, cmdQueue, cmdQueueLength);
+            cmdQueueLength = 0;
+        }
+    }
+
     void uniform1f(int location, float v0) {
-        nUniform1f(nativeCtxInfo, location, v0);
+        int i = queueCommand(CMD_UNIFORM1F, location, 1);
+        cmdQueue[i] = Float.floatToRawIntBits(v0);
     }
 
     void uniform2f(int location, float v0, float v1) {
-        nUniform2f(nativeCtxInfo, location, v0, v1);
+        int i = queueCommand(CMD_UNIFORM2F, location, 2);
+        cmdQueue[i] = Float.floatToRawIntBits(v0);
+        cmdQueue[i + 1] = Float.floatToRawIntBits(v1);
     }
 
     void uniform3f(int location, float v0, float v1, float v2) {
-        nUniform3f(nativeCtxInfo, location, v0, v1, v2);
+        int i = queueCommand(CMD_UNIFORM3F, location, 3);
+        cmdQueue[i] = Float.floatToRawIntBits(v0);
+        cmdQueue[i + 1] = Float.floatToRawIntBits(v1);
+        cmdQueue[i + 2] = Float.floatToRawIntBits(v2);
     }
 
     void uniform4f(int location, float v0, float v1, float v2, float v3) {
-        nUniform4f(nativeCtxInfo, location, v0, v1, v2, v3);
+        int i = queueCommand(CMD_UNIFORM4F, location, 4);
+        cmdQueue[i] = Float.floatToRawIntBits(v0);
+        cmdQueue[i + 1] = Float.floatToRawIntBits(v1);
+        cmdQueue[i + 2] = Float.floatToRawIntBits(v2);
+        cmdQueue[i + 3] = Float.floatToRawIntBits(v3);
     }
 
     void uniform4fv(int location, int count, java.nio.FloatBuffer value) {
+        flushCommands();
         boolean direct = BufferFactory.isDirect(value);
         if (direct) {
             nUniform4fv0(nativeCtxInfo, location, count, value,
@@ -682,22 +762,33 @@ abstract class GLContext {
     }
 
     void uniform1i(int location, int v0) {
-        nUniform1i(nativeCtxInfo, location, v0);
+        int i = queueCommand(CMD_UNIFORM1I, location, 1);
+        cmdQueue[i] = v0;
     }
 
     void uniform2i(int location, int v0, int v1) {
-        nUniform2i(nativeCtxInfo, location, v0, v1);
+        int i = queueCommand(CMD_UNIFORM2I, location, 2);
+        cmdQueue[i] = v0;
+        cmdQueue[i + 1] = v1;
     }
 
     void uniform3i(int location, int v0, int v1, int v2) {
-        nUniform3i(nativeCtxInfo, location, v0, v1, v2);
+        int i = queueCommand(CMD_UNIFORM3I, location, 3);
+        cmdQueue[i] = v0;
+        cmdQueue[i + 1] = v1;
+        cmdQueue[i + 2] = v2;
     }
 
     void uniform4i(int location, int v0, int v1, int v2, int v3) {
-        nUniform4i(nativeCtxInfo, location, v0, v1, v2, v3);
+        int i = queueCommand(CMD_UNIFORM4I, location, 4);
+        cmdQueue[i] = v0;
+        cmdQueue[i + 1] = v1;
+        cmdQueue[i + 2] = v2;
+        cmdQueue[i + 3] = v3;
     }
 
     void uniform4iv(int location, int count, java.nio.IntBuffer value) {
+        flushCommands();
         boolean direct = BufferFactory.isDirect(value);
         if (direct) {
             nUniform4iv0(nativeCtxInfo, location, count, value,
@@ -709,6 +800,7 @@ abstract class GLContext {
     }
 
     void uniformMatrix4fv(int location, boolean transpose, float values[]) {
+        flushCommands();
         nUniformMatrix4fv(nativeCtxInfo, location, transpose, values);
     }
 
@@ -721,6 +813,7 @@ abstract class GLContext {
     }
 
     void drawIndexedQuads(float coords[], byte colors[], int numVertices) {
+        flushCommands();
         nDrawIndexedQuads(nativeCtxInfo, numVertices, coords, colors);
     }
 
@@ -760,6 +853,12 @@ abstract class GLContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertexBuffer(long nativeHandle, float[] vertexBuffer,
+            int vertexBufferOffset, int vertexBufferLength) {
+        return nUpdateNativeVertexBuffer(nativeCtxInfo, nativeHandle, vertexBuffer,
+                vertexBufferOffset, vertexBufferLength);
+    }
+
     long createES2PhongMaterial() {
         return nCreateES2PhongMaterial(nativeCtxInfo);
     }
@@ -818,6 +917,7 @@ abstract class GLContext {
     }
 
     void renderMeshView(long nativeMeshViewInfo) {
+        flushCommands();
         nRenderMeshView(nativeCtxInfo, nativeMeshViewInfo);
     }
 }
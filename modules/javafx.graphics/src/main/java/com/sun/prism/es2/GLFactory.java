@@ -218,6 +218,12 @@ abstract class GLFactory {
 
     abstract void updateDeviceDetails(HashMap deviceDetails);
 
+    // Identifies the driver that produced a program binary
+    String getDriverSignature() {
+        return nGetGLVendor(nativeCtxInfo) + "|" + nGetGLRenderer(nativeCtxInfo)
+                + "|" + nGetGLVersion(nativeCtxInfo);
+    }
+
     void printDriverInformation(int adapter) {
         /* We are assuming a system with a single or homogeneous GPUs. */
         System.out.println("Graphics Vendor: " + nGetGLVendor(nativeCtxInfo));
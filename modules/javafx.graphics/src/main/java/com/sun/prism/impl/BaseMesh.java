@@ -78,6 +78,11 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
     public abstract boolean buildNativeGeometry(float[] vertexBuffer,
             int vertexBufferLength, short[] indexBufferShort, int indexBufferLength);
 
+    // Re-uploads part of a vertex buffer previously passed to
+    // buildNativeGeometry; the index buffer and vertex count are unchanged
+    public abstract boolean updateNativeVertexBuffer(float[] vertexBuffer,
+            int vertexBufferOffset, int vertexBufferLength);
+
     private boolean[] dirtyVertices;
     private float[] cachedNormals;
     private float[] cachedTangents;
@@ -490,14 +495,21 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
         convertNormalsToQuats(instance, numberOfVertices,
                 cachedNormals, cachedTangents, cachedBitangents, vertexBuffer, dirtyVertices);
 
-        if (indexBuffer != null) {
-            return buildNativeGeometry(vertexBuffer,
-                    numberOfVertices * VERTEX_SIZE_VB, indexBuffer, indexBufferSize);
-        } else {
-            return buildNativeGeometry(vertexBuffer,
-                    numberOfVertices * VERTEX_SIZE_VB, indexBufferShort, indexBufferSize);
+        // Only the dirty vertices have been written, so upload just the range
+        // that covers them instead of rebuilding the native buffers
+        int firstDirty = 0;
+        while (firstDirty < numberOfVertices && !dirtyVertices[firstDirty]) {
+            firstDirty++;
         }
-
+        if (firstDirty == numberOfVertices) {
+            return true;
+        }
+        int lastDirty = numberOfVertices - 1;
+        while (!dirtyVertices[lastDirty]) {
+            lastDirty--;
+        }
+        return updateNativeVertexBuffer(vertexBuffer, firstDirty * VERTEX_SIZE_VB,
+                (lastDirty - firstDirty + 1) * VERTEX_SIZE_VB);
     }
 
     @Override
@@ -43,6 +43,9 @@ public final class PrismSettings {
     public static final boolean trace;
     public static final boolean printAllocs;
     public static final boolean isVsyncEnabled;
+    public static final boolean isFlipModelEnabled;
+    public static final boolean prewarmShaders;
+    public static final String programCacheDir;
     public static final boolean dirtyOptsEnabled;
     public static final boolean occlusionCullingEnabled;
     public static final boolean scrollCacheOpt;
@@ -123,6 +126,29 @@ public final class PrismSettings {
                                              "javafx.animation.fullspeed",
                                              false);
 
+        /* D3D flip model presentation (Windows 7+ D3D9Ex FLIPEX swap chains) */
+        isFlipModelEnabled = getBoolean(systemProperties, "prism.d3d.flipmodel",
+                                        false);
+
+        /* Create the 3D shaders with the device instead of on first use */
+        prewarmShaders = getBoolean(systemProperties, "prism.prewarmshaders",
+                                    false);
+
+        /*
+         * ES2 program binary cache: "true" for the default location in the
+         * user's openjfx cache, or the path of the cache directory
+         */
+        String programCache = systemProperties.getProperty("prism.es2.programcache");
+        if (programCache == null || programCache.isEmpty()
+                || "false".equalsIgnoreCase(programCache)) {
+            programCacheDir = null;
+        } else if ("true".equalsIgnoreCase(programCache)) {
+            programCacheDir = systemProperties.getProperty("user.home")
+                    + "/.openjfx/cache/prism-es2";
+        } else {
+            programCacheDir = programCache;
+        }
+
         /* Dirty region optimizations */
         dirtyOptsEnabled = getBoolean(systemProperties, "prism.dirtyopts",
                                       true);
@@ -27,6 +27,7 @@ package com.sun.prism.impl;
 
 import com.sun.glass.ui.Application;
 import com.sun.glass.ui.Pixels;
+import com.sun.javafx.geom.Rectangle;
 import com.sun.prism.PixelSource;
 import java.lang.ref.WeakReference;
 import java.nio.IntBuffer;
@@ -64,6 +65,10 @@ public class QueuedPixelSource implements PixelSource {
     private final List<WeakReference<Pixels>> saved =
          new ArrayList<>(3);
     private final boolean useDirectBuffers;
+    // area changed by all deliveries since the last one that was consumed,
+    // or null if it is unknown and everything must be presented
+    private Rectangle pendingDirty = null;
+    private Rectangle consumedDirty = null;
 
     public QueuedPixelSource(boolean useDirectBuffers) {
         this.useDirectBuffers = useDirectBuffers;
@@ -77,10 +82,17 @@ public class QueuedPixelSource implements PixelSource {
         if (enqueued != null) {
             beingConsumed = enqueued;
             enqueued = null;
+            consumedDirty = pendingDirty;
+            pendingDirty = new Rectangle(0, 0, -1, -1);
         }
         return beingConsumed;
     }
 
+    @Override
+    public synchronized Rectangle getLatestDirtyRect() {
+        return consumedDirty;
+    }
+
     @Override
     public synchronized void doneWithPixels(Pixels used) {
         if (beingConsumed != used) {
@@ -170,6 +182,24 @@ public class QueuedPixelSource implements PixelSource {
      * @param pixels the {@code Pixels} object to be enqueued
      */
     public synchronized void enqueuePixels(Pixels pixels) {
+        enqueuePixels(pixels, null);
+    }
+
+    /**
+     * Place the indicated {@code Pixels} object into the enqueued state,
+     * recording the area that changed since the previous delivery.  The
+     * changed areas of deliveries that are replaced or skipped before being
+     * consumed are accumulated into the next one.
+     *
+     * @param pixels the {@code Pixels} object to be enqueued
+     * @param dirty the changed area in pixels, or null if everything changed
+     */
+    public synchronized void enqueuePixels(Pixels pixels, Rectangle dirty) {
         enqueued = pixels;
+        if (dirty == null) {
+            pendingDirty = null;
+        } else if (pendingDirty != null) {
+            pendingDirty.add(dirty);
+        }
     }
 }
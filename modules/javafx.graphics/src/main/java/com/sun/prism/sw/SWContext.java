@@ -43,6 +43,7 @@ import com.sun.prism.Texture;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.shape.DMarlinPrismUtils;
 import java.lang.ref.SoftReference;
+import java.util.Arrays;
 
 final class SWContext {
 
@@ -57,7 +58,17 @@ final class SWContext {
     }
 
     static final class DirectRTMarlinAlphaConsumer implements MarlinAlphaConsumer {
+        // alpha rows are batched and emitted with one native call per batch
+        // instead of one call per scanline
+        private static final int MAX_BATCH_ROWS = 64;
+        private static final int MIN_BATCH_LENGTH = 16 * 1024;
+
         private byte alpha_map[];
+        private int batchDeltas[] = new int[MIN_BATCH_LENGTH];
+        private final int batchRows[] = new int[4 * MAX_BATCH_ROWS];
+        private int batchRowCount;
+        private int batchLength;
+        private int batchRowNum;
         private int x;
         private int y;
         private int w;
@@ -72,9 +83,20 @@ final class SWContext {
             this.w = w;
             this.h = h;
             rowNum = 0;
+            batchRowCount = 0;
+            batchLength = 0;
             this.pr = pr;
         }
 
+        public void flush() {
+            if (batchRowCount > 0) {
+                pr.emitAndClearAlphaRows(alpha_map, batchDeltas, batchRows,
+                                         batchRowCount, batchRowNum);
+                batchRowCount = 0;
+                batchLength = 0;
+            }
+        }
+
         @Override
         public int getOriginX() {
             return x;
@@ -120,11 +142,32 @@ final class SWContext {
                                               final int pix_from, final int pix_to)
         {
             // pix_from indicates the first alpha coverage != 0 within [x; pix_to[
-            pr.emitAndClearAlphaRow(alpha_map, alphaDeltas, pix_y, pix_from, pix_to, (pix_from - x), rowNum);
+            final int from = pix_from - x;
+            final int to = pix_to - x;
+            final int len = Math.min(to, w) - from + 1;
+            if (len > 0) {
+                if (batchRowCount == MAX_BATCH_ROWS || batchLength + len > batchDeltas.length) {
+                    flush();
+                    if (len > batchDeltas.length) {
+                        batchDeltas = new int[len];
+                    }
+                }
+                System.arraycopy(alphaDeltas, from, batchDeltas, batchLength, len);
+                Arrays.fill(alphaDeltas, from, from + len, 0);
+
+                if (batchRowCount == 0) {
+                    batchRowNum = rowNum;
+                }
+                final int i = 4 * batchRowCount++;
+                batchRows[i] = pix_y;
+                batchRows[i + 1] = pix_from;
+                batchRows[i + 2] = pix_from + len - 1;
+                batchRows[i + 3] = batchLength;
+                batchLength += len;
+            }
             rowNum++;
 
             // clear properly the end of the alphaDeltas:
-            final int to = pix_to - x;
             if (to <= w) {
                 alphaDeltas[to] = 0;
             } else {
@@ -181,6 +224,7 @@ final class SWContext {
                 }
                 alphaConsumer.initConsumer(outpix_xmin, outpix_ymin, w, h, pr);
                 renderer.produceAlphas(alphaConsumer);
+                alphaConsumer.flush();
             } finally {
                 if (renderer != null) {
                     renderer.dispose();
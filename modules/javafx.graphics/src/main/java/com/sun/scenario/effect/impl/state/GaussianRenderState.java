@@ -337,6 +337,11 @@ public class GaussianRenderState extends LinearConvolveRenderState {
         return isShadow;
     }
 
+    @Override
+    public boolean isGaussian() {
+        return true;
+    }
+
     @Override
     public Color4f getShadowColor() {
         return shadowColor;
@@ -187,6 +187,20 @@ public abstract class LinearConvolveRenderState implements RenderState {
      */
     public abstract boolean isShadow();
 
+    /**
+     * Returns true if the weights for every pass are samples of a Gaussian
+     * distribution.  Such a pass may be approximated by repeated box
+     * filters of the same variance.
+     * This value is dependent only on the original {@code Effect} from which
+     * this {@code RenderState} was instantiated and does not vary as the
+     * filter operation progresses.
+     *
+     * @return true if the pass weights are Gaussian
+     */
+    public boolean isGaussian() {
+        return false;
+    }
+
     /**
      * Returns the {@code Color4f} representing the shadow color if this
      * is a shadow operation.
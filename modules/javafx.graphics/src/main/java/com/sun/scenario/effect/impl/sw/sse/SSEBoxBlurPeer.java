@@ -75,9 +75,36 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
         HeapImage src = (HeapImage)inputs[0].getUntransformedImage();
         Rectangle srcr = inputs[0].getUntransformedBounds();
 
-        HeapImage cur = src;
+        // Lines across the blur direction are independent, so only those
+        // that can reach the output clip need to be filtered.  This matters
+        // when the input is a cached image larger than the dirty region.
+        int srcx = 0;
+        int srcy = 0;
         int curw = srcr.width;
         int curh = srcr.height;
+        if (outputClip != null) {
+            if (horizontal) {
+                // leave room for the vertical pass that follows
+                int pad = brstate.getInputKernelSize(1) / 2;
+                int y0 = Math.max(srcr.y, outputClip.y - pad);
+                int y1 = Math.min(srcr.y + srcr.height,
+                                  outputClip.y + outputClip.height + pad);
+                if (y0 < y1) {
+                    srcy = y0 - srcr.y;
+                    curh = y1 - y0;
+                }
+            } else {
+                int x0 = Math.max(srcr.x, outputClip.x);
+                int x1 = Math.min(srcr.x + srcr.width,
+                                  outputClip.x + outputClip.width);
+                if (x0 < x1) {
+                    srcx = x0 - srcr.x;
+                    curw = x1 - x0;
+                }
+            }
+        }
+
+        HeapImage cur = src;
         int curscan = cur.getScanlineStride();
         int[] curPixels = cur.getPixelArray();
 
@@ -91,12 +118,22 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
             HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(neww, newh);
             int newscan = dst.getScanlineStride();
             int[] newPixels = dst.getPixelArray();
+            // the crop offset only applies to the original source image
+            final int dw = neww, dh = newh, dscan = newscan;
+            final int sscan = curscan;
+            final int[] dpix = newPixels, spix = curPixels;
             if (horizontal) {
-                filterHorizontal(newPixels, neww, newh, newscan,
-                                 curPixels, curw, curh, curscan);
+                final int sw = curw, sh = (cur == src) ? srcr.height : curh;
+                final int sy = (cur == src) ? srcy : 0;
+                forEachBand(dh, dw, (from, to) ->
+                    filterHorizontal(dpix, dw, dh, dscan,
+                                     spix, sw, sh, sscan, sy, from, to));
             } else {
-                filterVertical(newPixels, neww, newh, newscan,
-                               curPixels, curw, curh, curscan);
+                final int sw = (cur == src) ? srcr.width : curw, sh = curh;
+                final int sx = (cur == src) ? srcx : 0;
+                forEachBand(dw, dh, (from, to) ->
+                    filterVertical(dpix, dw, dh, dscan,
+                                   spix, sw, sh, sscan, sx, from, to));
             }
             if (cur != src) {
                 getRenderer().releaseCompatibleImage(cur);
@@ -109,15 +146,26 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
         }
 
         Rectangle dstBounds =
-            new Rectangle(srcr.x - growx/2, srcr.y - growy/2, curw, curh);
+            new Rectangle(srcr.x + srcx - growx/2, srcr.y + srcy - growy/2,
+                          curw, curh);
         return new ImageData(getFilterContext(), cur, dstBounds);
     }
 
+    /**
+     * Blurs the destination rows {@code [rowFrom, rowTo)} horizontally,
+     * reading destination row {@code y} from source row {@code srcy + y}.
+     */
     private static native void
         filterHorizontal(int dstPixels[], int dstw, int dsth, int dstscan,
-                         int srcPixels[], int srcw, int srch, int srcscan);
+                         int srcPixels[], int srcw, int srch, int srcscan,
+                         int srcy, int rowFrom, int rowTo);
 
+    /**
+     * Blurs the destination columns {@code [colFrom, colTo)} vertically,
+     * reading destination column {@code x} from source column {@code srcx + x}.
+     */
     private static native void
         filterVertical(int dstPixels[], int dstw, int dsth, int dstscan,
-                       int srcPixels[], int srcw, int srch, int srcscan);
+                       int srcPixels[], int srcw, int srch, int srcscan,
+                       int srcx, int colFrom, int colTo);
 }
@@ -25,6 +25,9 @@
 
 package com.sun.scenario.effect.impl.sw.sse;
 
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+import java.util.stream.IntStream;
 import com.sun.scenario.effect.FilterContext;
 import com.sun.scenario.effect.impl.EffectPeer;
 import com.sun.scenario.effect.impl.Renderer;
@@ -32,7 +35,50 @@ import com.sun.scenario.effect.impl.state.RenderState;
 
 public abstract class SSEEffectPeer<T extends RenderState> extends EffectPeer<T> {
 
+    /**
+     * Maximum number of bands a native pass is split into, or 1 to always
+     * run the passes on the calling thread.
+     */
+    private static final int maxBands;
+
+    /**
+     * Passes touching fewer pixels than this are not worth splitting.
+     */
+    private static final int MIN_PARALLEL_PIXELS = 64 * 1024;
+
+    static {
+        @SuppressWarnings("removal")
+        int bands = AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+            Integer.getInteger("decora.sse.threads",
+                               Math.min(Runtime.getRuntime().availableProcessors(), 8)));
+        maxBands = Math.max(bands, 1);
+    }
+
     protected SSEEffectPeer(FilterContext fctx, Renderer r, String uniqueName) {
         super(fctx, r, uniqueName);
     }
+
+    /**
+     * A native pass restricted to the lines {@code [from, to)} of its output.
+     */
+    protected interface BandFilter {
+        void filter(int from, int to);
+    }
+
+    /**
+     * Splits {@code count} independent output lines of {@code lineLength}
+     * pixels each into bands and runs the filter over them, in parallel
+     * when the pass is large enough.  Returns once every band is done.
+     */
+    protected static void forEachBand(int count, int lineLength, BandFilter f) {
+        int bands = Math.min(maxBands, count);
+        if (bands <= 1 || (long) count * lineLength < MIN_PARALLEL_PIXELS) {
+            f.filter(0, count);
+            return;
+        }
+        IntStream.range(0, bands).parallel().forEach(b -> {
+            f.filter((int) ((long) count * b / bands),
+                     (int) ((long) count * (b + 1) / bands));
+        });
+    }
 }
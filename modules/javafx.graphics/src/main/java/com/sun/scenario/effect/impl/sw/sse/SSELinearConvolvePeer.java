@@ -43,6 +43,13 @@ import com.sun.scenario.effect.impl.state.LinearConvolveRenderState.PassType;
 
 public class SSELinearConvolvePeer extends SSEEffectPeer<LinearConvolveRenderState> {
 
+    /**
+     * Centered Gaussian passes with at least this many weights are
+     * approximated with three box filters, whose cost does not grow with
+     * the kernel size.
+     */
+    private static final int MIN_BOX_KERNEL_SIZE = 64;
+
     public SSELinearConvolvePeer(FilterContext fctx, Renderer r, String uniqueName) {
         super(fctx, r, uniqueName);
     }
@@ -96,7 +103,26 @@ public class SSELinearConvolvePeer extends SSEEffectPeer<LinearConvolveRenderSta
             // and transforms...
             type = PassType.GENERAL_VECTOR;
         }
-        if (type == PassType.HORIZONTAL_CENTERED) {
+        int[] boxSizes = null;
+        if (type != PassType.GENERAL_VECTOR &&
+            count >= MIN_BOX_KERNEL_SIZE && lcrstate.isGaussian())
+        {
+            float[] weights_arr = new float[count];
+            weights_buf.get(weights_arr, 0, count);
+            weights_buf.rewind();
+            boxSizes = getBoxSizes(weights_arr, count);
+        }
+        if (boxSizes != null) {
+            if (type == PassType.HORIZONTAL_CENTERED) {
+                filterHVBox(dstPixels, dstw, dsth, 1, dstscan,
+                            srcPixels, srcw, srch, 1, srcscan,
+                            count, boxSizes);
+            } else {
+                filterHVBox(dstPixels, dsth, dstw, dstscan, 1,
+                            srcPixels, srch, srcw, srcscan, 1,
+                            count, boxSizes);
+            }
+        } else if (type == PassType.HORIZONTAL_CENTERED) {
             float[] weights_arr = new float[count * 2];
             weights_buf.get(weights_arr, 0, count);
             weights_buf.rewind();
@@ -176,4 +202,58 @@ public class SSELinearConvolvePeer extends SSEEffectPeer<LinearConvolveRenderSta
         filterHV(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
                  int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
                  float weights[]);
+
+    /*
+     * Approximates a centered pass of kernelSize Gaussian weights with three
+     * box filters of the indicated sizes.  The other arguments are as for
+     * filterHV.
+     */
+    native void
+        filterHVBox(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
+                    int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
+                    int kernelSize, int boxSizes[]);
+
+    /**
+     * Returns the odd sizes of three box filters whose combined variance
+     * best matches that of the given symmetric kernel, while still fitting
+     * within the kernel's extent, or null if the kernel is not normalized.
+     */
+    static int[] getBoxSizes(float weights[], int count) {
+        int center = count / 2;
+        double sum = 0.0;
+        double var = 0.0;
+        for (int i = 0; i < count; i++) {
+            int d = i - center;
+            sum += weights[i];
+            var += weights[i] * d * d;
+        }
+        if (Math.abs(sum - 1.0) > 1e-3) {
+            // boosted by a shadow spread, which the boxes cannot reproduce
+            return null;
+        }
+        var /= sum;
+        // A box of odd size w has a variance of (w*w - 1) / 12, split the
+        // total between two neighbouring odd sizes.
+        int wl = (int) Math.floor(Math.sqrt(4.0 * var + 1.0));
+        if ((wl & 1) == 0) wl--;
+        if (wl < 1) wl = 1;
+        int m = (int) Math.round((12.0 * var - 3 * wl * wl - 12 * wl - 9) /
+                                 (-4.0 * wl - 4.0));
+        int[] sizes = new int[3];
+        int extent = 0;
+        for (int i = 0; i < 3; i++) {
+            sizes[i] = (i < m) ? wl : wl + 2;
+            extent += sizes[i] / 2;
+        }
+        // The result must not spread wider than the kernel it replaces
+        while (extent > center) {
+            int largest = 0;
+            for (int i = 1; i < 3; i++) {
+                if (sizes[i] > sizes[largest]) largest = i;
+            }
+            sizes[largest] -= 2;
+            extent--;
+        }
+        return sizes;
+    }
 }
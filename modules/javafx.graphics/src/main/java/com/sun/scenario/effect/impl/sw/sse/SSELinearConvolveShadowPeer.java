@@ -94,4 +94,20 @@ public class SSELinearConvolveShadowPeer extends SSELinearConvolvePeer {
                  srcPixels, srccols, srcrows, scolinc, srowinc,
                  weights, getShadowColor());
     }
+
+    private static native void
+        filterHVBox(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
+                    int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
+                    int kernelSize, int boxSizes[], float shadowColor[]);
+
+    @Override
+    void
+        filterHVBox(int dstPixels[], int dstcols, int dstrows, int dcolinc, int drowinc,
+                    int srcPixels[], int srccols, int srcrows, int scolinc, int srowinc,
+                    int kernelSize, int boxSizes[])
+    {
+        filterHVBox(dstPixels, dstcols, dstrows, dcolinc, drowinc,
+                    srcPixels, srccols, srcrows, scolinc, srowinc,
+                    kernelSize, boxSizes, getShadowColor());
+    }
 }
@@ -1012,7 +1012,9 @@ public class Image {
         platformImage.set(newPlatformImage);
     }
 
-    private static final int MAX_RUNNING_TASKS = 4;
+    // at least the original 4, and up to one task per core for at most 8
+    private static final int MAX_RUNNING_TASKS =
+            Math.max(4, Math.min(Runtime.getRuntime().availableProcessors(), 8));
     private static int runningTasks = 0;
     private static final Queue<ImageTask> pendingTasks =
             new LinkedList<>();
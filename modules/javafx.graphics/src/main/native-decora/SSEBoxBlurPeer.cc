@@ -32,16 +32,44 @@
 #include "SSEUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer.h"
 
+/*
+ * The box sums are kept two channels per 64-bit word, alpha and green in
+ * one and red and blue in the other, each in its own 32-bit lane.  A sum
+ * never exceeds ksize * 255 and (sum * kscale) never exceeds 0x7fffffff,
+ * so the lanes cannot carry into each other and the results are identical
+ * to summing each channel on its own.
+ */
+#define LANE_MASK 0x000000ff000000ffLL
+
+static inline jlong spread2(jint rgb) {
+    jlong x = rgb & 0x00ff00ff;
+    return (x | (x << 16)) & LANE_MASK;
+}
+
+static inline jint scale2(jlong sum, jint kscale) {
+    jlong x = ((sum * kscale) >> 23) & LANE_MASK;
+    return (jint) ((x | (x >> 16)) & 0x00ff00ff);
+}
+
+/*
+ * The vertical pass walks a strip of this many columns down the image
+ * together, so that each source row is read sequentially.
+ */
+#define STRIP_WIDTH 64
+
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
     (JNIEnv *env, jclass klass,
      jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint srcy, jint rowFrom, jint rowTo)
 {
     if ((checkRange(env,
                     dstPixels_arr, dstw, dsth,
                     srcPixels_arr, srcw, srch)) ||
-        dsth > srch) { // We should not move out of source vertical bounds
+        // We should not move out of source vertical bounds
+        srcy < 0 || dsth > srch - srcy ||
+        rowFrom < 0 || rowFrom > rowTo || rowTo > dsth) {
         return;
     }
 
@@ -55,32 +83,23 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
 
     jint hsize = dstw - srcw + 1;
     jint kscale = 0x7fffffff / (hsize * 255);
-    jint srcoff = 0;
-    jint dstoff = 0;
-    for (jint y = 0; y < dsth; y++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
+    jint srcoff = (srcy + rowFrom) * srcscan;
+    jint dstoff = rowFrom * dstscan;
+    for (jint y = rowFrom; y < rowTo; y++) {
+        jlong sumag = 0;
+        jlong sumrb = 0;
         for (jint x = 0; x < dstw; x++) {
             jint rgb;
             // Un-accumulate the data for col-hsize location into the sums.
             rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
+            sumag -= spread2(rgb >> 8);
+            sumrb -= spread2(rgb);
             // Accumulate the data for this col location into the sums.
             rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
+            sumag += spread2(rgb >> 8);
+            sumrb += spread2(rgb);
             dstPixels[dstoff + x] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
+                (scale2(sumag, kscale) << 8) + scale2(sumrb, kscale);
         }
         srcoff += srcscan;
         dstoff += dstscan;
@@ -94,12 +113,15 @@ JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
     (JNIEnv *env, jclass klass,
      jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint srcx, jint colFrom, jint colTo)
 {
     if ((checkRange(env,
                     dstPixels_arr, dstw, dsth,
                     srcPixels_arr, srcw, srch)) ||
-        dstw > srcw) { // We should not move out of source horizontal bounds
+        // We should not move out of source horizontal bounds
+        srcx < 0 || dstw > srcw - srcx ||
+        colFrom < 0 || colFrom > colTo || colTo > dstw) {
         return;
     }
 
@@ -114,32 +136,30 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
     jint vsize = dsth - srch + 1;
     jint kscale = 0x7fffffff / (vsize * 255);
     jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        jint srcoff = x;
-        jint dstoff = x;
+    jlong sumag[STRIP_WIDTH];
+    jlong sumrb[STRIP_WIDTH];
+    for (jint x0 = colFrom; x0 < colTo; x0 += STRIP_WIDTH) {
+        jint n = (colTo - x0 < STRIP_WIDTH) ? colTo - x0 : STRIP_WIDTH;
+        for (jint i = 0; i < n; i++) {
+            sumag[i] = 0;
+            sumrb[i] = 0;
+        }
+        jint srcoff = srcx + x0;
+        jint dstoff = x0;
         for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
+            for (jint i = 0; i < n; i++) {
+                jint rgb;
+                // Un-accumulate the data for row-vsize location into the sums.
+                rgb = (srcoff + i >= voff) ? srcPixels[srcoff + i - voff] : 0;
+                sumag[i] -= spread2(rgb >> 8);
+                sumrb[i] -= spread2(rgb);
+                // Accumulate the data for this col location into the sums.
+                rgb = (y < srch) ? srcPixels[srcoff + i] : 0;
+                sumag[i] += spread2(rgb >> 8);
+                sumrb[i] += spread2(rgb);
+                dstPixels[dstoff + i] =
+                    (scale2(sumag[i], kscale) << 8) + scale2(sumrb[i], kscale);
+            }
             srcoff += srcscan;
             dstoff += dstscan;
         }
@@ -30,6 +30,7 @@
 
 #include <jni.h>
 #include <math.h>
+#include <stdlib.h>
 #include "SSEUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer.h"
 
@@ -183,3 +184,88 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHV
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
 }
+
+/*
+ * Approximates a centered Gaussian pass of kernelSize weights with three
+ * box filters of the given sizes, at a cost that does not depend on the
+ * kernel size.  The arguments are otherwise as for filterHV.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHVBox
+    (JNIEnv *env, jobject lcpthis,
+     jintArray dstPixels_arr, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+     jintArray srcPixels_arr, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+     jint kernelSize, jintArray boxSizes_arr)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstcols, dstrows,
+                    srcPixels_arr, srccols, srcrows)) ||
+        dstrows > srcrows || // We should not move out of source vertical bounds
+        kernelSize < 1 || kernelSize > 128 ||
+        env->GetArrayLength(boxSizes_arr) < 3) {
+        return;
+    }
+
+    jint boxSizes[3];
+    env->GetIntArrayRegion(boxSizes_arr, 0, 3, boxSizes);
+    for (jint i = 0; i < 3; i++) {
+        // keeps the scaled sums below 255 * 128^3
+        if (boxSizes[i] < 1 || boxSizes[i] > kernelSize) return;
+    }
+    // Output column c is centered on source column c - pad, so the line
+    // is filtered over its full padded length even if the output is clipped.
+    jint pad = kernelSize / 2;
+    jint n = srccols + 2 * pad;
+    if (dstcols > n) return;
+    jint *cvals = (jint *) malloc(n * 5 * sizeof(jint));
+    if (cvals == NULL) return;
+    jint *tmp = cvals + n * 4;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) {
+        free(cvals);
+        return;
+    }
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        free(cvals);
+        return;
+    }
+
+    jint scale = boxSizes[0] * boxSizes[1] * boxSizes[2];
+    jint dstrow = 0;
+    jint srcrow = 0;
+    for (jint r = 0; r < dstrows; r++) {
+        jint srcoff = srcrow;
+        for (jint c = 0; c < n; c++) {
+            jint rgb = 0;
+            if (c >= pad && c - pad < srccols) {
+                rgb = srcPixels[srcoff];
+                srcoff += scolinc;
+            }
+            cvals[c      ] = (rgb >> 24) & 0xff;
+            cvals[c + n  ] = (rgb >> 16) & 0xff;
+            cvals[c + n*2] = (rgb >>  8) & 0xff;
+            cvals[c + n*3] = (rgb      ) & 0xff;
+        }
+        for (jint i = 0; i < 4; i++) {
+            boxfilter3(cvals + n * i, tmp, n, boxSizes);
+        }
+        jint dstoff = dstrow;
+        for (jint c = 0; c < dstcols; c++) {
+            dstPixels[dstoff] =
+                (((cvals[c      ] + scale / 2) / scale) << 24) +
+                (((cvals[c + n  ] + scale / 2) / scale) << 16) +
+                (((cvals[c + n*2] + scale / 2) / scale) <<  8) +
+                (((cvals[c + n*3] + scale / 2) / scale)      );
+            dstoff += dcolinc;
+        }
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+
+    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
+    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+    free(cvals);
+}
@@ -30,6 +30,7 @@
 
 #include <jni.h>
 #include <math.h>
+#include <stdlib.h>
 #include "SSEUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer.h"
 
@@ -188,3 +189,88 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterHV
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
 }
+
+/*
+ * Approximates a centered Gaussian pass of kernelSize weights with three
+ * box filters of the given sizes, at a cost that does not depend on the
+ * kernel size.  The arguments are otherwise as for filterHV.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolveShadowPeer_filterHVBox
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+     jintArray srcPixels_arr, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+     jint kernelSize, jintArray boxSizes_arr, jfloatArray shadowColor_arr)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstcols, dstrows,
+                    srcPixels_arr, srccols, srcrows)) ||
+        dstrows > srcrows || // We should not move out of source vertical bounds
+        kernelSize < 1 || kernelSize > 128 ||
+        env->GetArrayLength(boxSizes_arr) < 3) {
+        return;
+    }
+
+    jint boxSizes[3];
+    env->GetIntArrayRegion(boxSizes_arr, 0, 3, boxSizes);
+    for (jint i = 0; i < 3; i++) {
+        // keeps the scaled sums below 255 * 128^3
+        if (boxSizes[i] < 1 || boxSizes[i] > kernelSize) return;
+    }
+    jfloat shadowColor[4];
+    env->GetFloatArrayRegion(shadowColor_arr, 0, 4, shadowColor);
+    jint shadowRGBs[256];
+    for (jint i = 0; i < 256; i++) {
+        shadowRGBs[i] = ((int) (shadowColor[0] * i) << 16) |
+                        ((int) (shadowColor[1] * i) <<  8) |
+                        ((int) (shadowColor[2] * i) <<  0) |
+                        ((int) (shadowColor[3] * i) << 24);
+    }
+    // Output column c is centered on source column c - pad, so the line
+    // is filtered over its full padded length even if the output is clipped.
+    jint pad = kernelSize / 2;
+    jint n = srccols + 2 * pad;
+    if (dstcols > n) return;
+    jint *avals = (jint *) malloc(n * 2 * sizeof(jint));
+    if (avals == NULL) return;
+    jint *tmp = avals + n;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) {
+        free(avals);
+        return;
+    }
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        free(avals);
+        return;
+    }
+
+    jint scale = boxSizes[0] * boxSizes[1] * boxSizes[2];
+    jint dstrow = 0;
+    jint srcrow = 0;
+    for (jint r = 0; r < dstrows; r++) {
+        jint srcoff = srcrow;
+        for (jint c = 0; c < n; c++) {
+            jint rgb = 0;
+            if (c >= pad && c - pad < srccols) {
+                rgb = srcPixels[srcoff];
+                srcoff += scolinc;
+            }
+            avals[c] = (rgb >> 24) & 0xff;
+        }
+        boxfilter3(avals, tmp, n, boxSizes);
+        jint dstoff = dstrow;
+        for (jint c = 0; c < dstcols; c++) {
+            dstPixels[dstoff] = shadowRGBs[(avals[c] + scale / 2) / scale];
+            dstoff += dcolinc;
+        }
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+
+    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
+    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+    free(avals);
+}
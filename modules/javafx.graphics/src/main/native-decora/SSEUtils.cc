@@ -204,3 +204,43 @@ bool checkRange(JNIEnv *env,
             (srcw * srch) > env->GetArrayLength(srcPixels_arr) ||
             (dstw * dsth) > env->GetArrayLength(dstPixels_arr));
 }
+
+/*
+ * Applies a centered box filter of the given odd size to the n values
+ * in src, treating all values outside of the line as 0, and stores the
+ * unnormalized sums in dst.
+ */
+static void boxfilter(jint *src, jint *dst, jint n, jint size)
+{
+    jint half = size / 2;
+    jint sum = 0;
+    for (jint i = 0; i < half && i < n; i++) {
+        sum += src[i];
+    }
+    for (jint i = 0; i < n; i++) {
+        if (i + half < n) {
+            sum += src[i + half];
+        }
+        dst[i] = sum;
+        if (i >= half) {
+            sum -= src[i - half];
+        }
+    }
+}
+
+/*
+ * Applies three successive box filters of the indicated odd sizes to
+ * the n values in vals, which approximates a Gaussian of the same
+ * variance in constant time per value.  The result is left in vals,
+ * scaled by the product of the three sizes.  tmp must have room for n
+ * values.
+ */
+void boxfilter3(jint *vals, jint *tmp, jint n, const jint *sizes)
+{
+    boxfilter(vals, tmp, n, sizes[0]);
+    boxfilter(tmp, vals, n, sizes[1]);
+    boxfilter(vals, tmp, n, sizes[2]);
+    for (jint i = 0; i < n; i++) {
+        vals[i] = tmp[i];
+    }
+}
@@ -61,6 +61,8 @@ bool checkRange(JNIEnv *env,
                 jintArray dstPixels_arr, jint dstw, jint dsth,
                 jintArray srcPixels_arr, jint srcw, jint srch);
 
+void boxfilter3(jint *vals, jint *tmp, jint n, const jint *sizes);
+
 #ifdef __cplusplus
 };
 #endif /* __cplusplus */
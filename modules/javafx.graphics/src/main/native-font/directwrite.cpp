@@ -67,101 +67,6 @@ static jboolean checkAndClearException(JNIEnv* env)
 /*                                                                        */
 /**************************************************************************/
 
-typedef struct DWRITE_GLYPH_METRICS_FID_CACHE {
-    int cached;
-    jclass clazz;
-    jfieldID leftSideBearing, advanceWidth, rightSideBearing, topSideBearing, advanceHeight, bottomSideBearing, verticalOriginY;
-    jmethodID init;
-} DWRITE_GLYPH_METRICS_FID_CACHE;
-
-DWRITE_GLYPH_METRICS_FID_CACHE DWRITE_GLYPH_METRICSFc;
-
-void cacheDWRITE_GLYPH_METRICSFields(JNIEnv *env)
-{
-    if (DWRITE_GLYPH_METRICSFc.cached) return;
-    jclass tmpClass = env->FindClass("com/sun/javafx/font/directwrite/DWRITE_GLYPH_METRICS");
-    if (checkAndClearException(env) || !tmpClass) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or tmpClass == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.clazz =  (jclass)env->NewGlobalRef(tmpClass);
-    DWRITE_GLYPH_METRICSFc.leftSideBearing = env->GetFieldID(DWRITE_GLYPH_METRICSFc.clazz, "leftSideBearing", "I");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.leftSideBearing) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or leftSideBearing == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.advanceWidth = env->GetFieldID(DWRITE_GLYPH_METRICSFc.clazz, "advanceWidth", "I");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.advanceWidth) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or advanceWidth == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.rightSideBearing = env->GetFieldID(DWRITE_GLYPH_METRICSFc.clazz, "rightSideBearing", "I");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.rightSideBearing) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or rightSideBearing == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.topSideBearing = env->GetFieldID(DWRITE_GLYPH_METRICSFc.clazz, "topSideBearing", "I");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.topSideBearing) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or topSideBearing == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.advanceHeight = env->GetFieldID(DWRITE_GLYPH_METRICSFc.clazz, "advanceHeight", "I");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.advanceHeight) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or advanceHeight == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.bottomSideBearing = env->GetFieldID(DWRITE_GLYPH_METRICSFc.clazz, "bottomSideBearing", "I");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.bottomSideBearing) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or bottomSideBearing == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.verticalOriginY = env->GetFieldID(DWRITE_GLYPH_METRICSFc.clazz, "verticalOriginY", "I");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.verticalOriginY) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or verticalOriginY == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.init = env->GetMethodID(DWRITE_GLYPH_METRICSFc.clazz, "<init>", "()V");
-    if (checkAndClearException(env) || !DWRITE_GLYPH_METRICSFc.init) {
-        fprintf(stderr, "cacheDWRITE_GLYPH_METRICSFields error: JNI exception or <init> == NULL");
-        return;
-    }
-    DWRITE_GLYPH_METRICSFc.cached = 1;
-}
-
-DWRITE_GLYPH_METRICS *getDWRITE_GLYPH_METRICSFields(JNIEnv *env, jobject lpObject, DWRITE_GLYPH_METRICS *lpStruct)
-{
-    if (!DWRITE_GLYPH_METRICSFc.cached) cacheDWRITE_GLYPH_METRICSFields(env);
-    lpStruct->leftSideBearing = env->GetIntField(lpObject, DWRITE_GLYPH_METRICSFc.leftSideBearing);
-    lpStruct->advanceWidth = env->GetIntField(lpObject, DWRITE_GLYPH_METRICSFc.advanceWidth);
-    lpStruct->rightSideBearing = env->GetIntField(lpObject, DWRITE_GLYPH_METRICSFc.rightSideBearing);
-    lpStruct->topSideBearing = env->GetIntField(lpObject, DWRITE_GLYPH_METRICSFc.topSideBearing);
-    lpStruct->advanceHeight = env->GetIntField(lpObject, DWRITE_GLYPH_METRICSFc.advanceHeight);
-    lpStruct->bottomSideBearing = env->GetIntField(lpObject, DWRITE_GLYPH_METRICSFc.bottomSideBearing);
-    lpStruct->verticalOriginY = env->GetIntField(lpObject, DWRITE_GLYPH_METRICSFc.verticalOriginY);
-    return lpStruct;
-}
-
-void setDWRITE_GLYPH_METRICSFields(JNIEnv *env, jobject lpObject, DWRITE_GLYPH_METRICS *lpStruct)
-{
-    if (!DWRITE_GLYPH_METRICSFc.cached) cacheDWRITE_GLYPH_METRICSFields(env);
-    env->SetIntField(lpObject, DWRITE_GLYPH_METRICSFc.leftSideBearing, (jint)lpStruct->leftSideBearing);
-    env->SetIntField(lpObject, DWRITE_GLYPH_METRICSFc.advanceWidth, (jint)lpStruct->advanceWidth);
-    env->SetIntField(lpObject, DWRITE_GLYPH_METRICSFc.rightSideBearing, (jint)lpStruct->rightSideBearing);
-    env->SetIntField(lpObject, DWRITE_GLYPH_METRICSFc.topSideBearing, (jint)lpStruct->topSideBearing);
-    env->SetIntField(lpObject, DWRITE_GLYPH_METRICSFc.advanceHeight, (jint)lpStruct->advanceHeight);
-    env->SetIntField(lpObject, DWRITE_GLYPH_METRICSFc.bottomSideBearing, (jint)lpStruct->bottomSideBearing);
-    env->SetIntField(lpObject, DWRITE_GLYPH_METRICSFc.verticalOriginY, (jint)lpStruct->verticalOriginY);
-}
-
-jobject newDWRITE_GLYPH_METRICS(JNIEnv *env, DWRITE_GLYPH_METRICS *lpStruct)
-{
-    jobject lpObject = NULL;
-    if (!DWRITE_GLYPH_METRICSFc.cached) cacheDWRITE_GLYPH_METRICSFields(env);
-    lpObject = env->NewObject(DWRITE_GLYPH_METRICSFc.clazz, DWRITE_GLYPH_METRICSFc.init);
-    if (lpObject && lpStruct) setDWRITE_GLYPH_METRICSFields(env, lpObject, lpStruct);
-    return lpObject;
-}
-
 typedef struct DWRITE_MATRIX_FID_CACHE {
     int cached;
     jclass clazz;
@@ -1811,20 +1716,47 @@ fail:
     return result;
 }
 
-JNIEXPORT jobject JNICALL OS_NATIVE(GetDesignGlyphMetrics)
-    (JNIEnv *env, jclass that, jlong arg0, jshort arg1, jboolean arg2)
+/*
+ * Returns the design metrics of count glyphs, seven values per glyph in the
+ * order of the DWRITE_GLYPH_METRICS fields, without any per field JNI work.
+ */
+JNIEXPORT jint JNICALL OS_NATIVE(GetDesignGlyphMetrics)
+    (JNIEnv *env, jclass that, jlong arg0, jshortArray arg1, jint arg2, jboolean arg3, jintArray arg4)
 {
     HRESULT hr = E_FAIL;
-    jobject result = NULL;
-    const UINT32  glyphCount = 1;
-    const UINT16 glyphIndices[glyphCount] = {arg1};
-    DWRITE_GLYPH_METRICS glyphMetrics[glyphCount];
-
-    hr = ((IDWriteFontFace *)arg0)->GetDesignGlyphMetrics(glyphIndices, glyphCount, glyphMetrics, arg2);
+    jshort *lparg1 = NULL;
+    DWRITE_GLYPH_METRICS *glyphMetrics = NULL;
+    jint *metrics = NULL;
+
+    if (!arg1 || !arg4) return hr;
+    if (arg2 <= 0 || arg2 > env->GetArrayLength(arg1)) return hr;
+    if (arg2 > env->GetArrayLength(arg4) / 7) return hr;
+    glyphMetrics = new (std::nothrow) DWRITE_GLYPH_METRICS[arg2];
+    if (!glyphMetrics) return hr;
+    if ((lparg1 = env->GetShortArrayElements(arg1, NULL)) == NULL) goto fail;
+
+    hr = ((IDWriteFontFace *)arg0)->GetDesignGlyphMetrics((const UINT16 *)lparg1, arg2, glyphMetrics, arg3);
     if (SUCCEEDED(hr)) {
-        result = newDWRITE_GLYPH_METRICS(env, &glyphMetrics[0]);
+        if ((metrics = env->GetIntArrayElements(arg4, NULL)) == NULL) {
+            hr = E_FAIL;
+            goto fail;
+        }
+        for (jint i = 0; i < arg2; i++) {
+            jint *m = metrics + i * 7;
+            m[0] = (jint)glyphMetrics[i].leftSideBearing;
+            m[1] = (jint)glyphMetrics[i].advanceWidth;
+            m[2] = (jint)glyphMetrics[i].rightSideBearing;
+            m[3] = (jint)glyphMetrics[i].topSideBearing;
+            m[4] = (jint)glyphMetrics[i].advanceHeight;
+            m[5] = (jint)glyphMetrics[i].bottomSideBearing;
+            m[6] = (jint)glyphMetrics[i].verticalOriginY;
+        }
     }
-    return result;
+fail:
+    if (metrics) env->ReleaseIntArrayElements(arg4, metrics, 0);
+    if (lparg1) env->ReleaseShortArrayElements(arg1, lparg1, JNI_ABORT);
+    delete [] glyphMetrics;
+    return hr;
 }
 
 /* IDWriteFactory */
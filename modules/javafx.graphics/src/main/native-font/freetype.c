@@ -397,6 +397,69 @@ JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that,
     return result;
 }
 
+/*
+ * Loads and renders the glyph in a single call.  The slot fields needed by
+ * the glyph cache are stored in metrics (see OSFreetype.GLYPH_*) and the
+ * bitmap is returned with its rows packed to the bitmap width.  Returns an
+ * empty array for a blank glyph and NULL if the glyph could not be loaded
+ * or was not rendered to a gray or LCD bitmap.
+ */
+JNIEXPORT jbyteArray JNICALL OS_NATIVE(renderGlyph)
+    (JNIEnv *env, jclass that, jlong facePtr, jint glyphIndex, jint loadFlags,
+     jintArray metrics)
+{
+    if (!facePtr || !metrics) return NULL;
+    if ((*env)->GetArrayLength(env, metrics) < 9) return NULL;
+    FT_Face face = (FT_Face)facePtr;
+    jint values[9] = {0};
+    FT_Error error = FT_Load_Glyph(face, (FT_UInt)glyphIndex, (FT_Int32)loadFlags);
+    FT_GlyphSlot slot = face->glyph;
+    if (error || !slot) {
+        values[0] = error ? error : -1;
+        (*env)->SetIntArrayRegion(env, metrics, 0, 9, values);
+        return NULL;
+    }
+    FT_Bitmap bitmap = slot->bitmap;
+    values[1] = bitmap.pixel_mode;
+    values[2] = bitmap.width;
+    values[3] = bitmap.rows;
+    values[4] = slot->bitmap_left;
+    values[5] = slot->bitmap_top;
+    values[6] = (jint)slot->advance.x;
+    values[7] = (jint)slot->advance.y;
+    values[8] = (jint)slot->linearHoriAdvance;
+    (*env)->SetIntArrayRegion(env, metrics, 0, 9, values);
+
+    if (bitmap.pixel_mode != FT_PIXEL_MODE_GRAY &&
+        bitmap.pixel_mode != FT_PIXEL_MODE_LCD) {
+        return NULL;
+    }
+    if (bitmap.width == 0 || bitmap.rows == 0) {
+        return (*env)->NewByteArray(env, 0);
+    }
+    unsigned char* src = bitmap.buffer;
+    if (!src) return NULL;
+    if (bitmap.pitch <= 0 || (unsigned int)bitmap.pitch < bitmap.width) return NULL;
+    if (bitmap.rows > INT_MAX / bitmap.width) return NULL;
+    jbyteArray result = (*env)->NewByteArray(env, bitmap.width * bitmap.rows);
+    if (result) {
+        unsigned char* dst = (*env)->GetPrimitiveArrayCritical(env, result, NULL);
+        if (dst) {
+            if ((unsigned int)bitmap.pitch == bitmap.width) {
+                memcpy(dst, src, bitmap.width * bitmap.rows);
+            } else {
+                /* Common for LCD glyphs */
+                unsigned int y;
+                for (y = 0; y < bitmap.rows; y++) {
+                    memcpy(dst + y * bitmap.width, src + y * bitmap.pitch, bitmap.width);
+                }
+            }
+            (*env)->ReleasePrimitiveArrayCritical(env, result, dst, 0);
+        }
+    }
+    return result;
+}
+
 JNIEXPORT void JNICALL OS_NATIVE(FT_1Set_1Transform)
     (JNIEnv *env, jclass that, jlong arg0, jobject arg1, jlong arg2, jlong arg3)
 {
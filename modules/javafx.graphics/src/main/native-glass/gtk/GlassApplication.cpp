@@ -119,7 +119,11 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1initGTK
     init_threads();
 
     gdk_threads_enter();
-    gtk_init(NULL, NULL);
+    if (!gtk_init_check(NULL, NULL)) {
+        jclass uoe = env->FindClass("java/lang/UnsupportedOperationException");
+        env->ThrowNew(uoe, "Unable to open DISPLAY");
+        return;
+    }
 
     // Major version is checked before loading
     if (version == 3
@@ -158,12 +162,7 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
     (void)suggestedVersion;
     (void)verbose;
 
-    Display *display = XOpenDisplay(NULL);
-    if (display == NULL) {
-        return com_sun_glass_ui_gtk_GtkApplication_QUERY_NO_DISPLAY;
-    }
-    XCloseDisplay(display);
-
+    // The DISPLAY is validated by gtk_init_check() in _initGTK
     return com_sun_glass_ui_gtk_GtkApplication_QUERY_USE_CURRENT;
 }
 #endif
@@ -469,6 +468,26 @@ bool is_window_enabled_for_event(GdkWindow * window, WindowContext *ctx, gint ev
     return TRUE;
 }
 
+/*
+ * A motion event is dropped when the next queued event is another motion
+ * of the same device over the same window with the same modifiers, so high
+ * rate pointers do not flood the FX thread with positions that are already
+ * stale when they are delivered.
+ */
+static bool is_motion_superseded(GdkEventMotion* event)
+{
+    GdkEvent* next = gdk_event_peek();
+    if (next == NULL) {
+        return false;
+    }
+    bool superseded = next->type == GDK_MOTION_NOTIFY
+            && next->motion.window == event->window
+            && next->motion.device == event->device
+            && next->motion.state == event->state;
+    gdk_event_free(next);
+    return superseded;
+}
+
 static void process_events(GdkEvent* event, gpointer data)
 {
     GdkWindow* window = event->any.window;
@@ -524,7 +543,9 @@ static void process_events(GdkEvent* event, gpointer data)
                     ctx->process_mouse_button(&event->button);
                     break;
                 case GDK_MOTION_NOTIFY:
-                    ctx->process_mouse_motion(&event->motion);
+                    if (!is_motion_superseded(&event->motion)) {
+                        ctx->process_mouse_motion(&event->motion);
+                    }
                     gdk_event_request_motions(&event->motion);
                     break;
                 case GDK_SCROLL:
@@ -275,23 +275,37 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1getScreenCapture
         return;
     }
 
-    GdkPixbuf *screenshot, *tmp;
     GdkWindow *root_window = gdk_get_default_root_window();
 
-    tmp = glass_pixbuf_from_window(root_window, x, y, width, height);
-    if (!tmp) {
+    GdkPixbuf *screenshot = glass_pixbuf_from_window(root_window, x, y, width, height);
+    if (!screenshot) {
         return;
     }
-    screenshot = gdk_pixbuf_add_alpha(tmp, FALSE, 0, 0, 0);
-    g_object_unref(tmp);
-    if (!screenshot) {
+
+    const int channels = gdk_pixbuf_get_n_channels(screenshot);
+    const gboolean hasAlpha = gdk_pixbuf_get_has_alpha(screenshot);
+    if (gdk_pixbuf_get_width(screenshot) < width
+            || gdk_pixbuf_get_height(screenshot) < height
+            || channels < (hasAlpha ? 4 : 3)) {
+        g_object_unref(screenshot);
         return;
     }
+    const int rowstride = gdk_pixbuf_get_rowstride(screenshot);
+    const guint8 *src = gdk_pixbuf_get_pixels(screenshot);
 
-    jint *pixels = (jint *)convert_BGRA_to_RGBA((int*)gdk_pixbuf_get_pixels(screenshot), width * 4, height);
+    // Convert the RGB(A) rows straight into the ARGB result instead of
+    // adding an alpha channel and swizzling through intermediate copies
+    jint *pixels = (jint *)env->GetPrimitiveArrayCritical(data, 0);
     if (pixels) {
-        env->SetIntArrayRegion(data, 0, numPixels, pixels);
-        g_free(pixels);
+        for (int row = 0; row < height; row++) {
+            const guint8 *s = src + (gsize)row * rowstride;
+            jint *d = pixels + row * width;
+            for (int col = 0; col < width; col++, s += channels) {
+                guint32 a = hasAlpha ? s[3] : 0xff;
+                d[col] = (jint)((a << 24) | (s[0] << 16) | (s[1] << 8) | s[2]);
+            }
+        }
+        env->ReleasePrimitiveArrayCritical(data, pixels, 0);
     }
     g_object_unref(screenshot);
 }
@@ -83,6 +83,181 @@ static GtkClipboard *get_clipboard() {
     return clipboard;
 }
 
+// Upper bound on how long a clipboard read may block the FX thread when
+// the owner of the selection is slow to respond or hung.
+#define CLIPBOARD_REQUEST_TIMEOUT_MS 3000
+
+// The gtk_clipboard_wait_for_* functions wait for the owner with no limit,
+// so reads are issued with gtk_clipboard_request_* and waited for here
+// instead.  A request is shared with its callback, so that a reply which
+// arrives after the wait gave up is freed rather than written to a stale
+// stack frame.
+struct ClipboardRequest {
+    gint ref_count;
+    gboolean done;
+    gpointer data;
+    GDestroyNotify free_data;
+    GdkAtom *targets;
+    gint ntargets;
+};
+
+static ClipboardRequest *clipboard_request_new(GDestroyNotify free_data)
+{
+    ClipboardRequest *request = g_new0(ClipboardRequest, 1);
+    request->ref_count = 2; // the caller and the callback
+    request->free_data = free_data;
+    return request;
+}
+
+static void clipboard_request_unref(ClipboardRequest *request)
+{
+    if (--request->ref_count == 0) {
+        if (request->data != NULL && request->free_data != NULL) {
+            request->free_data(request->data);
+        }
+        g_free(request->targets);
+        g_free(request);
+    }
+}
+
+static void clipboard_request_done(ClipboardRequest *request, gpointer data)
+{
+    request->data = data;
+    request->done = TRUE;
+    clipboard_request_unref(request);
+}
+
+static gboolean clipboard_request_timed_out(gpointer user_data)
+{
+    *(gboolean *) user_data = TRUE;
+    return FALSE;
+}
+
+// Returns the data of the request, owned by the caller, or NULL if the
+// owner didn't answer in time.
+static gpointer clipboard_request_wait(ClipboardRequest *request)
+{
+    if (!request->done) {
+        gboolean timed_out = FALSE;
+        guint timeout_id = g_timeout_add(CLIPBOARD_REQUEST_TIMEOUT_MS,
+                clipboard_request_timed_out, &timed_out);
+        while (!request->done && !timed_out) {
+            g_main_context_iteration(NULL, TRUE);
+        }
+        if (!timed_out) {
+            g_source_remove(timeout_id);
+        }
+    }
+    gpointer data = request->data;
+    request->data = NULL;
+    return data;
+}
+
+static void text_received(GtkClipboard *clipboard, const gchar *text, gpointer user_data)
+{
+    (void)clipboard;
+    clipboard_request_done((ClipboardRequest *) user_data, g_strdup(text));
+}
+
+static void uris_received(GtkClipboard *clipboard, gchar **uris, gpointer user_data)
+{
+    (void)clipboard;
+    clipboard_request_done((ClipboardRequest *) user_data, g_strdupv(uris));
+}
+
+static void image_received(GtkClipboard *clipboard, GdkPixbuf *pixbuf, gpointer user_data)
+{
+    (void)clipboard;
+    clipboard_request_done((ClipboardRequest *) user_data,
+            pixbuf != NULL ? g_object_ref(pixbuf) : NULL);
+}
+
+static void contents_received(GtkClipboard *clipboard, GtkSelectionData *data, gpointer user_data)
+{
+    (void)clipboard;
+    clipboard_request_done((ClipboardRequest *) user_data,
+            data != NULL && gtk_selection_data_get_length(data) >= 0
+                    ? gtk_selection_data_copy(data) : NULL);
+}
+
+static void targets_received(GtkClipboard *clipboard, GdkAtom *atoms, gint n_atoms, gpointer user_data)
+{
+    (void)clipboard;
+    ClipboardRequest *request = (ClipboardRequest *) user_data;
+    if (atoms != NULL && n_atoms > 0) {
+        request->targets = g_new(GdkAtom, n_atoms);
+        memcpy(request->targets, atoms, n_atoms * sizeof(GdkAtom));
+        request->ntargets = n_atoms;
+    }
+    clipboard_request_done(request, NULL);
+}
+
+static gchar *clipboard_get_text()
+{
+    ClipboardRequest *request = clipboard_request_new(g_free);
+    gtk_clipboard_request_text(get_clipboard(), text_received, request);
+    gchar *text = (gchar *) clipboard_request_wait(request);
+    clipboard_request_unref(request);
+    return text;
+}
+
+static gchar **clipboard_get_uris()
+{
+    ClipboardRequest *request = clipboard_request_new((GDestroyNotify) g_strfreev);
+    gtk_clipboard_request_uris(get_clipboard(), uris_received, request);
+    gchar **uris = (gchar **) clipboard_request_wait(request);
+    clipboard_request_unref(request);
+    return uris;
+}
+
+static GdkPixbuf *clipboard_get_image()
+{
+    ClipboardRequest *request = clipboard_request_new(g_object_unref);
+    gtk_clipboard_request_image(get_clipboard(), image_received, request);
+    GdkPixbuf *pixbuf = (GdkPixbuf *) clipboard_request_wait(request);
+    clipboard_request_unref(request);
+    return pixbuf;
+}
+
+static GtkSelectionData *clipboard_get_contents(GdkAtom target)
+{
+    ClipboardRequest *request = clipboard_request_new((GDestroyNotify) gtk_selection_data_free);
+    gtk_clipboard_request_contents(get_clipboard(), target, contents_received, request);
+    GtkSelectionData *data = (GtkSelectionData *) clipboard_request_wait(request);
+    clipboard_request_unref(request);
+    return data;
+}
+
+// Returns FALSE if the owner didn't answer in time.
+static gboolean clipboard_get_targets(GdkAtom **targets, gint *ntargets)
+{
+    ClipboardRequest *request = clipboard_request_new(NULL);
+    gtk_clipboard_request_targets(get_clipboard(), targets_received, request);
+    clipboard_request_wait(request);
+    gboolean done = request->done;
+    *targets = request->targets;
+    *ntargets = request->ntargets;
+    request->targets = NULL;
+    clipboard_request_unref(request);
+    return done;
+}
+
+// Mime types last reported by mimesFromSystem, kept until the clipboard
+// owner changes.  Only used when the display notifies owner changes.
+static GdkAtom *cached_mimes = NULL;
+static gint cached_mimes_count = 0;
+static gboolean cached_mimes_valid = FALSE;
+static guint owner_change_serial = 0;
+
+static void invalidate_cached_mimes()
+{
+    owner_change_serial++;
+    g_free(cached_mimes);
+    cached_mimes = NULL;
+    cached_mimes_count = 0;
+    cached_mimes_valid = FALSE;
+}
+
 static jobject createUTF(JNIEnv *env, char *data) {
     int len;
     jbyteArray ba;
@@ -329,7 +504,7 @@ static void clear_data_func(GtkClipboard *clipboard, gpointer user_data)
 
 static jobject get_data_text(JNIEnv *env)
 {
-    gchar *data = gtk_clipboard_wait_for_text(get_clipboard());
+    gchar *data = clipboard_get_text();
     if (data == NULL) {
         return NULL;
     }
@@ -341,7 +516,7 @@ static jobject get_data_text(JNIEnv *env)
 
 static jobject get_data_uri_list(JNIEnv *env, gboolean files)
 {
-    return uris_to_java(env, gtk_clipboard_wait_for_uris(get_clipboard()), files);
+    return uris_to_java(env, clipboard_get_uris(), files);
 }
 
 static jobject get_data_image(JNIEnv* env) {
@@ -351,7 +526,7 @@ static jobject get_data_image(JNIEnv* env) {
     jobject buffer, result;
     int w,h,stride;
 
-    pixbuf = gtk_clipboard_wait_for_image(get_clipboard());
+    pixbuf = clipboard_get_image();
     if (pixbuf == NULL) {
         return NULL;
     }
@@ -403,7 +578,7 @@ static jobject get_data_raw(JNIEnv *env, const char* mime, gboolean string_data)
     jsize length;
     jbyteArray array;
     jobject result = NULL;
-    data = gtk_clipboard_wait_for_contents(get_clipboard(), gdk_atom_intern(mime, FALSE));
+    data = clipboard_get_contents(gdk_atom_intern(mime, FALSE));
     if (data != NULL) {
         raw_data = glass_gtk_selection_data_get_data_with_length(data, &length);
         if (string_data) {
@@ -433,6 +608,7 @@ static void clipboard_owner_changed_callback(GtkClipboard *clipboard, GdkEventOw
 
     is_clipboard_owner = is_clipboard_updated_by_glass;
     is_clipboard_updated_by_glass = FALSE;
+    invalidate_cached_mimes();
     mainEnv->CallVoidMethod(obj, jClipboardContentChanged);
     CHECK_JNI_EXCEPTION(mainEnv)
 }
@@ -468,6 +644,7 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkSystemClipboard_dispose
 
     g_signal_handler_disconnect(G_OBJECT(get_clipboard()), owner_change_handler_id);
     env->DeleteGlobalRef(jclipboard);
+    invalidate_cached_mimes();
 
     owner_change_handler_id = 0;
     jclipboard = NULL;
@@ -516,6 +693,7 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkSystemClipboard_pushToSystem
     }
 
     is_clipboard_updated_by_glass = TRUE;
+    invalidate_cached_mimes();
 }
 
 /*
@@ -590,74 +768,88 @@ JNIEXPORT jobjectArray JNICALL Java_com_sun_glass_ui_gtk_GtkSystemClipboard_mime
 {
     (void)obj;
 
-    GdkAtom *targets;
-    gint ntargets;
-    gint i;
-    GdkAtom *convertible;
-    GdkAtom *convertible_ptr;
     gchar *name;
     jobjectArray result;
     jstring tmpString;
+    gint i;
 
     init_atoms();
 
-    gtk_clipboard_wait_for_targets(get_clipboard(), &targets, &ntargets);
+    if (!cached_mimes_valid) {
+        GdkAtom *targets;
+        gint ntargets;
+        GdkAtom *convertible;
+        GdkAtom *convertible_ptr;
 
-    convertible = (GdkAtom*) glass_try_malloc0_n(ntargets * 2, sizeof(GdkAtom)); //theoretically, the number can double
-    if (!convertible) {
-        if (ntargets > 0) {
-            glass_throw_oom(env, "Failed to allocate mimes");
-        }
-        g_free(targets);
-        return NULL;
-    }
+        // the wait below runs the main loop, which may deliver an owner change
+        guint serial = owner_change_serial;
+        gboolean answered = clipboard_get_targets(&targets, &ntargets);
 
-    convertible_ptr = convertible;
+        convertible = (GdkAtom*) glass_try_malloc0_n(ntargets * 2, sizeof(GdkAtom)); //theoretically, the number can double
+        if (!convertible) {
+            if (ntargets > 0) {
+                glass_throw_oom(env, "Failed to allocate mimes");
+            }
+            g_free(targets);
+            return NULL;
+        }
 
-    bool uri_list_added = false;
-    bool text_added = false;
-    bool image_added = false;
+        convertible_ptr = convertible;
 
-    for (i = 0; i < ntargets; ++i) {
-        //handle text targets
-        //if (targets[i] == TEXT_TARGET || targets[i] == STRING_TARGET || targets[i] == UTF8_STRING_TARGET) {
+        bool uri_list_added = false;
+        bool text_added = false;
+        bool image_added = false;
 
-        if (gtk_targets_include_text(targets + i, 1) && !text_added) {
-            *(convertible_ptr++) = MIME_TEXT_PLAIN_TARGET;
-            text_added = true;
-        } else if (gtk_targets_include_image(targets + i, 1, TRUE) && !image_added) {
-            *(convertible_ptr++) = MIME_JAVA_IMAGE;
-            image_added = true;
-        }
-        //TODO text/x-moz-url ? RT-17802
+        for (i = 0; i < ntargets; ++i) {
+            //handle text targets
+            //if (targets[i] == TEXT_TARGET || targets[i] == STRING_TARGET || targets[i] == UTF8_STRING_TARGET) {
 
-        if (targets[i] == MIME_TEXT_URI_LIST_TARGET) {
-            if (uri_list_added) {
-                continue;
+            if (gtk_targets_include_text(targets + i, 1) && !text_added) {
+                *(convertible_ptr++) = MIME_TEXT_PLAIN_TARGET;
+                text_added = true;
+            } else if (gtk_targets_include_image(targets + i, 1, TRUE) && !image_added) {
+                *(convertible_ptr++) = MIME_JAVA_IMAGE;
+                image_added = true;
             }
+            //TODO text/x-moz-url ? RT-17802
 
-            gchar** uris = gtk_clipboard_wait_for_uris(get_clipboard());
-            if (uris) {
-                guint size = g_strv_length(uris);
-                guint files_cnt = get_files_count(uris);
-                if (files_cnt) {
-                    *(convertible_ptr++) = MIME_FILES_TARGET;
+            if (targets[i] == MIME_TEXT_URI_LIST_TARGET) {
+                if (uri_list_added) {
+                    continue;
                 }
-                if (size - files_cnt) {
-                    *(convertible_ptr++) = MIME_TEXT_URI_LIST_TARGET;
+
+                gchar** uris = clipboard_get_uris();
+                if (uris) {
+                    guint size = g_strv_length(uris);
+                    guint files_cnt = get_files_count(uris);
+                    if (files_cnt) {
+                        *(convertible_ptr++) = MIME_FILES_TARGET;
+                    }
+                    if (size - files_cnt) {
+                        *(convertible_ptr++) = MIME_TEXT_URI_LIST_TARGET;
+                    }
+                    g_strfreev(uris);
                 }
-                g_strfreev(uris);
+                uri_list_added = true;
+            } else {
+                *(convertible_ptr++) = targets[i];
             }
-            uri_list_added = true;
-        } else {
-            *(convertible_ptr++) = targets[i];
         }
+        g_free(targets);
+
+        g_free(cached_mimes);
+        cached_mimes = convertible;
+        cached_mimes_count = convertible_ptr - convertible;
+        // without owner change notifications the list could go stale, and
+        // an owner that didn't answer may still have data later
+        cached_mimes_valid = answered && serial == owner_change_serial
+                && gdk_display_supports_selection_notification(gdk_display_get_default());
     }
 
-    result = env->NewObjectArray(convertible_ptr - convertible, jStringCls, NULL);
+    result = env->NewObjectArray(cached_mimes_count, jStringCls, NULL);
     EXCEPTION_OCCURED(env);
-    for (i = 0; convertible + i < convertible_ptr; ++i) {
-        name = gdk_atom_name(convertible[i]);
+    for (i = 0; i < cached_mimes_count; ++i) {
+        name = gdk_atom_name(cached_mimes[i]);
         tmpString = env->NewStringUTF(name);
         EXCEPTION_OCCURED(env);
         env->SetObjectArrayElement(result, (jsize)i, tmpString);
@@ -665,8 +857,6 @@ JNIEXPORT jobjectArray JNICALL Java_com_sun_glass_ui_gtk_GtkSystemClipboard_mime
         g_free(name);
     }
 
-    g_free(targets);
-    g_free(convertible);
     return result;
 }
 
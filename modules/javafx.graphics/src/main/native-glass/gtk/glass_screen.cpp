@@ -126,9 +126,12 @@ jfloat getUIScale(GdkScreen* screen) {
     return uiScale;
 }
 
-static jobject createJavaScreen(JNIEnv* env, GdkScreen* screen, gint monitor_idx)
+// The work area and the UI scale are the same for every monitor, and
+// looking them up takes X server round trips and a settings query, so
+// callers building several screens look them up only once
+static jobject createJavaScreen(JNIEnv* env, GdkScreen* screen, gint monitor_idx,
+                                GdkRectangle workArea, jfloat uiScale)
 {
-    GdkRectangle workArea = get_screen_workarea(screen);
     LOG4("Work Area: x:%d, y:%d, w:%d, h:%d\n", workArea.x, workArea.y, workArea.width, workArea.height);
 
     GdkRectangle monitor_geometry;
@@ -143,9 +146,6 @@ static jobject createJavaScreen(JNIEnv* env, GdkScreen* screen, gint monitor_idx
     GdkRectangle working_monitor_geometry;
     gdk_rectangle_intersect(&workArea, &monitor_geometry, &working_monitor_geometry);
 
-    jfloat uiScale = getUIScale(screen);
-
-
     jint mx = monitor_geometry.x / uiScale;
     jint my = monitor_geometry.y / uiScale;
     jint mw = monitor_geometry.width / uiScale;
@@ -195,7 +195,9 @@ static jobject createJavaScreen(JNIEnv* env, GdkScreen* screen, gint monitor_idx
 jobject createJavaScreen(JNIEnv* env, gint monitor_idx) {
     GdkScreen *default_gdk_screen = gdk_screen_get_default();
     try {
-        return createJavaScreen(env, default_gdk_screen, monitor_idx);
+        return createJavaScreen(env, default_gdk_screen, monitor_idx,
+                                get_screen_workarea(default_gdk_screen),
+                                getUIScale(default_gdk_screen));
     } catch (jni_exception&) {
         return NULL;
     }
@@ -209,9 +211,13 @@ jobjectArray rebuild_screens(JNIEnv* env) {
     JNI_EXCEPTION_TO_CPP(env)
     LOG1("Available monitors: %d\n", n_monitors)
 
+    GdkRectangle workArea = get_screen_workarea(default_gdk_screen);
+    jfloat uiScale = getUIScale(default_gdk_screen);
+
     int i;
     for (i=0; i < n_monitors; i++) {
-        env->SetObjectArrayElement(jscreens, i, createJavaScreen(env, default_gdk_screen, i));
+        env->SetObjectArrayElement(jscreens, i,
+                createJavaScreen(env, default_gdk_screen, i, workArea, uiScale));
         JNI_EXCEPTION_TO_CPP(env)
     }
 
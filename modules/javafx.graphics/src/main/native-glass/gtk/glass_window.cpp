@@ -514,12 +514,21 @@ void WindowContextBase::process_key(GdkEventKey* event) {
     }
 }
 
-void WindowContextBase::paint(void* data, jint width, jint height) {
-#ifdef GLASS_GTK3
-    cairo_rectangle_int_t rect = {0, 0, width, height};
-    cairo_region_t *region = cairo_region_create_rectangle(&rect);
-    gdk_window_begin_paint_region(gdk_window, region);
-#endif
+void WindowContextBase::paint(void* data, jint width, jint height,
+        jint dirtyX, jint dirtyY, jint dirtyW, jint dirtyH) {
+    // Only the dirty area is copied to the window, the rest of the window
+    // still shows the previous frame
+    jint x0 = MAX(dirtyX, 0);
+    jint y0 = MAX(dirtyY, 0);
+    jint x1 = MIN((jlong) dirtyX + dirtyW, width);
+    jint y1 = MIN((jlong) dirtyY + dirtyH, height);
+    if (x1 <= x0 || y1 <= y0) {
+        return;
+    }
+    // The dirty area is filled in a single SOURCE blit, so there is nothing
+    // to hide behind a gdk_window_begin_paint_region() double buffer; doing
+    // without it saves copying the area once more per frame. Glass always
+    // runs on X11, where cairo uploads the pixels through XShm when it can.
     cairo_t* context = gdk_cairo_create(gdk_window);
 
     cairo_surface_t* cairo_surface =
@@ -532,12 +541,8 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
 
     cairo_set_source_surface(context, cairo_surface, 0, 0);
     cairo_set_operator(context, CAIRO_OPERATOR_SOURCE);
-    cairo_paint(context);
-
-#ifdef GLASS_GTK3
-    gdk_window_end_paint(gdk_window);
-    cairo_region_destroy(region);
-#endif
+    cairo_rectangle(context, x0, y0, x1 - x0, y1 - y0);
+    cairo_fill(context);
 
     cairo_destroy(context);
     cairo_surface_destroy(cairo_surface);
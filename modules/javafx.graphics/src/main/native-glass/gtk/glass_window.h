@@ -101,7 +101,8 @@ public:
     virtual bool filterIME(GdkEvent *) = 0;
     virtual void enableOrResetIME() = 0;
     virtual void disableIME() = 0;
-    virtual void paint(void* data, jint width, jint height) = 0;
+    virtual void paint(void* data, jint width, jint height,
+            jint dirtyX, jint dirtyY, jint dirtyW, jint dirtyH) = 0;
     virtual WindowFrameExtents get_frame_extents() = 0;
 
     virtual void enter_fullscreen() = 0;
@@ -213,7 +214,7 @@ public:
     bool filterIME(GdkEvent *);
     void enableOrResetIME();
     void disableIME();
-    void paint(void*, jint, jint);
+    void paint(void*, jint, jint, jint, jint, jint, jint);
     GdkWindow *get_gdk_window();
     jobject get_jwindow();
     jobject get_jview();
@@ -37,8 +37,6 @@
 #include <strings.h>
 #include <stdlib.h>
 
-#include <X11/Xlib.h>
-
 #include <assert.h>
 
 #include <jni.h>
@@ -199,14 +197,10 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
     //Set the gtk backend to x11 on all the systems
     putenv("GDK_BACKEND=x11");
 
-    // Before doing anything with GTK we validate that the DISPLAY can be opened
-    Display *display = XOpenDisplay(NULL);
-    if (display == NULL) {
-        return com_sun_glass_ui_gtk_GtkApplication_QUERY_NO_DISPLAY;
-    }
-    XCloseDisplay(display);
+    // The DISPLAY is validated by gtk_init_check() in _initGTK, which saves
+    // opening a throwaway X connection here on every startup
 
-    // now check the the presence of the libraries
+    // check the the presence of the libraries
 
     char version = sniffLibs(suggestedVersion);
     if (version == '3') {
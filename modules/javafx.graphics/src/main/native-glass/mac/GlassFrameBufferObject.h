@@ -42,6 +42,8 @@
 }
 
 - (void)blitFromFBO:(GlassFrameBufferObject*)other_fbo;
+- (BOOL)swapTextureWithFBO:(GlassFrameBufferObject*)other_fbo;
+- (void)attachTexture;
 - (GLuint)texture;
 - (GLuint)fbo;
 - (void)setIsSwPipe:(BOOL)isSwPipe;
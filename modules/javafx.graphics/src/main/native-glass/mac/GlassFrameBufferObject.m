@@ -324,6 +324,35 @@
     glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, self->_fboToRestore);
 }
 
+// Exchanges the color textures, and so the contents, of the two FBOs
+// instead of copying one into the other.  Only done when both have a
+// texture of the same size, returns NO otherwise.  Re-attaches our new
+// texture, the other FBO has to call attachTexture in its own context.
+- (BOOL)swapTextureWithFBO:(GlassFrameBufferObject*)other_fbo
+{
+    if ((self->_fbo == 0) || (self->_texture == 0) ||
+        (other_fbo->_fbo == 0) || (other_fbo->_texture == 0) ||
+        (self->_width != other_fbo->_width) || (self->_height != other_fbo->_height))
+    {
+        return NO;
+    }
+    GLuint texture = self->_texture;
+    self->_texture = other_fbo->_texture;
+    other_fbo->_texture = texture;
+    [self attachTexture];
+    return YES;
+}
+
+- (void)attachTexture
+{
+    [self _assertContext];
+    GLuint fboToRestore = 0; // default to screen
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING_EXT, (GLint*)&fboToRestore);
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, self->_fbo);
+    glFramebufferTexture2DEXT(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT, TARGET, self->_texture, 0);
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, fboToRestore);
+    LOG("           GlassFrameBufferObject attached Texture: %d to FBO: %d", self->_texture, self->_fbo);
+}
 
 - (GLuint)texture
 {
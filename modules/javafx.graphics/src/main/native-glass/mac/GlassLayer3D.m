@@ -159,7 +159,7 @@ static NSArray *allModes = nil;
 
 - (void)flush
 {
-    [(GlassOffscreen*)_glassOffscreen blitFromOffscreen:(GlassOffscreen*)_painterOffscreen];
+    [(GlassOffscreen*)_glassOffscreen presentFromOffscreen:(GlassOffscreen*)_painterOffscreen];
     if ([NSThread isMainThread]) {
         [[self->_glassOffscreen getLayer] setNeedsDisplay];
     } else {
@@ -76,5 +76,6 @@
 - (GLboolean)isDirty;
 
 - (void)blitFromOffscreen:(GlassOffscreen*) other_offscreen;
+- (void)presentFromOffscreen:(GlassOffscreen*) other_offscreen;
 
 @end
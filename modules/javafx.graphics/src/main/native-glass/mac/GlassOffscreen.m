@@ -209,4 +209,35 @@
     [self unsetContext];
 }
 
+// The painter's FBO is fully repainted every frame, so rather than copying
+// it we flip its texture with ours and the painter renders the next frame
+// into the texture that was shown last.  Falls back to the copy when the
+// two differ in size, e.g. on the first frame after a resize.
+- (void)presentFromOffscreen:(GlassOffscreen*) other_offscreen
+{
+    GlassFrameBufferObject *fbo = (GlassFrameBufferObject*)self->_offscreen;
+    GlassFrameBufferObject *otherFbo = (GlassFrameBufferObject*)other_offscreen->_offscreen;
+    BOOL swapped;
+
+    [other_offscreen setContext];
+    // make the painter's rendering visible to our context
+    glFlush();
+    [self setContext];
+    {
+        swapped = [fbo swapTextureWithFBO:otherFbo];
+        if (swapped) {
+            self->_dirty = GL_TRUE;
+        }
+    }
+    [self unsetContext];
+    if (swapped) {
+        [otherFbo attachTexture];
+    }
+    [other_offscreen unsetContext];
+
+    if (!swapped) {
+        [self blitFromOffscreen:other_offscreen];
+    }
+}
+
 @end
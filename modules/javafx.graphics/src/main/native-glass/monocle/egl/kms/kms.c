@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * DRM/KMS + GBM implementation of the functions declared in egl_ext.h.
+ *
+ * This is built as a separate shared library (linked with -ldrm -lgbm -lEGL)
+ * and selected with
+ *     -Dmonocle.platform=EGL -Dmonocle.egl.lib=<path to the library>
+ *     -Degl.displayid=/dev/dri/cardN
+ *
+ * The first connected connector is driven with its preferred mode. Rendering
+ * goes to a GBM surface; every swap locks the new front buffer and queues it
+ * with a page flip, then waits for the flip event, so presentation is tear
+ * free and the render loop is throttled to the display refresh. The mouse
+ * cursor uses the CRTC's hardware cursor.
+ */
+
+#include <EGL/egl.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include <gbm.h>
+
+#include "../egl_ext.h"
+
+#define KMS_CURSOR_SIZE 64
+/* com.sun.glass.ui.Pixels.Format.BYTE_BGRA_PRE */
+#define KMS_NATIVE_FORMAT 1
+
+typedef struct {
+    int fd;
+    uint32_t connectorId;
+    uint32_t crtcId;
+    drmModeModeInfo mode;
+    uint32_t mmWidth;
+
+    struct gbm_device *gbmDevice;
+    struct gbm_surface *gbmSurface;
+    struct gbm_bo *frontBo;
+    jboolean modeSet;
+
+    struct gbm_bo *cursorBo;
+    uint32_t cursorPixels[KMS_CURSOR_SIZE * KMS_CURSOR_SIZE];
+    jint cursorWidth, cursorHeight;
+    jboolean cursorVisible;
+} KMSState;
+
+static KMSState kms = { .fd = -1 };
+
+static jboolean findDisplay() {
+    drmModeRes *resources = drmModeGetResources(kms.fd);
+    drmModeConnector *connector = NULL;
+    int i;
+
+    if (resources == NULL) {
+        fprintf(stderr, "KMS: drmModeGetResources failed (%s)\n", strerror(errno));
+        return JNI_FALSE;
+    }
+    for (i = 0; i < resources->count_connectors; i++) {
+        connector = drmModeGetConnector(kms.fd, resources->connectors[i]);
+        if (connector != NULL && connector->connection == DRM_MODE_CONNECTED
+                && connector->count_modes > 0) {
+            break;
+        }
+        drmModeFreeConnector(connector);
+        connector = NULL;
+    }
+    if (connector == NULL) {
+        fprintf(stderr, "KMS: no connected display\n");
+        drmModeFreeResources(resources);
+        return JNI_FALSE;
+    }
+
+    kms.connectorId = connector->connector_id;
+    kms.mmWidth = connector->mmWidth;
+    kms.mode = connector->modes[0];
+    for (i = 0; i < connector->count_modes; i++) {
+        if (connector->modes[i].type & DRM_MODE_TYPE_PREFERRED) {
+            kms.mode = connector->modes[i];
+            break;
+        }
+    }
+
+    // prefer the CRTC already driving the connector, otherwise take the
+    // first one that any of its encoders can use
+    kms.crtcId = 0;
+    if (connector->encoder_id != 0) {
+        drmModeEncoder *encoder = drmModeGetEncoder(kms.fd, connector->encoder_id);
+        if (encoder != NULL) {
+            kms.crtcId = encoder->crtc_id;
+            drmModeFreeEncoder(encoder);
+        }
+    }
+    for (i = 0; kms.crtcId == 0 && i < connector->count_encoders; i++) {
+        drmModeEncoder *encoder = drmModeGetEncoder(kms.fd, connector->encoders[i]);
+        int j;
+        if (encoder == NULL) {
+            continue;
+        }
+        for (j = 0; j < resources->count_crtcs; j++) {
+            if (encoder->possible_crtcs & (1 << j)) {
+                kms.crtcId = resources->crtcs[j];
+                break;
+            }
+        }
+        drmModeFreeEncoder(encoder);
+    }
+
+    drmModeFreeConnector(connector);
+    drmModeFreeResources(resources);
+    if (kms.crtcId == 0) {
+        fprintf(stderr, "KMS: no CRTC available for the display\n");
+        return JNI_FALSE;
+    }
+    return JNI_TRUE;
+}
+
+jlong getNativeWindowHandle(const char *v) {
+    if (kms.gbmSurface != NULL) {
+        return (jlong) (intptr_t) kms.gbmSurface;
+    }
+    kms.fd = open(v, O_RDWR | O_CLOEXEC);
+    if (kms.fd < 0) {
+        fprintf(stderr, "KMS: cannot open %s (%s)\n", v, strerror(errno));
+        return 0;
+    }
+    if (!findDisplay()) {
+        return 0;
+    }
+    kms.gbmDevice = gbm_create_device(kms.fd);
+    if (kms.gbmDevice == NULL) {
+        fprintf(stderr, "KMS: gbm_create_device failed\n");
+        return 0;
+    }
+    kms.gbmSurface = gbm_surface_create(kms.gbmDevice,
+            kms.mode.hdisplay, kms.mode.vdisplay, GBM_FORMAT_XRGB8888,
+            GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+    if (kms.gbmSurface == NULL) {
+        fprintf(stderr, "KMS: gbm_surface_create failed\n");
+        return 0;
+    }
+    return (jlong) (intptr_t) kms.gbmSurface;
+}
+
+jlong getEglDisplayHandle() {
+    return (jlong) (intptr_t) eglGetDisplay((EGLNativeDisplayType) kms.gbmDevice);
+}
+
+jboolean doEglInitialize(void *handle) {
+    EGLint major, minor;
+    return eglInitialize((EGLDisplay) handle, &major, &minor) ? JNI_TRUE : JNI_FALSE;
+}
+
+jboolean doEglBindApi(int api) {
+    return eglBindAPI((EGLenum) api) ? JNI_TRUE : JNI_FALSE;
+}
+
+jlong doEglChooseConfig(jlong eglDisplay, int *attribs) {
+    EGLDisplay display = (EGLDisplay) (intptr_t) eglDisplay;
+    EGLConfig *configs;
+    EGLint count = 0;
+    jlong answer = -1;
+    int i;
+
+    if (!eglChooseConfig(display, (EGLint *) attribs, NULL, 0, &count) || count <= 0) {
+        return -1;
+    }
+    configs = (EGLConfig *) malloc(count * sizeof (EGLConfig));
+    if (configs == NULL) {
+        return -1;
+    }
+    // the config must match the GBM surface format, or the window surface
+    // cannot be created
+    if (eglChooseConfig(display, (EGLint *) attribs, configs, count, &count)) {
+        for (i = 0; i < count; i++) {
+            EGLint visualId = 0;
+            if (eglGetConfigAttrib(display, configs[i], EGL_NATIVE_VISUAL_ID, &visualId)
+                    && visualId == GBM_FORMAT_XRGB8888) {
+                answer = (jlong) (intptr_t) configs[i];
+                break;
+            }
+        }
+    }
+    free(configs);
+    return answer;
+}
+
+jlong doEglCreateWindowSurface(jlong eglDisplay, jlong config,
+        jlong nativeWindow) {
+    return (jlong) (intptr_t) eglCreateWindowSurface(
+            (EGLDisplay) (intptr_t) eglDisplay, (EGLConfig) (intptr_t) config,
+            (EGLNativeWindowType) (intptr_t) nativeWindow, NULL);
+}
+
+jlong doEglCreateContext(jlong eglDisplay, jlong config) {
+    EGLint contextAttrs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+    return (jlong) (intptr_t) eglCreateContext(
+            (EGLDisplay) (intptr_t) eglDisplay, (EGLConfig) (intptr_t) config,
+            EGL_NO_CONTEXT, contextAttrs);
+}
+
+jboolean doEglMakeCurrent(jlong eglDisplay, jlong drawSurface,
+        jlong readSurface, jlong eglContext) {
+    return eglMakeCurrent((EGLDisplay) (intptr_t) eglDisplay,
+            (EGLSurface) (intptr_t) drawSurface,
+            (EGLSurface) (intptr_t) readSurface,
+            (EGLContext) (intptr_t) eglContext) ? JNI_TRUE : JNI_FALSE;
+}
+
+static void destroyFramebuffer(struct gbm_bo *bo, void *data) {
+    uint32_t fb = (uint32_t) (uintptr_t) data;
+    if (fb != 0) {
+        drmModeRmFB(kms.fd, fb);
+    }
+}
+
+/* GBM recycles its buffers, so the KMS framebuffer is created once per bo */
+static uint32_t getFramebuffer(struct gbm_bo *bo) {
+    uint32_t fb = (uint32_t) (uintptr_t) gbm_bo_get_user_data(bo);
+    if (fb == 0) {
+        if (drmModeAddFB(kms.fd, gbm_bo_get_width(bo), gbm_bo_get_height(bo),
+                24, 32, gbm_bo_get_stride(bo), gbm_bo_get_handle(bo).u32, &fb) != 0) {
+            fprintf(stderr, "KMS: drmModeAddFB failed (%s)\n", strerror(errno));
+            return 0;
+        }
+        gbm_bo_set_user_data(bo, (void *) (uintptr_t) fb, destroyFramebuffer);
+    }
+    return fb;
+}
+
+static void pageFlipHandler(int fd, unsigned int frame,
+        unsigned int sec, unsigned int usec, void *data) {
+    *((jboolean *) data) = JNI_FALSE;
+}
+
+static jboolean waitForPageFlip(jboolean *pending) {
+    drmEventContext evctx;
+    struct pollfd pfd;
+
+    memset(&evctx, 0, sizeof (evctx));
+    evctx.version = 2;
+    evctx.page_flip_handler = pageFlipHandler;
+    pfd.fd = kms.fd;
+    pfd.events = POLLIN;
+    while (*pending) {
+        pfd.revents = 0;
+        if (poll(&pfd, 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return JNI_FALSE;
+        }
+        if (drmHandleEvent(kms.fd, &evctx) != 0) {
+            return JNI_FALSE;
+        }
+    }
+    return JNI_TRUE;
+}
+
+jboolean doEglSwapBuffers(jlong eglDisplay, jlong eglSurface) {
+    struct gbm_bo *bo;
+    uint32_t fb;
+    jboolean pending = JNI_TRUE;
+
+    if (!eglSwapBuffers((EGLDisplay) (intptr_t) eglDisplay,
+            (EGLSurface) (intptr_t) eglSurface)) {
+        return JNI_FALSE;
+    }
+    bo = gbm_surface_lock_front_buffer(kms.gbmSurface);
+    if (bo == NULL) {
+        return JNI_FALSE;
+    }
+    fb = getFramebuffer(bo);
+    if (fb == 0) {
+        gbm_surface_release_buffer(kms.gbmSurface, bo);
+        return JNI_FALSE;
+    }
+
+    if (!kms.modeSet) {
+        if (drmModeSetCrtc(kms.fd, kms.crtcId, fb, 0, 0,
+                &kms.connectorId, 1, &kms.mode) != 0) {
+            fprintf(stderr, "KMS: drmModeSetCrtc failed (%s)\n", strerror(errno));
+            gbm_surface_release_buffer(kms.gbmSurface, bo);
+            return JNI_FALSE;
+        }
+        kms.modeSet = JNI_TRUE;
+    } else {
+        if (drmModePageFlip(kms.fd, kms.crtcId, fb,
+                DRM_MODE_PAGE_FLIP_EVENT, &pending) != 0
+                || !waitForPageFlip(&pending)) {
+            gbm_surface_release_buffer(kms.gbmSurface, bo);
+            return JNI_FALSE;
+        }
+    }
+
+    // the previous front buffer is no longer scanned out
+    if (kms.frontBo != NULL) {
+        gbm_surface_release_buffer(kms.gbmSurface, kms.frontBo);
+    }
+    kms.frontBo = bo;
+    return JNI_TRUE;
+}
+
+jint doGetNumberOfScreens() {
+    return 1;
+}
+
+jlong doGetHandle(jint idx) {
+    return (jlong) kms.crtcId;
+}
+
+jint doGetDepth(jint idx) {
+    return 32;
+}
+
+jint doGetWidth(jint idx) {
+    return kms.mode.hdisplay;
+}
+
+jint doGetHeight(jint idx) {
+    return kms.mode.vdisplay;
+}
+
+jint doGetOffsetX(jint idx) {
+    return 0;
+}
+
+jint doGetOffsetY(jint idx) {
+    return 0;
+}
+
+jint doGetDpi(jint idx) {
+    if (kms.mmWidth == 0) {
+        return 96;
+    }
+    return (jint) (kms.mode.hdisplay * 25.4f / kms.mmWidth + 0.5f);
+}
+
+jint doGetNativeFormat(jint idx) {
+    return KMS_NATIVE_FORMAT;
+}
+
+jfloat doGetScale(jint idx) {
+    return 1.0f;
+}
+
+static void updateCursor() {
+    if (kms.cursorBo == NULL) {
+        return;
+    }
+    if (kms.cursorVisible) {
+        drmModeSetCursor(kms.fd, kms.crtcId, gbm_bo_get_handle(kms.cursorBo).u32,
+                KMS_CURSOR_SIZE, KMS_CURSOR_SIZE);
+    } else {
+        drmModeSetCursor(kms.fd, kms.crtcId, 0, 0, 0);
+    }
+}
+
+void doInitCursor(jint width, jint height) {
+    if (kms.gbmDevice == NULL || kms.cursorBo != NULL) {
+        return;
+    }
+    kms.cursorWidth = width < KMS_CURSOR_SIZE ? width : KMS_CURSOR_SIZE;
+    kms.cursorHeight = height < KMS_CURSOR_SIZE ? height : KMS_CURSOR_SIZE;
+    kms.cursorBo = gbm_bo_create(kms.gbmDevice, KMS_CURSOR_SIZE, KMS_CURSOR_SIZE,
+            GBM_FORMAT_ARGB8888, GBM_BO_USE_CURSOR | GBM_BO_USE_WRITE);
+    if (kms.cursorBo == NULL) {
+        fprintf(stderr, "KMS: cannot create a hardware cursor\n");
+    }
+}
+
+void doSetCursorVisibility(jboolean val) {
+    kms.cursorVisible = val;
+    updateCursor();
+}
+
+void doSetLocation(jint x, jint y) {
+    if (kms.cursorBo != NULL) {
+        drmModeMoveCursor(kms.fd, kms.crtcId, x, y);
+    }
+}
+
+void doSetCursorImage(jbyte *img, int length) {
+    int row;
+    int rowBytes = kms.cursorWidth * 4;
+
+    if (kms.cursorBo == NULL) {
+        return;
+    }
+    // the image is cursorWidth x cursorHeight BGRA_PRE, which matches
+    // GBM_FORMAT_ARGB8888 in memory; pad it to the hardware cursor size
+    memset(kms.cursorPixels, 0, sizeof (kms.cursorPixels));
+    for (row = 0; row < kms.cursorHeight && (row + 1) * rowBytes <= length; row++) {
+        memcpy(&kms.cursorPixels[row * KMS_CURSOR_SIZE], img + row * rowBytes, rowBytes);
+    }
+    gbm_bo_write(kms.cursorBo, kms.cursorPixels, sizeof (kms.cursorPixels));
+    updateCursor();
+}
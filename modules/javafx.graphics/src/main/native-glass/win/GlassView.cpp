@@ -407,6 +407,46 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1end
 {
 }
 
+static void UploadPixels(GlassView * view, jobject jPixels, const RECT * dirty)
+{
+    HWND hWnd = view->GetHostHwnd();
+    if (!::IsWindow(hWnd)) {
+        //NOTE: uploadPixels() may be invoked from a thread other than the
+        //      toolkit thread. Therefore, when SendMessage() is finally
+        //      processed, the hWnd may be stale already, and hence
+        //      the pWindow == NULL shouldn't be surprising.
+        return;
+    }
+
+    GlassWindow *pWindow = GlassWindow::FromHandle(hWnd);
+    Pixels pixels(GetEnv(), jPixels);
+
+    if (!pWindow || !pWindow->IsTransparent()) {
+        // Either a non-glass window (FullScreenWindow), or not transparent
+        BITMAPINFOHEADER bmi;
+
+        ZeroMemory(&bmi, sizeof(bmi));
+        bmi.biSize = sizeof(bmi);
+        bmi.biWidth = pixels.GetWidth();
+        bmi.biHeight = -pixels.GetHeight();
+        bmi.biPlanes = 1;
+        bmi.biBitCount = 32;
+        bmi.biCompression = BI_RGB;
+
+        HDC hdcDst = ::GetDC(hWnd);
+        ::SetDIBitsToDevice(
+                hdcDst,
+                0, 0, pixels.GetWidth(), pixels.GetHeight(),
+                0, 0,
+                0, pixels.GetHeight(),
+                pixels.GetBits(),
+                (BITMAPINFO*)&bmi, DIB_RGB_COLORS);
+        ::ReleaseDC(hWnd, hdcDst);
+    } else { // IsTransparent() == TRUE
+        pWindow->UpdateLayered(pixels, dirty);
+    }
+}
+
 /*
  * Class:     com_sun_glass_ui_win_WinView
  * Method:    _uploadPixels
@@ -417,78 +457,34 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
 {
     ENTER_MAIN_THREAD()
     {
-        HWND hWnd = view->GetHostHwnd();
-        if (!::IsWindow(hWnd)) {
-            //NOTE: uploadPixels() may be invoked from a thread other than the
-            //      toolkit thread. Therefore, when SendMessage() is finally
-            //      processed, the hWnd may be stale already, and hence
-            //      the pWindow == NULL shouldn't be surprising.
-            return;
-        }
+        UploadPixels(view, jPixels, NULL);
+    }
+    DECL_jobject(jPixels);
+    LEAVE_MAIN_THREAD_WITH_view;
 
-        GlassWindow *pWindow = GlassWindow::FromHandle(hWnd);
-        Pixels pixels(GetEnv(), jPixels);
-
-        if (!pWindow || !pWindow->IsTransparent()) {
-            // Either a non-glass window (FullScreenWindow), or not transparent
-            BITMAPINFOHEADER bmi;
-
-            ZeroMemory(&bmi, sizeof(bmi));
-            bmi.biSize = sizeof(bmi);
-            bmi.biWidth = pixels.GetWidth();
-            bmi.biHeight = -pixels.GetHeight();
-            bmi.biPlanes = 1;
-            bmi.biBitCount = 32;
-            bmi.biCompression = BI_RGB;
-
-            HDC hdcDst = ::GetDC(hWnd);
-            ::SetDIBitsToDevice(
-                    hdcDst,
-                    0, 0, pixels.GetWidth(), pixels.GetHeight(),
-                    0, 0,
-                    0, pixels.GetHeight(),
-                    pixels.GetBits(),
-                    (BITMAPINFO*)&bmi, DIB_RGB_COLORS);
-            ::ReleaseDC(hWnd, hdcDst);
-        } else { // IsTransparent() == TRUE
-            // http://msdn.microsoft.com/en-us/library/ms997507.aspx
-            RECT rect;
-            ::GetWindowRect(hWnd, &rect);
-            SIZE size = { rect.right - rect.left, rect.bottom - rect.top };
-
-            if (size.cx != pixels.GetWidth() || size.cy != pixels.GetHeight()) {
-                //XXX: should report a error? OTOH, we could proceed, but
-                //this will cause the window to resize to the size of the bitmap
-                return;
-            }
-
-            POINT ptSrc = { 0, 0 };
-            POINT ptDst = { rect.left, rect.top };
-
-            BLENDFUNCTION bf;
-            bf.SourceConstantAlpha = pWindow->GetAlpha();
-            bf.AlphaFormat = AC_SRC_ALPHA;
-            bf.BlendOp = AC_SRC_OVER;
-            bf.BlendFlags = 0;
-
-            DIBitmap bitmap(pixels);
-
-            HDC hdcDst = ::GetDC(NULL);
-            HDC hdcSrc = ::CreateCompatibleDC(NULL);
-            HBITMAP oldBitmap = (HBITMAP)::SelectObject(hdcSrc, bitmap);
-
-            ::UpdateLayeredWindow(hWnd, hdcDst, &ptDst, &size, hdcSrc, &ptSrc,
-                    RGB(0, 0, 0), &bf, ULW_ALPHA);
-
-            ::SelectObject(hdcSrc, oldBitmap);
-            ::DeleteDC(hdcSrc);
-            ::ReleaseDC(NULL, hdcDst);
-        }
+    ARG(jPixels) = jPixels;
+    PERFORM();
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinView
+ * Method:    _uploadPixelsDirty
+ * Signature: (JLcom/sun/glass/ui/Pixels;IIII)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixelsDirty
+    (JNIEnv *env, jobject jThis, jlong ptr, jobject jPixels,
+     jint x, jint y, jint width, jint height)
+{
+    ENTER_MAIN_THREAD()
+    {
+        UploadPixels(view, jPixels, &dirty);
     }
     DECL_jobject(jPixels);
+    RECT dirty;
     LEAVE_MAIN_THREAD_WITH_view;
 
     ARG(jPixels) = jPixels;
+    ::SetRect(&ARG(dirty), x, y, x + width, y + height);
     PERFORM();
 }
 
@@ -82,9 +82,12 @@ GlassWindow::GlassWindow(jobject jrefThis, bool isTransparent, bool isDecorated,
     m_beforeFullScreenStyle(0),
     m_beforeFullScreenExStyle(0),
     m_beforeFullScreenMenu(NULL),
-    m_hIcon(NULL)
+    m_hIcon(NULL),
+    m_layeredBitmap(NULL),
+    m_layeredBits(NULL)
 {
     m_grefThis = GetEnv()->NewGlobalRef(jrefThis);
+    m_layeredSize.cx = m_layeredSize.cy = 0;
     m_minSize.x = m_minSize.y = -1;   // "not set" value
     m_maxSize.x = m_maxSize.y = -1;   // "not set" value
     m_hMonitor = NULL;
@@ -106,6 +109,10 @@ GlassWindow::~GlassWindow()
         ::DestroyIcon(m_hIcon);
     }
 
+    if (m_layeredBitmap) {
+        ::DeleteObject(m_layeredBitmap);
+    }
+
     if (m_grefThis) {
         GetEnv()->DeleteGlobalRef(m_grefThis);
     }
@@ -115,6 +122,105 @@ GlassWindow::~GlassWindow()
     }
 }
 
+// Presents the pixels of a transparent window. The frame is kept in a DIB
+// section owned by the window, so that only the dirty area (if given) has to
+// be copied and recomposed; the rest of the DIB still holds the previous frame.
+void GlassWindow::UpdateLayered(Pixels & pixels, const RECT * dirty)
+{
+    // http://msdn.microsoft.com/en-us/library/ms997507.aspx
+    HWND hWnd = GetHWND();
+    RECT rect;
+    ::GetWindowRect(hWnd, &rect);
+    SIZE size = { rect.right - rect.left, rect.bottom - rect.top };
+
+    int const width = pixels.GetWidth();
+    int const height = pixels.GetHeight();
+    if (size.cx != width || size.cy != height) {
+        //XXX: should report a error? OTOH, we could proceed, but
+        //this will cause the window to resize to the size of the bitmap
+        return;
+    }
+
+    RECT update = { 0, 0, width, height };
+    if (!m_layeredBitmap || m_layeredSize.cx != width || m_layeredSize.cy != height) {
+        if (m_layeredBitmap) {
+            ::DeleteObject(m_layeredBitmap);
+            m_layeredBitmap = NULL;
+            m_layeredBits = NULL;
+        }
+
+        BITMAPINFOHEADER bmi = {0};
+        bmi.biSize = sizeof(bmi);
+        bmi.biWidth = width;
+        bmi.biHeight = -height;
+        bmi.biPlanes = 1;
+        bmi.biBitCount = 32;
+        bmi.biCompression = BI_RGB;
+        bmi.biSizeImage = width * height * 4;
+
+        m_layeredBitmap = ::CreateDIBSection(NULL, (BITMAPINFO *)&bmi,
+                DIB_RGB_COLORS, &m_layeredBits, NULL, 0);
+        if (!m_layeredBitmap || !m_layeredBits) {
+            if (m_layeredBitmap) {
+                ::DeleteObject(m_layeredBitmap);
+                m_layeredBitmap = NULL;
+            }
+            m_layeredBits = NULL;
+            return;
+        }
+        m_layeredSize = size;
+    } else if (dirty) {
+        RECT full = update;
+        if (!::IntersectRect(&update, dirty, &full)) {
+            return;
+        }
+    }
+
+    BYTE * const src = (BYTE *)pixels.GetBits();
+    BYTE * const dst = (BYTE *)m_layeredBits;
+    size_t const rowBytes = (size_t)(update.right - update.left) * 4;
+    for (LONG y = update.top; y < update.bottom; y++) {
+        size_t const offset = ((size_t)y * width + update.left) * 4;
+        memcpy(dst + offset, src + offset, rowBytes);
+    }
+
+    POINT ptSrc = { 0, 0 };
+    POINT ptDst = { rect.left, rect.top };
+
+    BLENDFUNCTION bf;
+    bf.SourceConstantAlpha = GetAlpha();
+    bf.AlphaFormat = AC_SRC_ALPHA;
+    bf.BlendOp = AC_SRC_OVER;
+    bf.BlendFlags = 0;
+
+    HDC hdcDst = ::GetDC(NULL);
+    HDC hdcSrc = ::CreateCompatibleDC(NULL);
+    HBITMAP oldBitmap = (HBITMAP)::SelectObject(hdcSrc, m_layeredBitmap);
+
+    UPDATELAYEREDWINDOWINFO info;
+    ZeroMemory(&info, sizeof(info));
+    info.cbSize = sizeof(info);
+    info.hdcDst = hdcDst;
+    info.pptDst = &ptDst;
+    info.psize = &size;
+    info.hdcSrc = hdcSrc;
+    info.pptSrc = &ptSrc;
+    info.crKey = RGB(0, 0, 0);
+    info.pblend = &bf;
+    info.dwFlags = ULW_ALPHA;
+    info.prcDirty = &update;
+
+    if (!::UpdateLayeredWindowIndirect(hWnd, &info)) {
+        // e.g. the first update of the window, which must cover all of it
+        info.prcDirty = NULL;
+        ::UpdateLayeredWindowIndirect(hWnd, &info);
+    }
+
+    ::SelectObject(hdcSrc, oldBitmap);
+    ::DeleteDC(hdcSrc);
+    ::ReleaseDC(NULL, hdcDst);
+}
+
 LPCTSTR GlassWindow::GetWindowClassNameSuffix()
 {
     return szGlassWindowClassName;
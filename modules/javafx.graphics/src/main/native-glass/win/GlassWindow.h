@@ -29,6 +29,8 @@
 #include "BaseWnd.h"
 #include "ViewContainer.h"
 
+class Pixels;
+
 
 class GlassWindow : public BaseWnd, public ViewContainer {
 public:
@@ -101,6 +103,8 @@ public:
     virtual void ExitFullScreenMode(BOOL animate);
 
     void SetIcon(HICON hIcon);
+
+    void UpdateLayered(Pixels & pixels, const RECT * dirty);
     void HandleWindowPosChangedEvent();
 
 protected:
@@ -153,6 +157,11 @@ private:
 
     HICON m_hIcon;
 
+    // Persistent DIB section holding the last frame of a transparent window
+    HBITMAP m_layeredBitmap;
+    void * m_layeredBits;
+    SIZE m_layeredSize;
+
     //NOTE: this is not a rectangle. The left, top, right, and bottom
     //components contain corresponding insets values.
     RECT m_insets;
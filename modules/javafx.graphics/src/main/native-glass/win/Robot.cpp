@@ -245,6 +245,7 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinRobot__1mouseWheel
 }
 
 void GetScreenCapture(jint x, jint y, jint width, jint height, jint *pixelData);
+void GetScreenBits(jint x, jint y, jint width, jint height, jint *pixelData);
 
 /*
  * Class:     com_sun_glass_ui_win_WinRobot
@@ -298,15 +299,37 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinRobot__1getScreenCapture
     jint * pixelData = (jint *)(new BYTE[pixelDataSize]);
 
     if (pixelData) {
-        GetScreenCapture(x, y, width, height, pixelData);
-
-        // copy pixels into Java array
-        env->SetIntArrayRegion(pixelArray, 0, numPixels, pixelData);
+        GetScreenBits(x, y, width, height, pixelData);
+
+        // convert to ARGB while copying into the Java array, rather than
+        // converting in place and copying in a second pass
+        jint *dst = (jint *)env->GetPrimitiveArrayCritical(pixelArray, NULL);
+        if (dst) {
+            for (int nPixel = 0; nPixel < numPixels; nPixel++) {
+                dst[nPixel] = pixelData[nPixel] | 0xFF000000;
+            }
+            env->ReleasePrimitiveArrayCritical(pixelArray, dst, 0);
+        }
         delete[] pixelData;
     }
 }
 
 void GetScreenCapture(jint x, jint y, jint width, jint height, jint *pixelData)
+{
+    GetScreenBits(x, y, width, height, pixelData);
+
+    // convert Win32 pixel format (BGRX) to Java format (ARGB)
+    ASSERT(sizeof(jint) == sizeof(RGBQUAD));
+    jint numPixels = width * height;
+    jint *pPixel = pixelData;
+    for(int nPixel = 0; nPixel < numPixels; nPixel++) {
+        RGBQUAD * prgbq = (RGBQUAD *) pPixel;
+        *pPixel++ = WinToJavaPixel(prgbq->rgbRed, prgbq->rgbGreen, prgbq->rgbBlue);
+    }
+}
+
+// Reads the screen area as 32-bit BGRX pixels, leaving the X byte undefined
+void GetScreenBits(jint x, jint y, jint width, jint height, jint *pixelData)
 {
     HDC hdcScreen = ::CreateDC(TEXT("DISPLAY"), NULL, NULL, NULL);
     HDC hdcMem = ::CreateCompatibleDC(hdcScreen);
@@ -364,15 +387,6 @@ void GetScreenCapture(jint x, jint y, jint width, jint height, jint *pixelData)
     // Get the bitmap data in device-independent, 32-bit packed pixel format
     ::GetDIBits(hdcMem, hbitmap, 0, height, pixelData, (BITMAPINFO *)&BitmapInfo, DIB_RGB_COLORS);
 
-    // convert Win32 pixel format (BGRX) to Java format (ARGB)
-    ASSERT(sizeof(jint) == sizeof(RGBQUAD));
-    jint numPixels = width * height;
-    jint *pPixel = pixelData;
-    for(int nPixel = 0; nPixel < numPixels; nPixel++) {
-        RGBQUAD * prgbq = (RGBQUAD *) pPixel;
-        *pPixel++ = WinToJavaPixel(prgbq->rgbRed, prgbq->rgbGreen, prgbq->rgbBlue);
-    }
-
     // free all the GDI objects we made
     ::SelectObject(hdcMem, hOldBitmap);
     if (hOldPalette != NULL) {
@@ -77,14 +77,218 @@ class RunnableTimer : public Timer {
         }
 };
 
+// Returns the DWM refresh period in QPC ticks, or 0 if it is not known
+static LONGLONG GetRefreshPeriod()
+{
+    DWM_TIMING_INFO info;
+    ::memset(&info, 0, sizeof(info));
+    info.cbSize = sizeof(info);
+    if (FAILED(::DwmGetCompositionTimingInfo(NULL, &info))) {
+        return 0;
+    }
+    return (LONGLONG)info.qpcRefreshPeriod;
+}
+
+/*
+ * Runs the runnable once per DWM composition pass on a dedicated thread.
+ * Stop() does not wait for the thread, because the runnable may itself call
+ * back into the synchronized Timer methods; the object is shared by the
+ * caller and the thread and freed by whichever lets go of it last.
+ */
+class VsyncTimer {
+    public:
+        static jlong Start(jobject r)
+        {
+            LONGLONG period = GetRefreshPeriod();
+            if (period <= 0) {
+                return 0;
+            }
+            VsyncTimer *timer = new (std::nothrow) VsyncTimer(r, period);
+            if (!timer) {
+                return 0;
+            }
+            if (!timer->start()) {
+                delete timer;
+                return 0;
+            }
+            return ptr_to_jlong(timer);
+        }
+
+        static void Stop(jlong timer)
+        {
+            VsyncTimer *t = (VsyncTimer*)jlong_to_ptr(timer);
+            t->stopped = true;
+            ::SetEvent(t->running);
+            t->Release();
+        }
+
+        static void Pause(jlong timer)
+        {
+            ::ResetEvent(((VsyncTimer*)jlong_to_ptr(timer))->running);
+        }
+
+        static void Resume(jlong timer)
+        {
+            ::SetEvent(((VsyncTimer*)jlong_to_ptr(timer))->running);
+        }
+
+    private:
+        JGlobalRef<jobject> runnable;
+        LONGLONG period;
+        HANDLE running;
+        volatile bool stopped;
+        volatile LONG refs;
+
+        VsyncTimer(jobject r, LONGLONG p) : runnable(r), period(p), stopped(false), refs(1)
+        {
+            running = ::CreateEvent(NULL, TRUE, TRUE, NULL);
+        }
+
+        ~VsyncTimer()
+        {
+            if (running) {
+                ::CloseHandle(running);
+            }
+        }
+
+        void Release()
+        {
+            if (::InterlockedDecrement(&refs) == 0) {
+                delete this;
+            }
+        }
+
+        bool start()
+        {
+            if (!running) {
+                return false;
+            }
+            ::InterlockedIncrement(&refs);
+            HANDLE thread = ::CreateThread(NULL, 0, StaticThreadProc, this, 0, NULL);
+            if (!thread) {
+                ::InterlockedDecrement(&refs);
+                return false;
+            }
+            ::CloseHandle(thread);
+            return true;
+        }
+
+        void WaitForVsync(LONGLONG last)
+        {
+            HRESULT hr = ::DwmFlush();
+
+            // DwmFlush() returns at once when composition is disabled, so
+            // sleep out the rest of the refresh period instead of spinning
+            LARGE_INTEGER now, freq;
+            ::QueryPerformanceCounter(&now);
+            LONGLONG elapsed = now.QuadPart - last;
+            if (FAILED(hr) || elapsed < period / 2) {
+                ::QueryPerformanceFrequency(&freq);
+                LONGLONG remaining = period - elapsed;
+                DWORD ms = remaining > 0 ? (DWORD)(remaining * 1000 / freq.QuadPart) : 0;
+                ::Sleep(max(ms, 1));
+            }
+        }
+
+        void Run()
+        {
+            JNIEnv *env = NULL;
+            GetJVM()->AttachCurrentThreadAsDaemon((void**)&env, NULL);
+
+            LARGE_INTEGER last;
+            ::QueryPerformanceCounter(&last);
+            while (!stopped) {
+                ::WaitForSingleObject(running, INFINITE);
+                if (stopped) {
+                    break;
+                }
+                WaitForVsync(last.QuadPart);
+                ::QueryPerformanceCounter(&last);
+                if (stopped) {
+                    break;
+                }
+                env->CallVoidMethod(runnable, javaIDs.Runnable.run);
+                CheckAndClearException(env);
+            }
+            Release();
+        }
+
+        static DWORD WINAPI StaticThreadProc(LPVOID param)
+        {
+            ((VsyncTimer*)param)->Run();
+            GetJVM()->DetachCurrentThread();
+            return 0;
+        }
+};
+
 extern "C" {
 
 /*
  * Class:     com_sun_glass_ui_win_WinTimer
- * Method:    _start
- * Signature: (I)J
+ * Method:    _startVsync
+ * Signature: (Ljava/lang/Runnable;)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_win_WinTimer__1startVsync
+  (JNIEnv * env, jobject jThis, jobject runnable)
+{
+    return VsyncTimer::Start(runnable);
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _stopVsync
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1stopVsync
+  (JNIEnv * env, jobject jThis, jlong timer)
+{
+    VsyncTimer::Stop(timer);
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _pauseVsync
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1pauseVsync
+  (JNIEnv * env, jobject jThis, jlong timer)
+{
+    VsyncTimer::Pause(timer);
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _resumeVsync
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1resumeVsync
+  (JNIEnv * env, jobject jThis, jlong timer)
+{
+    VsyncTimer::Resume(timer);
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _getVsyncPeriod
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_com_sun_glass_ui_win_WinTimer__1getVsyncPeriod
+  (JNIEnv * env, jclass cls)
+{
+    LARGE_INTEGER freq;
+    LONGLONG period = GetRefreshPeriod();
+    if (period <= 0 || !::QueryPerformanceFrequency(&freq)) {
+        return 0.0;
+    }
+    return (jdouble)period * 1000.0 / (jdouble)freq.QuadPart;
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _startPeriodic
+ * Signature: (Ljava/lang/Runnable;I)J
  */
-JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_win_WinTimer__1start
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_win_WinTimer__1startPeriodic
   (JNIEnv * env, jobject jThis, jobject runnable, jint period)
 {
     return RunnableTimer::Start(runnable, period);
@@ -92,10 +296,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_win_WinTimer__1start
 
 /*
  * Class:     com_sun_glass_ui_win_WinTimer
- * Method:    _stop
+ * Method:    _stopPeriodic
  * Signature: (J)V
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1stop
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1stopPeriodic
   (JNIEnv * env, jobject jThis, jlong timer)
 {
     RunnableTimer::Stop(timer);
@@ -168,10 +168,12 @@ typedef struct streamBufferStruct {
  * IJG library, with the comment "an efficiently freadable size", and 1K
  * in AWT.
  * Unlike in the other Java designs, these objects will persist, so 64K
- * seems too big and 1K seems too small.  If 4K was good enough for the
- * IJG folks, it's good enough for me.
+ * seems too big and 1K seems too small.  Each refill costs an upcall to
+ * InputStream.read and an unpin/pin of the buffer, though, which at 4K
+ * adds up to over a thousand round trips for a multi-megapixel photo, so
+ * use 32K.
  */
-#define STREAMBUF_SIZE 4096
+#define STREAMBUF_SIZE 32768
 
 /*
  * Used to signal that no data need be restored from an unpin to a pin.
@@ -1532,9 +1534,8 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
     struct jpeg_source_mgr *src = cinfo->src;
     sun_jpeg_error_ptr jerr;
 
-    jfloat x_scale;
-    jfloat y_scale;
-    jfloat max_scale;
+    unsigned int x_num;
+    unsigned int y_num;
 
     if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
         ThrowByName(env,
@@ -1570,26 +1571,31 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
      *
      *     Scale the image by the fraction scale_num/scale_denom.  Default is
      *     1/1, or no scaling.  Currently, the only supported scaling ratios
-     *     are 1/1, 1/2, 1/4, and 1/8.  (The library design allows for arbitrary
-     *     scaling ratios but this is not likely to be implemented any time soon.)
-     *     Smaller scaling ratios permit significantly faster decoding since
-     *     fewer pixels need be processed and a simpler IDCT method can be used.
+     *     are M/8 with all M from 1 to 16, or any reduced fraction thereof
+     *     (such as 1/2, 3/4, etc.)  Smaller scaling ratios permit significantly
+     *     faster decoding since fewer pixels need be processed and a simpler
+     *     IDCT method can be used.
+     *
+     * Pick the smallest M/8 that still yields at least the requested size,
+     * so the Java side only has to resample down by less than one eighth.
      */
 
-    cinfo->scale_num = 1;
-
-    x_scale = (jfloat) dest_width / (jfloat) cinfo->image_width;
-    y_scale = (jfloat) dest_height / (jfloat) cinfo->image_height;
-    max_scale = x_scale > y_scale ? x_scale : y_scale;
-
-    if (max_scale > 0.5) {
-        cinfo->scale_denom = 1;
-    } else if (max_scale > 0.25) {
-        cinfo->scale_denom = 2;
-    } else if (max_scale > 0.125) {
-        cinfo->scale_denom = 4;
-    } else {
-        cinfo->scale_denom = 8;
+    cinfo->scale_denom = 8;
+    cinfo->scale_num = 8;
+
+    if (dest_width > 0 && dest_height > 0
+            && cinfo->image_width > 0 && cinfo->image_height > 0) {
+        /* M = ceil(8 * dest / image) for each direction */
+        x_num = (unsigned int) (((unsigned long long) dest_width * 8
+                + cinfo->image_width - 1) / cinfo->image_width);
+        y_num = (unsigned int) (((unsigned long long) dest_height * 8
+                + cinfo->image_height - 1) / cinfo->image_height);
+        cinfo->scale_num = x_num > y_num ? x_num : y_num;
+        if (cinfo->scale_num < 1) {
+            cinfo->scale_num = 1;
+        } else if (cinfo->scale_num > 8) {
+            cinfo->scale_num = 8;
+        }
     }
 
     jpeg_start_decompress(cinfo);
@@ -100,6 +100,12 @@ typedef my_color_deconverter * my_cconvert_ptr;
 #define ONE_HALF    ((INT32) 1 << (SCALEBITS-1))
 #define FIX(x)        ((INT32) ((x) * (1L<<SCALEBITS) + 0.5))
 
+#if BITS_IN_JSAMPLE == 8 && RGB_PIXELSIZE == 3 && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define YCC_RGB_SSE2
+#include <emmintrin.h>
+#endif
+
 
 /*
  * Initialize tables for YCbCr->RGB and BG_YCC->RGB colorspace conversion.
@@ -228,6 +234,113 @@ ycc_rgb_convert (j_decompress_ptr cinfo,
 }
 
 
+#ifdef YCC_RGB_SSE2
+
+/*
+ * SSE2 version of ycc_rgb_convert for sYCC input, 8 pixels at a time.
+ * The table constants are split into an integer part, applied with adds
+ * and shifts, and a 16-bit fractional part for PMADDWD, so that every
+ * output sample is bit-for-bit the one the table lookup would produce.
+ */
+
+#define FIX_R_FRAC    ((short) (FIX(1.402) - 65536))
+#define FIX_B_FRAC    ((short) (FIX(1.772) - 2 * 65536))
+#define FIX_G_CB      ((short) (- FIX(0.344136286)))
+#define FIX_G_CR_FRAC ((short) (65536 - FIX(0.714136286)))
+
+METHODDEF(void)
+ycc_rgb_convert_sse2 (j_decompress_ptr cinfo,
+              JSAMPIMAGE input_buf, JDIMENSION input_row,
+              JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  register int y, cb, cr;
+  register JSAMPROW outptr;
+  register JSAMPROW inptr0, inptr1, inptr2;
+  register JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  register int * Crrtab = cconvert->Cr_r_tab;
+  register int * Cbbtab = cconvert->Cb_b_tab;
+  register INT32 * Crgtab = cconvert->Cr_g_tab;
+  register INT32 * Cbgtab = cconvert->Cb_g_tab;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i center = _mm_set1_epi16(CENTERJSAMPLE);
+  const __m128i kr = _mm_set_epi16(16384, FIX_R_FRAC, 16384, FIX_R_FRAC,
+                                   16384, FIX_R_FRAC, 16384, FIX_R_FRAC);
+  const __m128i kb = _mm_set_epi16(16384, FIX_B_FRAC, 16384, FIX_B_FRAC,
+                                   16384, FIX_B_FRAC, 16384, FIX_B_FRAC);
+  const __m128i kg = _mm_set_epi16(FIX_G_CR_FRAC, FIX_G_CB, FIX_G_CR_FRAC, FIX_G_CB,
+                                   FIX_G_CR_FRAC, FIX_G_CB, FIX_G_CR_FRAC, FIX_G_CB);
+  const __m128i two = _mm_set1_epi16(2);
+  const __m128i half = _mm_set1_epi32(ONE_HALF);
+  __m128i vy, vcb, vcr, lo, hi, vr, vg, vb, rg, bz;
+  JSAMPLE rgbx[32];
+  int i;
+  SHIFT_TEMPS
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col + 8 <= num_cols; col += 8) {
+      vy  = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (inptr0 + col)), zero);
+      vcb = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (inptr1 + col)), zero);
+      vcr = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (inptr2 + col)), zero);
+      vcb = _mm_sub_epi16(vcb, center);
+      vcr = _mm_sub_epi16(vcr, center);
+
+      /* R = Y + Cr + ((frac(1.402) * Cr + ONE_HALF) >> 16) */
+      lo = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vcr, two), kr), SCALEBITS);
+      hi = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vcr, two), kr), SCALEBITS);
+      vr = _mm_add_epi16(_mm_add_epi16(vy, vcr), _mm_packs_epi32(lo, hi));
+
+      /* B = Y + 2 * Cb + ((frac(1.772) * Cb + ONE_HALF) >> 16) */
+      lo = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vcb, two), kb), SCALEBITS);
+      hi = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vcb, two), kb), SCALEBITS);
+      vb = _mm_add_epi16(_mm_add_epi16(vy, _mm_add_epi16(vcb, vcb)), _mm_packs_epi32(lo, hi));
+
+      /* G = Y - Cr + ((-0.344136286 * Cb + frac(-0.714136286) * Cr + ONE_HALF) >> 16) */
+      lo = _mm_madd_epi16(_mm_unpacklo_epi16(vcb, vcr), kg);
+      hi = _mm_madd_epi16(_mm_unpackhi_epi16(vcb, vcr), kg);
+      lo = _mm_srai_epi32(_mm_add_epi32(lo, half), SCALEBITS);
+      hi = _mm_srai_epi32(_mm_add_epi32(hi, half), SCALEBITS);
+      vg = _mm_add_epi16(_mm_sub_epi16(vy, vcr), _mm_packs_epi32(lo, hi));
+
+      /* saturating packs do the range limiting */
+      vr = _mm_packus_epi16(vr, vr);
+      vg = _mm_packus_epi16(vg, vg);
+      vb = _mm_packus_epi16(vb, vb);
+      rg = _mm_unpacklo_epi8(vr, vg);
+      bz = _mm_unpacklo_epi8(vb, zero);
+      _mm_storeu_si128((__m128i *) rgbx, _mm_unpacklo_epi16(rg, bz));
+      _mm_storeu_si128((__m128i *) (rgbx + 16), _mm_unpackhi_epi16(rg, bz));
+      for (i = 0; i < 8; i++) {
+        outptr[RGB_RED]   = rgbx[i * 4];
+        outptr[RGB_GREEN] = rgbx[i * 4 + 1];
+        outptr[RGB_BLUE]  = rgbx[i * 4 + 2];
+        outptr += RGB_PIXELSIZE;
+      }
+    }
+    for (; col < num_cols; col++) {
+      y  = GETJSAMPLE(inptr0[col]);
+      cb = GETJSAMPLE(inptr1[col]);
+      cr = GETJSAMPLE(inptr2[col]);
+      outptr[RGB_RED]   = range_limit[y + Crrtab[cr]];
+      outptr[RGB_GREEN] = range_limit[y +
+                  ((int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr],
+                         SCALEBITS))];
+      outptr[RGB_BLUE]  = range_limit[y + Cbbtab[cb]];
+      outptr += RGB_PIXELSIZE;
+    }
+  }
+}
+
+#endif /* YCC_RGB_SSE2 */
+
+
 /**************** Cases other than YCC -> RGB ****************/
 
 
@@ -798,7 +911,11 @@ jinit_color_deconverter (j_decompress_ptr cinfo)
       cconvert->pub.color_convert = gray_rgb_convert;
       break;
     case JCS_YCbCr:
+#ifdef YCC_RGB_SSE2
+      cconvert->pub.color_convert = ycc_rgb_convert_sse2;
+#else
       cconvert->pub.color_convert = ycc_rgb_convert;
+#endif
       build_ycc_rgb_table(cinfo);
       break;
     case JCS_BG_YCC:
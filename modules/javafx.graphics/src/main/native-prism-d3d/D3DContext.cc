@@ -102,6 +102,13 @@ D3DContext::D3DContext(IDirect3D9Ex *pd3d9, UINT adapter)
     ZeroMemory(&devCaps, sizeof(D3DCAPS9));
     ZeroMemory(&curParams, sizeof(curParams));
     ZeroMemory(textureCache, sizeof(textureCache));
+    ZeroMemory(textureCacheNext, sizeof(textureCacheNext));
+#if defined PERF_COUNTERS
+    ZeroMemory(gpuTimers, sizeof(gpuTimers));
+    gpuTimerNext = 0;
+    bGpuFramePending = FALSE;
+    bGpuTimersUnsupported = FALSE;
+#endif
 }
 
 /**
@@ -131,6 +138,9 @@ void D3DContext::ReleaseContextResources(int releaseType)
     }
 
     EndScene();
+#if defined PERF_COUNTERS
+    ReleaseGpuTimers();
+#endif
 
     if (releaseType == RELEASE_DEFAULT) {
         if (pVertexBufferRes != NULL && pVertexBufferRes->IsDefaultPool()) {
@@ -157,8 +167,10 @@ int D3DContext::release() {
                 pd3dDevice, pd3dObject);
     ReleaseContextResources(RELEASE_ALL);
     for (int i = 0; i < NUM_TEXTURE_CACHE; i++) {
-        SAFE_RELEASE(textureCache[i].surface);
-        SAFE_RELEASE(textureCache[i].texture);
+        for (int j = 0; j <= TEXTURE_CACHE_RING; j++) {
+            SAFE_RELEASE(textureCache[i][j].surface);
+            SAFE_RELEASE(textureCache[i][j].texture);
+        }
     }
     SAFE_RELEASE(pd3dDevice);
 
@@ -287,6 +299,40 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nBuildNativeGeometr
     return result;
 }
 
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nUpdateNativeVertexBuffer
+ * Signature: (JJ[FII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nUpdateNativeVertexBuffer
+  (JNIEnv *env, jclass, jlong ctx, jlong nativeMesh, jfloatArray vb, jint vbOffset, jint vbLength)
+{
+    TraceLn(NWT_TRACE_INFO, "D3DContext_nUpdateNativeVertexBuffer");
+    D3DMesh *mesh = (D3DMesh *) jlong_to_ptr(nativeMesh);
+    RETURN_STATUS_IF_NULL(mesh, JNI_FALSE);
+
+    if (vbOffset < 0 || vbLength < 0) {
+        return JNI_FALSE;
+    }
+
+    UINT uvbOffset = (UINT) vbOffset;
+    UINT uvbLength = (UINT) vbLength;
+    UINT vertexBufferSize = env->GetArrayLength(vb);
+    if (uvbOffset + uvbLength > vertexBufferSize) {
+        return JNI_FALSE;
+    }
+
+    float *vertexBuffer = (float *) (env->GetPrimitiveArrayCritical(vb, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    boolean result = mesh->updateVertexBuffer(vertexBuffer, uvbOffset, uvbLength);
+    env->ReleasePrimitiveArrayCritical(vb, vertexBuffer, JNI_ABORT);
+
+    return result;
+}
+
 /*
  * Class:     com_sun_prism_d3d_D3DContext
  * Method:    nCreateD3DPhongMaterial
@@ -561,6 +607,8 @@ HRESULT D3DContext::setDeviceParametersFor2D() {
     HRESULT res = S_OK;
 
     IDirect3DVertexBuffer9 *vb = pVertexBufferRes->GetVertexBuffer();
+    state.resetMeshState();
+    state.invalidate2DState();
 
     SUCCEEDED(res = pd3dDevice->SetVertexDeclaration(pVertexDecl)) &&
     SUCCEEDED(res = pd3dDevice->SetIndices(pIndices)) &&
@@ -605,6 +653,8 @@ HRESULT D3DContext::setDeviceParametersFor3D() {
     // Reset 3D states
     state.wireframe = false;
     state.cullMode = D3DCULL_NONE;
+    state.resetMeshState();
+    state.invalidate2DState();
     if (res == S_OK) {
         SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE)) &&
         SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID)) &&
@@ -681,6 +731,8 @@ HRESULT D3DContext::InitDevice(IDirect3DDevice9Ex *pd3dDevice)
     pd3dDevice->SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID);
     state.wireframe = false;
     state.cullMode = D3DCULL_NONE;
+    state.resetMeshState();
+    state.invalidate2DState();
 
     if (pResourceMgr == NULL) {
         pResourceMgr = D3DResourceManager::CreateInstance(this);
@@ -720,6 +772,12 @@ HRESULT D3DContext::InitDevice(IDirect3DDevice9Ex *pd3dDevice)
 //                                      0, sizeof(PRISM_VERTEX_2D));
 //    RETURN_STATUS_IF_FAILED(res);
 
+    // Creating every Phong pixel shader variant takes long enough to cause
+    // a visible hitch on the first 3D frame, so do it up front if asked to
+    if (phongShader == NULL && D3DPipelineManager::GetInstance()->IsPrewarmShaders()) {
+        phongShader = new D3DPhongShader(pd3dDevice);
+    }
+
     bBeginScenePending = FALSE;
 
     RlsTraceLn1(NWT_TRACE_INFO,
@@ -883,6 +941,18 @@ D3DContext::UpdateVertexShaderTX()
     wvp._14 += pixadjustx;
     wvp._24 += pixadjusty;
 
+    if (state.wvpValid && memcmp(&wvp, &state.wvp, sizeof(wvp)) == 0) {
+#if defined PERF_COUNTERS
+        stats.numRedundantStateChanges++;
+#endif
+        return S_OK;
+    }
+#if defined PERF_COUNTERS
+    stats.numStateChanges++;
+#endif
+    state.wvp = wvp;
+    state.wvpValid = TRUE;
+
 //    fprintf(stderr, "UpdateVertexShaderTX:\n");
 //    fprintf(stderr, "  %5f %5f %5f %5f\n", wvp._11, wvp._12, wvp._13, wvp._14);
 //    fprintf(stderr, "  %5f %5f %5f %5f\n", wvp._21, wvp._22, wvp._23, wvp._24);
@@ -926,6 +996,8 @@ D3DContext::SetRenderTarget(IDirect3DSurface9 *pSurface,
             }
 
             currentSurface = pSurface;
+            // SetRenderTarget resets the scissor rect to the new target
+            SetRect(&state.scissorRect, 0, 0, -1, -1);
         }
         SAFE_RELEASE(pCurrentTarget);
 
@@ -1078,6 +1150,8 @@ D3DContext::SetProjViewMatrix(BOOL depthTest,
     if (phongShader) {
         D3DUtils_MatrixTransposed(mat, projection);
         SUCCEEDED(res = pd3dDevice->SetVertexShaderConstantF(VSR_VIEWPROJMATRIX, (float*) mat.m, 4));
+        // the 2D WorldViewProj matrix shares these registers
+        state.wvpValid = FALSE;
     }
 
     return res;
@@ -1208,7 +1282,7 @@ D3DContext::SetRectClip(int x1, int y1, int x2, int y2)
     {
         TraceLn(NWT_TRACE_VERBOSE,
                    "  disabling clip (== render target dimensions)");
-        return pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
+        return SetScissorTestEnabled(FALSE);
     }
 
     // clip to the dimensions of the target surface, otherwise
@@ -1220,8 +1294,18 @@ D3DContext::SetRectClip(int x1, int y1, int x2, int y2)
     if (x1 > x2)                x2 = x1 = 0;
     if (y1 > y2)                y2 = y1 = 0;
     RECT newRect = { x1, y1, x2, y2 };
+    if (EqualRect(&newRect, &state.scissorRect)) {
+#if defined PERF_COUNTERS
+        stats.numRedundantStateChanges++;
+#endif
+        return SetScissorTestEnabled(TRUE);
+    }
     if (SUCCEEDED(res = pd3dDevice->SetScissorRect(&newRect))) {
-        res = pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, TRUE);
+#if defined PERF_COUNTERS
+        stats.numStateChanges++;
+#endif
+        state.scissorRect = newRect;
+        res = SetScissorTestEnabled(TRUE);
     } else {
         DebugPrintD3DError(res, "Error setting scissor rect");
         RlsTraceLn4(NWT_TRACE_ERROR,
@@ -1239,7 +1323,24 @@ D3DContext::ResetClip()
 
     RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
 
-    return pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
+    return SetScissorTestEnabled(FALSE);
+}
+
+HRESULT
+D3DContext::SetScissorTestEnabled(BOOL enable)
+{
+    if (state.scissorEnabled == enable) {
+#if defined PERF_COUNTERS
+        stats.numRedundantStateChanges++;
+#endif
+        return S_OK;
+    }
+#if defined PERF_COUNTERS
+    stats.numStateChanges++;
+#endif
+    HRESULT res = pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, enable);
+    state.scissorEnabled = SUCCEEDED(res) ? enable : -1;
+    return res;
 }
 
 HRESULT D3DContext::BeginScene()
@@ -1248,6 +1349,7 @@ HRESULT D3DContext::BeginScene()
 
     if (!bBeginScenePending) {
         bBeginScenePending = TRUE;
+        BeginGpuFrame();
         HRESULT res = pd3dDevice->BeginScene();
         TraceLn(NWT_TRACE_INFO, "D3DContext::BeginScene");
         return res;
@@ -1265,6 +1367,105 @@ HRESULT D3DContext::EndScene()
     return S_OK;
 }
 
+#if defined PERF_COUNTERS
+HRESULT D3DContext::CreateGpuTimer(GpuTimer *pTimer)
+{
+    HRESULT res;
+    if (FAILED(res = pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPDISJOINT, &pTimer->disjoint)) ||
+        FAILED(res = pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPFREQ, &pTimer->frequency)) ||
+        FAILED(res = pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMP, &pTimer->begin)) ||
+        FAILED(res = pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMP, &pTimer->end)))
+    {
+        SAFE_RELEASE(pTimer->disjoint);
+        SAFE_RELEASE(pTimer->frequency);
+        SAFE_RELEASE(pTimer->begin);
+        SAFE_RELEASE(pTimer->end);
+    }
+    return res;
+}
+
+void D3DContext::ResolveGpuTimers()
+{
+    for (int i = 0; i < GPU_TIMER_RING; i++) {
+        GpuTimer &t = gpuTimers[i];
+        if (!t.pending) {
+            continue;
+        }
+        BOOL disjoint;
+        UINT64 frequency, begin, end;
+        // no D3DGETDATA_FLUSH, a result that isn't ready yet is picked up
+        // on a later frame
+        if (t.disjoint->GetData(&disjoint, sizeof(disjoint), 0) != S_OK ||
+            t.frequency->GetData(&frequency, sizeof(frequency), 0) != S_OK ||
+            t.begin->GetData(&begin, sizeof(begin), 0) != S_OK ||
+            t.end->GetData(&end, sizeof(end), 0) != S_OK)
+        {
+            continue;
+        }
+        t.pending = FALSE;
+        // the timestamps are meaningless if the GPU clock changed meanwhile
+        if (!disjoint && frequency != 0 && end >= begin) {
+            stats.numGpuFrames++;
+            stats.gpuTimeMicros += (int)((end - begin) * 1000000 / frequency);
+        }
+    }
+}
+
+void D3DContext::ReleaseGpuTimers()
+{
+    for (int i = 0; i < GPU_TIMER_RING; i++) {
+        SAFE_RELEASE(gpuTimers[i].disjoint);
+        SAFE_RELEASE(gpuTimers[i].frequency);
+        SAFE_RELEASE(gpuTimers[i].begin);
+        SAFE_RELEASE(gpuTimers[i].end);
+        gpuTimers[i].pending = FALSE;
+    }
+    bGpuFramePending = FALSE;
+}
+#endif
+
+void D3DContext::BeginGpuFrame()
+{
+#if defined PERF_COUNTERS
+    if (bGpuFramePending || bGpuTimersUnsupported || pd3dDevice == NULL) {
+        return;
+    }
+    GpuTimer &t = gpuTimers[gpuTimerNext];
+    if (t.pending) {
+        // the GPU is more than GPU_TIMER_RING frames behind, this frame
+        // goes untimed rather than stalling on the oldest result
+        ResolveGpuTimers();
+        if (t.pending) {
+            return;
+        }
+    }
+    if (t.disjoint == NULL && FAILED(CreateGpuTimer(&t))) {
+        TraceLn(NWT_TRACE_WARNING, "D3DContext::BeginGpuFrame: timestamp queries not supported");
+        bGpuTimersUnsupported = TRUE;
+        return;
+    }
+    t.disjoint->Issue(D3DISSUE_BEGIN);
+    t.begin->Issue(D3DISSUE_END);
+    bGpuFramePending = TRUE;
+#endif
+}
+
+void D3DContext::EndGpuFrame()
+{
+#if defined PERF_COUNTERS
+    if (bGpuFramePending) {
+        GpuTimer &t = gpuTimers[gpuTimerNext];
+        t.end->Issue(D3DISSUE_END);
+        t.frequency->Issue(D3DISSUE_END);
+        t.disjoint->Issue(D3DISSUE_END);
+        t.pending = TRUE;
+        bGpuFramePending = FALSE;
+        gpuTimerNext = (gpuTimerNext + 1) % GPU_TIMER_RING;
+    }
+    ResolveGpuTimers();
+#endif
+}
+
 HRESULT D3DContext::InitContextCaps() {
     if (!IsPow2TexturesOnly()) {
         RlsTraceLn(NWT_TRACE_VERBOSE, "  CAPS_TEXNONPOW2");
@@ -1321,6 +1522,17 @@ IDirect3DTexture9 *D3DContext::getTextureCache(int formatIndex, D3DFORMAT format
     if (formatIndex < 0 || formatIndex >= NUM_TEXTURE_CACHE) {
         return createTexture(format, width, height, pSurface, pd3dDevice);
     }
-    TextureUpdateCache &cache = textureCache[formatIndex];
-    return cache.getTexture(format, width, height, pSurface, pd3dDevice);
+    if (width > TEXTURE_CACHE_RING_MAX_SIZE || height > TEXTURE_CACHE_RING_MAX_SIZE) {
+        TextureUpdateCache &cache = textureCache[formatIndex][0];
+        return cache.getTexture(format, width, height, pSurface, pd3dDevice);
+    }
+    // round small uploads up to a power of two bucket so that a slot is
+    // not re-created every time the upload size creeps up
+    int w = 64, h = 64;
+    while (w < width) w <<= 1;
+    while (h < height) h <<= 1;
+    int slot = textureCacheNext[formatIndex];
+    textureCacheNext[formatIndex] = (slot + 1) % TEXTURE_CACHE_RING;
+    TextureUpdateCache &cache = textureCache[formatIndex][slot + 1];
+    return cache.getTexture(format, w, h, pSurface, pd3dDevice);
 }
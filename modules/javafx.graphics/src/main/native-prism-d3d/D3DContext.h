@@ -36,6 +36,12 @@
 //see com.sun.prism.PixelFormat enum
 #define NUM_TEXTURE_CACHE 8
 
+// small uploads rotate through this many staging textures per format so
+// that locking one doesn't wait on the UpdateSurface of the previous upload
+#define TEXTURE_CACHE_RING 4
+// uploads up to this size use the ring, larger ones share a single texture
+#define TEXTURE_CACHE_RING_MAX_SIZE 512
+
 // allow for 256 quads to match the size of the D3DVertexBuffer's nio buffer
 
 #define MAX_BATCH_QUADS 256
@@ -65,6 +71,11 @@ const D3DVERTEXELEMENT9 PrismVDecl[5] = {
 #define RELEASE_ALL (0)
 #define RELEASE_DEFAULT (1)
 
+#if defined PERF_COUNTERS
+// number of frames whose GPU timestamp queries may be in flight at once
+#define GPU_TIMER_RING 4
+#endif
+
 class D3DResource;
 class D3DVertexBufferResource;
 class D3DResourceManager;
@@ -160,6 +171,7 @@ public:
     // clipping-related methods
     HRESULT SetRectClip(int x1, int y1, int x2, int y2);
     HRESULT ResetClip();
+    HRESULT SetScissorTestEnabled(BOOL enable);
 
     BOOL IsPow2TexturesOnly()
         { return devCaps.TextureCaps & D3DPTEXTURECAPS_POW2; };
@@ -206,6 +218,11 @@ public:
         int numSetTexture;
         int numSetPixelShader;
         int numRenderTargetSwitch;
+        int numStateChanges;
+        int numRedundantStateChanges;
+        // GPU time of the frames whose timestamp queries have resolved
+        int numGpuFrames;
+        int gpuTimeMicros;
 
         void clear() {
             numTrianglesDrawn = 0;
@@ -216,12 +233,25 @@ public:
             numSetTexture = 0;
             numSetPixelShader = 0;
             numRenderTargetSwitch = 0;
+            numStateChanges = 0;
+            numRedundantStateChanges = 0;
+            numGpuFrames = 0;
+            gpuTimeMicros = 0;
         }
     } stats;
 
     FrameStats& getStats() { return stats; }
 #endif
 
+    /**
+     * Brackets the device work of one presented frame with GPU timestamp
+     * queries.  BeginGpuFrame is called by BeginScene, EndGpuFrame right
+     * before the swap chain is presented.  Results are read back without
+     * flushing a few frames later and added to the frame stats.
+     */
+    void BeginGpuFrame();
+    void EndGpuFrame();
+
     HMONITOR getAdapterMonitor() {
         return pd3dObject->GetAdapterMonitor(adapterOrdinal);
     }
@@ -233,6 +263,31 @@ public:
     struct State {
         bool wireframe;
         int cullMode;
+        // mesh state last set by D3DMeshView::render, so that consecutive
+        // mesh views sharing a mesh and material skip redundant device calls
+        bool phongVSSet;
+        IDirect3DVertexBuffer9 *vertexBuffer;
+        IDirect3DIndexBuffer9 *indexBuffer;
+        IDirect3DBaseTexture9 *maps[4];
+        void resetMeshState() {
+            phongVSSet = false;
+            vertexBuffer = NULL;
+            indexBuffer = NULL;
+            ZeroMemory(maps, sizeof(maps));
+        }
+        // shadow copies of the 2D blend, scissor and transform state,
+        // -1 or FALSE when the device state is unknown
+        int blendMode;
+        int scissorEnabled;
+        RECT scissorRect;
+        BOOL wvpValid;
+        D3DMATRIX wvp;
+        void invalidate2DState() {
+            blendMode = -1;
+            scissorEnabled = -1;
+            SetRect(&scissorRect, 0, 0, -1, -1);
+            wvpValid = FALSE;
+        }
     } state;
 
 private:
@@ -292,7 +347,26 @@ private:
         IDirect3DSurface9 *surface;
         int width, height;
         IDirect3DTexture9 *getTexture(D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface, IDirect3DDevice9Ex *dev);
-    } textureCache[NUM_TEXTURE_CACHE];
+    } textureCache[NUM_TEXTURE_CACHE][TEXTURE_CACHE_RING + 1];
+    // next ring slot to use for each format, slot 0 is for large uploads
+    int textureCacheNext[NUM_TEXTURE_CACHE];
+
+#if defined PERF_COUNTERS
+    struct GpuTimer {
+        IDirect3DQuery9 *disjoint;
+        IDirect3DQuery9 *frequency;
+        IDirect3DQuery9 *begin;
+        IDirect3DQuery9 *end;
+        BOOL pending;
+    } gpuTimers[GPU_TIMER_RING];
+    int gpuTimerNext;
+    BOOL bGpuFramePending;
+    BOOL bGpuTimersUnsupported;
+
+    HRESULT CreateGpuTimer(GpuTimer *pTimer);
+    void ResolveGpuTimers();
+    void ReleaseGpuTimers();
+#endif
 
 public:
     IDirect3DTexture9 *getTextureCache(int formatIndex, D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface);
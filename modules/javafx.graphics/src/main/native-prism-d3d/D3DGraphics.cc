@@ -32,6 +32,10 @@
 #include "com_sun_prism_d3d_D3DSwapChain.h"
 #include "com_sun_prism_d3d_D3DContext.h"
 
+#if defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#endif
+
 /*
  * Class:     com_sun_prism_d3d_D3DSwapChain
  * Method:    nPresent
@@ -50,9 +54,70 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DSwapChain_nPresent
     RETURN_STATUS_IF_NULL(pSwapChainRes, E_FAIL);
 
     pCtx->EndScene();
+    pCtx->EndGpuFrame();
+
+    IDirect3DSwapChain9 *pSwapChain = pSwapChainRes->GetSwapChain();
+    D3DPRESENT_PARAMETERS params;
+    if (SUCCEEDED(pSwapChain->GetPresentParameters(&params)) &&
+        params.SwapEffect == D3DSWAPEFFECT_FLIPEX)
+    {
+        // flip model swap chains don't accept source or dest rects
+        return pSwapChain->Present(0, 0, 0, 0, 0);
+    }
 
     RECT r = { 0, 0, pSwapChainRes->GetDesc()->Width, pSwapChainRes->GetDesc()->Height };
-    return pSwapChainRes->GetSwapChain()->Present(0, &r, 0, 0, 0);
+    return pSwapChain->Present(0, &r, 0, 0, 0);
+}
+
+// upper bound on how long nWaitForPresentQueue may block, so an occluded
+// or minimized window whose frames never reach the screen can't stall
+// the render thread
+#define MAX_PRESENT_WAIT_VBLANKS 4
+
+/*
+ * Class:     com_sun_prism_d3d_D3DSwapChain
+ * Method:    nWaitForPresentQueue
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DSwapChain_nWaitForPresentQueue
+  (JNIEnv *, jclass, jlong ctx, jlong swapChain)
+{
+    TraceLn(NWT_TRACE_INFO, "D3DSwapChain_nWaitForPresentQueue");
+
+    D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
+
+    RETURN_STATUS_IF_NULL(pCtx, E_FAIL);
+
+    D3DResource *pSwapChainRes = (D3DResource*)jlong_to_ptr(swapChain);
+
+    RETURN_STATUS_IF_NULL(pSwapChainRes, E_FAIL);
+
+    IDirect3DDevice9Ex *pd3dDevice = pCtx->Get3DDevice();
+
+    RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
+
+    IDirect3DSwapChain9Ex *pSwapChainEx = NULL;
+    HRESULT res = pSwapChainRes->GetSwapChain()->QueryInterface(
+            IID_IDirect3DSwapChain9Ex, (void**)&pSwapChainEx);
+    if (FAILED(res)) {
+        return res;
+    }
+
+    // present statistics are only available for FLIPEX swap chains, so
+    // COPY swap chains fall straight through here
+    for (int i = 0; i < MAX_PRESENT_WAIT_VBLANKS; i++) {
+        UINT lastPresentCount;
+        D3DPRESENTSTATS stats;
+        if (FAILED(res = pSwapChainEx->GetLastPresentCount(&lastPresentCount)) ||
+            FAILED(res = pSwapChainEx->GetPresentStats(&stats)) ||
+            stats.PresentCount >= lastPresentCount)
+        {
+            break;
+        }
+        pd3dDevice->WaitForVBlank(0);
+    }
+
+    pSwapChainEx->Release();
+    return res;
 }
 
 void setIntField(JNIEnv *env, jobject object, jclass clazz, const char *name, int value);
@@ -83,6 +148,10 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nGetFrameStats
     setIntField(env, pResultObject, pResultClass, "numSetTexture", st.numSetTexture);
     setIntField(env, pResultObject, pResultClass, "numSetPixelShader", st.numSetPixelShader);
     setIntField(env, pResultObject, pResultClass, "numRenderTargetSwitch", st.numRenderTargetSwitch);
+    setIntField(env, pResultObject, pResultClass, "numStateChanges", st.numStateChanges);
+    setIntField(env, pResultObject, pResultClass, "numRedundantStateChanges", st.numRedundantStateChanges);
+    setIntField(env, pResultObject, pResultClass, "numGpuFrames", st.numGpuFrames);
+    setIntField(env, pResultObject, pResultClass, "gpuTimeMicros", st.gpuTimeMicros);
 
     if (bReset) st.clear();
 
@@ -126,25 +195,51 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nDrawIndexedQuads
     return hr;
 }
 
+inline void copyVertex(PRISM_VERTEX_2D *pVert, PrismSourceVertex const *pSrc, DWORD color) {
+    pVert->x = pSrc->x;
+    pVert->y = pSrc->y;
+    pVert->z = pSrc->z;
+
+    pVert->color = color;
+
+    pVert->tu1 = pSrc->tu1;
+    pVert->tv1 = pSrc->tv1;
+
+    pVert->tu2 = pSrc->tu2;
+    pVert->tv2 = pSrc->tv2;
+}
+
 /*
  * Note: this method assumes that pVert, pSrcFloats and pSrcColors are not null
  */
 void fillVB(PRISM_VERTEX_2D *pVert, PrismSourceVertex const *pSrcFloats, BYTE const *pSrcColors, UINT numVerts) {
-    for (UINT i = 0; i < numVerts; i++) {
-
-        pVert->x = pSrcFloats->x;
-        pVert->y = pSrcFloats->y;
-        pVert->z = pSrcFloats->z;
+    UINT i = 0;
+
+#if defined(_M_X64) || defined(_M_IX86)
+    // Vertices always come in quads, so swizzle the RGBA source colors
+    // into D3DCOLOR (ARGB) four at a time by swapping bytes 0 and 2.
+    const __m128i maskAG = _mm_set1_epi32(0xFF00FF00);
+    const __m128i maskB0 = _mm_set1_epi32(0x000000FF);
+    for (; i + 4 <= numVerts; i += 4) {
+        __m128i c = _mm_loadu_si128((__m128i const *)pSrcColors);
+        c = _mm_or_si128(_mm_and_si128(c, maskAG),
+            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(c, 16), maskB0),
+                         _mm_slli_epi32(_mm_and_si128(c, maskB0), 16)));
+        DWORD colors[4];
+        _mm_storeu_si128((__m128i *)colors, c);
+
+        copyVertex(pVert++, pSrcFloats++, colors[0]);
+        copyVertex(pVert++, pSrcFloats++, colors[1]);
+        copyVertex(pVert++, pSrcFloats++, colors[2]);
+        copyVertex(pVert++, pSrcFloats++, colors[3]);
+        pSrcColors += 16;
+    }
+#endif
 
-        pVert->color =
+    for (; i < numVerts; i++) {
+        copyVertex(pVert, pSrcFloats,
             (pSrcColors[3]<<24) + (pSrcColors[0]<<16) +
-            (pSrcColors[1]<<8 ) +  pSrcColors[2];
-
-        pVert->tu1 = pSrcFloats->tu1;
-        pVert->tv1 = pSrcFloats->tv1;
-
-        pVert->tu2 = pSrcFloats->tu2;
-        pVert->tv2 = pSrcFloats->tv2;
+            (pSrcColors[1]<<8 ) +  pSrcColors[2]);
 
         pSrcFloats++;
         pSrcColors+=4;
@@ -268,6 +363,14 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetBlendEnabled
     IDirect3DDevice9Ex *pd3dDevice = pCtx->Get3DDevice();
     RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
 
+    D3DContext::State &state = pCtx->state;
+    if (state.blendMode == d3dmode) {
+#if defined PERF_COUNTERS
+        pCtx->getStats().numRedundantStateChanges++;
+#endif
+        return S_OK;
+    }
+
     HRESULT res;
     D3DBLEND srcBlend, dstBlend;
     BOOL enable = TRUE;
@@ -298,6 +401,10 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetBlendEnabled
         res = pd3dDevice->SetRenderState(D3DRS_SRCBLEND, srcBlend);
         res = pd3dDevice->SetRenderState(D3DRS_DESTBLEND, dstBlend);
     }
+#if defined PERF_COUNTERS
+    pCtx->getStats().numStateChanges++;
+#endif
+    state.blendMode = SUCCEEDED(res) ? d3dmode : -1;
 
     return res;
 }
@@ -351,6 +458,10 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetTexture
     IDirect3DTexture9 *pTex = pRes == NULL ? NULL : pRes->GetTexture();
     res = pd3dDevice->SetTexture(texUnit, pTex);
     RETURN_STATUS_IF_FAILED(res);
+    if (texUnit >= 0 && texUnit < 4) {
+        // keep the mesh texture cache in sync with the device
+        pCtx->state.maps[texUnit] = pTex;
+    }
 
     if (pTex != NULL) {
         D3DTEXTUREFILTERTYPE fhint = linear ? D3DTEXF_LINEAR : D3DTEXF_POINT;
@@ -196,6 +196,31 @@ boolean D3DMesh::buildBuffers(float *vb, UINT vbSize, UINT *ib, UINT ibSize) {
 
 }
 
+/*
+ * Copies vb[offset, offset + length) into the existing vertex buffer. Only
+ * the dirty range is locked, so an animated mesh does not rewrite (or
+ * recreate) the whole buffer every frame.
+ */
+boolean D3DMesh::updateVertexBuffer(float *vb, UINT offset, UINT length) {
+    if (vertexBuffer == NULL
+            || (offset + length) * sizeof (float) > numVertices * PRIMITIVE_VERTEX_SIZE) {
+        return false;
+    }
+    if (length == 0) {
+        return true;
+    }
+
+    UINT offsetBytes = offset * sizeof (float);
+    UINT size = length * sizeof (float);
+    float *data;
+    HRESULT result = vertexBuffer->Lock(offsetBytes, size, (void **) &data, 0);
+    if (SUCCEEDED(result)) {
+        memcpy_s(data, size, vb + offset, size);
+        result = vertexBuffer->Unlock();
+    }
+    return SUCCEEDED(result);
+}
+
 DWORD D3DMesh::getVertexFVF() {
     return fvf;
 }
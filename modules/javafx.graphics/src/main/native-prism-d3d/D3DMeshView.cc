@@ -113,6 +113,16 @@ inline void matrixTransposed(D3DMATRIX& r, const D3DMATRIX& a) {
     }
 }
 
+void D3DMeshView::setMap(IDirect3DDevice9Ex *device, int sampler, IDirect3DBaseTexture9 *map) {
+    // the device holds a reference to bound textures, so a cached pointer
+    // can't be reused by a different texture while it is still bound
+    IDirect3DBaseTexture9 *&current = context->state.maps[sampler];
+    if (current != map) {
+        current = map;
+        SUCCEEDED(device->SetTexture(sampler, map));
+    }
+}
+
 void D3DMeshView::render() {
     RETURN_IF_NULL(context);
     RETURN_IF_NULL(material);
@@ -121,19 +131,24 @@ void D3DMeshView::render() {
     IDirect3DDevice9Ex *device = context->Get3DDevice();
     RETURN_IF_NULL(device);
 
-    HRESULT status = SUCCEEDED(device->SetFVF(mesh->getVertexFVF()));
-    if (!status) {
-        cout << "D3DMeshView.render() - SetFVF failed !!!" << endl;
-        return;
-    }
-
     D3DPhongShader *pShader = context->getPhongShader();
     RETURN_IF_NULL(pShader);
 
-    status = SUCCEEDED(device->SetVertexShader(pShader->getVertexShader()));
-    if (!status) {
-        cout << "D3DMeshView.render() - SetVertexShader failed !!!" << endl;
-        return;
+    D3DContext::State &state = context->state;
+    HRESULT status;
+    if (!state.phongVSSet) {
+        status = SUCCEEDED(device->SetFVF(mesh->getVertexFVF()));
+        if (!status) {
+            cout << "D3DMeshView.render() - SetFVF failed !!!" << endl;
+            return;
+        }
+
+        status = SUCCEEDED(device->SetVertexShader(pShader->getVertexShader()));
+        if (!status) {
+            cout << "D3DMeshView.render() - SetVertexShader failed !!!" << endl;
+            return;
+        }
+        state.phongVSSet = true;
     }
 
     computeNumLights();
@@ -289,10 +304,10 @@ void D3DMeshView::render() {
         return;
     }
 
-    SUCCEEDED(device->SetTexture(SR_DIFFUSE_MAP, material->getMap(DIFFUSE)));
-    SUCCEEDED(device->SetTexture(SR_SPECULAR_MAP, material->getMap(SPECULAR)));
-    SUCCEEDED(device->SetTexture(SR_BUMPHEIGHT_MAP, material->getMap(BUMP)));
-    SUCCEEDED(device->SetTexture(SR_SELFILLUM_MAP, material->getMap(SELFILLUMINATION)));
+    setMap(device, SR_DIFFUSE_MAP, material->getMap(DIFFUSE));
+    setMap(device, SR_SPECULAR_MAP, material->getMap(SPECULAR));
+    setMap(device, SR_BUMPHEIGHT_MAP, material->getMap(BUMP));
+    setMap(device, SR_SELFILLUM_MAP, material->getMap(SELFILLUMINATION));
 
     if (context->state.cullMode != cullMode) {
         context->state.cullMode = cullMode;
@@ -304,8 +319,14 @@ void D3DMeshView::render() {
                 wireframe ? D3DFILL_WIREFRAME : D3DFILL_SOLID));
     }
 
-    SUCCEEDED(device->SetStreamSource(0, mesh->getVertexBuffer(), 0, PRIMITIVE_VERTEX_SIZE));
-    SUCCEEDED(device->SetIndices(mesh->getIndexBuffer()));
+    if (state.vertexBuffer != mesh->getVertexBuffer()) {
+        state.vertexBuffer = mesh->getVertexBuffer();
+        SUCCEEDED(device->SetStreamSource(0, state.vertexBuffer, 0, PRIMITIVE_VERTEX_SIZE));
+    }
+    if (state.indexBuffer != mesh->getIndexBuffer()) {
+        state.indexBuffer = mesh->getIndexBuffer();
+        SUCCEEDED(device->SetIndices(state.indexBuffer));
+    }
     SUCCEEDED(device->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0,
             mesh->getNumVertices(), 0, (mesh->getNumIndices()/3)));
 }
@@ -50,6 +50,8 @@ public:
     void render();
 
 private:
+    void setMap(IDirect3DDevice9Ex *device, int sampler, IDirect3DBaseTexture9 *map);
+
     D3DContext *context = NULL;
     D3DMesh *mesh = NULL;
     D3DPhongMaterial *material = NULL;
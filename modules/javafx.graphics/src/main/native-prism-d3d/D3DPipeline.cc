@@ -170,6 +170,19 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DPipeline_nGetAdapterOrdinal(JNI
     return pMgr->GetAdapterOrdinalByHmon(HMONITOR(hMonitor));
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DPipeline_nAdaptersUnchanged(JNIEnv *, jclass) {
+    D3DPipelineManager *pMgr = D3DPipelineManager::GetInstance();
+    return pMgr && pMgr->AdaptersUnchanged();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DPipeline_nReleaseContext(JNIEnv *, jclass, jint adapter) {
+    D3DPipelineManager *pMgr = D3DPipelineManager::GetInstance();
+    if (!pMgr) {
+        return E_FAIL;
+    }
+    return pMgr->ReleaseContext(adapter);
+}
+
 JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DPipeline_nGetAdapterCount(JNIEnv *, jclass) {
     D3DPipelineManager *pMgr = D3DPipelineManager::GetInstance();
     if (!pMgr) {
@@ -70,6 +70,7 @@ D3DPipelineManager::D3DPipelineManager(IConfig &cfg)
     pAdapters = NULL;
     adapterCount = 0;
     isVsyncEnabled = cfg.getBool("isVsyncEnabled");
+    prewarmShaders = cfg.getBool("prewarmShaders");
 
     devType = SelectDeviceType();
 
@@ -572,6 +573,53 @@ D3DPipelineManager::GetMatchingDepthStencilFormat(UINT adapterOrdinal,
     return newFormat;
 }
 
+bool D3DPipelineManager::AdaptersUnchanged()
+{
+    TraceLn(NWT_TRACE_INFO, "D3DPPLM::AdaptersUnchanged");
+
+    if (pd3d9 == NULL || pAdapters == NULL) {
+        return false;
+    }
+
+    // the adapter list of an IDirect3D9Ex object is fixed when it is
+    // created, so a fresh one is needed to see hot-plugged displays
+    IDirect3D9Ex *pd3d9New = Direct3DCreate9Ex();
+    if (pd3d9New == NULL) {
+        return false;
+    }
+
+    bool unchanged = pd3d9New->GetAdapterCount() == adapterCount;
+    for (UINT i = 0; unchanged && i < adapterCount; i++) {
+        LUID luid, luidNew;
+        unchanged =
+            SUCCEEDED(pd3d9->GetAdapterLUID(i, &luid)) &&
+            SUCCEEDED(pd3d9New->GetAdapterLUID(i, &luidNew)) &&
+            luid.LowPart == luidNew.LowPart &&
+            luid.HighPart == luidNew.HighPart &&
+            pd3d9->GetAdapterMonitor(i) == pd3d9New->GetAdapterMonitor(i);
+    }
+
+    SAFE_RELEASE(pd3d9New);
+    return unchanged;
+}
+
+HRESULT D3DPipelineManager::ReleaseContext(UINT adapterOrdinal)
+{
+    TraceLn1(NWT_TRACE_INFO, "D3DPPLM::ReleaseContext adapter=%d", adapterOrdinal);
+
+    if (adapterOrdinal >= adapterCount || pAdapters == NULL) {
+        return E_FAIL;
+    }
+
+    D3DAdapter &adapter = pAdapters[adapterOrdinal];
+    if (adapter.pd3dContext != NULL) {
+        adapter.pd3dContext->release();
+        adapter.pd3dContext = NULL;
+    }
+    adapter.state = CONTEXT_NOT_INITED;
+    return S_OK;
+}
+
 HRESULT D3DPipelineManager::GetD3DContext(UINT adapterOrdinal,
                                           D3DContext **ppd3dContext)
 {
@@ -81,12 +81,20 @@ public:
 
     LPDIRECT3D9EX GetD3DObject() { return pd3d9; }
     D3DDEVTYPE GetDeviceType() { return devType; }
+    bool IsPrewarmShaders() { return prewarmShaders; }
 
     // returns adapterOrdinal given a HMONITOR handle
     UINT GetAdapterOrdinalByHmon(HMONITOR hMon);
 
     UINT GetAdapterCount() const { return adapterCount; }
 
+    // returns true if the system still reports the same adapters, in the
+    // same order and on the same monitors, as when the pipeline was created
+    bool AdaptersUnchanged();
+    // releases the context of a single adapter so that it is re-created on
+    // the next GetD3DContext call, leaving the other adapters untouched
+    HRESULT ReleaseContext(UINT adapterOrdinal);
+
     // returns warning message if warning is true during driver check.
     static char const * GetErrorMessage();
     static void SetErrorMessage(char const *msg);
@@ -141,6 +149,7 @@ private:
     D3DAdapter *pAdapters;
 
     bool isVsyncEnabled;
+    bool prewarmShaders;
 
     // instance of this object
     static D3DPipelineManager* pMgr;
@@ -137,7 +137,8 @@ Java_com_sun_prism_d3d_D3DResourceFactory_nCreateTexture
  * Signature: (JJ)J
  */
 JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapChain
-  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled)
+  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled,
+   jboolean isFlipModelEnabled)
 {
     D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
     RETURN_STATUS_IF_NULL(pCtx, 0L);
@@ -150,16 +151,27 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapCha
 
     D3DResource *pSwapChainRes = NULL;
     HRESULT res = pCtx->GetResourceManager()->
-            CreateSwapChain(hWnd, 1,
+            CreateSwapChain(hWnd, isFlipModelEnabled ? 2 : 1,
             0, 0,
             // have to use COPY since we don't re-render the scene
-            // if it didn't change
-            D3DSWAPEFFECT_COPY,
+            // if it didn't change; FLIPEX is fine because D3DSwapChain
+            // always redraws the whole back buffer from its RTT
+            isFlipModelEnabled ? D3DSWAPEFFECT_FLIPEX : D3DSWAPEFFECT_COPY,
             isVsyncEnabled ?
             D3DPRESENT_INTERVAL_ONE :
             D3DPRESENT_INTERVAL_IMMEDIATE,
             &pSwapChainRes);
 
+    if (FAILED(res) && isFlipModelEnabled) {
+        // FLIPEX needs Windows 7 and a WDDM 1.1 driver, fall back to COPY
+        res = pCtx->GetResourceManager()->
+            CreateSwapChain(hWnd, 1, 0, 0, D3DSWAPEFFECT_COPY,
+            isVsyncEnabled ?
+            D3DPRESENT_INTERVAL_ONE :
+            D3DPRESENT_INTERVAL_IMMEDIATE,
+            &pSwapChainRes);
+    }
+
     if (SUCCEEDED(res)) {
         return ptr_to_jlong(pSwapChainRes);
     }
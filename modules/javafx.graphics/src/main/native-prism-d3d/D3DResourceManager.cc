@@ -564,6 +564,11 @@ D3DResourceManager::CreateSwapChain(HWND hWnd, UINT numBuffers,
 
     if (SUCCEEDED(res)) {
         TraceLn1(NWT_TRACE_VERBOSE,"  created swap chain: 0x%x ",pSwapChain);
+        if (swapEffect == D3DSWAPEFFECT_FLIPEX) {
+            // keep at most one frame queued so that Present blocks
+            // instead of letting input-to-display latency build up
+            pd3dDevice->SetMaximumFrameLatency(1);
+        }
         *ppSwapChainResource = new D3DResource(pSwapChain);
         res = AddResource(*ppSwapChainResource);
     } else {
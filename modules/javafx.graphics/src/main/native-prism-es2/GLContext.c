@@ -151,6 +151,7 @@ void initState(ContextInfo *ctxInfo) {
     ctxInfo->state.cullEnable = JNI_FALSE;
     ctxInfo->state.cullMode = GL_BACK;
     ctxInfo->state.fbo = 0;
+    ctxInfo->state.meshVertexBuffer = 0;
 }
 
 void clearBuffers(ContextInfo *ctxInfo,
@@ -607,6 +608,106 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
     return shaderProgram;
 }
 
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetProgramBinary
+ * Signature: (JI[I)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_sun_prism_es2_GLContext_nGetProgramBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint shaderProgram,
+        jintArray formatArr) {
+    GLint numFormats = 0;
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum format = 0;
+    jint jformat;
+    void *binary;
+    jbyteArray result = NULL;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (formatArr == NULL)
+            || (ctxInfo->glGetProgramBinary == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)) {
+        return NULL;
+    }
+
+    // a driver may export the entry point yet offer no binary formats
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    if (numFormats <= 0) {
+        return NULL;
+    }
+
+    ctxInfo->glGetProgramiv(shaderProgram, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return NULL;
+    }
+
+    binary = malloc(length);
+    if (binary == NULL) {
+        return NULL;
+    }
+    ctxInfo->glGetProgramBinary(shaderProgram, length, &written, &format, binary);
+    if (written > 0) {
+        result = (*env)->NewByteArray(env, written);
+        if (result != NULL) {
+            (*env)->SetByteArrayRegion(env, result, 0, written, (jbyte *) binary);
+            jformat = (jint) format;
+            (*env)->SetIntArrayRegion(env, formatArr, 0, 1, &jformat);
+        }
+    }
+    free(binary);
+    return result;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCreateProgramFromBinary
+ * Signature: (JI[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgramFromBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint format,
+        jbyteArray binaryArr) {
+    GLuint shaderProgram;
+    GLint success = GL_FALSE;
+    jsize length;
+    jbyte *binary;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (binaryArr == NULL)
+            || (ctxInfo->glCreateProgram == NULL)
+            || (ctxInfo->glProgramBinary == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glDeleteProgram == NULL)) {
+        return 0;
+    }
+
+    length = (*env)->GetArrayLength(env, binaryArr);
+    binary = (*env)->GetByteArrayElements(env, binaryArr, NULL);
+    if (binary == NULL) {
+        return 0;
+    }
+
+    shaderProgram = ctxInfo->glCreateProgram();
+    ctxInfo->glProgramBinary(shaderProgram, (GLenum) format, binary, (GLsizei) length);
+    (*env)->ReleaseByteArrayElements(env, binaryArr, binary, JNI_ABORT);
+
+    // A binary from a different driver build is rejected by the driver
+    // rather than being an error; the caller falls back to the sources.
+    ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (success == GL_FALSE) {
+        // clear any GL_INVALID_ENUM raised for an unknown binary format
+        glGetError();
+        ctxInfo->glDeleteProgram(shaderProgram);
+        return 0;
+    }
+    return shaderProgram;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCompileShader
@@ -1001,6 +1102,25 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nPixelStorei
     glPixelStorei((GLenum) translatePixelStore(pname), (GLint) value);
 }
 
+#ifndef GL_IMPLEMENTATION_COLOR_READ_TYPE
+#define GL_IMPLEMENTATION_COLOR_READ_TYPE 0x8B9A
+#endif
+#ifndef GL_IMPLEMENTATION_COLOR_READ_FORMAT
+#define GL_IMPLEMENTATION_COLOR_READ_FORMAT 0x8B9B
+#endif
+
+/*
+ * Swaps the R and B bytes of each RGBA pixel in place. Works on whole
+ * 32-bit pixels so that the compiler can vectorize the loop.
+ */
+static void swizzleRB(GLuint *pixels, jint count) {
+    jint i;
+    for (i = 0; i < count; i++) {
+        GLuint p = pixels[i];
+        pixels[i] = (p & 0xFF00FF00) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16);
+    }
+}
+
 jboolean doReadPixels(JNIEnv *env, jlong nativeCtxInfo, jint length, jobject buffer,
         jarray pixelArr, jint x, jint y, jint width, jint height) {
     GLvoid *ptr = NULL;
@@ -1037,17 +1157,18 @@ jboolean doReadPixels(JNIEnv *env, jlong nativeCtxInfo, jint length, jobject buf
         glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
                     GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, ptr);
     } else {
-        jint i;
-        GLubyte* c = (GLubyte*) ptr;
-        GLubyte temp;
-        glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
-                GL_RGBA, GL_UNSIGNED_BYTE, ptr);
-
-        for (i = 0; i < width * height; i++) {
-            temp = c[0];
-            c[0] = c[2];
-            c[2] = temp;
-            c += 4;
+        GLint readFormat = 0, readType = 0;
+        // GLES only guarantees RGBA reads, but most implementations also
+        // offer BGRA (EXT_read_format_bgra) which avoids the swizzle
+        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_FORMAT, &readFormat);
+        glGetIntegerv(GL_IMPLEMENTATION_COLOR_READ_TYPE, &readType);
+        if (readFormat == GL_BGRA && readType == GL_UNSIGNED_BYTE) {
+            glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
+                    GL_BGRA, GL_UNSIGNED_BYTE, ptr);
+        } else {
+            glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
+                    GL_RGBA, GL_UNSIGNED_BYTE, ptr);
+            swizzleRB((GLuint *) ptr, width * height);
         }
     }
 
@@ -1305,62 +1426,96 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDepthTest
 }
 
 /*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform1f
- * Signature: (JIF)V
+ * Command values of the queue built by GLContext.queueCommand, each
+ * followed by a location or program id and the command's values
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform1f
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location, jfloat v0) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if (ctxInfo == NULL) {
-        return;
-    }
-    ctxInfo->glUniform1f(location, v0);
+#define CMD_USE_PROGRAM 1
+#define CMD_UNIFORM1F   2
+#define CMD_UNIFORM2F   3
+#define CMD_UNIFORM3F   4
+#define CMD_UNIFORM4F   5
+#define CMD_UNIFORM1I   6
+#define CMD_UNIFORM2I   7
+#define CMD_UNIFORM3I   8
+#define CMD_UNIFORM4I   9
+
+static GLfloat intBitsToFloat(jint bits) {
+    union { jint i; GLfloat f; } u;
+    u.i = bits;
+    return u.f;
 }
 
 /*
  * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform2f
- * Signature: (JIFF)V
+ * Method:    nFlushCommands
+ * Signature: (J[II)V
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform2f
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
-        jfloat v0, jfloat v1) {
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nFlushCommands
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jintArray commands, jint length) {
+    jint *cmd, *end, *_ptr;
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if (ctxInfo == NULL) {
+    if ((ctxInfo == NULL) || (ctxInfo->glUseProgram == NULL)) {
         return;
     }
-    ctxInfo->glUniform2f(location, v0, v1);
-}
 
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform3f
- * Signature: (JIFFF)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform3f
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
-        jfloat v0, jfloat v1, jfloat v2) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if (ctxInfo == NULL) {
+    _ptr = (jint *) (*env)->GetPrimitiveArrayCritical(env, commands, NULL);
+    if (_ptr == NULL) {
+        fprintf(stderr, "nFlushCommands: GetPrimitiveArrayCritical returns NULL: out of memory\n");
         return;
     }
-    ctxInfo->glUniform3f(location, v0, v1, v2);
-}
 
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform4f
- * Signature: (JIFFFF)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4f
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
-        jfloat v0, jfloat v1, jfloat v2, jfloat v3) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if (ctxInfo == NULL) {
-        return;
+    cmd = _ptr;
+    end = _ptr + length;
+    while (cmd < end) {
+        switch (cmd[0]) {
+        case CMD_USE_PROGRAM:
+            ctxInfo->glUseProgram(cmd[1]);
+            cmd += 2;
+            break;
+        case CMD_UNIFORM1F:
+            ctxInfo->glUniform1f(cmd[1], intBitsToFloat(cmd[2]));
+            cmd += 3;
+            break;
+        case CMD_UNIFORM2F:
+            ctxInfo->glUniform2f(cmd[1], intBitsToFloat(cmd[2]),
+                    intBitsToFloat(cmd[3]));
+            cmd += 4;
+            break;
+        case CMD_UNIFORM3F:
+            ctxInfo->glUniform3f(cmd[1], intBitsToFloat(cmd[2]),
+                    intBitsToFloat(cmd[3]), intBitsToFloat(cmd[4]));
+            cmd += 5;
+            break;
+        case CMD_UNIFORM4F:
+            ctxInfo->glUniform4f(cmd[1], intBitsToFloat(cmd[2]),
+                    intBitsToFloat(cmd[3]), intBitsToFloat(cmd[4]),
+                    intBitsToFloat(cmd[5]));
+            cmd += 6;
+            break;
+        case CMD_UNIFORM1I:
+            ctxInfo->glUniform1i(cmd[1], cmd[2]);
+            cmd += 3;
+            break;
+        case CMD_UNIFORM2I:
+            ctxInfo->glUniform2i(cmd[1], cmd[2], cmd[3]);
+            cmd += 4;
+            break;
+        case CMD_UNIFORM3I:
+            ctxInfo->glUniform3i(cmd[1], cmd[2], cmd[3], cmd[4]);
+            cmd += 5;
+            break;
+        case CMD_UNIFORM4I:
+            ctxInfo->glUniform4i(cmd[1], cmd[2], cmd[3], cmd[4], cmd[5]);
+            cmd += 6;
+            break;
+        default:
+            fprintf(stderr, "nFlushCommands: unknown command %d\n", cmd[0]);
+            cmd = end;
+            break;
+        }
     }
-    ctxInfo->glUniform4f(location, v0, v1, v2, v3);
+
+    (*env)->ReleasePrimitiveArrayCritical(env, commands, _ptr, JNI_ABORT);
 }
 
 /*
@@ -1412,64 +1567,6 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4fv1
     }
 }
 
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform1i
- * Signature: (JII)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform1i
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location, jint v0) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if ((ctxInfo == NULL) || (ctxInfo->glUniform1i == NULL)) {
-        return;
-    }
-    ctxInfo->glUniform1i(location, v0);
-}
-
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform2i
- * Signature: (JIII)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform2i
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location, jint v0, jint v1) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if ((ctxInfo == NULL) || (ctxInfo->glUniform2i == NULL)) {
-        return;
-    }
-    ctxInfo->glUniform2i(location, v0, v1);
-}
-
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform3i
- * Signature: (JIIII)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform3i
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
-        jint v0, jint v1, jint v2) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if ((ctxInfo == NULL) || (ctxInfo->glUniform3i == NULL)) {
-        return;
-    }
-    ctxInfo->glUniform3i(location, v0, v1, v2);
-}
-
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUniform4i
- * Signature: (JIIIII)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniform4i
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint location,
-        jint v0, jint v1, jint v2, jint v3) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if ((ctxInfo == NULL) || (ctxInfo->glUniform4i == NULL)) {
-        return;
-    }
-    ctxInfo->glUniform4i(location, v0, v1, v2, v3);
-}
-
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nUniform4iv0
@@ -1573,20 +1670,6 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUpdateWrapState
             (GLenum) translatePrismToGL(wrapMode));
 }
 
-/*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nUseProgram
- * Signature: (JI)V
- */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUseProgram
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint pID) {
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if ((ctxInfo == NULL) || (ctxInfo->glUseProgram == NULL)) {
-        return;
-    }
-    ctxInfo->glUseProgram(pID);
-}
-
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nDisableVertexAttributes
@@ -1743,6 +1826,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor2
 
     ctxInfo->vbFloatData = NULL;
     ctxInfo->vbByteData = NULL;
+    ctxInfo->state.meshVertexBuffer = 0;
 
     glEnable(GL_BLEND);
     glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
@@ -1776,6 +1860,9 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor3
     }
     // Note: projViewTx and camPos are handled above in the Java layer
 
+    // vertex attributes were disabled by the Java layer
+    ctxInfo->state.meshVertexBuffer = 0;
+
     // This setting matches 2D ((1,1-alpha); premultiplied alpha case.
     // Will need to evaluate when support proper 3D blending (alpha,1-alpha).
     glEnable(GL_BLEND);
@@ -1824,6 +1911,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nCreateES2Mesh
     meshInfo->vboIDArray[MESH_INDEXBUFFER] = 0;
     meshInfo->indexBufferSize = 0;
     meshInfo->indexBufferType = 0;
+    meshInfo->vertexBufferSize = 0;
+    meshInfo->dynamicVertexBuffer = JNI_FALSE;
 
     /* create vbo ids */
     ctxInfo->glGenBuffers(MESH_MAX_BUFFERS, (meshInfo->vboIDArray));
@@ -1848,10 +1937,23 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nReleaseES2Mesh
 
     // TODO: 3D - Native clean up. Need to determine do we have to free what
     //            is held by ES2MeshInfo.
+    // the buffer names may be reused by the next mesh
+    ctxInfo->state.meshVertexBuffer = 0;
     ctxInfo->glDeleteBuffers(MESH_MAX_BUFFERS, (GLuint *) (meshInfo->vboIDArray));
     free(meshInfo);
 }
 
+/*
+ * A mesh that is rebuilt or updated after it was first built is likely to be
+ * animated, so its vertex buffer storage is respecified with GL_DYNAMIC_DRAW.
+ */
+static GLenum meshVertexBufferUsage(MeshInfo *meshInfo) {
+    if (meshInfo->vertexBufferSize != 0) {
+        meshInfo->dynamicVertexBuffer = JNI_TRUE;
+    }
+    return meshInfo->dynamicVertexBuffer ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nBuildNativeGeometryShort
@@ -1897,7 +1999,8 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
         // Initialize vertex buffer
         ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
         ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
+                vertexBuffer, meshVertexBufferUsage(meshInfo));
+        meshInfo->vertexBufferSize = uvbSize;
 
         // Initialize index buffer
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
@@ -1909,6 +2012,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
         // Unbind VBOs
         ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        ctxInfo->state.meshVertexBuffer = 0;
     }
 
     if (indexBuffer) {
@@ -1966,7 +2070,8 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
         // Initialize vertex buffer
         ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
         ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
+                vertexBuffer, meshVertexBufferUsage(meshInfo));
+        meshInfo->vertexBufferSize = uvbSize;
 
         // Initialize index buffer
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
@@ -1978,6 +2083,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
         // Unbind VBOs
         ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        ctxInfo->state.meshVertexBuffer = 0;
     }
 
     if (indexBuffer) {
@@ -1990,6 +2096,59 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     return status;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nUpdateNativeVertexBuffer
+ * Signature: (JJ[FII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nUpdateNativeVertexBuffer
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshInfo,
+        jfloatArray vbArray, jint vbOffset, jint vbLength)
+{
+    GLuint vertexBufferSize;
+    GLfloat *vertexBuffer;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshInfo *meshInfo = (MeshInfo *) jlong_to_ptr(nativeMeshInfo);
+    if ((ctxInfo == NULL) || (meshInfo == NULL) || (vbArray == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (meshInfo->vboIDArray[MESH_VERTEXBUFFER] == 0) ||
+            vbOffset < 0 || vbLength < 0) {
+        return JNI_FALSE;
+    }
+
+    vertexBufferSize = (*env)->GetArrayLength(env, vbArray);
+    if ((GLuint) vbOffset + (GLuint) vbLength > meshInfo->vertexBufferSize
+            || meshInfo->vertexBufferSize > vertexBufferSize) {
+        return JNI_FALSE;
+    }
+
+    vertexBuffer = (GLfloat *) ((*env)->GetPrimitiveArrayCritical(env, vbArray, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
+    if (!meshInfo->dynamicVertexBuffer) {
+        // First update of a static mesh: respecify the whole buffer once so
+        // the driver can place it in memory suited to frequent updates
+        meshInfo->dynamicVertexBuffer = JNI_TRUE;
+        ctxInfo->glBufferData(GL_ARRAY_BUFFER,
+                meshInfo->vertexBufferSize * sizeof (GLfloat),
+                vertexBuffer, GL_DYNAMIC_DRAW);
+    } else {
+        ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, vbOffset * sizeof (GLfloat),
+                vbLength * sizeof (GLfloat), vertexBuffer + vbOffset);
+    }
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+    ctxInfo->state.meshVertexBuffer = 0;
+
+    (*env)->ReleasePrimitiveArrayCritical(env, vbArray, vertexBuffer, JNI_ABORT);
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateES2PhongMaterial
@@ -2342,30 +2501,32 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
 
     // Draw triangles ...
     mInfo = mvInfo->meshInfo;
-    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, mInfo->vboIDArray[MESH_VERTEXBUFFER]);
-    ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mInfo->vboIDArray[MESH_INDEXBUFFER]);
-
-    ctxInfo->glEnableVertexAttribArray(VC_3D_INDEX);
-    ctxInfo->glEnableVertexAttribArray(TC_3D_INDEX);
-    ctxInfo->glEnableVertexAttribArray(NC_3D_INDEX);
-
-    ctxInfo->glVertexAttribPointer(VC_3D_INDEX, VC_3D_SIZE, GL_FLOAT, GL_FALSE,
-            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
-    offset += VC_3D_SIZE * sizeof(GLfloat);
-    ctxInfo->glVertexAttribPointer(TC_3D_INDEX, TC_3D_SIZE, GL_FLOAT, GL_FALSE,
-            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
-    offset += TC_3D_SIZE * sizeof(GLfloat);
-    ctxInfo->glVertexAttribPointer(NC_3D_INDEX, NC_3D_SIZE, GL_FLOAT, GL_FALSE,
-            VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+    if (ctxInfo->state.meshVertexBuffer != mInfo->vboIDArray[MESH_VERTEXBUFFER]) {
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, mInfo->vboIDArray[MESH_VERTEXBUFFER]);
+        ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mInfo->vboIDArray[MESH_INDEXBUFFER]);
+
+        if (ctxInfo->state.meshVertexBuffer == 0) {
+            ctxInfo->glEnableVertexAttribArray(VC_3D_INDEX);
+            ctxInfo->glEnableVertexAttribArray(TC_3D_INDEX);
+            ctxInfo->glEnableVertexAttribArray(NC_3D_INDEX);
+        }
+
+        ctxInfo->glVertexAttribPointer(VC_3D_INDEX, VC_3D_SIZE, GL_FLOAT, GL_FALSE,
+                VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+        offset += VC_3D_SIZE * sizeof(GLfloat);
+        ctxInfo->glVertexAttribPointer(TC_3D_INDEX, TC_3D_SIZE, GL_FLOAT, GL_FALSE,
+                VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+        offset += TC_3D_SIZE * sizeof(GLfloat);
+        ctxInfo->glVertexAttribPointer(NC_3D_INDEX, NC_3D_SIZE, GL_FLOAT, GL_FALSE,
+                VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+
+        ctxInfo->state.meshVertexBuffer = mInfo->vboIDArray[MESH_VERTEXBUFFER];
+    }
 
     glDrawElements(GL_TRIANGLES, mvInfo->meshInfo->indexBufferSize,
             mvInfo->meshInfo->indexBufferType, 0);
 
-    // Reset states
-    ctxInfo->glDisableVertexAttribArray(VC_3D_INDEX);
-    ctxInfo->glDisableVertexAttribArray(NC_3D_INDEX);
-    ctxInfo->glDisableVertexAttribArray(TC_3D_INDEX);
-    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
-    ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    // The mesh buffers and vertex attributes stay bound for the next mesh
+    // view; nSetDeviceParametersFor2D unbinds them when switching back to 2D
 }
 
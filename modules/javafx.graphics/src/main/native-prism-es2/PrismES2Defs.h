@@ -187,6 +187,10 @@ struct DrawableInfoRec {
     Display *display;
     Window win;
 #endif
+#ifdef IS_GLX
+    /* swap interval last set on this drawable, -1 if not set yet */
+    int swapInterval;
+#endif
 #endif
 
 #ifdef __APPLE__
@@ -210,6 +214,10 @@ struct StateInfoRec {
     GLenum cullMode;
     GLenum fillMode;
 
+    /* Mesh vertex buffer bound by nRenderMeshView, 0 if none. Consecutive */
+    /* mesh views sharing a mesh skip rebinding and attribute setup */
+    GLuint meshVertexBuffer;
+
     /* Currently bound fbo */
     GLuint fbo;
 };
@@ -263,6 +271,7 @@ struct ContextInfoRec {
 #ifdef UNIX /* LINUX || SOLARIS */
     char *glxExtensionStr;
     PFNGLXSWAPINTERVALSGIPROC glXSwapIntervalSGI;
+    PFNGLXSWAPINTERVALEXTPROC glXSwapIntervalEXT;
 #endif /* LINUX || SOLARIS */
 
     /* gl function pointers */
@@ -317,6 +326,8 @@ struct ContextInfoRec {
     PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
     PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
     PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glProgramBinary;
 
     /* For state caching */
     StateInfo state;
@@ -363,6 +374,10 @@ struct MeshInfoRec {
     GLuint vboIDArray[MESH_MAX_BUFFERS];
     GLuint indexBufferSize;
     GLenum indexBufferType;
+    // number of floats in vboIDArray[MESH_VERTEXBUFFER]
+    GLuint vertexBufferSize;
+    // set once the vertex buffer has been updated after it was built
+    jboolean dynamicVertexBuffer;
 };
 
 typedef struct PhongMaterialInfoRec PhongMaterialInfo;
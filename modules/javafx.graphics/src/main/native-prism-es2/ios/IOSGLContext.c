@@ -256,6 +256,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_IOSGLContext_nInitialize
             getProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             getProcAddress("glBlitFramebuffer");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            getProcAddress("glGetProgramBinaryOES");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            getProcAddress("glProgramBinaryOES");
 
     // initialize platform states and properties to match
     // cached states and properties
@@ -218,6 +218,21 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_MonocleGLFactory_nPopulateNativeC
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
                             GET_DLSYM(handle, "glBlitFramebuffer");
 
+    // glProgramBinary is core in OpenGL ES 3.0; on ES 2.0 it is only
+    // available through GL_OES_get_program_binary
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                            get_dlsym(handle, "glGetProgramBinary", 0);
+    if (ctxInfo->glGetProgramBinary == NULL) {
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                                get_dlsym(handle, "glGetProgramBinaryOES", 0);
+    }
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                            get_dlsym(handle, "glProgramBinary", 0);
+    if (ctxInfo->glProgramBinary == NULL) {
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                                get_dlsym(handle, "glProgramBinaryOES", 0);
+    }
+
     initState(ctxInfo);
     return ctxInfo;
 }
@@ -268,6 +268,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
             dlsym(RTLD_DEFAULT,"glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             dlsym(RTLD_DEFAULT,"glBlitFramebuffer");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT, "glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT, "glProgramBinary");
 
     if (isExtensionSupported(ctxInfo->glxExtensionStr,
             "GLX_SGI_swap_control")) {
@@ -281,9 +285,18 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
 
     }
 
+    // GLX_EXT_swap_control sets the interval on a given drawable, so each
+    // window keeps its own setting instead of the context toggling one
+    // global value whenever it switches drawables
+    if (isExtensionSupported(ctxInfo->glxExtensionStr,
+            "GLX_EXT_swap_control")) {
+        ctxInfo->glXSwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)
+                glXGetProcAddress((const GLubyte *)"glXSwapIntervalEXT");
+    }
+
     // initialize platform states and properties to match
     // cached states and properties
-    if (ctxInfo->glXSwapIntervalSGI != NULL) {
+    if (ctxInfo->glXSwapIntervalEXT == NULL && ctxInfo->glXSwapIntervalSGI != NULL) {
         ctxInfo->glXSwapIntervalSGI(0);
     }
     ctxInfo->state.vSyncEnabled = JNI_FALSE;
@@ -328,6 +341,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_X11GLContext_nMakeCurrent
     }
 
     vSyncNeeded = ctxInfo->vSyncRequested && dInfo->onScreen;
+    if (ctxInfo->glXSwapIntervalEXT != NULL) {
+        interval = (vSyncNeeded) ? 1 : 0;
+        if (dInfo->swapInterval != interval) {
+            ctxInfo->glXSwapIntervalEXT(ctxInfo->display, dInfo->win, interval);
+            dInfo->swapInterval = interval;
+        }
+        return;
+    }
     if (vSyncNeeded == ctxInfo->state.vSyncEnabled) {
         return;
     }
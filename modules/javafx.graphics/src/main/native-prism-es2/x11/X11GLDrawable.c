@@ -63,6 +63,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLDrawable_nCreateDrawable
     dInfo->display = pfInfo->display;
     dInfo->win = (Window) jlong_to_ptr(nativeWindow);
     dInfo->onScreen = JNI_TRUE;
+    dInfo->swapInterval = -1;
 
     return ptr_to_jlong(dInfo);
 }
@@ -95,6 +96,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLDrawable_nGetDummyDrawable
     dInfo->display = pfInfo->display;
     dInfo->win = pfInfo->dummyWin;
     dInfo->onScreen = JNI_FALSE;
+    dInfo->swapInterval = -1;
 
     return ptr_to_jlong(dInfo);
 }
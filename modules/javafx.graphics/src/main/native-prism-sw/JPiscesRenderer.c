@@ -54,6 +54,8 @@ static int toPiscesCoords(unsigned int ff);
 static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint maxY,
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask, jint x, jint y,
     jint maskWidth, jint maskHeight, jint offset, jint stride);
+static void emitAlphaRow(Renderer* rdr, Surface* surface, jbyte* alphaMap,
+    jint* alphaRow, jint y, jint x_from, jint x_to, jint x_off, jint rowNum);
 
 JNIEXPORT void JNICALL
 Java_com_sun_pisces_PiscesRenderer_initialize(JNIEnv* env, jobject objectHandle)
@@ -586,35 +588,65 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_emitAndClearAlphaRowIm
         jint* alphaRow = (jint*)(*env)->GetPrimitiveArrayCritical(env, jAlphaDeltas, NULL);
         if (alphaRow != NULL)
         {
-            x_from = MAX(x_from, rdr->_clip_bbMinX);
-            x_to = MIN(x_to, rdr->_clip_bbMaxX);
+            emitAlphaRow(rdr, surface, alphaMap, alphaRow, y, x_from, x_to, x_off, rowNum);
+            (*env)->ReleasePrimitiveArrayCritical(env, jAlphaDeltas, alphaRow, 0);
+        } else {
+            setMemErrorFlag();
+        }
+        (*env)->ReleasePrimitiveArrayCritical(env, jAlphaMap, alphaMap, 0);
+    } else {
+        setMemErrorFlag();
+    }
 
-            if (x_to >= x_from &&
-                y >= rdr->_clip_bbMinY &&
-                y <= rdr->_clip_bbMaxY)
-            {
-                rdr->_minTouched = x_from;
-                rdr->_maxTouched = x_to;
-                rdr->_currX = x_from;
-                rdr->_currY = y;
+    RELEASE_SURFACE(surface, env, surfaceHandle);
 
-                rdr->_rowNum = rowNum;
+    if (JNI_TRUE == readAndClearMemErrorFlag()) {
+        JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
+            "Allocation of internal renderer buffer failed.");
+    }
+}
 
-                rdr->alphaMap = alphaMap;
-                rdr->_rowAAInt = alphaRow + x_off; /* add offset in alpha buffer */
-                rdr->_alphaWidth = x_to - x_from + 1;
+/*
+ * Class:     com_sun_pisces_PiscesRenderer
+ * Method:    emitAndClearAlphaRowsImpl
+ * Signature: ([B[I[III)V
+ * rows holds rowCount records of (y, x_from, x_to, x_off), one per alpha row
+ * stored in alphaDeltas, so that a whole shape is emitted in a single call.
+ */
+JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_emitAndClearAlphaRowsImpl
+  (JNIEnv *env, jobject this, jbyteArray jAlphaMap, jintArray jAlphaDeltas,
+   jintArray jRows, jint rowCount, jint rowNum)
+{
+    Renderer* rdr;
+    Surface* surface;
+    jobject surfaceHandle;
+    jbyte* alphaMap;
 
-                rdr->_currImageOffset = y * surface->width;
-                rdr->_imageScanlineStride = surface->width;
-                rdr->_imagePixelStride = 1;
+    rdr = (Renderer*)JLongToPointer((*env)->GetLongField(env, this, fieldIds[RENDERER_NATIVE_PTR]));
 
-                if (rdr->_genPaint) {
-                    size_t l = (x_to - x_from + 1);
-                    ALLOC3(rdr->_paint, jint, l);
-                    rdr->_genPaint(rdr, 1);
+    SURFACE_FROM_RENDERER(surface, env, surfaceHandle, this);
+    ACQUIRE_SURFACE(surface, env, surfaceHandle);
+    INVALIDATE_RENDERER_SURFACE(rdr);
+    VALIDATE_BLITTING(rdr);
+
+    alphaMap = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, jAlphaMap, NULL);
+    if (alphaMap != NULL)
+    {
+        jint* alphaRow = (jint*)(*env)->GetPrimitiveArrayCritical(env, jAlphaDeltas, NULL);
+        if (alphaRow != NULL)
+        {
+            jint* rows = (jint*)(*env)->GetPrimitiveArrayCritical(env, jRows, NULL);
+            if (rows != NULL)
+            {
+                jint i;
+                for (i = 0; i < rowCount; i++) {
+                    jint* row = rows + 4 * i;
+                    emitAlphaRow(rdr, surface, alphaMap, alphaRow,
+                        row[0], row[1], row[2], row[3], rowNum + i);
                 }
-                rdr->_emitRows(rdr, 1);
-                rdr->_rowAAInt = NULL;
+                (*env)->ReleasePrimitiveArrayCritical(env, jRows, rows, JNI_ABORT);
+            } else {
+                setMemErrorFlag();
             }
             (*env)->ReleasePrimitiveArrayCritical(env, jAlphaDeltas, alphaRow, 0);
         } else {
@@ -633,6 +665,42 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_emitAndClearAlphaRowIm
     }
 }
 
+static void
+emitAlphaRow(Renderer* rdr, Surface* surface, jbyte* alphaMap, jint* alphaRow,
+    jint y, jint x_from, jint x_to, jint x_off, jint rowNum)
+{
+    x_from = MAX(x_from, rdr->_clip_bbMinX);
+    x_to = MIN(x_to, rdr->_clip_bbMaxX);
+
+    if (x_to >= x_from &&
+        y >= rdr->_clip_bbMinY &&
+        y <= rdr->_clip_bbMaxY)
+    {
+        rdr->_minTouched = x_from;
+        rdr->_maxTouched = x_to;
+        rdr->_currX = x_from;
+        rdr->_currY = y;
+
+        rdr->_rowNum = rowNum;
+
+        rdr->alphaMap = alphaMap;
+        rdr->_rowAAInt = alphaRow + x_off; /* add offset in alpha buffer */
+        rdr->_alphaWidth = x_to - x_from + 1;
+
+        rdr->_currImageOffset = y * surface->width;
+        rdr->_imageScanlineStride = surface->width;
+        rdr->_imagePixelStride = 1;
+
+        if (rdr->_genPaint) {
+            size_t l = (x_to - x_from + 1);
+            ALLOC3(rdr->_paint, jint, l);
+            rdr->_genPaint(rdr, 1);
+        }
+        rdr->_emitRows(rdr, 1);
+        rdr->_rowAAInt = NULL;
+    }
+}
+
 /*
  * Class:     com_sun_pisces_PiscesRenderer
  * Method:    drawImageImpl
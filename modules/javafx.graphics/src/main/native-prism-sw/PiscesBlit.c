@@ -62,6 +62,22 @@ static INLINE jint div255(jint x) {
     return (x*257 + 257) >> 16;
 }
 
+/*
+ * Two 8-bit channels can be processed at once when each is held in a 16-bit
+ * lane of a 32-bit word, red and blue in one word and alpha and green in the
+ * other.  Every product used by the blend functions is at most 255 * 255, so
+ * no lane carries into its neighbour and the results are identical to the
+ * per-channel arithmetic.
+ */
+#define LANE_MASK 0x00ff00ff
+
+static INLINE unsigned int div255x2(unsigned int x) {
+    // per lane: div255(v) == (v + 1 + ((v + 1) >> 8)) >> 8
+    x += 0x00010001;
+    x += (x >> 8) & LANE_MASK;
+    return (x >> 8) & LANE_MASK;
+}
+
 static INLINE jint A(jint x) {
     return (x >> 24) & 0xFF;
 }
@@ -865,22 +881,19 @@ static void
 blendSrcOver8888_pre(jint *intData,
                              jint aval,
                              jint sred, jint sgreen, jint sblue) {
-    jint ival = *intData;
-    //destination alpha
-    jint dalpha = (ival >> 24) & 0xff;
-    //destination components premultiplied by dalpha
-    jint dred = (ival >> 16) & 0xff;
-    jint dgreen = (ival >> 8) & 0xff;
-    jint dblue = ival & 0xff;
+    unsigned int ival = (unsigned int)*intData;
+    //destination components premultiplied by dalpha, two per word
+    unsigned int drb = ival & LANE_MASK;
+    unsigned int dag = (ival >> 8) & LANE_MASK;
 
-    jint oneminusaval = (255 - aval);
+    unsigned int oneminusaval = (255 - aval);
 
-    jint oalpha  = div255(255 * aval    + oneminusaval * dalpha);
-    jint ored    = div255(sred * aval   + oneminusaval * dred);
-    jint ogreen  = div255(sgreen * aval + oneminusaval * dgreen);
-    jint oblue   = div255(sblue * aval  + oneminusaval * dblue);
+    unsigned int orb = div255x2(((sred << 16) | sblue) * aval +
+                                oneminusaval * drb);
+    unsigned int oag = div255x2(((255 << 16) | sgreen) * aval +
+                                oneminusaval * dag);
 
-    *intData = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+    *intData = (jint)((oag << 8) | orb);
 }
 
 // *intData are premultiplied, sred, sgreen, sblue are premultiplied
@@ -888,45 +901,38 @@ static void
 blendSrcOver8888_pre_pre(jint *intData, jint frac,
                              jint aval,
                              jint sred, jint sgreen, jint sblue) {
-    jint ival = *intData;
-    //destination alpha
-    jint dalpha = (ival >> 24) & 0xff;
-    //destination components premultiplied by dalpha
-    jint dred = (ival >> 16) & 0xff;
-    jint dgreen = (ival >> 8) & 0xff;
-    jint dblue = ival & 0xff;
+    unsigned int ival = (unsigned int)*intData;
+    //destination components premultiplied by dalpha, two per word
+    unsigned int drb = ival & LANE_MASK;
+    unsigned int dag = (ival >> 8) & LANE_MASK;
 
     jint aval2 = (aval * frac) >> 8;
-    jint oneminusaval = (255 - aval2);
+    unsigned int oneminusaval = (255 - aval2);
+
+    unsigned int srb = (((sred * frac) >> 8) << 16) | ((sblue * frac) >> 8);
+    unsigned int sag = (aval2 << 16) | ((sgreen * frac) >> 8);
 
-    jint oalpha  = aval2                  + div255(oneminusaval * dalpha);
-    jint ored    = ((sred * frac) >> 8)   + div255(oneminusaval * dred);
-    jint ogreen  = ((sgreen * frac) >> 8) + div255(oneminusaval * dgreen);
-    jint oblue   = ((sblue * frac) >> 8)  + div255(oneminusaval * dblue);
+    unsigned int orb = srb + div255x2(oneminusaval * drb);
+    unsigned int oag = sag + div255x2(oneminusaval * dag);
 
-    *intData = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+    *intData = (jint)((oag << 8) | orb);
 }
 
 // *intData are premultiplied, sred, sgreen, sblue are premultiplied
 static void
 blendSrcOver8888_pre_pre_fullFrac(jint *intData, jint aval,
                              jint sred, jint sgreen, jint sblue) {
-    jint ival = *intData;
-    //destination alpha
-    jint dalpha = (ival >> 24) & 0xff;
-    //destination components premultiplied by dalpha
-    jint dred = (ival >> 16) & 0xff;
-    jint dgreen = (ival >> 8) & 0xff;
-    jint dblue = ival & 0xff;
+    unsigned int ival = (unsigned int)*intData;
+    //destination components premultiplied by dalpha, two per word
+    unsigned int drb = ival & LANE_MASK;
+    unsigned int dag = (ival >> 8) & LANE_MASK;
 
-    jint oneminusaval = (255 - aval);
+    unsigned int oneminusaval = (255 - aval);
 
-    jint oalpha  = aval   + div255(oneminusaval * dalpha);
-    jint ored    = sred   + div255(oneminusaval * dred);
-    jint ogreen  = sgreen + div255(oneminusaval * dgreen);
-    jint oblue   = sblue  + div255(oneminusaval * dblue);
+    unsigned int orb = ((sred << 16) | sblue) + div255x2(oneminusaval * drb);
+    unsigned int oag = ((aval << 16) | sgreen) + div255x2(oneminusaval * dag);
 
-    *intData = (oalpha << 24) | (ored << 16) | (ogreen << 8) | oblue;
+    *intData = (jint)((oag << 8) | orb);
 }
 
 // *intData are premultiplied, sred, sgreen, sblue are NOT premultiplied
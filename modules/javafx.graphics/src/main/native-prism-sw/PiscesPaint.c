@@ -47,6 +47,26 @@ static jlong lmod(jlong x, jlong y) {
 }
 
 
+/*
+ * The interpolation helpers below work on two channels at a time, each held
+ * in a 32-bit lane of a 64-bit word: red and blue in one word and alpha and
+ * green in the other.  Each lane is interpolated as
+ * (x0 * (65536 - frac) + x1 * frac + 0x8000) >> 16, which is the value of
+ * ((x0 << 16) + (x1 - x0) * frac + 0x8000) >> 16 for 0 <= frac <= 0xffff
+ * and never exceeds 24 bits, so the results are identical to interpolating
+ * each channel on its own.
+ */
+#define LANE_MASK 0x000000ff000000ffLL
+
+static INLINE jlong spread2(jint p) {
+    jlong x = p & 0x00ff00ff;
+    return (x | (x << 16)) & LANE_MASK;
+}
+
+static INLINE jint pack2(jlong x) {
+    return (jint)((x | (x >> 16)) & 0x00ff00ff);
+}
+
 #if defined(__arm__) && (defined(__GNUC__) && __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 4))
 #define GCC_BUG_57967_WORKAROUND
 #endif
@@ -56,8 +76,9 @@ static jlong lmod(jlong x, jlong y) {
 #pragma GCC optimize ("O1")
 #endif
 
-static INLINE jint interp(jint x0, jint x1, jint frac) {
-    return ((x0 << 16) + (x1 - x0) * frac + 0x8000) >> 16;
+static INLINE jlong interp2(jlong x0, jlong x1, jint frac) {
+    return ((x0 * (65536 - frac) + x1 * frac + 0x0000800000008000LL) >> 16)
+        & LANE_MASK;
 }
 
 #ifdef GCC_BUG_57967_WORKAROUND
@@ -234,22 +255,10 @@ genRadialGradientPaint(Renderer *rdr, jint height) {
 }
 
 static INLINE jint interpolate2points(jint p0, jint p1, jint frac) {
-    jint a0 = (p0 >> 24) & 0xff;
-    jint r0 = (p0 >> 16) & 0xff;
-    jint g0 = (p0 >> 8)  & 0xff;
-    jint b0 =  p0        & 0xff;
-
-    jint a1 = (p1 >> 24) & 0xff;
-    jint r1 = (p1 >> 16) & 0xff;
-    jint g1 = (p1 >> 8)  & 0xff;
-    jint b1 =  p1        & 0xff;
-
-    jint aa = interp(a0, a1, frac);
-    jint rr = interp(r0, r1, frac);
-    jint gg = interp(g0, g1, frac);
-    jint bb = interp(b0, b1, frac);
-
-    return (aa << 24) | (rr << 16) | (gg << 8) | bb;
+    jlong rb = interp2(spread2(p0), spread2(p1), frac);
+    jlong ag = interp2(spread2(p0 >> 8), spread2(p1 >> 8), frac);
+
+    return (pack2(ag) << 8) | pack2(rb);
 }
 
 /**
@@ -263,91 +272,25 @@ static INLINE jint interpolate2points(jint p0, jint p1, jint frac) {
 
 static INLINE jint interpolate4points(jint p00, jint p01, jint p10, jint p11,
                                jint hfrac, jint vfrac) {
-    jint a00 = (p00 >> 24) & 0xff;
-    jint r00 = (p00 >> 16) & 0xff;
-    jint g00 = (p00 >> 8)  & 0xff;
-    jint b00 =  p00        & 0xff;
-
-    jint a01 = (p01 >> 24) & 0xff;
-    jint r01 = (p01 >> 16) & 0xff;
-    jint g01 = (p01 >> 8)  & 0xff;
-    jint b01 =  p01        & 0xff;
-
-    jint a0 = interp(a00, a01, hfrac);
-    jint r0 = interp(r00, r01, hfrac);
-    jint g0 = interp(g00, g01, hfrac);
-    jint b0 = interp(b00, b01, hfrac);
-
-    jint a10 = (p10 >> 24) & 0xff;
-    jint r10 = (p10 >> 16) & 0xff;
-    jint g10 = (p10 >> 8)  & 0xff;
-    jint b10 =  p10        & 0xff;
-
-    jint a11 = (p11 >> 24) & 0xff;
-    jint r11 = (p11 >> 16) & 0xff;
-    jint g11 = (p11 >> 8)  & 0xff;
-    jint b11 =  p11        & 0xff;
-
-    jint a1 = interp(a10, a11, hfrac);
-    jint r1 = interp(r10, r11, hfrac);
-    jint g1 = interp(g10, g11, hfrac);
-    jint b1 = interp(b10, b11, hfrac);
-
-    jint aa = interp(a0, a1, vfrac);
-    jint rr = interp(r0, r1, vfrac);
-    jint gg = interp(g0, g1, vfrac);
-    jint bb = interp(b0, b1, vfrac);
-
-    return (aa << 24) | (rr << 16) | (gg << 8) | bb;
-}
+    jlong rb0 = interp2(spread2(p00), spread2(p01), hfrac);
+    jlong ag0 = interp2(spread2(p00 >> 8), spread2(p01 >> 8), hfrac);
 
-static INLINE jint interpolate2pointsNoAlpha(jint p0, jint p1, jint frac) {
-    jint r0 = (p0 >> 16) & 0xff;
-    jint g0 = (p0 >> 8)  & 0xff;
-    jint b0 =  p0        & 0xff;
+    jlong rb1 = interp2(spread2(p10), spread2(p11), hfrac);
+    jlong ag1 = interp2(spread2(p10 >> 8), spread2(p11 >> 8), hfrac);
 
-    jint r1 = (p1 >> 16) & 0xff;
-    jint g1 = (p1 >> 8)  & 0xff;
-    jint b1 =  p1        & 0xff;
+    jlong rb = interp2(rb0, rb1, vfrac);
+    jlong ag = interp2(ag0, ag1, vfrac);
 
-    jint rr = interp(r0, r1, frac);
-    jint gg = interp(g0, g1, frac);
-    jint bb = interp(b0, b1, frac);
+    return (pack2(ag) << 8) | pack2(rb);
+}
 
-    return (0xff000000) | (rr << 16) | (gg << 8) | bb;
+static INLINE jint interpolate2pointsNoAlpha(jint p0, jint p1, jint frac) {
+    return (0xff000000) | interpolate2points(p0, p1, frac);
 }
 
 static INLINE jint interpolate4pointsNoAlpha(jint p00, jint p01, jint p10, jint p11,
                                       jint hfrac, jint vfrac) {
-    jint r00 = (p00 >> 16) & 0xff;
-    jint g00 = (p00 >> 8)  & 0xff;
-    jint b00 =  p00        & 0xff;
-
-    jint r01 = (p01 >> 16) & 0xff;
-    jint g01 = (p01 >> 8)  & 0xff;
-    jint b01 =  p01        & 0xff;
-
-    jint r0 = interp(r00, r01, hfrac);
-    jint g0 = interp(g00, g01, hfrac);
-    jint b0 = interp(b00, b01, hfrac);
-
-    jint r10 = (p10 >> 16) & 0xff;
-    jint g10 = (p10 >> 8)  & 0xff;
-    jint b10 =  p10        & 0xff;
-
-    jint r11 = (p11 >> 16) & 0xff;
-    jint g11 = (p11 >> 8)  & 0xff;
-    jint b11 =  p11        & 0xff;
-
-    jint r1 = interp(r10, r11, hfrac);
-    jint g1 = interp(g10, g11, hfrac);
-    jint b1 = interp(b10, b11, hfrac);
-
-    jint rr = interp(r0, r1, vfrac);
-    jint gg = interp(g0, g1, vfrac);
-    jint bb = interp(b0, b1, vfrac);
-
-    return (0xff000000) | (rr << 16) | (gg << 8) | bb;
+    return (0xff000000) | interpolate4points(p00, p01, p10, p11, hfrac, vfrac);
 }
 
 static INLINE jboolean isInBoundsNoRepeat(jint *a, jlong *la, jint min, jint max) {
@@ -37,6 +37,7 @@ public class EPDSettingsShim {
     public final boolean noWait;
     public final int grayscale;
     public final int flags;
+    public final boolean regionUpdates;
 
     /**
      * Obtains a new instance of this class with the current values of the EPD
@@ -61,5 +62,6 @@ public class EPDSettingsShim {
         noWait = settings.noWait;
         grayscale = settings.grayscale;
         flags = settings.flags;
+        regionUpdates = settings.regionUpdates;
     }
 }
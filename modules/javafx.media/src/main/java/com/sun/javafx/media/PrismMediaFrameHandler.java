@@ -130,7 +130,22 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
             tme.texture = null;
         }
 
-        PrismFrameBuffer prismBuffer = new PrismFrameBuffer(vdb);
+        ResourceFactory screenFactory =
+            GraphicsPipeline.getPipeline().getResourceFactory(screen);
+        MediaFrame prismBuffer = new PrismFrameBuffer(vdb);
+        MediaFrame converted = null;
+
+        // The native planes are uploaded as they are and converted by the
+        // shaders. Only convert on the CPU when the factory cannot take the
+        // frame format at all, e.g. 4:2:2 on GLES without GL_APPLE_ycbcr_422.
+        if (!screenFactory.isFormatSupported(prismBuffer.getPixelFormat())) {
+            converted = prismBuffer.convertToFormat(PixelFormat.INT_ARGB_PRE);
+            if (converted == null) {
+                return;
+            }
+            prismBuffer = converted;
+        }
+
         if (tme.texture == null) {
             ResourceFactory factory = GraphicsPipeline.getDefaultResourceFactory();
             if (registeredWithFactory == null || registeredWithFactory.get() != factory) {
@@ -140,9 +155,7 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
                 registeredWithFactory = new WeakReference<>(factory);
             }
 
-            tme.texture = GraphicsPipeline.getPipeline().
-                getResourceFactory(screen).
-                    createTexture(prismBuffer);
+            tme.texture = screenFactory.createTexture(prismBuffer);
             tme.encodedWidth = vdb.getEncodedWidth();
             tme.encodedHeight = vdb.getEncodedHeight();
         }
@@ -152,6 +165,10 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
             tme.texture.update(prismBuffer, false);
         }
         tme.lastFrameTime = vdb.getTimestamp();
+
+        if (converted != null) {
+            converted.releaseFrame();
+        }
     }
 
     private void releaseData() {
@@ -206,6 +206,14 @@ public interface MediaPlayer {
      */
     public long getAudioSyncDelay();
 
+    /**
+     * Takes a snapshot of the playback counters of this player. This is cheap
+     * enough to poll, for instance to monitor playback health.
+     *
+     * @return the current counter values.
+     */
+    public PlayerStatistics getStatistics();
+
     /**
      * Begins playing of the media.  To ensure smooth playback, catch the
      * onReady event in the MediaPlayerListener before playing.
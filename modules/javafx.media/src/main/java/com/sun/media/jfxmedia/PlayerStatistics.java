@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmedia;
+
+/**
+ * Snapshot of the playback counters of a {@link MediaPlayer}. Counters start
+ * at zero when the player is created and are not reset by seeking. Values a
+ * platform does not track are reported as zero.
+ */
+public final class PlayerStatistics {
+    // Indices into the values filled in by the native player, these must
+    // match CPipeline::Statistic.
+    public static final int FRAMES_RENDERED = 0;
+    public static final int FRAMES_LATE = 1;
+    public static final int FRAMES_DROPPED = 2;
+    public static final int VIDEO_DECODE_TIME = 3;
+    public static final int FRAME_CALLBACK_TIME = 4;
+    public static final int FRAME_CALLBACK_MAX_TIME = 5;
+    public static final int VIDEO_QUEUE_LEVEL = 6;
+    public static final int AUDIO_QUEUE_LEVEL = 7;
+    public static final int COUNT = 8;
+
+    private final long[] values;
+
+    /**
+     * Creates a snapshot from values laid out by the indices above.
+     *
+     * @param values the counter values, of length {@link #COUNT}.
+     * @throws IllegalArgumentException if <code>values</code> is
+     * <code>null</code> or too short.
+     */
+    public PlayerStatistics(long[] values) {
+        if (values == null || values.length < COUNT) {
+            throw new IllegalArgumentException("values.length < COUNT!");
+        }
+        this.values = values.clone();
+    }
+
+    /**
+     * @return the number of video frames handed to the renderer.
+     */
+    public long getFramesRendered() {
+        return values[FRAMES_RENDERED];
+    }
+
+    /**
+     * @return the number of video frames which reached the renderer
+     * noticeably after their presentation time.
+     */
+    public long getFramesLate() {
+        return values[FRAMES_LATE];
+    }
+
+    /**
+     * @return the number of video frames dropped before rendering.
+     */
+    public long getFramesDropped() {
+        return values[FRAMES_DROPPED];
+    }
+
+    /**
+     * @return the time spent decoding the last video frame in microseconds.
+     */
+    public long getVideoDecodeTime() {
+        return values[VIDEO_DECODE_TIME];
+    }
+
+    /**
+     * @return the total time spent delivering video frames to Java in
+     * microseconds.
+     */
+    public long getFrameCallbackTime() {
+        return values[FRAME_CALLBACK_TIME];
+    }
+
+    /**
+     * @return the longest time spent delivering one video frame to Java in
+     * microseconds.
+     */
+    public long getFrameCallbackMaxTime() {
+        return values[FRAME_CALLBACK_MAX_TIME];
+    }
+
+    /**
+     * @return the number of buffers waiting to be decoded in the video queue.
+     */
+    public long getVideoQueueLevel() {
+        return values[VIDEO_QUEUE_LEVEL];
+    }
+
+    /**
+     * @return the number of buffers waiting to be decoded in the audio queue.
+     */
+    public long getAudioQueueLevel() {
+        return values[AUDIO_QUEUE_LEVEL];
+    }
+
+    @Override
+    public String toString() {
+        return "PlayerStatistics[rendered=" + getFramesRendered()
+                + ", late=" + getFramesLate()
+                + ", dropped=" + getFramesDropped()
+                + ", decodeTime=" + getVideoDecodeTime()
+                + ", callbackTime=" + getFrameCallbackTime()
+                + ", callbackMaxTime=" + getFrameCallbackMaxTime()
+                + ", videoQueue=" + getVideoQueueLevel()
+                + ", audioQueue=" + getAudioQueueLevel() + "]";
+    }
+}
@@ -127,6 +127,10 @@ public interface VideoDataBuffer {
      * either {@code ARGB_PRE} or {@code BGRA_PRE}, converting to YCbCr is not
      * supported here. Once a conversion is done, a reference to the converted
      * buffer is retained so that future conversions do not need to be performed.
+     * <p>
+     * Conversion is done on the CPU. Renderers that can sample the native
+     * planes should upload them from {@link #getBufferForPlane} instead and
+     * only call this method when they cannot handle the source format.
      *
      * @param newFormat the video format to convert to
      * @return new buffer containing a converted copy of the source video image
@@ -87,6 +87,26 @@ public abstract class ConnectionHolder {
         return channel.read(buffer);
     }
 
+    /**
+     * Reads a block of data from the current position of the opened stream
+     * straight into the destination, up to its remaining bytes. Native code
+     * passes a direct buffer wrapping the pipeline memory, so no further copy
+     * is needed.
+     *
+     * @return The number of bytes read, possibly zero, or -1 if the channel
+     * has reached end-of-stream.
+     *
+     * @throws ClosedChannelException if an attempt is made to read after
+     * closeConnection has been called
+     */
+    public int readNextBlock(ByteBuffer destination) throws IOException {
+        // avoid NPE if channel does not exist or has been closed
+        if (null == channel) {
+            throw new ClosedChannelException();
+        }
+        return channel.read(destination);
+    }
+
     public ByteBuffer getBuffer() {
         return buffer;
     }
@@ -102,6 +122,28 @@ public abstract class ConnectionHolder {
      */
     abstract int readBlock(long position, int size) throws IOException;
 
+    /**
+     * Reads a block of data from the arbitrary position of the opened stream
+     * straight into the destination, up to its remaining bytes. By default the
+     * block is read with {@link #readBlock(long, int)} and copied over; holders
+     * which can read into any buffer override it.
+     *
+     * @return The number of bytes read, possibly zero, or -1 if the given position
+     * is greater than or equal to the file's current size.
+     *
+     * @throws ClosedChannelException if an attempt is made to read after
+     * closeConnection has been called
+     */
+    int readBlock(long position, ByteBuffer destination) throws IOException {
+        int read = readBlock(position, destination.remaining());
+        if (read > 0) {
+            ByteBuffer source = buffer.duplicate();
+            source.rewind().limit(read);
+            destination.put(source);
+        }
+        return read;
+    }
+
     /**
      * Detects whether this source needs buffering at the pipeline level.
      * When true the pipeline contains progressbuffer after the source.
@@ -210,6 +252,15 @@ public abstract class ConnectionHolder {
             return ((FileChannel)channel).read(buffer, position);
         }
 
+        @Override
+        int readBlock(long position, ByteBuffer destination) throws IOException {
+            if (null == channel) {
+                throw new ClosedChannelException();
+            }
+
+            return ((FileChannel)channel).read(destination, position);
+        }
+
         private ReadableByteChannel openFile(final URI uri) throws IOException {
             if (file != null) {
                 file.close();
@@ -389,7 +440,7 @@ public abstract class ConnectionHolder {
                     }
 
                     int actual;
-                    if (bb.equals(buffer)) {
+                    if (bb == buffer) {
                         // we'll cheat here as we know that bb is buffer and rather
                         // than copy the data, just slice it like for readBlock
                         actual = Math.min(DEFAULT_BUFFER_SIZE, backingBuffer.remaining());
@@ -28,22 +28,35 @@ import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
 import com.sun.media.jfxmediaimpl.MediaUtils;
 import java.io.BufferedReader;
+import java.io.ByteArrayOutputStream;
 import java.io.IOException;
+import java.io.InputStream;
 import java.io.InputStreamReader;
 import java.net.HttpURLConnection;
 import java.net.MalformedURLException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.URLConnection;
+import java.nio.ByteBuffer;
 import java.nio.channels.Channels;
+import java.nio.channels.ClosedChannelException;
 import java.nio.channels.ReadableByteChannel;
 import java.nio.charset.Charset;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Iterator;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.CancellationException;
 import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.Semaphore;
 import java.util.stream.Stream;
@@ -73,6 +86,11 @@ final class HLSConnectionHolder extends ConnectionHolder {
     // Seek will set this value and HLS_PROP_SEGMENT_START_TIME
     // should return it if set.
     private int segmentStartTimeAfterSeek = -1;
+    // Downloads the next media files while the current one plays.
+    // Created with the first segment if PREFETCH_SEGMENTS is not 0.
+    private SegmentPrefetcher prefetcher = null;
+    private boolean isSegmentPrefetched = false;
+    private int segmentLength = -1;
     static final long HLS_VALUE_FLOAT_MULTIPLIER = 1000;
     static final int HLS_PROP_GET_DURATION = 1;
     static final int HLS_PROP_GET_HLS_MODE = 2;
@@ -87,6 +105,13 @@ final class HLSConnectionHolder extends ConnectionHolder {
     static final int HLS_VALUE_MIMETYPE_AAC = 4;
     static final String CHARSET_UTF_8 = "UTF-8";
     static final String CHARSET_US_ASCII = "US-ASCII";
+    // Number of media files downloaded ahead of playback in parallel,
+    // -Djfxmedia.hls.prefetch=0 loads one segment at a time.
+    static final int MAX_PREFETCH_SEGMENTS = 8;
+    @SuppressWarnings("removal")
+    static final int PREFETCH_SEGMENTS = Math.max(0, Math.min(MAX_PREFETCH_SEGMENTS,
+            AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+                    Integer.getInteger("jfxmedia.hls.prefetch", 2))));
 
     HLSConnectionHolder(URI uri) {
         playlistLoader = new PlaylistLoader();
@@ -109,16 +134,21 @@ final class HLSConnectionHolder extends ConnectionHolder {
 
     @Override
     public int readNextBlock() throws IOException {
+        buffer.rewind();
+        if (buffer.limit() < buffer.capacity()) {
+            buffer.limit(buffer.capacity());
+        }
+        return readNextBlock(buffer);
+    }
+
+    @Override
+    public int readNextBlock(ByteBuffer destination) throws IOException {
         if (isBitrateAdjustable && readStartTime == -1) {
             readStartTime = System.currentTimeMillis();
         }
 
         if (headerChannel != null) {
-            buffer.rewind();
-            if (buffer.limit() < buffer.capacity()) {
-                buffer.limit(buffer.capacity());
-            }
-            int read = headerChannel.read(buffer);
+            int read = headerChannel.read(destination);
             if (read == -1) {
                 resetHeaderConnection();
             } else {
@@ -126,7 +156,7 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
-        int read = super.readNextBlock();
+        int read = super.readNextBlock(destination);
         if (isBitrateAdjustable && read == -1) {
             long readTime = System.currentTimeMillis() - readStartTime;
             readStartTime = -1;
@@ -164,6 +194,11 @@ final class HLSConnectionHolder extends ConnectionHolder {
             return -1;
         }
 
+        // Segments ahead of the old position are of no use anymore
+        if (prefetcher != null) {
+            prefetcher.clear();
+        }
+
         if (hasAudioExtStream && position != 0) {
             if (getAudioStream() == null || getAudioStream().getCurrentPlaylist() == null) {
                 return -1; // Something wrong or EOS
@@ -196,6 +231,9 @@ final class HLSConnectionHolder extends ConnectionHolder {
         currentPlaylist.close();
         super.closeConnection();
         resetConnection();
+        if (prefetcher != null) {
+            prefetcher.shutdown();
+        }
         playlistLoader.putState(PlaylistLoader.STATE_EXIT);
     }
 
@@ -379,21 +417,53 @@ final class HLSConnectionHolder extends ConnectionHolder {
             return -1;
         }
 
-        try {
-            URI uri = new URI(mediaFile);
-            urlConnection = uri.toURL().openConnection();
-            channel = openChannel();
-        } catch (IOException | URISyntaxException e) {
-            return -1;
+        ByteBuffer prefetched = (prefetcher != null) ? prefetcher.take(mediaFile) : null;
+        isSegmentPrefetched = (prefetched != null);
+        if (isSegmentPrefetched) {
+            channel = new SegmentChannel(prefetched);
+            segmentLength = prefetched.remaining();
+        } else {
+            try {
+                URI uri = new URI(mediaFile);
+                urlConnection = uri.toURL().openConnection();
+                channel = openChannel();
+            } catch (IOException | URISyntaxException e) {
+                return -1;
+            }
+            segmentLength = urlConnection.getContentLength();
         }
 
+        prefetchNextSegments();
+
         if (currentPlaylist.isCurrentMediaFileDiscontinuity()) {
-            return (-1 * (urlConnection.getContentLength() + headerLength));
+            return (-1 * (segmentLength + headerLength));
         } else {
-            return (urlConnection.getContentLength() + headerLength);
+            return (segmentLength + headerLength);
         }
     }
 
+    // Starts downloading the media files following the current one and drops
+    // downloads which are not among them anymore.
+    private void prefetchNextSegments() {
+        if (PREFETCH_SEGMENTS == 0) {
+            return;
+        }
+
+        if (prefetcher == null) {
+            prefetcher = new SegmentPrefetcher(PREFETCH_SEGMENTS);
+        }
+
+        List<String> mediaFiles = new ArrayList<>(PREFETCH_SEGMENTS);
+        for (int i = 1; i <= PREFETCH_SEGMENTS; i++) {
+            String mediaFile = currentPlaylist.peekMediaFile(i);
+            if (mediaFile == null) {
+                break;
+            }
+            mediaFiles.add(mediaFile);
+        }
+        prefetcher.schedule(mediaFiles);
+    }
+
     private ReadableByteChannel openChannel() throws IOException {
         return Channels.newChannel(urlConnection.getInputStream());
     }
@@ -403,10 +473,21 @@ final class HLSConnectionHolder extends ConnectionHolder {
     }
 
     private void adjustBitrate(long readTime) {
-        int avgBitrate = (int) (((long) urlConnection.getContentLength() * 8 * 1000) / readTime);
+        int avgBitrate = -1;
+        // A prefetched segment is read from memory, so its read time says nothing
+        // about the network. Use the estimate over all downloads instead.
+        if (isSegmentPrefetched) {
+            avgBitrate = prefetcher.getBitrate();
+        }
+        if (avgBitrate <= 0) {
+            avgBitrate = (int) (((long) segmentLength * 8 * 1000) / Math.max(readTime, 1));
+        }
 
         Playlist playlist = variantPlaylist.getPlaylistBasedOnBitrate(avgBitrate);
         if (playlist != null && playlist != currentPlaylist) {
+            if (prefetcher != null) {
+                prefetcher.clear();
+            }
             if (currentPlaylist.isLive()) {
                 playlist.update(currentPlaylist.getNextMediaFile());
                 playlistLoader.setReloadPlaylist(playlist);
@@ -435,6 +516,9 @@ final class HLSConnectionHolder extends ConnectionHolder {
         // If video stream provided new playlist, then use it.
         synchronized (newPlaylistLock) {
             if (newCurrentPlaylist != null && newCurrentPlaylist != currentPlaylist) {
+                if (prefetcher != null) {
+                    prefetcher.clear();
+                }
                 if (currentPlaylist.isLive()) {
                     newCurrentPlaylist.update(currentPlaylist.getNextMediaFile());
                     playlistLoader.setReloadAudioExtPlaylist(newCurrentPlaylist);
@@ -466,6 +550,175 @@ final class HLSConnectionHolder extends ConnectionHolder {
         return currentPlaylist;
     }
 
+    // Serves a prefetched media file to readNextBlock.
+    private static final class SegmentChannel implements ReadableByteChannel {
+
+        private ByteBuffer data;
+
+        SegmentChannel(ByteBuffer data) {
+            this.data = data;
+        }
+
+        @Override
+        public int read(ByteBuffer destination) throws IOException {
+            if (data == null) {
+                throw new ClosedChannelException();
+            }
+            if (!data.hasRemaining()) {
+                return -1;
+            }
+
+            int length = Math.min(destination.remaining(), data.remaining());
+            ByteBuffer block = data.slice();
+            block.limit(length);
+            destination.put(block);
+            data.position(data.position() + length);
+            return length;
+        }
+
+        @Override
+        public boolean isOpen() {
+            return data != null;
+        }
+
+        @Override
+        public void close() {
+            data = null;
+        }
+    }
+
+    // Downloads media files on background threads ahead of playback, so the
+    // next segment does not wait for a request on a high latency link. Also
+    // estimates the bandwidth over all downloads, the parallel ones included.
+    private static final class SegmentPrefetcher {
+
+        private static final int BLOCK_SIZE = 65536;
+        private final ExecutorService executor;
+        private final Map<String, Future<ByteBuffer>> downloads = new LinkedHashMap<>();
+        // Bandwidth estimation: bytes and busy time since the last finished
+        // download, smoothed over downloads.
+        private int activeDownloads = 0;
+        private long busySince = 0;
+        private long busyTime = 0;
+        private long bytes = 0;
+        private double bitrate = -1.0;
+
+        SegmentPrefetcher(int threads) {
+            executor = Executors.newFixedThreadPool(threads, (Runnable r) -> {
+                Thread thread = new Thread(r, "JFXMedia HLS Prefetch Thread");
+                thread.setDaemon(true);
+                return thread;
+            });
+        }
+
+        // Returns the downloaded media file, waiting for it if it is still in
+        // progress, or null if it was not prefetched or its download failed.
+        ByteBuffer take(String mediaFile) {
+            Future<ByteBuffer> download;
+            synchronized (this) {
+                download = downloads.remove(mediaFile);
+            }
+            if (download == null) {
+                return null;
+            }
+
+            try {
+                return download.get();
+            } catch (InterruptedException | ExecutionException | CancellationException e) {
+                return null;
+            }
+        }
+
+        synchronized void schedule(List<String> mediaFiles) {
+            if (executor.isShutdown()) {
+                return;
+            }
+
+            Iterator<Map.Entry<String, Future<ByteBuffer>>> it = downloads.entrySet().iterator();
+            while (it.hasNext()) {
+                Map.Entry<String, Future<ByteBuffer>> entry = it.next();
+                if (!mediaFiles.contains(entry.getKey())) {
+                    entry.getValue().cancel(true);
+                    it.remove();
+                }
+            }
+
+            for (String mediaFile : mediaFiles) {
+                if (!downloads.containsKey(mediaFile)) {
+                    downloads.put(mediaFile, executor.submit(() -> download(mediaFile)));
+                }
+            }
+        }
+
+        synchronized void clear() {
+            downloads.values().forEach(download -> download.cancel(true));
+            downloads.clear();
+        }
+
+        void shutdown() {
+            clear();
+            executor.shutdownNow();
+        }
+
+        // Returns the smoothed bandwidth in bits per second, -1 if unknown.
+        synchronized int getBitrate() {
+            return (int) bitrate;
+        }
+
+        private ByteBuffer download(String mediaFile) throws IOException, URISyntaxException {
+            URLConnection connection = new URI(mediaFile).toURL().openConnection();
+            long read = 0;
+            downloadStarted();
+            try (InputStream input = connection.getInputStream()) {
+                int length = connection.getContentLength();
+                if (length > 0) {
+                    byte[] data = new byte[length];
+                    while (read < length) {
+                        int count = input.read(data, (int) read, Math.min(BLOCK_SIZE, length - (int) read));
+                        if (count == -1) {
+                            break;
+                        }
+                        read += count;
+                    }
+                    return ByteBuffer.wrap(data, 0, (int) read);
+                } else {
+                    ByteArrayOutputStream data = new ByteArrayOutputStream(BLOCK_SIZE);
+                    byte[] block = new byte[BLOCK_SIZE];
+                    int count;
+                    while ((count = input.read(block)) != -1) {
+                        data.write(block, 0, count);
+                        read += count;
+                    }
+                    return ByteBuffer.wrap(data.toByteArray());
+                }
+            } finally {
+                downloadFinished(read);
+                Locator.closeConnection(connection);
+            }
+        }
+
+        private synchronized void downloadStarted() {
+            if (activeDownloads++ == 0) {
+                busySince = System.currentTimeMillis();
+            }
+        }
+
+        private synchronized void downloadFinished(long count) {
+            long now = System.currentTimeMillis();
+            busyTime += now - busySince;
+            busySince = now;
+            bytes += count;
+            activeDownloads--;
+
+            if (busyTime > 0 && bytes > 0) {
+                double sample = (double) bytes * 8 * 1000 / busyTime;
+                bitrate = (bitrate < 0) ? sample : (0.7 * bitrate + 0.3 * sample);
+                bytes = 0;
+                busyTime = 0;
+            }
+        }
+    }
+
     private static class PlaylistLoader extends Thread {
 
         public static final int STATE_INIT = 0;
@@ -1352,6 +1605,23 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
+        // Returns the media file ahead positions after the current one without
+        // moving to it, or null if the playlist does not have it yet.
+        String peekMediaFile(int ahead) {
+            synchronized (lock) {
+                int index = mediaFileIndex + ahead;
+                if (index >= 0 && index < mediaFiles.size()) {
+                    if (baseURI != null) {
+                        return baseURI + mediaFiles.get(index);
+                    } else {
+                        return mediaFiles.get(index);
+                    }
+                } else {
+                    return null;
+                }
+            }
+        }
+
         String getHeaderFile() {
             synchronized (lock) {
                 if (mediaFiles.size() > 0) {
@@ -94,6 +94,21 @@ public class Locator {
      */
     private final Object propertyLock = new Object();
 
+    /**
+     * Whether pipelines for this locator are tuned for live sources.
+     */
+    private volatile boolean lowLatency = false;
+
+    /**
+     * Whether pipelines for this locator run on the shared clock.
+     */
+    private volatile boolean sharedClock = false;
+
+    /**
+     * Content type supplied by the caller, used instead of probing the media.
+     */
+    private volatile String contentTypeHint = null;
+
     /*
      * These variables will be initialized by constructor and used by init()
      */
@@ -430,7 +445,11 @@ public class Locator {
                             // For WAV use file signature, since it can detect audio format
                             // and we can fail sooner, then doing it at runtime.
                             // This is important for AudioClip.
-                            if (MediaUtils.CONTENT_TYPE_WAV.equals(contentType)) {
+                            String hint = contentTypeHint;
+                            if (hint != null && MediaManager.canPlayContentType(hint)) {
+                                // Caller knows the container, skip probing.
+                                contentType = hint;
+                            } else if (MediaUtils.CONTENT_TYPE_WAV.equals(contentType)) {
                                 contentType = getContentTypeFromFileSignature(uri);
                                 if (!MediaManager.canPlayContentType(contentType)) {
                                     isMediaSupported = false;
@@ -596,6 +615,71 @@ public class Locator {
         }
     }
 
+    /**
+     * Requests low latency playback, meant for live sources such as cameras.
+     * The native pipeline then keeps its queues minimal, drops late video
+     * frames and does not prebuffer progressive downloads. This method should
+     * be invoked <i>before</i> the player is created or it will have no effect.
+     *
+     * @param lowLatency <code>true</code> to tune playback for latency.
+     */
+    public void setLowLatency(boolean lowLatency) {
+        this.lowLatency = lowLatency;
+    }
+
+    /**
+     * Returns whether low latency playback was requested.
+     *
+     * @return <code>true</code> if playback is tuned for latency.
+     */
+    public boolean isLowLatency() {
+        return lowLatency;
+    }
+
+    /**
+     * Requests that the player runs on a clock shared by all players which
+     * request it, instead of the clock of its own audio device. Players of a
+     * video wall then stay in step with each other. This method should be
+     * invoked <i>before</i> the player is created or it will have no effect.
+     *
+     * @param sharedClock <code>true</code> to use the shared clock.
+     */
+    public void setSharedClock(boolean sharedClock) {
+        this.sharedClock = sharedClock;
+    }
+
+    /**
+     * Returns whether the player runs on the shared clock.
+     *
+     * @return <code>true</code> if the shared clock is used.
+     */
+    public boolean isSharedClock() {
+        return sharedClock;
+    }
+
+    /**
+     * Supplies the content type of the media, for callers which already know
+     * the container. If the type can be played, it is used as is and the
+     * file name and signature of the media are not examined. This method
+     * should be invoked <i>before</i> {@link #init()} or it will have no
+     * effect.
+     *
+     * @param contentType the content type of the media, or <code>null</code>
+     * to detect it.
+     */
+    public void setContentTypeHint(String contentType) {
+        this.contentTypeHint = contentType;
+    }
+
+    /**
+     * Returns the content type supplied with {@link #setContentTypeHint}.
+     *
+     * @return the content type hint or <code>null</code> if none was given.
+     */
+    public String getContentTypeHint() {
+        return contentTypeHint;
+    }
+
     public ConnectionHolder createConnectionHolder() throws IOException {
         // check if it's cached
         if (null != cacheEntry) {
@@ -33,7 +33,9 @@ import com.sun.media.jfxmedia.events.PlayerStateListener;
 import com.sun.media.jfxmedia.locator.Locator;
 import com.sun.media.jfxmedia.logging.Logger;
 import java.net.URI;
+import java.util.ArrayDeque;
 import java.util.ArrayList;
+import java.util.Iterator;
 import java.util.List;
 import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.LinkedBlockingQueue;
@@ -68,6 +70,13 @@ final class NativeMediaAudioClipPlayer
                 new ArrayList<>(MAX_PLAYER_COUNT);
     private static final ReentrantLock playerListLock = new ReentrantLock();
 
+    // Players of clips that finished playing, paused at the start. Playing
+    // the same clip again reuses one instead of building a new pipeline.
+    private static final int MAX_IDLE_PLAYER_COUNT = 8;
+
+    private static final ArrayDeque<IdlePlayer> idlePlayers =
+                new ArrayDeque<>(MAX_IDLE_PLAYER_COUNT);
+
     public static int getPlayerLimit() {
         return MAX_PLAYER_COUNT;
     }
@@ -316,9 +325,18 @@ final class NativeMediaAudioClipPlayer
             playCount = 0;
 
             if (null == mediaPlayer) {
-                mediaPlayer = MediaManager.getPlayer(source());
-                mediaPlayer.addMediaPlayerListener(this);
-                mediaPlayer.addMediaErrorListener(this);
+                mediaPlayer = takeIdlePlayer(source().getURI());
+                if (null != mediaPlayer) {
+                    // already prerolled, no onReady() will follow
+                    mediaPlayer.addMediaPlayerListener(this);
+                    mediaPlayer.addMediaErrorListener(this);
+                    ready = true;
+                    startPlayback();
+                } else {
+                    mediaPlayer = MediaManager.getPlayer(source());
+                    mediaPlayer.addMediaPlayerListener(this);
+                    mediaPlayer.addMediaErrorListener(this);
+                }
             } else {
                 mediaPlayer.play();
             }
@@ -331,7 +349,11 @@ final class NativeMediaAudioClipPlayer
         invalidate();
     }
 
-    public synchronized void invalidate() {
+    public void invalidate() {
+        invalidate(false);
+    }
+
+    private synchronized void invalidate(boolean finished) {
         playerStateLock.lock();
         playerListLock.lock();
 
@@ -345,10 +367,9 @@ final class NativeMediaAudioClipPlayer
 
             if (null != mediaPlayer) {
                 mediaPlayer.removeMediaPlayerListener(this);
-                mediaPlayer.setMute(true);
-                SchedulerEntry entry = new SchedulerEntry(mediaPlayer);
-                if (!schedule.offer(entry)) {
-                    mediaPlayer.dispose();
+                mediaPlayer.removeMediaErrorListener(this);
+                if (!finished || !recyclePlayer(source().getURI(), mediaPlayer)) {
+                    disposePlayer(mediaPlayer);
                 }
                 mediaPlayer = null;
 
@@ -362,16 +383,62 @@ final class NativeMediaAudioClipPlayer
         }
     }
 
+    private void startPlayback() {
+        mediaPlayer.setVolume((float)volume);
+        mediaPlayer.setBalance((float)balance);
+        mediaPlayer.setRate((float)rate);
+        mediaPlayer.play();
+    }
+
+    // Called with playerListLock held
+    private static void disposePlayer(MediaPlayer player) {
+        player.setMute(true);
+        SchedulerEntry entry = new SchedulerEntry(player);
+        if (!schedule.offer(entry)) {
+            player.dispose();
+        }
+    }
+
+    // Called with playerListLock held. Parks the player of a clip that played
+    // to the end, evicting the oldest idle player if the pool is full.
+    private static boolean recyclePlayer(URI uri, MediaPlayer player) {
+        try {
+            player.pause();
+            player.seek(0);
+        } catch (Throwable t) {
+            return false;
+        }
+        if (idlePlayers.size() >= MAX_IDLE_PLAYER_COUNT) {
+            disposePlayer(idlePlayers.removeFirst().player);
+        }
+        idlePlayers.addLast(new IdlePlayer(uri, player));
+        return true;
+    }
+
+    private static MediaPlayer takeIdlePlayer(URI uri) {
+        playerListLock.lock();
+        try {
+            Iterator<IdlePlayer> it = idlePlayers.descendingIterator();
+            while (it.hasNext()) {
+                IdlePlayer idle = it.next();
+                if (idle.uri.equals(uri)) {
+                    it.remove();
+                    return idle.player;
+                }
+            }
+            return null;
+        } finally {
+            playerListLock.unlock();
+        }
+    }
+
     @Override
     public void onReady(PlayerStateEvent evt) {
         playerStateLock.lock();
         try {
             ready = true;
             if (playing) {
-                mediaPlayer.setVolume((float)volume);
-                mediaPlayer.setBalance((float)balance);
-                mediaPlayer.setRate((float)rate);
-                mediaPlayer.play();
+                startPlayback();
             }
         } finally {
             playerStateLock.unlock();
@@ -405,7 +472,7 @@ final class NativeMediaAudioClipPlayer
                     if (playCount <= loopCount) {
                         mediaPlayer.seek(0); // restart
                     } else {
-                        invalidate();
+                        invalidate(true);
                     }
                 } else {
                     mediaPlayer.seek(0); // restart
@@ -472,6 +539,16 @@ final class NativeMediaAudioClipPlayer
         return h;
     }
 
+    private static class IdlePlayer {
+        final URI uri;
+        final MediaPlayer player;
+
+        IdlePlayer(URI uri, MediaPlayer player) {
+            this.uri = uri;
+            this.player = player;
+        }
+    }
+
     private static class SchedulerEntry {
         private final int command; // 0 = play, 1 = stop, 2 = dispose
         private final NativeMediaAudioClipPlayer player; // MAY BE NULL!
@@ -30,6 +30,7 @@ import com.sun.media.jfxmedia.Media;
 import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
 import com.sun.media.jfxmedia.MediaPlayer;
+import com.sun.media.jfxmedia.PlayerStatistics;
 import com.sun.media.jfxmedia.control.VideoRenderControl;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
@@ -107,6 +108,10 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
     private NewFrameEvent firstFrameEvent = null;
     private double firstFrameTime;
     private final Object firstFrameLock = new Object();
+    // Guards taking frames from the native dispatcher against its disposal
+    private final Object frameTakeLock = new Object();
+    private boolean isFrameTakeDisabled = false;
+    private FrameAvailableEvent frameAvailableEvent = null;
     private EventQueueThread eventLoop = new EventQueueThread();
     private int frameWidth = -1;
     private int frameHeight = -1;
@@ -398,7 +403,18 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
                     PlayerEvent evt = eventQueue.take();
 
                     if (!stopped) {
-                        if (evt instanceof NewFrameEvent) {
+                        if (evt instanceof FrameAvailableEvent) {
+                            try {
+                                NewFrameEvent frameEvent = takeNewFrame(((FrameAvailableEvent) evt).dispatcherRef);
+                                if (frameEvent != null) {
+                                    HandleRendererEvents(frameEvent);
+                                }
+                            } catch (Throwable t) {
+                                if (Logger.canLog(Logger.ERROR)) {
+                                    Logger.logMsg(Logger.ERROR, "Caught exception in HandleRendererEvents: " + t.toString());
+                                }
+                            }
+                        } else if (evt instanceof NewFrameEvent) {
                             try {
                                 HandleRendererEvents((NewFrameEvent) evt);
                             } catch (Throwable t) {
@@ -1023,6 +1039,19 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         return 0;
     }
 
+    @Override
+    public PlayerStatistics getStatistics() {
+        long[] values = new long[PlayerStatistics.COUNT];
+        if (!isDisposed) {
+            try {
+                playerGetStatistics(values);
+            } catch (MediaException me) {
+                sendPlayerEvent(new MediaErrorEvent(this, me.getMediaError()));
+            }
+        }
+        return new PlayerStatistics(values);
+    }
+
     @Override
     public void play() {
         try {
@@ -1274,6 +1303,13 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
 
     protected abstract void playerSetAudioSyncDelay(long delay) throws MediaException;
 
+    /**
+     * Fills in the playback counters, indexed as in {@link PlayerStatistics}.
+     * Platforms which do not track them leave the values at zero.
+     */
+    protected void playerGetStatistics(long[] values) throws MediaException {
+    }
+
     protected abstract void playerPlay() throws MediaException;
 
     protected abstract void playerStop() throws MediaException;
@@ -1338,6 +1374,11 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
                     }
                 }
 
+                // The native dispatcher goes away with the native layer
+                synchronized (frameTakeLock) {
+                    isFrameTakeDisabled = true;
+                }
+
                 // Terminate native layer
                 playerDispose();
 
@@ -1500,6 +1541,47 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         sendPlayerEvent(new NewFrameEvent(newFrameData));
     }
 
+    /**
+     * Called by the native event dispatcher when it holds a new frame. The
+     * dispatcher keeps only the latest frame and does not call again until
+     * the event thread has taken it, so at most one of these events is queued
+     * and the same instance is reused.
+     *
+     * @param dispatcherRef the native dispatcher to take the frame from
+     */
+    protected void sendFrameAvailableEvent(long dispatcherRef) {
+        if (frameAvailableEvent == null || frameAvailableEvent.dispatcherRef != dispatcherRef) {
+            frameAvailableEvent = new FrameAvailableEvent(dispatcherRef);
+        }
+        sendPlayerEvent(frameAvailableEvent);
+    }
+
+    private NewFrameEvent takeNewFrame(long dispatcherRef) {
+        long frameRef;
+        synchronized (frameTakeLock) {
+            if (isFrameTakeDisabled) {
+                return null;
+            }
+            frameRef = nativeTakeNewFrame(dispatcherRef);
+        }
+        if (frameRef == 0) {
+            return null;
+        }
+        // createVideoBuffer puts a hold on the frame which
+        // HandleRendererEvents releases once the listeners are done
+        return new NewFrameEvent(NativeVideoBuffer.createVideoBuffer(frameRef));
+    }
+
+    private static native long nativeTakeNewFrame(long dispatcherRef);
+
+    private static final class FrameAvailableEvent extends PlayerEvent {
+        private final long dispatcherRef;
+
+        FrameAvailableEvent(long dispatcherRef) {
+            this.dispatcherRef = dispatcherRef;
+        }
+    }
+
     protected void sendFrameSizeChangedEvent(int width, int height) {
         sendPlayerEvent(new FrameSizeChangedEvent(width, height));
     }
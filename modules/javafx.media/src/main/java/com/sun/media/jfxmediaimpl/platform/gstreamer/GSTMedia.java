@@ -64,7 +64,7 @@ final class GSTMedia extends NativeMedia {
         Locator loc = getLocator();
         ret = MediaError.getFromCode(gstInitNativeMedia(loc,
                 loc.getContentType(), loc.getContentLength(),
-                nativeMediaHandle));
+                loc.isLowLatency(), loc.isSharedClock(), nativeMediaHandle));
         if (ret != MediaError.ERROR_NONE && ret != MediaError.ERROR_PLATFORM_UNSUPPORTED) {
             MediaUtils.nativeError(this, ret);
         }
@@ -92,6 +92,8 @@ final class GSTMedia extends NativeMedia {
     private native int gstInitNativeMedia(Locator locator,
                                                String contentType,
                                                long sizeHint,
+                                               boolean lowLatency,
+                                               boolean sharedClock,
                                                long[] nativeMediaHandle);
     private native void gstDispose(long refNativeMedia);
 }
@@ -104,6 +104,14 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
         }
     }
 
+    @Override
+    protected void playerGetStatistics(long[] values) throws MediaException {
+        int rc = gstGetStatistics(gstMedia.getNativeMediaRef(), values);
+        if (0 != rc) {
+            throwMediaErrorException(rc, null);
+        }
+    }
+
     @Override
     protected void playerPlay() throws MediaException {
         int rc = gstPlay(gstMedia.getNativeMediaRef());
@@ -284,6 +292,7 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
     private native long gstGetAudioSpectrum(long refNativeMedia);
     private native int gstGetAudioSyncDelay(long refNativeMedia, long[] syncDelay);
     private native int gstSetAudioSyncDelay(long refNativeMedia, long delay);
+    private native int gstGetStatistics(long refNativeMedia, long[] statistics);
     private native int gstPlay(long refNativeMedia);
     private native int gstPause(long refNativeMedia);
     private native int gstStop(long refNativeMedia);
@@ -0,0 +1,297 @@
+/* GStreamer
+ * Copyright (C) <2026> Oracle and/or its affiliates. All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* SSE and SSE2 inner product kernels for gstreamer-lite, which is built
+ * without ORC and so cannot use the runtime selected x86 kernels of
+ * upstream.  This header is only included when SSE2 is part of the
+ * baseline the library is compiled for, so the kernels are always safe
+ * to install.
+ *
+ * The kernels rely on the taps being 16 byte aligned and never read past
+ * the samples and taps the C versions read.  The gint16 kernels keep the
+ * 32 bit accumulation of the C versions and give identical results.  The
+ * float kernels only differ in the order the partial sums are added.
+ */
+
+#include <emmintrin.h>
+
+static inline void
+inner_product_gfloat_full_1_sse (gfloat * o, const gfloat * a,
+    const gfloat * b, gint len, const gfloat * icoeff, gint bstride)
+{
+  gint i;
+  __m128 sum = _mm_setzero_ps ();
+
+  for (i = 0; i < len; i += 4)
+    sum = _mm_add_ps (sum, _mm_mul_ps (_mm_loadu_ps (a + i),
+            _mm_load_ps (b + i)));
+  sum = _mm_add_ps (sum, _mm_movehl_ps (sum, sum));
+  sum = _mm_add_ss (sum, _mm_shuffle_ps (sum, sum, 0x55));
+  _mm_store_ss (o, sum);
+}
+
+static inline void
+inner_product_gfloat_linear_1_sse (gfloat * o, const gfloat * a,
+    const gfloat * b, gint len, const gfloat * icoeff, gint bstride)
+{
+  gint i;
+  __m128 sum[2], t;
+  const gfloat *c[2] = { (gfloat *) ((gint8 *) b + 0 * bstride),
+    (gfloat *) ((gint8 *) b + 1 * bstride)
+  };
+
+  sum[0] = sum[1] = _mm_setzero_ps ();
+
+  for (i = 0; i < len; i += 4) {
+    t = _mm_loadu_ps (a + i);
+    sum[0] = _mm_add_ps (sum[0], _mm_mul_ps (t, _mm_load_ps (c[0] + i)));
+    sum[1] = _mm_add_ps (sum[1], _mm_mul_ps (t, _mm_load_ps (c[1] + i)));
+  }
+  sum[0] = _mm_mul_ps (_mm_sub_ps (sum[0], sum[1]), _mm_load1_ps (icoeff));
+  sum[0] = _mm_add_ps (sum[0], sum[1]);
+  sum[0] = _mm_add_ps (sum[0], _mm_movehl_ps (sum[0], sum[0]));
+  sum[0] = _mm_add_ss (sum[0], _mm_shuffle_ps (sum[0], sum[0], 0x55));
+  _mm_store_ss (o, sum[0]);
+}
+
+static inline void
+inner_product_gfloat_cubic_1_sse (gfloat * o, const gfloat * a,
+    const gfloat * b, gint len, const gfloat * icoeff, gint bstride)
+{
+  gint i;
+  __m128 sum[4], t;
+  const gfloat *c[4] = { (gfloat *) ((gint8 *) b + 0 * bstride),
+    (gfloat *) ((gint8 *) b + 1 * bstride),
+    (gfloat *) ((gint8 *) b + 2 * bstride),
+    (gfloat *) ((gint8 *) b + 3 * bstride)
+  };
+
+  sum[0] = sum[1] = sum[2] = sum[3] = _mm_setzero_ps ();
+
+  for (i = 0; i < len; i += 4) {
+    t = _mm_loadu_ps (a + i);
+    sum[0] = _mm_add_ps (sum[0], _mm_mul_ps (t, _mm_load_ps (c[0] + i)));
+    sum[1] = _mm_add_ps (sum[1], _mm_mul_ps (t, _mm_load_ps (c[1] + i)));
+    sum[2] = _mm_add_ps (sum[2], _mm_mul_ps (t, _mm_load_ps (c[2] + i)));
+    sum[3] = _mm_add_ps (sum[3], _mm_mul_ps (t, _mm_load_ps (c[3] + i)));
+  }
+  sum[0] = _mm_mul_ps (sum[0], _mm_load1_ps (icoeff + 0));
+  sum[0] = _mm_add_ps (sum[0], _mm_mul_ps (sum[1], _mm_load1_ps (icoeff + 1)));
+  sum[0] = _mm_add_ps (sum[0], _mm_mul_ps (sum[2], _mm_load1_ps (icoeff + 2)));
+  sum[0] = _mm_add_ps (sum[0], _mm_mul_ps (sum[3], _mm_load1_ps (icoeff + 3)));
+  sum[0] = _mm_add_ps (sum[0], _mm_movehl_ps (sum[0], sum[0]));
+  sum[0] = _mm_add_ss (sum[0], _mm_shuffle_ps (sum[0], sum[0], 0x55));
+  _mm_store_ss (o, sum[0]);
+}
+
+MAKE_RESAMPLE_FUNC_STATIC (gfloat, full, 1, sse);
+MAKE_RESAMPLE_FUNC_STATIC (gfloat, linear, 1, sse);
+MAKE_RESAMPLE_FUNC_STATIC (gfloat, cubic, 1, sse);
+
+static inline gint32
+hsum_epi32_sse2 (__m128i sum)
+{
+  sum = _mm_add_epi32 (sum, _mm_shuffle_epi32 (sum, _MM_SHUFFLE (1, 0, 3, 2)));
+  sum = _mm_add_epi32 (sum, _mm_shuffle_epi32 (sum, _MM_SHUFFLE (2, 3, 0, 1)));
+  return _mm_cvtsi128_si32 (sum);
+}
+
+static inline void
+inner_product_gint16_full_1_sse2 (gint16 * o, const gint16 * a,
+    const gint16 * b, gint len, const gint16 * icoeff, gint bstride)
+{
+  gint i;
+  gint32 res;
+  __m128i sum = _mm_setzero_si128 ();
+
+  for (i = 0; i + 8 <= len; i += 8) {
+    sum = _mm_add_epi32 (sum,
+        _mm_madd_epi16 (_mm_loadu_si128 ((__m128i *) (a + i)),
+            _mm_load_si128 ((__m128i *) (b + i))));
+  }
+  /* the short filters of the linear and cubic methods are done in fours,
+   * like the C version, so that no more input is read than there */
+  for (; i < len; i += 4) {
+    sum = _mm_add_epi32 (sum,
+        _mm_madd_epi16 (_mm_loadl_epi64 ((__m128i *) (a + i)),
+            _mm_loadl_epi64 ((__m128i *) (b + i))));
+  }
+  res = hsum_epi32_sse2 (sum);
+  res = (res + (1 << (PRECISION_S16 - 1))) >> PRECISION_S16;
+  *o = CLAMP (res, -(1 << 15), (1 << 15) - 1);
+}
+
+static inline void
+inner_product_gint16_linear_1_sse2 (gint16 * o, const gint16 * a,
+    const gint16 * b, gint len, const gint16 * icoeff, gint bstride)
+{
+  gint i;
+  gint32 res[2], c0 = icoeff[0];
+  __m128i sum[2], t;
+  const gint16 *c[2] = { (gint16 *) ((gint8 *) b + 0 * bstride),
+    (gint16 *) ((gint8 *) b + 1 * bstride)
+  };
+
+  sum[0] = sum[1] = _mm_setzero_si128 ();
+
+  for (i = 0; i < len; i += 8) {
+    t = _mm_loadu_si128 ((__m128i *) (a + i));
+    sum[0] = _mm_add_epi32 (sum[0],
+        _mm_madd_epi16 (t, _mm_load_si128 ((__m128i *) (c[0] + i))));
+    sum[1] = _mm_add_epi32 (sum[1],
+        _mm_madd_epi16 (t, _mm_load_si128 ((__m128i *) (c[1] + i))));
+  }
+  res[0] = hsum_epi32_sse2 (sum[0]) >> PRECISION_S16;
+  res[1] = hsum_epi32_sse2 (sum[1]) >> PRECISION_S16;
+  res[0] = ((gint32) (gint16) res[0] - (gint32) (gint16) res[1]) * c0 +
+      ((gint32) (gint16) res[1] << PRECISION_S16);
+  res[0] = (res[0] + (1 << (PRECISION_S16 - 1))) >> PRECISION_S16;
+  *o = CLAMP (res[0], -(1 << 15), (1 << 15) - 1);
+}
+
+static inline void
+inner_product_gint16_cubic_1_sse2 (gint16 * o, const gint16 * a,
+    const gint16 * b, gint len, const gint16 * icoeff, gint bstride)
+{
+  gint i;
+  gint32 res;
+  __m128i sum[4], t;
+  const gint16 *c[4] = { (gint16 *) ((gint8 *) b + 0 * bstride),
+    (gint16 *) ((gint8 *) b + 1 * bstride),
+    (gint16 *) ((gint8 *) b + 2 * bstride),
+    (gint16 *) ((gint8 *) b + 3 * bstride)
+  };
+
+  sum[0] = sum[1] = sum[2] = sum[3] = _mm_setzero_si128 ();
+
+  for (i = 0; i < len; i += 8) {
+    t = _mm_loadu_si128 ((__m128i *) (a + i));
+    sum[0] = _mm_add_epi32 (sum[0],
+        _mm_madd_epi16 (t, _mm_load_si128 ((__m128i *) (c[0] + i))));
+    sum[1] = _mm_add_epi32 (sum[1],
+        _mm_madd_epi16 (t, _mm_load_si128 ((__m128i *) (c[1] + i))));
+    sum[2] = _mm_add_epi32 (sum[2],
+        _mm_madd_epi16 (t, _mm_load_si128 ((__m128i *) (c[2] + i))));
+    sum[3] = _mm_add_epi32 (sum[3],
+        _mm_madd_epi16 (t, _mm_load_si128 ((__m128i *) (c[3] + i))));
+  }
+  res = (gint32) (gint16) (hsum_epi32_sse2 (sum[0]) >> PRECISION_S16) *
+      (gint32) icoeff[0] +
+      (gint32) (gint16) (hsum_epi32_sse2 (sum[1]) >> PRECISION_S16) *
+      (gint32) icoeff[1] +
+      (gint32) (gint16) (hsum_epi32_sse2 (sum[2]) >> PRECISION_S16) *
+      (gint32) icoeff[2] +
+      (gint32) (gint16) (hsum_epi32_sse2 (sum[3]) >> PRECISION_S16) *
+      (gint32) icoeff[3];
+  res = (res + (1 << (PRECISION_S16 - 1))) >> PRECISION_S16;
+  *o = CLAMP (res, -(1 << 15), (1 << 15) - 1);
+}
+
+MAKE_RESAMPLE_FUNC_STATIC (gint16, full, 1, sse2);
+MAKE_RESAMPLE_FUNC_STATIC (gint16, linear, 1, sse2);
+MAKE_RESAMPLE_FUNC_STATIC (gint16, cubic, 1, sse2);
+
+static inline void
+inner_product_gdouble_full_1_sse2 (gdouble * o, const gdouble * a,
+    const gdouble * b, gint len, const gdouble * icoeff, gint bstride)
+{
+  gint i;
+  __m128d sum = _mm_setzero_pd ();
+
+  for (i = 0; i < len; i += 4) {
+    sum = _mm_add_pd (sum,
+        _mm_mul_pd (_mm_loadu_pd (a + i + 0), _mm_load_pd (b + i + 0)));
+    sum = _mm_add_pd (sum,
+        _mm_mul_pd (_mm_loadu_pd (a + i + 2), _mm_load_pd (b + i + 2)));
+  }
+  sum = _mm_add_sd (sum, _mm_unpackhi_pd (sum, sum));
+  _mm_store_sd (o, sum);
+}
+
+static inline void
+inner_product_gdouble_linear_1_sse2 (gdouble * o, const gdouble * a,
+    const gdouble * b, gint len, const gdouble * icoeff, gint bstride)
+{
+  gint i;
+  __m128d sum[2], t;
+  const gdouble *c[2] = { (gdouble *) ((gint8 *) b + 0 * bstride),
+    (gdouble *) ((gint8 *) b + 1 * bstride)
+  };
+
+  sum[0] = sum[1] = _mm_setzero_pd ();
+
+  for (i = 0; i < len; i += 2) {
+    t = _mm_loadu_pd (a + i);
+    sum[0] = _mm_add_pd (sum[0], _mm_mul_pd (t, _mm_load_pd (c[0] + i)));
+    sum[1] = _mm_add_pd (sum[1], _mm_mul_pd (t, _mm_load_pd (c[1] + i)));
+  }
+  sum[0] = _mm_mul_pd (_mm_sub_pd (sum[0], sum[1]), _mm_load1_pd (icoeff));
+  sum[0] = _mm_add_pd (sum[0], sum[1]);
+  sum[0] = _mm_add_sd (sum[0], _mm_unpackhi_pd (sum[0], sum[0]));
+  _mm_store_sd (o, sum[0]);
+}
+
+static inline void
+inner_product_gdouble_cubic_1_sse2 (gdouble * o, const gdouble * a,
+    const gdouble * b, gint len, const gdouble * icoeff, gint bstride)
+{
+  gint i;
+  __m128d sum[4], t;
+  const gdouble *c[4] = { (gdouble *) ((gint8 *) b + 0 * bstride),
+    (gdouble *) ((gint8 *) b + 1 * bstride),
+    (gdouble *) ((gint8 *) b + 2 * bstride),
+    (gdouble *) ((gint8 *) b + 3 * bstride)
+  };
+
+  sum[0] = sum[1] = sum[2] = sum[3] = _mm_setzero_pd ();
+
+  for (i = 0; i < len; i += 2) {
+    t = _mm_loadu_pd (a + i);
+    sum[0] = _mm_add_pd (sum[0], _mm_mul_pd (t, _mm_load_pd (c[0] + i)));
+    sum[1] = _mm_add_pd (sum[1], _mm_mul_pd (t, _mm_load_pd (c[1] + i)));
+    sum[2] = _mm_add_pd (sum[2], _mm_mul_pd (t, _mm_load_pd (c[2] + i)));
+    sum[3] = _mm_add_pd (sum[3], _mm_mul_pd (t, _mm_load_pd (c[3] + i)));
+  }
+  sum[0] = _mm_mul_pd (sum[0], _mm_load1_pd (icoeff + 0));
+  sum[0] = _mm_add_pd (sum[0], _mm_mul_pd (sum[1], _mm_load1_pd (icoeff + 1)));
+  sum[0] = _mm_add_pd (sum[0], _mm_mul_pd (sum[2], _mm_load1_pd (icoeff + 2)));
+  sum[0] = _mm_add_pd (sum[0], _mm_mul_pd (sum[3], _mm_load1_pd (icoeff + 3)));
+  sum[0] = _mm_add_sd (sum[0], _mm_unpackhi_pd (sum[0], sum[0]));
+  _mm_store_sd (o, sum[0]);
+}
+
+MAKE_RESAMPLE_FUNC_STATIC (gdouble, full, 1, sse2);
+MAKE_RESAMPLE_FUNC_STATIC (gdouble, linear, 1, sse2);
+MAKE_RESAMPLE_FUNC_STATIC (gdouble, cubic, 1, sse2);
+
+static void
+audio_resampler_check_sse2 (void)
+{
+  resample_gfloat_full_1 = resample_gfloat_full_1_sse;
+  resample_gfloat_linear_1 = resample_gfloat_linear_1_sse;
+  resample_gfloat_cubic_1 = resample_gfloat_cubic_1_sse;
+
+  resample_gint16_full_1 = resample_gint16_full_1_sse2;
+  resample_gint16_linear_1 = resample_gint16_linear_1_sse2;
+  resample_gint16_cubic_1 = resample_gint16_cubic_1_sse2;
+
+  resample_gdouble_full_1 = resample_gdouble_full_1_sse2;
+  resample_gdouble_linear_1 = resample_gdouble_linear_1_sse2;
+  resample_gdouble_cubic_1 = resample_gdouble_cubic_1_sse2;
+}
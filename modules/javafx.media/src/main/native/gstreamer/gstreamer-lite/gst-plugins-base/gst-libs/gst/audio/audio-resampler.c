@@ -833,6 +833,16 @@ static ResampleFunc resample_funcs[] = {
 # endif
 #endif
 
+#ifdef GSTREAMER_LITE
+/* There is no ORC to tell which SIMD kernels the CPU can run, so only use
+ * the ones that the compiler already assumes */
+#if defined (__SSE2__) || defined (_M_X64) || \
+    (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+# define CHECK_SSE2
+# include "audio-resampler-sse2.h"
+#endif
+#endif // GSTREAMER_LITE
+
 static void
 audio_resampler_init (void)
 {
@@ -874,6 +884,10 @@ audio_resampler_init (void)
         }
       }
     }
+#endif
+#ifdef CHECK_SSE2
+    GST_DEBUG ("using SSE2 resampler functions");
+    audio_resampler_check_sse2 ();
 #endif
     g_once_init_leave (&init_gonce, 1);
   }
@@ -744,16 +744,60 @@ gst_iir_equalizer_compute_frequencies (GstIirEqualizer * equ, guint new_count)
   BANDS_UNLOCK (equ);
 }
 
+/* Coefficients of a band that is not bypassed, gathered once per buffer so
+ * that the inner loops do not have to go through the band objects */
+typedef struct {
+  gdouble b1, b2;
+  gdouble a0, a1, a2;
+} SecondOrderCoeffs;
+
+/* A band at 0 dB passes its input through unchanged, so only the other
+ * bands are run.  Returns their number and fills their coefficients and
+ * their positions in the band list. */
+static guint
+get_active_bands (GstIirEqualizer * equ, SecondOrderCoeffs * coeffs,
+    guint * index)
+{
+  guint f, n = 0;
+
+  for (f = 0; f < equ->freq_band_count; f++) {
+    GstIirEqualizerBand *band = equ->bands[f];
+
+    if (band->gain == 0.0)
+      continue;
+    coeffs[n].b1 = band->b1;
+    coeffs[n].b2 = band->b2;
+    coeffs[n].a0 = band->a0;
+    coeffs[n].a1 = band->a1;
+    coeffs[n].a2 = band->a2;
+    index[n++] = f;
+  }
+  return n;
+}
+
 /* start of code that is type specific */
 
-#define CREATE_OPTIMIZED_FUNCTIONS_INT(TYPE,BIG_TYPE,MIN_VAL,MAX_VAL)   \
+/* The history of a bypassed band is only brought up to date for the last
+ * two frames of a buffer, which is all it needs to carry on without a click
+ * once the band has a gain again.
+ *
+ * Stereo streams keep the history of both channels side by side and run
+ * the channels in lockstep, so that the compiler can process them in the
+ * two lanes of a vector register.
+ */
+#define CREATE_FILTER_FUNCTIONS(TYPE,BIG_TYPE)                          \
 typedef struct {                                                        \
   BIG_TYPE x1, x2;          /* history of input values for a filter */  \
   BIG_TYPE y1, y2;          /* history of output values for a filter */ \
 } SecondOrderHistory ## TYPE;                                           \
                                                                         \
+typedef struct {                                                        \
+  BIG_TYPE x1[2], x2[2];    /* history of input values for a filter */  \
+  BIG_TYPE y1[2], y2[2];    /* history of output values for a filter */ \
+} SecondOrderHistoryStereo ## TYPE;                                     \
+                                                                        \
 static inline BIG_TYPE                                                  \
-one_step_ ## TYPE (GstIirEqualizerBand *filter,                         \
+one_step_ ## TYPE (const SecondOrderCoeffs *filter,                     \
     SecondOrderHistory ## TYPE *history, BIG_TYPE input)                \
 {                                                                       \
   /* calculate output */                                                \
@@ -769,80 +813,202 @@ one_step_ ## TYPE (GstIirEqualizerBand *filter,                         \
   return output;                                                        \
 }                                                                       \
                                                                         \
+static inline void                                                      \
+bypass_step_ ## TYPE (SecondOrderHistory ## TYPE *history,              \
+    BIG_TYPE input)                                                     \
+{                                                                       \
+  history->y2 = history->y1;                                            \
+  history->y1 = input;                                                  \
+  history->x2 = history->x1;                                            \
+  history->x1 = input;                                                  \
+}                                                                       \
+                                                                        \
+static inline BIG_TYPE                                                  \
+filter_ ## TYPE (const SecondOrderCoeffs *coeffs, const guint *index,   \
+    guint n, guint nf, SecondOrderHistory ## TYPE *history,             \
+    BIG_TYPE cur, gboolean tail)                                        \
+{                                                                       \
+  guint f, j;                                                           \
+                                                                        \
+  if (G_LIKELY (!tail || n == nf)) {                                    \
+    for (j = 0; j < n; j++)                                             \
+      cur = one_step_ ## TYPE (&coeffs[j], &history[index[j]], cur);    \
+  } else {                                                              \
+    for (f = 0, j = 0; f < nf; f++) {                                   \
+      if (j < n && index[j] == f) {                                     \
+        cur = one_step_ ## TYPE (&coeffs[j], &history[f], cur);         \
+        j++;                                                            \
+      } else {                                                          \
+        bypass_step_ ## TYPE (&history[f], cur);                        \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+  return cur;                                                           \
+}                                                                       \
+                                                                        \
+static inline void                                                      \
+one_step_stereo_ ## TYPE (const SecondOrderCoeffs *filter,              \
+    SecondOrderHistoryStereo ## TYPE *history, BIG_TYPE cur[2])         \
+{                                                                       \
+  BIG_TYPE output[2];                                                   \
+  gint c;                                                               \
+                                                                        \
+  for (c = 0; c < 2; c++) {                                             \
+    output[c] = filter->a0 * cur[c] +                                   \
+        filter->a1 * history->x1[c] + filter->a2 * history->x2[c] +     \
+        filter->b1 * history->y1[c] + filter->b2 * history->y2[c];      \
+  }                                                                     \
+  for (c = 0; c < 2; c++) {                                             \
+    history->y2[c] = history->y1[c];                                    \
+    history->y1[c] = output[c];                                         \
+    history->x2[c] = history->x1[c];                                    \
+    history->x1[c] = cur[c];                                            \
+    cur[c] = output[c];                                                 \
+  }                                                                     \
+}                                                                       \
+                                                                        \
+static inline void                                                      \
+bypass_step_stereo_ ## TYPE (SecondOrderHistoryStereo ## TYPE *history, \
+    const BIG_TYPE cur[2])                                              \
+{                                                                       \
+  gint c;                                                               \
+                                                                        \
+  for (c = 0; c < 2; c++) {                                             \
+    history->y2[c] = history->y1[c];                                    \
+    history->y1[c] = cur[c];                                            \
+    history->x2[c] = history->x1[c];                                    \
+    history->x1[c] = cur[c];                                            \
+  }                                                                     \
+}                                                                       \
+                                                                        \
+static inline void                                                      \
+filter_stereo_ ## TYPE (const SecondOrderCoeffs *coeffs,                \
+    const guint *index, guint n, guint nf,                              \
+    SecondOrderHistoryStereo ## TYPE *history, BIG_TYPE cur[2],         \
+    gboolean tail)                                                      \
+{                                                                       \
+  guint f, j;                                                           \
+                                                                        \
+  if (G_LIKELY (!tail || n == nf)) {                                    \
+    for (j = 0; j < n; j++)                                             \
+      one_step_stereo_ ## TYPE (&coeffs[j], &history[index[j]], cur);   \
+  } else {                                                              \
+    for (f = 0, j = 0; f < nf; f++) {                                   \
+      if (j < n && index[j] == f) {                                     \
+        one_step_stereo_ ## TYPE (&coeffs[j], &history[f], cur);        \
+        j++;                                                            \
+      } else {                                                          \
+        bypass_step_stereo_ ## TYPE (&history[f], cur);                 \
+      }                                                                 \
+    }                                                                   \
+  }                                                                     \
+}                                                                       \
+                                                                        \
 static const guint                                                      \
-history_size_ ## TYPE = sizeof (SecondOrderHistory ## TYPE);            \
+history_size_ ## TYPE = sizeof (SecondOrderHistory ## TYPE);
+
+#define CREATE_OPTIMIZED_FUNCTIONS_INT(TYPE,BIG_TYPE,MIN_VAL,MAX_VAL)   \
+CREATE_FILTER_FUNCTIONS (TYPE, BIG_TYPE)                                \
                                                                         \
 static void                                                             \
 gst_iir_equ_process_ ## TYPE (GstIirEqualizer *equ, guint8 *data,       \
 guint size, guint channels)                                             \
 {                                                                       \
   guint frames = size / channels / sizeof (TYPE);                       \
-  guint i, c, f, nf = equ->freq_band_count;                             \
+  guint i, c, n, nf = equ->freq_band_count;                             \
   BIG_TYPE cur;                                                         \
-  GstIirEqualizerBand **filters = equ->bands;                           \
+  SecondOrderCoeffs *coeffs = g_newa (SecondOrderCoeffs, nf);           \
+  guint *index = g_newa (guint, nf);                                    \
+                                                                        \
+  n = get_active_bands (equ, coeffs, index);                            \
                                                                         \
   for (i = 0; i < frames; i++) {                                        \
     SecondOrderHistory ## TYPE *history = equ->history;                 \
+    gboolean tail = i + 2 >= frames;                                    \
     for (c = 0; c < channels; c++) {                                    \
       cur = *((TYPE *) data);                                           \
-      for (f = 0; f < nf; f++) {                                        \
-        cur = one_step_ ## TYPE (filters[f], history, cur);             \
-        history++;                                                      \
-      }                                                                 \
+      cur = filter_ ## TYPE (coeffs, index, n, nf, history, cur, tail); \
       cur = CLAMP (cur, MIN_VAL, MAX_VAL);                              \
       *((TYPE *) data) = (TYPE) floor (cur);                            \
       data += sizeof (TYPE);                                            \
+      history += nf;                                                    \
     }                                                                   \
   }                                                                     \
-}
-
-#define CREATE_OPTIMIZED_FUNCTIONS(TYPE)                                \
-typedef struct {                                                        \
-  TYPE x1, x2;          /* history of input values for a filter */  \
-  TYPE y1, y2;          /* history of output values for a filter */ \
-} SecondOrderHistory ## TYPE;                                           \
+}                                                                       \
                                                                         \
-static inline TYPE                                                      \
-one_step_ ## TYPE (GstIirEqualizerBand *filter,                         \
-    SecondOrderHistory ## TYPE *history, TYPE input)                    \
+static void                                                             \
+gst_iir_equ_process_stereo_ ## TYPE (GstIirEqualizer *equ,              \
+guint8 *data, guint size, guint channels)                               \
 {                                                                       \
-  /* calculate output */                                                \
-  TYPE output = filter->a0 * input + filter->a1 * history->x1 +         \
-      filter->a2 * history->x2 + filter->b1 * history->y1 +             \
-      filter->b2 * history->y2;                                         \
-  /* update history */                                                  \
-  history->y2 = history->y1;                                            \
-  history->y1 = output;                                                 \
-  history->x2 = history->x1;                                            \
-  history->x1 = input;                                                  \
+  guint frames = size / 2 / sizeof (TYPE);                              \
+  guint i, c, n, nf = equ->freq_band_count;                             \
+  BIG_TYPE cur[2];                                                      \
+  SecondOrderCoeffs *coeffs = g_newa (SecondOrderCoeffs, nf);           \
+  guint *index = g_newa (guint, nf);                                    \
+  SecondOrderHistoryStereo ## TYPE *history = equ->history;             \
                                                                         \
-  return output;                                                        \
-}                                                                       \
+  n = get_active_bands (equ, coeffs, index);                            \
                                                                         \
-static const guint                                                      \
-history_size_ ## TYPE = sizeof (SecondOrderHistory ## TYPE);            \
+  for (i = 0; i < frames; i++) {                                        \
+    TYPE *samples = (TYPE *) data;                                      \
+    for (c = 0; c < 2; c++)                                             \
+      cur[c] = samples[c];                                              \
+    filter_stereo_ ## TYPE (coeffs, index, n, nf, history, cur,         \
+        i + 2 >= frames);                                               \
+    for (c = 0; c < 2; c++) {                                           \
+      cur[c] = CLAMP (cur[c], MIN_VAL, MAX_VAL);                        \
+      samples[c] = (TYPE) floor (cur[c]);                               \
+    }                                                                   \
+    data += 2 * sizeof (TYPE);                                          \
+  }                                                                     \
+}
+
+#define CREATE_OPTIMIZED_FUNCTIONS(TYPE)                                \
+CREATE_FILTER_FUNCTIONS (TYPE, TYPE)                                    \
                                                                         \
 static void                                                             \
 gst_iir_equ_process_ ## TYPE (GstIirEqualizer *equ, guint8 *data,       \
 guint size, guint channels)                                             \
 {                                                                       \
   guint frames = size / channels / sizeof (TYPE);                       \
-  guint i, c, f, nf = equ->freq_band_count;                             \
+  guint i, c, n, nf = equ->freq_band_count;                             \
   TYPE cur;                                                             \
-  GstIirEqualizerBand **filters = equ->bands;                           \
+  SecondOrderCoeffs *coeffs = g_newa (SecondOrderCoeffs, nf);           \
+  guint *index = g_newa (guint, nf);                                    \
+                                                                        \
+  n = get_active_bands (equ, coeffs, index);                            \
                                                                         \
   for (i = 0; i < frames; i++) {                                        \
     SecondOrderHistory ## TYPE *history = equ->history;                 \
+    gboolean tail = i + 2 >= frames;                                    \
     for (c = 0; c < channels; c++) {                                    \
       cur = *((TYPE *) data);                                           \
-      for (f = 0; f < nf; f++) {                                        \
-        cur = one_step_ ## TYPE (filters[f], history, cur);             \
-        history++;                                                      \
-      }                                                                 \
+      cur = filter_ ## TYPE (coeffs, index, n, nf, history, cur, tail); \
       *((TYPE *) data) = (TYPE) cur;                                    \
       data += sizeof (TYPE);                                            \
+      history += nf;                                                    \
     }                                                                   \
   }                                                                     \
+}                                                                       \
+                                                                        \
+static void                                                             \
+gst_iir_equ_process_stereo_ ## TYPE (GstIirEqualizer *equ,              \
+guint8 *data, guint size, guint channels)                               \
+{                                                                       \
+  guint frames = size / 2 / sizeof (TYPE);                              \
+  guint i, n, nf = equ->freq_band_count;                                \
+  TYPE *samples = (TYPE *) data;                                        \
+  SecondOrderCoeffs *coeffs = g_newa (SecondOrderCoeffs, nf);           \
+  guint *index = g_newa (guint, nf);                                    \
+  SecondOrderHistoryStereo ## TYPE *history = equ->history;             \
+                                                                        \
+  n = get_active_bands (equ, coeffs, index);                            \
+                                                                        \
+  for (i = 0; i < frames; i++) {                                        \
+    filter_stereo_ ## TYPE (coeffs, index, n, nf, history, samples,     \
+        i + 2 >= frames);                                               \
+    samples += 2;                                                       \
+  }                                                                     \
 }
 
 CREATE_OPTIMIZED_FUNCTIONS_INT (gint16, gfloat, -32768.0, 32767.0);
@@ -900,19 +1066,23 @@ static gboolean
 gst_iir_equalizer_setup (GstAudioFilter * audio, const GstAudioInfo * info)
 {
   GstIirEqualizer *equ = GST_IIR_EQUALIZER (audio);
+  gboolean stereo = GST_AUDIO_INFO_CHANNELS (info) == 2;
 
   switch (GST_AUDIO_INFO_FORMAT (info)) {
     case GST_AUDIO_FORMAT_S16:
       equ->history_size = history_size_gint16;
-      equ->process = gst_iir_equ_process_gint16;
+      equ->process = stereo ? gst_iir_equ_process_stereo_gint16 :
+          gst_iir_equ_process_gint16;
       break;
     case GST_AUDIO_FORMAT_F32:
       equ->history_size = history_size_gfloat;
-      equ->process = gst_iir_equ_process_gfloat;
+      equ->process = stereo ? gst_iir_equ_process_stereo_gfloat :
+          gst_iir_equ_process_gfloat;
       break;
     case GST_AUDIO_FORMAT_F64:
       equ->history_size = history_size_gdouble;
-      equ->process = gst_iir_equ_process_gdouble;
+      equ->process = stereo ? gst_iir_equ_process_stereo_gdouble :
+          gst_iir_equ_process_gdouble;
       break;
     default:
       return FALSE;
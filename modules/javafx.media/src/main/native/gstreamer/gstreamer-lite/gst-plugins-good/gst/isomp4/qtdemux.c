@@ -999,6 +999,11 @@ gst_qtdemux_find_index_linear (GstQTDemux * qtdemux, QtDemuxStream * str,
     index = gst_qtdemux_find_index (qtdemux, str, media_time);
     sample = str->samples + index;
   } else {
+#ifdef GSTREAMER_LITE
+    /* samples up to stbl_index are all before mov_time, resume from there */
+    if (str->stbl_index > 0)
+      index = str->stbl_index;
+#endif // GSTREAMER_LITE
     while (index < str->n_samples - 1) {
       if (!qtdemux_parse_samples (qtdemux, str, index + 1))
         goto parse_failed;
@@ -1052,6 +1057,38 @@ gst_qtdemux_find_keyframe (GstQTDemux * qtdemux, QtDemuxStream * str,
     goto beach;
   }
 
+#ifdef GSTREAMER_LITE
+  /* keyframes of the parsed moov samples are cached, search them first */
+  if (!qtdemux->fragmented && str->keyframes && str->keyframes->len > 0
+      && (gint64) index <= str->stbl_index) {
+    guint32 *keyframes = (guint32 *) str->keyframes->data;
+    guint32 low = 0, high = str->keyframes->len;
+
+    /* find the first cached keyframe after index */
+    while (low < high) {
+      guint32 mid = low + (high - low) / 2;
+      if (keyframes[mid] <= index)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+
+    if (!next) {
+      /* sample 0 is used when there is no keyframe before index */
+      new_index = low > 0 ? keyframes[low - 1] : 0;
+      goto beach;
+    } else if (low > 0 && keyframes[low - 1] == index) {
+      new_index = index;
+      goto beach;
+    } else if (low < str->keyframes->len) {
+      new_index = keyframes[low];
+      goto beach;
+    }
+    /* next keyframe is not parsed yet, continue after the cached ones */
+    new_index = str->stbl_index + 1;
+  }
+#endif // GSTREAMER_LITE
+
   /* else search until we have a keyframe */
   while (new_index < str->n_samples) {
     if (next && !qtdemux_parse_samples (qtdemux, str, new_index))
@@ -2600,6 +2637,12 @@ gst_qtdemux_stream_flush_samples_data (QtDemuxStream * stream)
   g_free (stream->samples);
   stream->samples = NULL;
   gst_qtdemux_stbl_free (stream);
+#ifdef GSTREAMER_LITE
+  if (stream->keyframes) {
+    g_array_free (stream->keyframes, TRUE);
+    stream->keyframes = NULL;
+  }
+#endif // GSTREAMER_LITE
 
   /* fragments */
   g_free (stream->ra_entries);
@@ -10901,6 +10944,20 @@ done3:
       stream->all_keyframe = TRUE;
       GST_DEBUG_OBJECT (qtdemux, "setting all keyframes");
     }
+#ifdef GSTREAMER_LITE
+    /* Remember the keyframes of the newly parsed range, so seeking can
+     * binary search them instead of walking back sample by sample. */
+    if (!stream->all_keyframe) {
+      if (!stream->keyframes)
+        stream->keyframes = g_array_new (FALSE, FALSE, sizeof (guint32));
+      for (cur = first; cur <= last; cur++) {
+        if (cur->keyframe) {
+          guint32 index = cur - samples;
+          g_array_append_val (stream->keyframes, index);
+        }
+      }
+    }
+#endif // GSTREAMER_LITE
   }
 
 ctts:
@@ -408,6 +408,9 @@ struct _QtDemuxStream
   guint32 n_samples;
   QtDemuxSample *samples;
   gboolean all_keyframe;        /* TRUE when all samples are keyframes (no stss) */
+#ifdef GSTREAMER_LITE
+  GArray *keyframes;            /* sorted indices of parsed keyframe samples */
+#endif // GSTREAMER_LITE
   guint32 n_samples_moof;       /* sample count in a moof */
   guint64 duration_moof;        /* duration in timescale of a moof, used for figure out
                                  * the framerate of fragmented format stream */
@@ -260,6 +260,14 @@ gst_spectrum_alloc_channel_data (GstSpectrum * spectrum)
     cd->freqdata = g_new0 (GstFFTF32Complex, bands);
     cd->spect_magnitude = g_new0 (gfloat, bands);
     cd->spect_phase = g_new0 (gfloat, bands);
+#ifdef GSTREAMER_LITE
+    {
+      guint n;
+      cd->window = g_new (gfloat, nfft);
+      for (n = 0; n < nfft; n++)
+        cd->window[n] = (gfloat) (0.53836 - 0.46164 * cos (2.0 * G_PI * n / nfft));
+    }
+#endif // GSTREAMER_LITE
   }
 }
 
@@ -282,6 +290,9 @@ gst_spectrum_free_channel_data (GstSpectrum * spectrum)
       g_free (cd->freqdata);
       g_free (cd->spect_magnitude);
       g_free (cd->spect_phase);
+#ifdef GSTREAMER_LITE
+      g_free (cd->window);
+#endif // GSTREAMER_LITE
     }
     g_free (spectrum->channel_data);
     spectrum->channel_data = NULL;
@@ -649,6 +660,7 @@ gst_spectrum_message_add_container (GstStructure * s, GType type,
   return (GValue *) gst_structure_get_value (s, name);
 }
 
+#ifndef GSTREAMER_LITE
 static void
 gst_spectrum_message_add_list (GValue * cv, gfloat * data, guint num_values)
 {
@@ -662,6 +674,7 @@ gst_spectrum_message_add_list (GValue * cv, gfloat * data, guint num_values)
   }
   g_value_unset (&v);
 }
+#endif // GSTREAMER_LITE
 
 static void
 gst_spectrum_message_add_array (GValue * cv, gfloat * data, guint num_values)
@@ -683,6 +696,19 @@ gst_spectrum_message_add_array (GValue * cv, gfloat * data, guint num_values)
   g_value_unset (&a);
 }
 
+#ifdef GSTREAMER_LITE
+static void
+gst_spectrum_message_add_bytes (GstStructure * s, const gchar * name,
+    gfloat * data, guint num_values)
+{
+  GValue v = G_VALUE_INIT;
+
+  g_value_init (&v, G_TYPE_BYTES);
+  g_value_take_boxed (&v, g_bytes_new (data, num_values * sizeof (gfloat)));
+  gst_structure_take_value (s, name, &v);
+}
+#endif // GSTREAMER_LITE
+
 static GstMessage *
 gst_spectrum_message_new (GstSpectrum * spectrum, GstClockTime timestamp,
     GstClockTime duration)
@@ -726,6 +752,16 @@ gst_spectrum_message_new (GstSpectrum * spectrum, GstClockTime timestamp,
   if (!spectrum->multi_channel) {
     cd = &spectrum->channel_data[0];
 
+#ifdef GSTREAMER_LITE
+    /* jfxmedia reads the bands as one block of floats, a list would need a
+     * GValue per band in every message. */
+    if (spectrum->message_magnitude)
+      gst_spectrum_message_add_bytes (s, "magnitude", cd->spect_magnitude,
+          spectrum->bands);
+    if (spectrum->message_phase)
+      gst_spectrum_message_add_bytes (s, "phase", cd->spect_phase,
+          spectrum->bands);
+#else // GSTREAMER_LITE
     if (spectrum->message_magnitude) {
       /* FIXME 0.11: this should be an array, not a list */
       mcv = gst_spectrum_message_add_container (s, GST_TYPE_LIST, "magnitude");
@@ -736,6 +772,7 @@ gst_spectrum_message_new (GstSpectrum * spectrum, GstClockTime timestamp,
       pcv = gst_spectrum_message_add_container (s, GST_TYPE_LIST, "phase");
       gst_spectrum_message_add_list (pcv, cd->spect_phase, spectrum->bands);
     }
+#endif // GSTREAMER_LITE
   } else {
     guint c;
     guint channels = GST_AUDIO_FILTER_CHANNELS (spectrum);
@@ -777,6 +814,38 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
   GstFFTF32Complex *freqdata = cd->freqdata;
   GstFFTF32 *fft_ctx = cd->fft_ctx;
 
+#ifdef GSTREAMER_LITE
+  /* Unroll the ring buffer with two copies and apply the cached window,
+   * instead of a modulo and a cosine per sample. */
+  gfloat *window = cd->window;
+
+  input_pos %= nfft;
+  memcpy (input_tmp, input + input_pos, (nfft - input_pos) * sizeof (gfloat));
+  memcpy (input_tmp + nfft - input_pos, input, input_pos * sizeof (gfloat));
+  for (i = 0; i < nfft; i++)
+    input_tmp[i] *= window[i];
+
+  gst_fft_f32_fft (fft_ctx, input_tmp, freqdata);
+
+  if (spectrum->message_magnitude) {
+    gfloat scale = 1.0f / ((gfloat) nfft * (gfloat) nfft);
+    gfloat val;
+    /* Calculate magnitude in db, in single precision */
+    for (i = 0; i < bands; i++) {
+      val = freqdata[i].r * freqdata[i].r + freqdata[i].i * freqdata[i].i;
+      val = 10.0f * log10f (val * scale);
+      if (val < threshold)
+        val = (gfloat) threshold;
+      spect_magnitude[i] += val;
+    }
+  }
+
+  if (spectrum->message_phase) {
+    /* Calculate phase */
+    for (i = 0; i < bands; i++)
+      spect_phase[i] += atan2f (freqdata[i].i, freqdata[i].r);
+  }
+#else // GSTREAMER_LITE
   for (i = 0; i < nfft; i++)
     input_tmp[i] = input[(input_pos + i) % nfft];
 
@@ -803,6 +872,7 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
     for (i = 0; i < bands; i++)
       spect_phase[i] += atan2 (freqdata[i].i, freqdata[i].r);
   }
+#endif // GSTREAMER_LITE
 }
 
 static void
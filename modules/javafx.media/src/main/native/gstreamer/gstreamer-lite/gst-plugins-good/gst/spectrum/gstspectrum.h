@@ -57,6 +57,9 @@ struct _GstSpectrumChannel
   gfloat *spect_magnitude;      /* accumulated mangitude and phase */
   gfloat *spect_phase;          /* will be scaled by num_fft before sending */
   GstFFTF32 *fft_ctx;
+#ifdef GSTREAMER_LITE
+  gfloat *window;               /* Hamming window, computed once per band count */
+#endif // GSTREAMER_LITE
 };
 
 struct _GstSpectrum
@@ -38,6 +38,11 @@
 #include <libavformat/avformat.h>
 #include <libavutil/samplefmt.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define AUDIODECODER_SSE2 1
+#endif
+
 GST_DEBUG_CATEGORY_STATIC(audiodecoder_debug);
 #define GST_CAT_DEFAULT audiodecoder_debug
 
@@ -205,6 +210,9 @@ static gboolean audiodecoder_init_state(AudioDecoder *decoder)
     decoder->sample_rate = 0;
     decoder->bit_rate = 0;
 
+    decoder->pool = NULL;
+    decoder->pool_size = 0;
+
     basedecoder_init_state(BASEDECODER(decoder));
     return TRUE;
 }
@@ -223,6 +231,16 @@ static void audiodecoder_state_reset(AudioDecoder *decoder)
     decoder->is_discont = TRUE;
 }
 
+static void audiodecoder_free_pool(AudioDecoder *decoder)
+{
+    if (decoder->pool)
+    {
+        gst_buffer_pool_set_active(decoder->pool, FALSE);
+        gst_object_unref(decoder->pool);
+        decoder->pool = NULL;
+    }
+}
+
 static void audiodecoder_close_decoder(AudioDecoder *decoder)
 {
 #if !DECODE_AUDIO4 && !USE_SEND_RECEIVE
@@ -233,6 +251,8 @@ static void audiodecoder_close_decoder(AudioDecoder *decoder)
     }
 #endif
 
+    audiodecoder_free_pool(decoder);
+
     basedecoder_close_decoder(BASEDECODER(decoder));
 }
 
@@ -636,6 +656,107 @@ static inline int16_t float_to_int(float sample)
     return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN : (int16_t)value;
 }
 
+#if DECODE_AUDIO4 || USE_SEND_RECEIVE
+#if AUDIODECODER_SSE2
+/*
+ * Converts and interleaves 8 samples of each channel at a time, the same
+ * way as float_to_int(). Returns the number of samples done.
+ */
+static int interleave_fltp_stereo_sse2(const float *left, const float *right, int16_t *buffer, int nb_samples)
+{
+    const __m128 scale = _mm_set1_ps((float)INT16_MAX);
+    int sample;
+
+    for (sample = 0; sample + 8 <= nb_samples; sample += 8)
+    {
+        __m128i l = _mm_packs_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(left + sample), scale)),
+                                    _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(left + sample + 4), scale)));
+        __m128i r = _mm_packs_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(right + sample), scale)),
+                                    _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(right + sample + 4), scale)));
+        _mm_storeu_si128((__m128i*)(buffer + 2 * sample), _mm_unpacklo_epi16(l, r));
+        _mm_storeu_si128((__m128i*)(buffer + 2 * sample + 8), _mm_unpackhi_epi16(l, r));
+    }
+    return sample;
+}
+#endif
+
+/*
+ * Reformats the planar output frame into the interleaved S16 buffer.
+ */
+static void audiodecoder_interleave(AVFrame *frame, int cc, int16_t *buffer)
+{
+    int nb_samples = frame->nb_samples;
+    int nc = cc < AUDIODECODER_OUT_NUM_CHANNELS ? cc : AUDIODECODER_OUT_NUM_CHANNELS;
+    int sample, ci;
+
+    if (frame->format == AV_SAMPLE_FMT_FLTP && cc == 2)
+    {
+        const float *left = (const float*)frame->data[0];
+        const float *right = (const float*)frame->data[1];
+
+#if AUDIODECODER_SSE2
+        sample = interleave_fltp_stereo_sse2(left, right, buffer, nb_samples);
+#else
+        sample = 0;
+#endif
+        for (; sample < nb_samples; sample++)
+        {
+            buffer[2 * sample] = float_to_int(left[sample]);
+            buffer[2 * sample + 1] = float_to_int(right[sample]);
+        }
+    }
+    else if (frame->format == AV_SAMPLE_FMT_FLTP)
+    {
+        for (ci = 0; ci < nc; ci++)
+        {
+            const float *src = (const float*)frame->data[ci];
+            for (sample = 0; sample < nb_samples; sample++)
+                buffer[cc * sample + ci] = float_to_int(src[sample]);
+        }
+    }
+    else
+    {
+        for (ci = 0; ci < nc; ci++)
+        {
+            const int16_t *src = (const int16_t*)frame->data[ci];
+            for (sample = 0; sample < nb_samples; sample++)
+                buffer[cc * sample + ci] = src[sample];
+        }
+    }
+}
+#endif
+
+/*
+ * Returns an output buffer of the given size. Decoded frames nearly always
+ * have the same size, so the buffers come from a pool that is replaced
+ * when the size changes.
+ */
+static GstBuffer* audiodecoder_alloc_output(AudioDecoder *decoder, gint size)
+{
+    GstBuffer *buffer = NULL;
+
+    if (decoder->pool == NULL || decoder->pool_size != size)
+    {
+        audiodecoder_free_pool(decoder);
+
+        GstBufferPool *pool = gst_buffer_pool_new();
+        GstStructure *config = gst_buffer_pool_get_config(pool);
+        gst_buffer_pool_config_set_params(config, NULL, size, 0, 0);
+        if (gst_buffer_pool_set_config(pool, config) && gst_buffer_pool_set_active(pool, TRUE))
+        {
+            decoder->pool = pool;
+            decoder->pool_size = size;
+        }
+        else
+            gst_object_unref(pool);
+    }
+
+    if (decoder->pool == NULL || gst_buffer_pool_acquire_buffer(decoder->pool, &buffer, NULL) != GST_FLOW_OK)
+        buffer = gst_buffer_new_allocate(NULL, size, NULL);
+
+    return buffer;
+}
+
 /*
  * Processes a buffer of MPEG audio data pushed to the sink pad.
  */
@@ -651,7 +772,7 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 
 #if DECODE_AUDIO4 || USE_SEND_RECEIVE
     gint          got_frame = 0;
-    int           sample, ci;
+    int           ci;
  #else
     gint          outbuf_size = AVCODEC_MAX_AUDIO_FRAME_SIZE;
 #endif
@@ -756,7 +877,7 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     }
 #endif
 
-    outbuf = gst_buffer_new_allocate(NULL, outbuf_size, NULL);
+    outbuf = audiodecoder_alloc_output(decoder, outbuf_size);
     // Bail out on error.
     if (outbuf == NULL)
     {
@@ -797,22 +918,7 @@ static GstFlowReturn audiodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
         }
 
         // Reformat the output frame into single buffer.
-        int16_t *buffer = (int16_t*)info2.data;
-        for (sample = 0; sample < base->frame->nb_samples; sample++)
-        {
-            for (ci = 0; ci < cc && ci < AUDIODECODER_OUT_NUM_CHANNELS; ci++)
-            {
-                switch (base->frame->format)
-                {
-                    case AV_SAMPLE_FMT_S16P:
-                        buffer[cc * sample + ci] = ((int16_t*)base->frame->data[ci])[sample];
-                        break;
-                    case AV_SAMPLE_FMT_FLTP:
-                        buffer[cc * sample + ci] = float_to_int(((float*)base->frame->data[ci])[sample]);
-                        break;
-                }
-            }
-        }
+        audiodecoder_interleave(base->frame, cc, (int16_t*)info2.data);
     }
     else if (base->frame->format == AV_SAMPLE_FMT_S16)
         memcpy(info2.data, base->frame->data[0], info2.size);
@@ -74,6 +74,9 @@ struct _AudioDecoder {
     guint64      total_samples;     // sample offset from zero at current time
     gboolean     generate_pts;
 
+    GstBufferPool *pool;            // output buffers of pool_size bytes
+    gint         pool_size;
+
     AVPacket     packet;
 };
 
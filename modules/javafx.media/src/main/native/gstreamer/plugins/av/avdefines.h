@@ -43,6 +43,9 @@
 // instead.
 #define CODEC_PAR              (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(59,0,0))
 
+// AVPacket data can be reference counted through AVPacket.buf since 55
+#define PACKET_BUF             (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(55,0,0))
+
 // Use "av_packet_unref()"
 #define PACKET_UNREF           (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(59,0,0))
 
@@ -61,5 +64,9 @@
 // except frame_num is 64-bit and frame_number is 32-bit. Since 61.
 #define USE_FRAME_NUM          (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(61,0,0))
 
+// Hardware decoding through AVCodecContext.hw_device_ctx and
+// avcodec_get_hw_config(). Available since 58.18 (FFmpeg 4.0).
+#define HW_DECODE              (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(58,18,0))
+
 #endif  /* AVDEFINES_H */
 
@@ -115,9 +115,10 @@ struct _MpegTSDemuxerClass
 
 /***********************************************************************************/
 
-#define BUFFER_SIZE   4096             // Bytes. Better take it from JavaSource.
-#define ADAPTER_LIMIT 40 * BUFFER_SIZE // Initial adapter limit. It grows if unlimited by adding LIMIT_STEP
-#define LIMIT_STEP    10 * BUFFER_SIZE
+#define BUFFER_SIZE    4096             // Bytes. Better take it from JavaSource.
+#define IO_BUFFER_SIZE 16384            // Bytes. Size of the libav reads, so that a frame takes fewer of them.
+#define ADAPTER_LIMIT  40 * BUFFER_SIZE // Initial adapter limit. It grows if unlimited by adding LIMIT_STEP
+#define LIMIT_STEP     10 * BUFFER_SIZE
 
 /***********************************************************************************
  * Debug category and pad templates
@@ -655,12 +656,32 @@ static void mpegts_demuxer_check_streams(MpegTSDemuxer *demuxer)
 /***********************************************************************************
  * Push functions
  ***********************************************************************************/
+#if PACKET_BUF
+static void packet_buffer_free(gpointer data)
+{
+    AVBufferRef *ref = (AVBufferRef*)data;
+    av_buffer_unref(&ref);
+}
+#endif
+
+// Wraps the packet data when libav reference counts it, copies it otherwise.
 static inline GstBuffer* packet_to_buffer(AVPacket *packet)
 {
-    GstBuffer* result = gst_buffer_new_allocate(NULL, packet->size, NULL);
-    if (result != NULL)
-        gst_buffer_fill(result, 0, packet->data, packet->size);
-    return result;
+#if PACKET_BUF
+    if (packet->buf != NULL)
+    {
+        AVBufferRef *ref = av_buffer_ref(packet->buf);
+        if (ref == NULL)
+            return NULL;
+        return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, packet->data, packet->size, 0, packet->size, ref, &packet_buffer_free);
+    }
+#endif
+
+    void *buffer_data = av_mallocz(packet->size);
+    if (buffer_data == NULL)
+        return NULL;
+    memcpy(buffer_data, packet->data, packet->size);
+    return gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
 }
 
 static inline gboolean same_stream(MpegTSDemuxer *demuxer, Stream *stream, AVPacket *packet)
@@ -683,11 +704,9 @@ static GstFlowReturn process_video_packet(MpegTSDemuxer *demuxer, AVPacket *pack
     GstBuffer     *buffer = NULL;
 
     GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
-    if (buffer_data != NULL)
+    buffer = packet_to_buffer(packet);
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
 
         if (packet->pts != AV_NOPTS_VALUE)
         {
@@ -779,12 +798,10 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
 
     GstBuffer *buffer = NULL;
     GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
+    buffer = packet_to_buffer(packet);
 
-    if (buffer_data != NULL)
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
 
         if (packet->pts != AV_NOPTS_VALUE)
         {
@@ -956,7 +973,7 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
                 g_print("MpegTS: action = PA_INIT\n");
 #endif
 
-                guchar      *io_buffer = (guchar*)av_malloc(BUFFER_SIZE);
+                guchar      *io_buffer = (guchar*)av_malloc(IO_BUFFER_SIZE);
                 if (!io_buffer)
                 {
                     post_error(demuxer, "LibAV input buffer alloc error", 0, GST_STREAM_ERROR_DEMUX);
@@ -964,7 +981,7 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
                 }
 
                 AVIOContext *io_context = avio_alloc_context(io_buffer,            // buffer
-                                                             BUFFER_SIZE,          // buffer size
+                                                             IO_BUFFER_SIZE,       // buffer size
                                                              0,                    // read only
                                                              demuxer,              // opaque reference
                                                              mpegts_demuxer_read_packet, // read callback
@@ -28,6 +28,8 @@
 #endif
 
 #include <fcntl.h>
+#include <stdlib.h>
+#include <strings.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -45,6 +47,9 @@ enum
     PROP_0,
     PROP_CODEC_ID,
     PROP_IS_SUPPORTED,
+    PROP_THREAD_COUNT,
+    PROP_THREAD_TYPE,
+    PROP_DECODE_TIME,
 };
 
 /*
@@ -73,6 +78,13 @@ static GstStaticPadTemplate source_template =
         GST_PAD_ALWAYS,
         GST_STATIC_CAPS(SOURCE_CAPS));
 
+// libavcodec warns about more than 16 frame threads for H.264 and H.265.
+#define MAX_THREAD_COUNT 16
+
+// Number of open decoders in the process. Automatic thread counts split the
+// cores between them, so many players do not oversubscribe the CPU.
+static gint active_decoders = 0;
+
 //#define DEBUG_OUTPUT
 //#define VERBOSE_DEBUG
 
@@ -118,8 +130,10 @@ static GstFlowReturn        videodecoder_chain(GstPad *pad, GstObject *parent, G
 
 static void                 videodecoder_init_state(VideoDecoder *decoder);
 static void                 videodecoder_state_reset(VideoDecoder *decoder);
+static void                 videodecoder_init_context(BaseDecoder *base);
 
 static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps);
+static void     videodecoder_drain(VideoDecoder *decoder);
 
 static void videodecoder_dispose(GObject* object);
 static void videodecoder_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
@@ -147,6 +161,8 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     gobject_class->set_property = videodecoder_set_property;
     gobject_class->get_property = videodecoder_get_property;
 
+    BASEDECODER_CLASS(klass)->init_context = videodecoder_init_context;
+
     g_object_class_install_property (gobject_class, PROP_CODEC_ID,
         g_param_spec_int ("codec-id", "Codec ID", "Codec ID", -1, G_MAXINT, 0,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
@@ -154,6 +170,22 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     g_object_class_install_property (gobject_class, PROP_IS_SUPPORTED,
         g_param_spec_boolean ("is-supported", "Is supported", "Is codec ID supported", FALSE,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_THREAD_COUNT,
+        g_param_spec_int ("thread-count", "Thread count",
+        "Number of decoding threads, 0 to use JFXMEDIA_AV_THREADS or one per core", 0, MAX_THREAD_COUNT, 0,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_THREAD_TYPE,
+        g_param_spec_int ("thread-type", "Thread type",
+        "Threading method, FF_THREAD_FRAME (1), FF_THREAD_SLICE (2) or both (3)", 1, 3,
+        FF_THREAD_FRAME | FF_THREAD_SLICE,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_DECODE_TIME,
+        g_param_spec_int64 ("decode-time", "Decode time",
+        "Microseconds spent in libavcodec for the last decoded frame", 0, G_MAXINT64, 0,
+        (GParamFlags)(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
 }
 
 static void videodecoder_init(VideoDecoder *decoder)
@@ -174,6 +206,12 @@ static void videodecoder_init(VideoDecoder *decoder)
 
 void videodecoder_close_decoder(VideoDecoder *decoder)
 {
+    if (decoder->is_active)
+    {
+        g_atomic_int_add(&active_decoders, -1);
+        decoder->is_active = FALSE;
+    }
+
 #if HEVC_SUPPORT
     if (decoder->dest_frame)
     {
@@ -193,6 +231,17 @@ void videodecoder_close_decoder(VideoDecoder *decoder)
         decoder->swscale_module = NULL;
     }
 #endif // HEVC_SUPPORT
+
+#if HW_DECODE
+    if (decoder->sw_frame)
+        av_frame_free(&decoder->sw_frame);
+
+    // The codec context holds its own reference and drops it on close.
+    if (decoder->hw_device_ctx)
+        av_buffer_unref(&decoder->hw_device_ctx);
+
+    decoder->hw_pix_fmt = AV_PIX_FMT_NONE;
+#endif // HW_DECODE
 }
 
 static void videodecoder_dispose(GObject* object)
@@ -200,6 +249,7 @@ static void videodecoder_dispose(GObject* object)
     VideoDecoder *decoder = VIDEODECODER(object);
 
     basedecoder_close_decoder(decoder);
+    videodecoder_close_decoder(decoder);
 
     G_OBJECT_CLASS(parent_class)->dispose(object);
 }
@@ -234,6 +284,12 @@ static void videodecoder_set_property(GObject *object, guint property_id, const
     case PROP_CODEC_ID:
         decoder->codec_id = g_value_get_int(value);
         break;
+    case PROP_THREAD_COUNT:
+        decoder->thread_count = g_value_get_int(value);
+        break;
+    case PROP_THREAD_TYPE:
+        decoder->thread_type = g_value_get_int(value);
+        break;
     default:
         break;
     }
@@ -249,6 +305,15 @@ static void videodecoder_get_property(GObject *object, guint property_id, GValue
         is_supported = videodecoder_is_decoder_by_codec_id_supported(decoder->codec_id);
         g_value_set_boolean(value, is_supported);
         break;
+    case PROP_THREAD_COUNT:
+        g_value_set_int(value, decoder->thread_count);
+        break;
+    case PROP_THREAD_TYPE:
+        g_value_set_int(value, decoder->thread_type);
+        break;
+    case PROP_DECODE_TIME:
+        g_value_set_int64(value, decoder->decode_time);
+        break;
     default:
         break;
     }
@@ -284,6 +349,7 @@ videodecoder_change_state(GstElement* element, GstStateChange transition)
     {
         case GST_STATE_CHANGE_PAUSED_TO_READY:
             basedecoder_close_decoder(BASEDECODER(decoder));
+            videodecoder_close_decoder(decoder);
             break;
         default:
             break;
@@ -316,6 +382,13 @@ static gboolean videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent
             BASEDECODER(decoder)->is_flushing = FALSE;
             break;
 
+        case GST_EVENT_EOS:
+            // Push the frames still held by the frame threads and the reorder
+            // buffer before EOS goes downstream.
+            if (!BASEDECODER(decoder)->is_flushing)
+                videodecoder_drain(decoder);
+            break;
+
         case GST_EVENT_CAPS:
         {
             GstCaps *caps;
@@ -368,14 +441,22 @@ static void videodecoder_init_state(VideoDecoder *decoder)
     decoder->frame_size = 0;
     decoder->discont = FALSE;
     decoder->codec_id = JFX_CODEC_ID_UNKNOWN;
+    decoder->decode_time = 0;
+    decoder->decode_time_pending = 0;
 #if HEVC_SUPPORT
     decoder->sws_context = NULL;
     decoder->dest_frame = NULL;
+    decoder->shift_bits = 0;
     decoder->swscale_module = NULL;
     decoder->sws_getContext_func = NULL;
     decoder->sws_freeContext_func = NULL;
     decoder->sws_scale_func = NULL;
 #endif // HEVC_SUPPORT
+#if HW_DECODE
+    decoder->hw_device_ctx = NULL;
+    decoder->hw_pix_fmt = AV_PIX_FMT_NONE;
+    decoder->sw_frame = NULL;
+#endif // HW_DECODE
 
     basedecoder_init_state(BASEDECODER(decoder));
 }
@@ -444,13 +525,194 @@ static void videodecoder_state_reset(VideoDecoder *decoder)
     basedecoder_flush(BASEDECODER(decoder));
 }
 
+#if HW_DECODE
+// VA-API decoding is opt-in with JFXMEDIA_AV_HWDECODE=yes until it has seen
+// more drivers. Decoding falls back to software if the codec, the driver or
+// the stream profile is not supported.
+static gboolean videodecoder_hw_decode_enabled(void)
+{
+    char *value = getenv("JFXMEDIA_AV_HWDECODE");
+    return (value != NULL && strncasecmp(value, "yes", 3) == 0);
+}
+
+static enum AVPixelFormat videodecoder_get_format(AVCodecContext *context,
+                                                  const enum AVPixelFormat *formats)
+{
+    VideoDecoder *decoder = (VideoDecoder*)context->opaque;
+    const enum AVPixelFormat *format;
+
+    for (format = formats; *format != AV_PIX_FMT_NONE; format++)
+    {
+        if (*format == decoder->hw_pix_fmt)
+            return *format;
+    }
+
+    // Hardware cannot decode this stream, let libavcodec pick a software format.
+    return avcodec_default_get_format(context, formats);
+}
+
+static gboolean videodecoder_init_hw_device(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+    const AVCodecHWConfig *config = NULL;
+    int i = 0;
+
+    while ((config = avcodec_get_hw_config(base->codec, i++)) != NULL)
+    {
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) &&
+            config->device_type == AV_HWDEVICE_TYPE_VAAPI)
+            break;
+    }
+
+    if (config == NULL)
+        return FALSE;
+
+    if (av_hwdevice_ctx_create(&decoder->hw_device_ctx, AV_HWDEVICE_TYPE_VAAPI, NULL, NULL, 0) < 0)
+    {
+        decoder->hw_device_ctx = NULL;
+        return FALSE;
+    }
+
+    base->context->hw_device_ctx = av_buffer_ref(decoder->hw_device_ctx);
+    if (base->context->hw_device_ctx == NULL)
+    {
+        av_buffer_unref(&decoder->hw_device_ctx);
+        return FALSE;
+    }
+
+    decoder->hw_pix_fmt = config->pix_fmt;
+    base->context->opaque = decoder;
+    base->context->get_format = videodecoder_get_format;
+
+    return TRUE;
+}
+
+// Copies a frame decoded into video memory to system memory. The frame comes
+// back in the driver's software format, usually NV12, and is then converted
+// to YUV420P by libswscale like any other non-YUV420P frame.
+static gboolean videodecoder_download_frame(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+
+    if (decoder->sw_frame == NULL)
+    {
+        decoder->sw_frame = av_frame_alloc();
+        if (decoder->sw_frame == NULL)
+            return FALSE;
+    }
+
+    if (av_hwframe_transfer_data(decoder->sw_frame, base->frame, 0) < 0 ||
+        av_frame_copy_props(decoder->sw_frame, base->frame) < 0)
+    {
+        av_frame_unref(decoder->sw_frame);
+        return FALSE;
+    }
+
+    av_frame_unref(base->frame);
+    av_frame_move_ref(base->frame, decoder->sw_frame);
+
+    return TRUE;
+}
+#endif // HW_DECODE
+
+// Without a thread count libavcodec decodes on a single thread, which cannot
+// keep up with 4K H.265. JFXMEDIA_AV_THREADS overrides the automatic choice
+// of one thread per core, shared between the open decoders. Decoders opened
+// earlier keep their count, libavcodec cannot change it once open.
+static int videodecoder_get_thread_count(VideoDecoder *decoder)
+{
+    int thread_count = decoder->thread_count;
+
+    if (thread_count <= 0)
+    {
+        char *value = getenv("JFXMEDIA_AV_THREADS");
+        if (value != NULL)
+            thread_count = atoi(value);
+    }
+
+    if (thread_count <= 0)
+        thread_count = (int)g_get_num_processors() / MAX(1, g_atomic_int_get(&active_decoders));
+
+    return CLAMP(thread_count, 1, MAX_THREAD_COUNT);
+}
+
+static void videodecoder_init_context(BaseDecoder *base)
+{
+    VideoDecoder *decoder = VIDEODECODER(base);
+
+    BASEDECODER_CLASS(parent_class)->init_context(base);
+
+    if (!decoder->is_active)
+    {
+        g_atomic_int_inc(&active_decoders);
+        decoder->is_active = TRUE;
+    }
+
+    base->context->thread_count = videodecoder_get_thread_count(decoder);
+    base->context->thread_type = decoder->thread_type;
+
+#if HW_DECODE
+    // Software decoding is used if no VA-API device can be opened. The GPU
+    // does the work otherwise, so extra threads only add latency.
+    if (videodecoder_hw_decode_enabled() && videodecoder_init_hw_device(decoder))
+        base->context->thread_count = 1;
+#endif // HW_DECODE
+}
+
 #if HEVC_SUPPORT
+// 10 and 12-bit 4:2:0 frames, the usual H.265 Main 10 and Main 12 output,
+// only need each sample scaled down to 8 bits. This is done in one pass by
+// videodecoder_shift_planes() instead of through libswscale.
+static int videodecoder_get_shift_bits(int format)
+{
+    switch (format)
+    {
+        case AV_PIX_FMT_YUV420P10LE:
+            return 2;
+        case AV_PIX_FMT_YUV420P12LE:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+static void videodecoder_shift_planes(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+    int shift = decoder->shift_bits;
+    int round = 1 << (shift - 1);
+    int plane, x, y;
+
+    for (plane = 0; plane < 3; plane++)
+    {
+        int width = plane == 0 ? decoder->width : (decoder->width + 1) / 2;
+        int height = plane == 0 ? decoder->height : (decoder->height + 1) / 2;
+        const uint8_t *src_row = base->frame->data[plane];
+        uint8_t *dest_row = decoder->dest_frame->data[plane];
+
+        for (y = 0; y < height; y++)
+        {
+            const uint16_t *src = (const uint16_t*)src_row;
+            for (x = 0; x < width; x++)
+            {
+                int value = (src[x] + round) >> shift;
+                dest_row[x] = (uint8_t)(value > 255 ? 255 : value);
+            }
+
+            src_row += base->frame->linesize[plane];
+            dest_row += decoder->dest_frame->linesize[plane];
+        }
+    }
+}
+
 static gboolean videodecoder_init_converter(VideoDecoder *decoder)
 {
     BaseDecoder *base = BASEDECODER(decoder);
 
+    decoder->shift_bits = videodecoder_get_shift_bits(base->frame->format);
+
     // Load libswscale
-    if (decoder->swscale_module == NULL)
+    if (decoder->shift_bits == 0 && decoder->swscale_module == NULL)
     {
         decoder->swscale_module = dlopen("libswscale.so", RTLD_LAZY);
         if (decoder->swscale_module == NULL)
@@ -507,14 +769,17 @@ static gboolean videodecoder_init_converter(VideoDecoder *decoder)
         decoder->sws_context = NULL;
     }
 
-    decoder->sws_context =
-            decoder->sws_getContext_func(decoder->width, decoder->height,
-                                         base->frame->format, decoder->width,
-                                         decoder->height, AV_PIX_FMT_YUV420P,
-                                         SWS_BILINEAR, NULL, NULL, NULL);
+    if (decoder->shift_bits == 0)
+    {
+        decoder->sws_context =
+                decoder->sws_getContext_func(decoder->width, decoder->height,
+                                             base->frame->format, decoder->width,
+                                             decoder->height, AV_PIX_FMT_YUV420P,
+                                             SWS_BILINEAR, NULL, NULL, NULL);
 
-    if (decoder->sws_context == NULL)
-        return FALSE;
+        if (decoder->sws_context == NULL)
+            return FALSE;
+    }
 
     decoder->dest_frame = av_frame_alloc();
     if (decoder->dest_frame == NULL)
@@ -528,8 +793,11 @@ static gboolean videodecoder_init_converter(VideoDecoder *decoder)
     {
         av_frame_free(&decoder->dest_frame);
         decoder->dest_frame = NULL;
-        decoder->sws_freeContext_func(decoder->sws_context);
-        decoder->sws_context = NULL;
+        if (decoder->sws_context)
+        {
+            decoder->sws_freeContext_func(decoder->sws_context);
+            decoder->sws_context = NULL;
+        }
         return FALSE;
     }
 
@@ -540,19 +808,28 @@ static gboolean videodecoder_convert_frame(VideoDecoder *decoder)
 {
     BaseDecoder *base = BASEDECODER(decoder);
 
-    if (decoder->sws_context == NULL || decoder->dest_frame == NULL ||
-            decoder->sws_scale_func == NULL)
+    if (decoder->dest_frame == NULL)
         return FALSE;
 
-    int ret = decoder->sws_scale_func(decoder->sws_context,
-                                      base->frame->data,
-                                      base->frame->linesize,
-                                      0,
-                                      base->frame->height,
-                                      decoder->dest_frame->data,
-                                      decoder->dest_frame->linesize);
-    if (ret < 0)
-        return FALSE;
+    if (decoder->shift_bits > 0)
+    {
+        videodecoder_shift_planes(decoder);
+    }
+    else
+    {
+        if (decoder->sws_context == NULL || decoder->sws_scale_func == NULL)
+            return FALSE;
+
+        int ret = decoder->sws_scale_func(decoder->sws_context,
+                                          base->frame->data,
+                                          base->frame->linesize,
+                                          0,
+                                          base->frame->height,
+                                          decoder->dest_frame->data,
+                                          decoder->dest_frame->linesize);
+        if (ret < 0)
+            return FALSE;
+    }
 
 #if NO_REORDERED_OPAQUE
     decoder->dest_frame->pts = base->frame->pts;
@@ -670,18 +947,16 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
 
     return TRUE;
 }
+
 /***********************************************************************************
- * chain
+ * Pushes base->frame downstream. duration and discont come from the input buffer
+ * the frame was decoded from, or are GST_CLOCK_TIME_NONE and FALSE when draining.
  ***********************************************************************************/
-static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+static GstFlowReturn videodecoder_push_frame(VideoDecoder *decoder, GstClockTime duration, gboolean discont)
 {
-    VideoDecoder  *decoder = VIDEODECODER(parent);
     BaseDecoder   *base = BASEDECODER(decoder);
     GstFlowReturn  result = GST_FLOW_OK;
-    int            num_dec = NO_DATA_USED;
-    GstMapInfo     info;
     GstMapInfo     info2;
-    gboolean       unmap_buf = FALSE;
     gboolean       set_frame_values = TRUE;
     int64_t        pts = AV_NOPTS_VALUE;
     unsigned int   out_buf_size = 0;
@@ -690,6 +965,227 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     uint8_t*       data1 = NULL;
     uint8_t*       data2 = NULL;
 
+#if HW_DECODE
+    if (decoder->hw_pix_fmt != AV_PIX_FMT_NONE &&
+        base->frame->format == decoder->hw_pix_fmt &&
+        !videodecoder_download_frame(decoder))
+    {
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                 GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                 g_strdup("Video frame download failed"), NULL,
+                                 ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+
+        return GST_FLOW_ERROR;
+    }
+#endif // HW_DECODE
+
+    if (!videodecoder_configure_sourcepad(decoder))
+        result = GST_FLOW_ERROR;
+    else
+    {
+#if HEVC_SUPPORT
+        // Check to see if we need to convert frame to YUV420p
+        if (base->frame->format != AV_PIX_FMT_YUV420P)
+        {
+            if (!videodecoder_convert_frame(decoder))
+            {
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                         GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                         g_strdup("Video frame conversion failed"), NULL,
+                                         ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+
+                result = GST_FLOW_ERROR;
+                return result;
+            }
+
+#if NO_REORDERED_OPAQUE
+            pts = decoder->dest_frame->pts;
+#else // NO_REORDERED_OPAQUE
+            pts = decoder->dest_frame->reordered_opaque;
+#endif // NO_REORDERED_OPAQUE
+            data0 = decoder->dest_frame->data[0];
+            data1 = decoder->dest_frame->data[1];
+            data2 = decoder->dest_frame->data[2];
+            set_frame_values = FALSE;
+        }
+#endif // HEVC_SUPPORTf
+
+        if (set_frame_values)
+        {
+#if NO_REORDERED_OPAQUE
+            pts = base->frame->pts;
+#else // NO_REORDERED_OPAQUE
+            pts = base->frame->reordered_opaque;
+#endif // NO_REORDERED_OPAQUE
+            data0 = base->frame->data[0];
+            data1 = base->frame->data[1];
+            data2 = base->frame->data[2];
+        }
+
+        GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+        if (outbuf == NULL)
+        {
+            if (result != GST_FLOW_FLUSHING)
+            {
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                         GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                         g_strdup("Decoded video buffer allocation failed"), NULL,
+                                         ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+            }
+        }
+        else
+        {
+#if USE_FRAME_NUM
+            GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
+#else // USE_FRAME_NUM
+            GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
+#endif // USE_FRAME_NUM
+            if (pts != AV_NOPTS_VALUE)
+            {
+                GST_BUFFER_TIMESTAMP(outbuf) = pts;
+                GST_BUFFER_DURATION(outbuf) = duration; // Duration for video usually same
+            }
+
+            if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
+            {
+                // INLINE - gst_buffer_unref()
+                gst_buffer_unref(outbuf);
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                 g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+                return result;
+            }
+
+            // Copy image by parts from different arrays.
+            if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
+            {
+                gst_buffer_unmap(outbuf, &info2);
+                // INLINE - gst_buffer_unref()
+                gst_buffer_unref(outbuf);
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                 g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+                return result;
+            }
+
+            out_buf_size = decoder->frame_size;
+            if (out_buf_size >= decoder->u_offset)
+            {
+                memcpy(info2.data, data0, decoder->u_offset);
+                out_buf_size -= decoder->u_offset;
+                if (out_buf_size >= decoder->uv_blocksize &&
+                    decoder->uv_blocksize <= decoder->frame_size &&
+                    decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
+                {
+                    memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
+                    out_buf_size -= decoder->uv_blocksize;
+                    if (out_buf_size >= decoder->uv_blocksize &&
+                        decoder->uv_blocksize <= decoder->frame_size &&
+                        decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
+                    {
+                        memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
+                    }
+                    else
+                    {
+                        copy_error = TRUE;
+                    }
+                }
+                else
+                {
+                    copy_error = TRUE;
+                }
+            }
+            else
+            {
+                copy_error = TRUE;
+            }
+
+            gst_buffer_unmap(outbuf, &info2);
+
+            if (copy_error)
+            {
+                // INLINE - gst_buffer_unref()
+                gst_buffer_unref(outbuf);
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                 g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+                return result;
+            }
+
+            GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
+
+            if (decoder->discont || discont)
+            {
+#ifdef DEBUG_OUTPUT
+                g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
+#endif
+                GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
+                decoder->discont = FALSE;
+            }
+
+
+#ifdef VERBOSE_DEBUG
+            g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
+                GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
+                GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
+#endif
+            result = gst_pad_push(base->srcpad, outbuf);
+#ifdef VERBOSE_DEBUG
+            g_print(" done, res=%s\n", gst_flow_get_name(result));
+#endif
+        }
+    }
+
+    return result;
+}
+
+/***********************************************************************************
+ * Drains the decoder at EOS
+ ***********************************************************************************/
+static void videodecoder_drain(VideoDecoder *decoder)
+{
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+
+    if (!base->is_initialized || base->context == NULL)
+        return;
+
+#if USE_SEND_RECEIVE
+    if (avcodec_send_packet(base->context, NULL) == 0)
+    {
+        while (result == GST_FLOW_OK && avcodec_receive_frame(base->context, base->frame) == 0)
+            result = videodecoder_push_frame(decoder, GST_CLOCK_TIME_NONE, FALSE);
+    }
+#else
+    av_init_packet(&decoder->packet);
+    decoder->packet.data = NULL;
+    decoder->packet.size = 0;
+
+    do
+    {
+        decoder->frame_finished = 0;
+        if (avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet) < 0)
+            break;
+
+        if (decoder->frame_finished > 0)
+            result = videodecoder_push_frame(decoder, GST_CLOCK_TIME_NONE, FALSE);
+    } while (decoder->frame_finished > 0 && result == GST_FLOW_OK);
+#endif
+
+    // A drained decoder only accepts new packets after a flush.
+    videodecoder_state_reset(decoder);
+}
+
+/***********************************************************************************
+ * chain
+ ***********************************************************************************/
+static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+{
+    VideoDecoder  *decoder = VIDEODECODER(parent);
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    int            num_dec = NO_DATA_USED;
+    GstMapInfo     info;
+    gboolean       unmap_buf = FALSE;
+    gint64         decode_start = 0;
+
     if (base->is_flushing)  // Reject buffers in flushing state.
     {
         result = GST_FLOW_FLUSHING;
@@ -709,6 +1205,7 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     }
 
     unmap_buf = TRUE;
+    decode_start = g_get_monotonic_time();
 
     if (!base->is_hls)
     {
@@ -784,6 +1281,10 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 #endif
     }
 
+    // With frame threading a packet often yields no frame, so the time is
+    // charged to the next frame that comes out.
+    decoder->decode_time_pending += g_get_monotonic_time() - decode_start;
+
     if (num_dec < 0)
     {
         //        basedecoder_flush(base);
@@ -795,159 +1296,9 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
 
     if (decoder->frame_finished > 0)
     {
-        if (!videodecoder_configure_sourcepad(decoder))
-            result = GST_FLOW_ERROR;
-        else
-        {
-#if HEVC_SUPPORT
-            // Check to see if we need to convert frame to YUV420p
-            if (base->frame->format != AV_PIX_FMT_YUV420P)
-            {
-                if (!videodecoder_convert_frame(decoder))
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Video frame conversion failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-
-                    result = GST_FLOW_ERROR;
-                    goto _exit;
-                }
-
-#if NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->pts;
-#else // NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-                data0 = decoder->dest_frame->data[0];
-                data1 = decoder->dest_frame->data[1];
-                data2 = decoder->dest_frame->data[2];
-                set_frame_values = FALSE;
-            }
-#endif // HEVC_SUPPORTf
-
-            if (set_frame_values)
-            {
-#if NO_REORDERED_OPAQUE
-                pts = base->frame->pts;
-#else // NO_REORDERED_OPAQUE
-                pts = base->frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-                data0 = base->frame->data[0];
-                data1 = base->frame->data[1];
-                data2 = base->frame->data[2];
-            }
-
-            GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
-            if (outbuf == NULL)
-            {
-                if (result != GST_FLOW_FLUSHING)
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Decoded video buffer allocation failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-                }
-            }
-            else
-            {
-#if USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
-#else // USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
-#endif // USE_FRAME_NUM
-                if (pts != AV_NOPTS_VALUE)
-                {
-                    GST_BUFFER_TIMESTAMP(outbuf) = pts;
-                    GST_BUFFER_DURATION(outbuf) = GST_BUFFER_DURATION(buf); // Duration for video usually same
-                }
-
-                if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                // Copy image by parts from different arrays.
-                if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
-                {
-                    gst_buffer_unmap(outbuf, &info2);
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                out_buf_size = decoder->frame_size;
-                if (out_buf_size >= decoder->u_offset)
-                {
-                    memcpy(info2.data, data0, decoder->u_offset);
-                    out_buf_size -= decoder->u_offset;
-                    if (out_buf_size >= decoder->uv_blocksize &&
-                        decoder->uv_blocksize <= decoder->frame_size &&
-                        decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                    {
-                        memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
-                        out_buf_size -= decoder->uv_blocksize;
-                        if (out_buf_size >= decoder->uv_blocksize &&
-                            decoder->uv_blocksize <= decoder->frame_size &&
-                            decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                        {
-                            memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
-                        }
-                        else
-                        {
-                            copy_error = TRUE;
-                        }
-                    }
-                    else
-                    {
-                        copy_error = TRUE;
-                    }
-                }
-                else
-                {
-                    copy_error = TRUE;
-                }
-
-                gst_buffer_unmap(outbuf, &info2);
-
-                if (copy_error)
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
-
-                if (decoder->discont || GST_BUFFER_IS_DISCONT(buf))
-                {
-#ifdef DEBUG_OUTPUT
-                    g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
-#endif
-                    GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
-                    decoder->discont = FALSE;
-                }
-
-
-#ifdef VERBOSE_DEBUG
-                g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
-                    GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
-                    GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
-#endif
-                result = gst_pad_push(base->srcpad, outbuf);
-#ifdef VERBOSE_DEBUG
-                g_print(" done, res=%s\n", gst_flow_get_name(result));
-#endif
-            }
-        }
+        decoder->decode_time = decoder->decode_time_pending;
+        decoder->decode_time_pending = 0;
+        result = videodecoder_push_frame(decoder, GST_BUFFER_DURATION(buf), GST_BUFFER_IS_DISCONT(buf));
     }
 
 _exit:
@@ -31,6 +31,10 @@
 #include <dlfcn.h>
 #include <libswscale/swscale.h>
 
+#if HW_DECODE
+#include <libavutil/hwcontext.h>
+#endif // HW_DECODE
+
 G_BEGIN_DECLS
 
 #define TYPE_VIDEODECODER \
@@ -81,9 +85,16 @@ struct _VideoDecoder {
 
     gint         codec_id;
 
+    gint         thread_count;         // 0 selects the count automatically
+    gint         thread_type;          // FF_THREAD_FRAME and/or FF_THREAD_SLICE
+    gboolean     is_active;            // counted in the decoders sharing the cores
+    gint64       decode_time;          // microseconds spent on the last frame
+    gint64       decode_time_pending;  // time spent since the last frame
+
 #if HEVC_SUPPORT
     struct SwsContext *sws_context;
     AVFrame           *dest_frame;
+    int                shift_bits;    // > 0 if 4:2:0 samples are shifted down without libswscale
 
     // Load and use libswscale dynamically
     void                *swscale_module;
@@ -91,6 +102,12 @@ struct _VideoDecoder {
     sws_freeContext_ptr sws_freeContext_func;
     sws_scale_ptr       sws_scale_func;
 #endif // HEVC_SUPPORT
+
+#if HW_DECODE
+    AVBufferRef        *hw_device_ctx; // VA-API device, NULL if software decoding
+    enum AVPixelFormat  hw_pix_fmt;    // pixel format of frames in video memory
+    AVFrame            *sw_frame;      // frame downloaded from video memory
+#endif // HW_DECODE
 };
 
 struct _VideoDecoderClass
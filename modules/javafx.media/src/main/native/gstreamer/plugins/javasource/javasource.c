@@ -52,6 +52,8 @@ enum
     SIGNAL_READ_NEXT_BLOCK,
     SIGNAL_READ_BLOCK,
     SIGNAL_COPY_BLOCK,
+    SIGNAL_READ_NEXT_BLOCK_INTO,
+    SIGNAL_READ_BLOCK_INTO,
     SIGNAL_CLOSE_CONNECTION,
     SIGNAL_PROPERTY,
     LAST_SIGNAL
@@ -66,7 +68,8 @@ enum
     PROP_STOP_ON_PAUSE,
     PROP_LOCATION,
     PROP_MIMETYPE,
-    PROP_HLS_MODE
+    PROP_HLS_MODE,
+    PROP_DIRECT_READ
 };
 
 /***********************************************************************************
@@ -103,6 +106,7 @@ struct _JavaSource
 
     guint         mode; // property controlled and/or internally
     gboolean      stop_on_pause; // property controlled
+    gboolean      direct_read; // property controlled
     gchar*        location; // property controlled
     gchar*        mimetype; // property controlled
     gdouble       rate;
@@ -213,6 +217,10 @@ static void java_source_class_init (JavaSourceClass *klass)
         g_param_spec_boolean ("hls-mode", "HLS Mode", "HTTP Live Streaming Mode", FALSE,
         G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+    g_object_class_install_property (gobject_klass, PROP_DIRECT_READ,
+        g_param_spec_boolean ("direct-read", "Direct read", "Read data straight into buffer memory with the read-*-into signals", FALSE,
+        G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
     g_object_class_install_property (gobject_klass, PROP_LOCATION,
         g_param_spec_string ("location", "Source Location", "Location of the source to read", NULL,
         G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
@@ -264,6 +272,28 @@ static void java_source_class_init (JavaSourceClass *klass)
         2,     /* n_params */
         G_TYPE_POINTER, G_TYPE_INT);
 
+    klass->signals[SIGNAL_READ_NEXT_BLOCK_INTO] = g_signal_new ("read-next-block-into",
+        G_TYPE_FROM_CLASS (klass),
+        G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+        0,
+        NULL, /* accumulator */
+        NULL, /* accu_data */
+        source_marshal_INT__POINTER_INT,
+        G_TYPE_INT, /* return_type */
+        2,     /* n_params */
+        G_TYPE_POINTER, G_TYPE_INT);
+
+    klass->signals[SIGNAL_READ_BLOCK_INTO] = g_signal_new ("read-block-into",
+        G_TYPE_FROM_CLASS (klass),
+        G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+        0,
+        NULL, /* accumulator */
+        NULL, /* accu_data */
+        source_marshal_INT__UINT64_POINTER_INT,
+        G_TYPE_INT, /* return_type */
+        3,     /* n_params */
+        G_TYPE_UINT64, G_TYPE_POINTER, G_TYPE_INT);
+
     klass->signals[SIGNAL_CLOSE_CONNECTION] = g_signal_new ("close-connection",
         G_TYPE_FROM_CLASS (klass),
         G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
@@ -329,6 +359,9 @@ static void java_source_set_property (GObject *object, guint prop_id,
     case PROP_STOP_ON_PAUSE:
         element->stop_on_pause = g_value_get_boolean (value);
         break;
+    case PROP_DIRECT_READ:
+        element->direct_read = g_value_get_boolean (value);
+        break;
     case PROP_LOCATION:
         element->location = g_strdup(g_value_get_string (value));
         break;
@@ -627,23 +660,63 @@ next_event:
             {
                 gint     size;
                 GstMapInfo info;
-                g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
-                if (size > 0)
+                GstBuffer *buffer = NULL;
+
+                if (element->direct_read)
                 {
-                    GstBuffer *buffer = gst_buffer_new_allocate(NULL, size, NULL);
-                    if (buffer)
+                    // Java reads straight into the buffer memory, up to MAX_READ_SIZE at once
+                    buffer = gst_buffer_new_allocate(NULL, MAX_READ_SIZE, NULL);
+                    if (buffer == NULL)
                     {
-                        GST_BUFFER_OFFSET(buffer) = element->position;
+                        result = GST_FLOW_ERROR;
+                        break;
+                    }
 
-                        if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE))
+                    if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE))
+                    {
+                        gst_buffer_unref(buffer);
+                        result = GST_FLOW_ERROR;
+                        break;
+                    }
+
+                    g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK_INTO], 0, info.data, MAX_READ_SIZE, &size);
+
+                    gst_buffer_unmap(buffer, &info);
+
+                    if (size > 0 && size <= MAX_READ_SIZE)
+                        gst_buffer_set_size(buffer, size);
+                    else
+                    {
+                        gst_buffer_unref(buffer);
+                        buffer = NULL;
+                    }
+                }
+                else
+                {
+                    g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
+                    if (size > 0)
+                    {
+                        buffer = gst_buffer_new_allocate(NULL, size, NULL);
+                        if (buffer)
                         {
-                            result = GST_FLOW_ERROR;
-                            break;
-                        }
+                            if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE))
+                            {
+                                result = GST_FLOW_ERROR;
+                                break;
+                            }
+
+                            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
 
-                        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
+                            gst_buffer_unmap(buffer, &info);
+                        }
+                    }
+                }
 
-                        gst_buffer_unmap(buffer, &info);
+                if (size > 0)
+                {
+                    if (buffer)
+                    {
+                        GST_BUFFER_OFFSET(buffer) = element->position;
 
                         if (element->discont)
                         {
@@ -822,7 +895,7 @@ static GstFlowReturn java_source_getrange(GstPad *pad, GstObject *parent, guint6
 
     GST_BUFFER_OFFSET(buf) = offset;
 
-    if (!gst_buffer_map(buf, &info, GST_MAP_READ))
+    if (!gst_buffer_map(buf, &info, GST_MAP_WRITE))
     {
         gst_buffer_unref(buf);
         return GST_FLOW_ERROR;
@@ -835,10 +908,20 @@ static GstFlowReturn java_source_getrange(GstPad *pad, GstObject *parent, guint6
         else
             toRead = (length - read);
 
-        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_BLOCK], 0, offset + read, toRead, &size);
+        if (element->direct_read)
+        {
+            // Java reads straight into the buffer memory, no copy-block needed
+            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_BLOCK_INTO], 0, offset + read, info.data + read, (gint)toRead, &size);
+        }
+        else
+        {
+            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_BLOCK], 0, offset + read, toRead, &size);
+            if (size > 0 && size <= toRead)
+                g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data + read, size);
+        }
+
         if (size > 0 && size <= toRead)
         {
-            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data + read, size);
             read += size;
 
             if (size < toRead)
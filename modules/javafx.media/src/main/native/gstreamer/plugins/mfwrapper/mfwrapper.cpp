@@ -31,10 +31,12 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <mfwrapper.h>
 #include <mfidl.h>
 #include <Wmcodecdsp.h>
+#include <d3d10.h>
 
 #include "fxplugins_common.h"
 
@@ -207,6 +209,10 @@ static void gst_mfwrapper_init(GstMFWrapper *decoder)
     decoder->pDecoder = NULL;
     decoder->pDecoderOutput = NULL;
 
+    decoder->pD3D11Device = NULL;
+    decoder->pDXGIDeviceManager = NULL;
+    decoder->is_dxva = FALSE;
+
     for (int i = 0; i < MAX_COLOR_CONVERT; i++)
     {
         decoder->pColorConvert[i] = NULL;
@@ -239,6 +245,10 @@ static void gst_mfwrapper_dispose(GObject* object)
         SafeRelease(&decoder->pColorConvert[i]);
     }
 
+    // Decoder holds the device manager until released above
+    SafeRelease(&decoder->pDXGIDeviceManager);
+    SafeRelease(&decoder->pD3D11Device);
+
     if (decoder->hr_mfstartup == S_OK)
         MFShutdown();
 
@@ -1196,7 +1206,7 @@ static gint mfwrapper_process_output(GstMFWrapper *decoder)
 {
     MFT_OUTPUT_DATA_BUFFER outputDataBuffer;
     outputDataBuffer.dwStreamID = 0;
-    outputDataBuffer.pSample = decoder->pDecoderOutput;
+    outputDataBuffer.pSample = decoder->is_dxva ? NULL : decoder->pDecoderOutput;
     outputDataBuffer.dwStatus = 0;
     outputDataBuffer.pEvents = NULL;
     DWORD dwFlags = 0;
@@ -1215,6 +1225,14 @@ static gint mfwrapper_process_output(GstMFWrapper *decoder)
 
     hr = decoder->pDecoder->ProcessOutput(0, 1, &outputDataBuffer, &dwStatus);
     SafeRelease(&outputDataBuffer.pEvents);
+    if (decoder->is_dxva && outputDataBuffer.pSample != NULL)
+    {
+        // DXVA decoder allocates its own samples from the D3D11 texture pool.
+        // Keep the last one until next output, so texture goes back to the
+        // pool after the color converter or deliver_sample() read it back.
+        SafeRelease(&decoder->pDecoderOutput);
+        decoder->pDecoderOutput = outputDataBuffer.pSample;
+    }
     if (hr == MF_E_TRANSFORM_NEED_MORE_INPUT)
     {
         return PO_NEED_MORE_DATA;
@@ -1428,6 +1446,68 @@ static gboolean mfwrapper_get_mf_media_types(GstCaps *caps, GUID *pMajorType, GU
     return FALSE;
 }
 
+// DXVA decoding is opt-in with JFXMEDIA_MF_HWDECODE=yes. Decoded frames are
+// read back from the GPU once, in NV12, by the color converter, instead of
+// being decoded and converted on CPU. Decoding stays in software if decoder
+// is not D3D11 aware or device cannot be created.
+static gboolean mfwrapper_dxva_enabled(void)
+{
+    char *value = getenv("JFXMEDIA_MF_HWDECODE");
+    return (value != NULL && _strnicmp(value, "yes", 3) == 0);
+}
+
+static HRESULT mfwrapper_init_dxva(GstMFWrapper *decoder)
+{
+    HRESULT hr = S_OK;
+    IMFAttributes *pAttributes = NULL;
+    ID3D10Multithread *pMultithread = NULL;
+    UINT32 isD3D11Aware = FALSE;
+    UINT resetToken = 0;
+
+    hr = decoder->pDecoder->GetAttributes(&pAttributes);
+    if (SUCCEEDED(hr))
+        hr = pAttributes->GetUINT32(MF_SA_D3D11_AWARE, &isD3D11Aware);
+    SafeRelease(&pAttributes);
+
+    if (SUCCEEDED(hr) && !isD3D11Aware)
+        hr = E_NOTIMPL;
+
+    if (SUCCEEDED(hr))
+        hr = D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL,
+                               D3D11_CREATE_DEVICE_VIDEO_SUPPORT, NULL, 0,
+                               D3D11_SDK_VERSION, &decoder->pD3D11Device,
+                               NULL, NULL);
+
+    // Decoder and streaming thread (read back) use device concurrently
+    if (SUCCEEDED(hr))
+        hr = decoder->pD3D11Device->QueryInterface(IID_PPV_ARGS(&pMultithread));
+    if (SUCCEEDED(hr))
+        pMultithread->SetMultithreadProtected(TRUE);
+    SafeRelease(&pMultithread);
+
+    if (SUCCEEDED(hr))
+        hr = MFCreateDXGIDeviceManager(&resetToken, &decoder->pDXGIDeviceManager);
+
+    if (SUCCEEDED(hr))
+        hr = decoder->pDXGIDeviceManager->ResetDevice(decoder->pD3D11Device, resetToken);
+
+    if (SUCCEEDED(hr))
+        hr = decoder->pDecoder->ProcessMessage(MFT_MESSAGE_SET_D3D_MANAGER,
+                                               (ULONG_PTR)decoder->pDXGIDeviceManager);
+
+    if (SUCCEEDED(hr))
+    {
+        decoder->is_dxva = TRUE;
+    }
+    else
+    {
+        SafeRelease(&decoder->pDXGIDeviceManager);
+        SafeRelease(&decoder->pD3D11Device);
+    }
+
+    return hr;
+}
+
 static HRESULT mfwrapper_load_decoder(GstMFWrapper *decoder, GstCaps *caps)
 {
     HRESULT hr = S_OK;
@@ -1472,6 +1552,12 @@ static HRESULT mfwrapper_load_decoder(GstMFWrapper *decoder, GstCaps *caps)
 
     CoTaskMemFree(ppActivate);
 
+    if (SUCCEEDED(hr) && mfwrapper_dxva_enabled())
+    {
+        if (FAILED(mfwrapper_init_dxva(decoder)))
+            GST_WARNING_OBJECT(decoder, "DXVA decoding not available, using software decoding");
+    }
+
     return hr;
 }
 
@@ -31,6 +31,7 @@
 #include <mfapi.h>
 #include <mferror.h>
 #include <mftransform.h>
+#include <d3d11.h>
 
 G_BEGIN_DECLS
 
@@ -80,6 +81,11 @@ struct _GstMFWrapper
     IMFTransform *pDecoder;
     IMFSample *pDecoderOutput;
 
+    // DXVA decoding, decoder writes output into D3D11 textures
+    ID3D11Device *pD3D11Device;
+    IMFDXGIDeviceManager *pDXGIDeviceManager;
+    gboolean is_dxva;
+
     IMFTransform *pColorConvert[MAX_COLOR_CONVERT];
     IMFSample *pColorConvertOutput[MAX_COLOR_CONVERT];
 
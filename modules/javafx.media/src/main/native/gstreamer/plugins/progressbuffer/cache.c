@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <cache.h>
+#include <filecache.h>
+
+#define MEMORY_READ_SIZE 65536
+
+typedef struct _MemoryBlock
+{
+    gint64     offset;
+    GstBuffer* buffer;
+} MemoryBlock;
+
+/* Small streams are kept as the list of written buffers, so nothing is copied
+ * on write and reads share the memory of the written buffers.
+ */
+struct _Cache
+{
+    FileCache* file;          // NULL while the data is kept in memory
+    GArray*    blocks;        // MemoryBlock entries in write order
+    gsize      memory_limit;
+    gsize      memory_size;   // bytes allocated by the buffers in blocks
+
+    gint64     read_position;
+    gint64     write_position;
+};
+
+void cache_static_init(void)
+{
+    file_cache_static_init();
+}
+
+static void cache_clear_blocks(Cache* cache)
+{
+    guint i;
+
+    for (i = 0; i < cache->blocks->len; i++)
+        gst_buffer_unref(g_array_index(cache->blocks, MemoryBlock, i).buffer);
+    g_array_set_size(cache->blocks, 0);
+    cache->memory_size = 0;
+}
+
+// Moves the data written so far to a file cache, which serves all further calls.
+static gboolean cache_spill(Cache* cache)
+{
+    FileCache* file = create_file_cache();
+    guint i;
+
+    if (file == NULL)
+        return FALSE;
+
+    for (i = 0; i < cache->blocks->len; i++)
+        file_cache_write_buffer(file, g_array_index(cache->blocks, MemoryBlock, i).buffer);
+    file_cache_set_read_position(file, cache->read_position);
+
+    cache_clear_blocks(cache);
+    g_array_free(cache->blocks, TRUE);
+    cache->blocks = NULL;
+    cache->file = file;
+    return TRUE;
+}
+
+// Returns the index of the block holding position, which must be below write_position.
+static guint cache_find_block(Cache* cache, gint64 position)
+{
+    guint low = 0, high = cache->blocks->len;
+
+    while (high - low > 1)
+    {
+        guint middle = (low + high) / 2;
+        if (g_array_index(cache->blocks, MemoryBlock, middle).offset <= position)
+            low = middle;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+// Returns a buffer sharing the memory of the blocks in [position, position + size).
+static GstBuffer* cache_share_blocks(Cache* cache, gint64 position, gsize size)
+{
+    GstBuffer* result = NULL;
+    guint i;
+
+    for (i = cache_find_block(cache, position); i < cache->blocks->len && size > 0; i++)
+    {
+        MemoryBlock* block = &g_array_index(cache->blocks, MemoryBlock, i);
+        gsize skip = (gsize)(position - block->offset);
+        gsize length = MIN(gst_buffer_get_size(block->buffer) - skip, size);
+        GstBuffer* region = gst_buffer_copy_region(block->buffer, GST_BUFFER_COPY_MEMORY, skip, length);
+
+        if (region == NULL)
+        {
+            if (result)
+                gst_buffer_unref(result);
+            return NULL;
+        }
+
+        result = result ? gst_buffer_append(result, region) : region;
+        position += length;
+        size -= length;
+    }
+    return result;
+}
+
+Cache* create_cache(gsize memory_limit)
+{
+    Cache* result = g_try_new0(Cache, 1);
+    if (result)
+    {
+        result->memory_limit = memory_limit;
+        if (memory_limit > 0)
+            result->blocks = g_array_new(FALSE, FALSE, sizeof(MemoryBlock));
+        else
+        {
+            result->file = create_file_cache();
+            if (result->file == NULL)
+            {
+                g_free(result);
+                return NULL;
+            }
+        }
+    }
+    return result;
+}
+
+void destroy_cache(Cache* instance)
+{
+    if (instance->file)
+        destroy_file_cache(instance->file);
+    if (instance->blocks)
+    {
+        cache_clear_blocks(instance);
+        g_array_free(instance->blocks, TRUE);
+    }
+
+    g_free(instance);
+}
+
+void cache_write_buffer(Cache* cache, GstBuffer* buffer)
+{
+    MemoryBlock block;
+    gsize size, maxsize;
+
+    if (cache->file == NULL)
+    {
+        size = gst_buffer_get_sizes(buffer, NULL, &maxsize);
+        if (size == 0)
+            return;
+
+        // Keep the data in memory if the temp file can't be created
+        if (cache->memory_size + maxsize <= cache->memory_limit || !cache_spill(cache))
+        {
+            block.offset = cache->write_position;
+            block.buffer = gst_buffer_ref(buffer);
+            g_array_append_val(cache->blocks, block);
+            cache->memory_size += maxsize;
+            cache->write_position += size;
+            return;
+        }
+    }
+
+    file_cache_write_buffer(cache->file, buffer);
+}
+
+gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+{
+    *buffer = NULL;
+
+    if (cache->file)
+        return file_cache_read_buffer(cache->file, buffer);
+
+    if (cache->read_position < cache->write_position)
+    {
+        MemoryBlock* block = &g_array_index(cache->blocks, MemoryBlock, cache_find_block(cache, cache->read_position));
+        gint64 size = block->offset + gst_buffer_get_size(block->buffer) - cache->read_position;
+
+        // Never span blocks here, so the buffer wraps a single memory
+        *buffer = cache_share_blocks(cache, cache->read_position, (gsize)MIN(size, MEMORY_READ_SIZE));
+        if (*buffer != NULL)
+        {
+            GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+            cache->read_position += gst_buffer_get_size(*buffer);
+            return cache->read_position;
+        }
+    }
+
+    return 0;
+}
+
+GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+{
+    GstFlowReturn result = GST_FLOW_ERROR;
+    *buffer = NULL;
+
+    if (cache->file)
+        return file_cache_read_buffer_from_position(cache->file, start_position, size, buffer);
+
+    if (cache_set_read_position(cache, start_position) && start_position + size <= cache->write_position)
+    {
+        *buffer = cache_share_blocks(cache, start_position, size);
+        if (*buffer != NULL)
+        {
+            GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+            cache->read_position += size;
+            result = GST_FLOW_OK;
+        }
+    }
+    return result;
+}
+
+gboolean cache_set_write_position(Cache* cache, gint64 position)
+{
+    if (cache->file)
+        return file_cache_set_write_position(cache->file, position);
+
+    if (position == cache->write_position)
+        return TRUE;
+    else if (position == 0)
+    {
+        // Buffers already read out keep their own references to the memory
+        cache_clear_blocks(cache);
+        cache->write_position = 0;
+        return TRUE;
+    }
+    return FALSE;
+}
+
+gboolean cache_set_read_position(Cache* cache, gint64 position)
+{
+    if (cache->file)
+        return file_cache_set_read_position(cache->file, position);
+
+    if (position < 0)
+        return FALSE;
+
+    cache->read_position = position;
+    return TRUE;
+}
+
+gboolean cache_has_enough_data(Cache* cache)
+{
+    if (cache->file)
+        return file_cache_has_enough_data(cache->file);
+
+    return cache->read_position < cache->write_position;
+}
@@ -32,16 +32,22 @@ typedef struct _Cache Cache;
 
 void      cache_static_init(void); // Must be called only once from the ProgressBuffer class initializer
 
-Cache*    create_cache();
+/* Creates a cache which keeps up to memory_limit bytes of written buffers in
+ * memory and moves them to a temp file once more data arrives. 0 uses the temp
+ * file from the start. If the file can't be created the data stays in memory.
+ */
+Cache*    create_cache(gsize memory_limit);
 void      destroy_cache(Cache* instance);
 
 // Writes a buffer.
 void           cache_write_buffer(Cache* cache, GstBuffer* buffer);
 
-/* Reads a buffer of the fixed size from the current read position.
+/* Reads a buffer of at most 64 KiB from the current read position.
  * Returns the read position after the operation has been made.
  * buffer parameter contains the target buffer with offset and size values set
  * This method is used in push mode.
+ * Buffers returned by the read functions may wrap a read-only mapping of the
+ * cache file instead of a copy of the data.
  */
 gint64         cache_read_buffer(Cache* cache, GstBuffer** buffer);
 
@@ -51,7 +57,7 @@ gint64         cache_read_buffer(Cache* cache, GstBuffer** buffer);
  */
 GstFlowReturn  cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer);
 
-// Sets a new write position
+// Sets a new write position. Until the cache spills to a file it can only be reset to 0.
 gboolean       cache_set_write_position(Cache* cache, gint64 position);
 
 // Sets a new read position
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef __FILE_CACHE_H__
+#define __FILE_CACHE_H__
+
+#include <gst/gst.h>
+
+/* Temp file backed storage of the progressbuffer cache. It is implemented per
+ * platform in posix/filecache.c and win32/filecache.c and used through cache.h,
+ * which keeps small streams in memory and only falls back to a file when needed.
+ * The functions behave as their cache_* counterparts in cache.h.
+ */
+typedef struct _FileCache FileCache;
+
+void           file_cache_static_init(void);
+
+FileCache*     create_file_cache();
+void           destroy_file_cache(FileCache* instance);
+
+void           file_cache_write_buffer(FileCache* cache, GstBuffer* buffer);
+gint64         file_cache_read_buffer(FileCache* cache, GstBuffer** buffer);
+GstFlowReturn  file_cache_read_buffer_from_position(FileCache* cache, gint64 start_position, guint size, GstBuffer** buffer);
+gboolean       file_cache_set_write_position(FileCache* cache, gint64 position);
+gboolean       file_cache_set_read_position(FileCache* cache, gint64 position);
+gboolean       file_cache_has_enough_data(FileCache* cache);
+
+#endif // __FILE_CACHE_H__
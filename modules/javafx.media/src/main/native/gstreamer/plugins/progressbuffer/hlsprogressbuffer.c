@@ -177,7 +177,7 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
 
     for (int i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
     {
-        element->cache[i] = create_cache();
+        element->cache[i] = create_cache(0);
         element->cache_size[i] = 0;
         element->cache_write_ready[i] = TRUE;
         element->cache_discont[i] = FALSE;
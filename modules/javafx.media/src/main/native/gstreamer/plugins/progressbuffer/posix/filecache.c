@@ -23,16 +23,30 @@
  * questions.
  */
 
-#include <cache.h>
+#include <filecache.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
 
 #define DEFAULT_BUFFER_SIZE 4096
+// Reads are served from read-only mappings of the cache file. One window
+// backs many buffers, so push mode reads can be larger than DEFAULT_BUFFER_SIZE.
+#define MAP_WINDOW_SIZE     (4 * 1024 * 1024)
+#define MAP_READ_SIZE       65536
 static const char *tempDir = NULL;
+static gint64 pageSize = 4096;
 
-struct _Cache
+typedef struct _CacheWindow
+{
+    gint    refcount;   // one for the cache, one for every buffer wrapping it
+    guint8* data;
+    gint64  start;
+    gsize   size;
+} CacheWindow;
+
+struct _FileCache
 {
     char*   filename;
     int     readHandle;
@@ -40,38 +54,139 @@ struct _Cache
 
     gint64  read_position;
     gint64  write_position;
+
+    CacheWindow* window;
+    gboolean     mapped;   // buffers of the current file may still be alive
+    gboolean     use_mmap;
 };
 
-void cache_static_init(void)
+void file_cache_static_init(void)
 {
+    long size = sysconf(_SC_PAGESIZE);
+
     tempDir = g_get_tmp_dir();
+    if (size > 0)
+        pageSize = size;
 }
 
-Cache* create_cache()
+static void cache_close_file(FileCache* cache)
 {
-    Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
-    if (result)
+    if (cache->writeHandle >= 0)
+        close(cache->writeHandle);
+    if (cache->readHandle >= 0)
+        close(cache->readHandle);
+    cache->writeHandle = cache->readHandle = -1;
+    g_free(cache->filename);
+    cache->filename = NULL;
+}
+
+static gboolean cache_open_file(FileCache* cache)
+{
+    cache->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
+    if (cache->filename == NULL)
+        return FALSE;
+
+    cache->writeHandle = g_mkstemp_full(cache->filename, O_RDWR, S_IRUSR|S_IWUSR);
+    cache->readHandle = open(cache->filename, O_RDONLY, 0);
+
+    if (cache->writeHandle < 0 || cache->readHandle < 0 || unlink(cache->filename) < 0)
     {
-        result->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
-        if (result->filename == NULL)
-            goto _error_exit;
-        else
-        {
-        result->writeHandle = g_mkstemp_full(result->filename, O_RDWR, S_IRUSR|S_IWUSR);
-            result->readHandle = open(result->filename, O_RDONLY, 0);
+        cache_close_file(cache);
+        return FALSE;
+    }
 
-            if(result->writeHandle < 0 || result->readHandle < 0)
-                goto _error_exit;
+    cache->mapped = FALSE;
+    return TRUE;
+}
 
-        if (unlink(result->filename) < 0)
-        {
-            close (result->writeHandle);
-            close (result->readHandle);
-        goto _error_exit;
-        }
 
-            result->read_position = result->write_position = 0;
-        }
+static void cache_window_unref(gpointer data)
+{
+    CacheWindow* window = (CacheWindow*)data;
+
+    if (g_atomic_int_dec_and_test(&window->refcount))
+    {
+        munmap(window->data, window->size);
+        g_free(window);
+    }
+}
+
+static void cache_release_window(FileCache* cache)
+{
+    if (cache->window)
+    {
+        cache_window_unref(cache->window);
+        cache->window = NULL;
+    }
+}
+
+/* Returns the window covering [position, position + size), mapping a new one
+ * if needed. NULL means the data has to be read with pread.
+ */
+static CacheWindow* cache_get_window(FileCache* cache, gint64 position, gsize size, int advice)
+{
+    CacheWindow* window = cache->window;
+    gint64 start;
+    gsize  length;
+    void*  data;
+
+    if (window && position >= window->start && position + (gint64)size <= window->start + (gint64)window->size)
+        return window;
+
+    if (!cache->use_mmap)
+        return NULL;
+
+    cache_release_window(cache);
+
+    start = position & ~(pageSize - 1);
+    length = MAP_WINDOW_SIZE;
+    if ((gint64)length < position - start + (gint64)size)
+        length = (gsize)((position - start + size + pageSize - 1) & ~(pageSize - 1));
+
+    // Pages past the end of the file are never touched, only written data is wrapped
+    data = mmap(NULL, length, PROT_READ, MAP_SHARED, cache->readHandle, (off_t)start);
+    if (data == MAP_FAILED)
+    {
+        cache->use_mmap = FALSE;
+        return NULL;
+    }
+    posix_madvise(data, length, advice);
+
+    window = g_try_new(CacheWindow, 1);
+    if (window == NULL)
+    {
+        munmap(data, length);
+        return NULL;
+    }
+
+    window->refcount = 1;
+    window->data = (guint8*)data;
+    window->start = start;
+    window->size = length;
+
+    cache->window = window;
+    cache->mapped = TRUE;
+    return window;
+}
+
+static GstBuffer* cache_wrap_window(CacheWindow* window, gint64 position, gsize size)
+{
+    g_atomic_int_inc(&window->refcount);
+    return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, window->data, window->size,
+                                       (gsize)(position - window->start), size, window, cache_window_unref);
+}
+
+FileCache* create_file_cache()
+{
+    FileCache* result= (FileCache*)g_try_malloc(sizeof(FileCache));
+    if (result)
+    {
+        if (!cache_open_file(result))
+            goto _error_exit;
+
+        result->read_position = result->write_position = 0;
+        result->window = NULL;
+        result->use_mmap = TRUE;
     }
     return result;
 
@@ -80,16 +195,15 @@ _error_exit:
     return NULL;
 }
 
-void destroy_cache(Cache* instance)
+void destroy_file_cache(FileCache* instance)
 {
-    close(instance->writeHandle);
-    close(instance->readHandle);
-    g_free(instance->filename);
+    cache_release_window(instance);
+    cache_close_file(instance);
 
     g_free(instance);
 }
 
-void cache_write_buffer(Cache* cache, GstBuffer* buffer)
+void file_cache_write_buffer(FileCache* cache, GstBuffer* buffer)
 {
     GstMapInfo info;
     if (gst_buffer_map(buffer, &info, GST_MAP_READ))
@@ -101,21 +215,40 @@ void cache_write_buffer(Cache* cache, GstBuffer* buffer)
     }
 }
 
-gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+gint64 file_cache_read_buffer(FileCache* cache, GstBuffer** buffer)
 {
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
+    gint64 available = cache->write_position - cache->read_position;
+    CacheWindow* window = NULL;
     *buffer = NULL;
 
+    if (available > 0)
+    {
+        gsize size = available < MAP_READ_SIZE ? (gsize)available : MAP_READ_SIZE;
+
+        window = cache_get_window(cache, cache->read_position, size, POSIX_MADV_SEQUENTIAL);
+        if (window)
+        {
+            *buffer = cache_wrap_window(window, cache->read_position, size);
+            if (*buffer != NULL)
+            {
+                GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+                cache->read_position += size;
+                return cache->read_position;
+            }
+            return 0;
+        }
+    }
+
+    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
     if (data)
     {
         ssize_t size = 0;
-        if ((cache->write_position - cache->read_position) > 0 &&
-            (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
-            size = cache->write_position - cache->read_position;
+        if (available > 0 && available < DEFAULT_BUFFER_SIZE)
+            size = available;
         else
             size = DEFAULT_BUFFER_SIZE;
 
-        ssize_t read_bytes = read(cache->readHandle, data, size);
+        ssize_t read_bytes = pread(cache->readHandle, data, size, (off_t)cache->read_position);
         if (read_bytes > 0)
         {
             *buffer = gst_buffer_new_wrapped_full(0, data, DEFAULT_BUFFER_SIZE, 0, read_bytes, data, g_free);
@@ -132,17 +265,40 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
     return 0;
 }
 
-GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+GstFlowReturn file_cache_read_buffer_from_position(FileCache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
     GstFlowReturn result = GST_FLOW_ERROR;
     *buffer = NULL;
 
-    if (cache_set_read_position(cache, start_position))
+    if (file_cache_set_read_position(cache, start_position))
     {
+        CacheWindow* window = NULL;
+
+        // Data up to write_position is in the file, map it rather than copy it
+        if (start_position + size <= cache->write_position)
+            window = cache_get_window(cache, start_position, size, POSIX_MADV_RANDOM);
+
+        if (window)
+        {
+            gint64 offset = (start_position - window->start) & ~(pageSize - 1);
+
+            // Let the kernel read the pages in before the demuxer faults on them
+            posix_madvise(window->data + offset, (size_t)(start_position - window->start - offset + size), POSIX_MADV_WILLNEED);
+
+            *buffer = cache_wrap_window(window, start_position, size);
+            if (*buffer != NULL)
+            {
+                GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+                cache->read_position += size;
+                result = GST_FLOW_OK;
+            }
+            return result;
+        }
+
         guint8 *data = (guint8*)g_try_malloc(size);
         if (data)
-    {
-        ssize_t read_bytes = read(cache->readHandle, data, size);
+        {
+            ssize_t read_bytes = pread(cache->readHandle, data, size, (off_t)cache->read_position);
             if (read_bytes == size)
             {
                 *buffer = gst_buffer_new_wrapped_full(0, data, size, 0, read_bytes, data, g_free);
@@ -153,10 +309,11 @@ GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_positio
                 }
             }
             else
-            g_free(data); // Wrong size, deleting buffer to avoid leaking.
+                g_free(data); // Wrong size, deleting buffer to avoid leaking.
 
-            cache->read_position += read_bytes;
-    }
+            if (read_bytes > 0)
+                cache->read_position += read_bytes;
+        }
     }
     return result;
 }
@@ -166,11 +323,24 @@ static inline gboolean cache_set_handler_position(int handle, guint64 position)
     return lseek(handle, position, SEEK_SET) >= 0;
 }
 
-gboolean cache_set_write_position(Cache* cache, gint64 position)
+gboolean file_cache_set_write_position(FileCache* cache, gint64 position)
 {
     gboolean result = (position == cache->write_position);
     if (!result)
     {
+        // Buffers pushed downstream may still wrap the mapped file. Start over on
+        // a new file instead of overwriting the data under them.
+        if (position == 0 && cache->mapped)
+        {
+            cache_release_window(cache);
+            cache_close_file(cache);
+            if (!cache_open_file(cache))
+                return FALSE;
+
+            cache->write_position = 0;
+            return TRUE;
+        }
+
         result = cache_set_handler_position(cache->writeHandle, position);
         if (result)
             cache->write_position = position;
@@ -178,19 +348,16 @@ gboolean cache_set_write_position(Cache* cache, gint64 position)
     return result;
 }
 
-gboolean cache_set_read_position(Cache* cache, gint64 position)
+gboolean file_cache_set_read_position(FileCache* cache, gint64 position)
 {
-    gboolean result = (position == cache->read_position);
-    if (!result)
-    {
-        result = cache_set_handler_position(cache->readHandle, position);
-        if (result)
-            cache->read_position = position;
-    }
+    // Reads use pread or the mapping, the read handle has no file position to move
+    gboolean result = (position >= 0);
+    if (result)
+        cache->read_position = position;
     return result;
 }
 
-gboolean cache_has_enough_data(Cache* cache)
+gboolean file_cache_has_enough_data(FileCache* cache)
 {
     return cache->read_position < cache->write_position;
 }
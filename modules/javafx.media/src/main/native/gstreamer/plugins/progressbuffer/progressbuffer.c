@@ -48,7 +48,8 @@ enum
     PROP_THRESHOLD,
     PROP_BANDWIDTH,
     PROP_PREBUFFER_TIME,
-    PROP_WAIT_TOLERANCE
+    PROP_WAIT_TOLERANCE,
+    PROP_MEMORY_CACHE_SIZE
 };
 
 /***********************************************************************************
@@ -85,6 +86,7 @@ struct _ProgressBuffer
     gdouble       bandwidth; // property accessible.
     gdouble       prebuffer_time; // property controlled.
     gdouble       wait_tolerance; // property controlled.
+    guint64       memory_cache_size; // property controlled.
     GTimer        *bandwidth_timer;
 
     gboolean      unexpected;
@@ -238,6 +240,15 @@ static void progress_buffer_class_init (ProgressBufferClass *klass)
                                                           2.0  /* default value */,
                                                           G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
 
+    g_object_class_install_property (gobject_class, PROP_MEMORY_CACHE_SIZE,
+                                     g_param_spec_uint64 ("memory-cache-size",
+                                                          "Memory cache size",
+                                                          "Streams up to this size in bytes are cached in memory instead of a temp file. 0 always uses a file.",
+                                                          0  /* minimum value */,
+                                                          G_MAXUINT64 /* maximum value */,
+                                                          0  /* default value */,
+                                                          G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+
     cache_static_init();
 }
 
@@ -289,6 +300,9 @@ static void progress_buffer_set_property (GObject *object, guint property_id,
         case PROP_WAIT_TOLERANCE:
             element->wait_tolerance = g_value_get_double(value);
             break;
+        case PROP_MEMORY_CACHE_SIZE:
+            element->memory_cache_size = g_value_get_uint64(value);
+            break;
 
         default:
             break;
@@ -322,6 +336,10 @@ static void progress_buffer_get_property (GObject *object, guint property_id,
             g_value_set_double(value, element->wait_tolerance);
             break;
 
+        case PROP_MEMORY_CACHE_SIZE:
+            g_value_set_uint64(value, element->memory_cache_size);
+            break;
+
         default:
             break;
     }
@@ -640,7 +658,11 @@ static GstFlowReturn progress_buffer_enqueue_item(ProgressBuffer *element, GstMi
                     if (element->cache)
                         destroy_cache(element->cache);
 
-                    element->cache = create_cache();
+                    // Small streams fit in memory, larger ones go to a temp file right away
+                    if ((guint64)(segment.stop - segment.start) <= element->memory_cache_size)
+                        element->cache = create_cache((gsize)element->memory_cache_size);
+                    else
+                        element->cache = create_cache(0);
                     if (!element->cache)
                     {
                         gst_element_message_full(GST_ELEMENT(element), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_OPEN_READ_WRITE,
@@ -23,13 +23,26 @@
  * questions.
  */
 
-#include <cache.h>
+#include <filecache.h>
 #include <windows.h>
 
 #define DEFAULT_BUFFER_SIZE 4096
+// Reads are served from read-only views of the cache file. One view backs
+// many buffers, so push mode reads can be larger than DEFAULT_BUFFER_SIZE.
+#define MAP_WINDOW_SIZE     (4 * 1024 * 1024)
+#define MAP_READ_SIZE       65536
 static char tempDir[MAX_PATH];
+static gint64 allocationGranularity = 65536;
 
-struct _Cache
+typedef struct _CacheWindow
+{
+    gint    refcount;   // one for the cache, one for every buffer wrapping it
+    guint8* data;
+    gint64  start;
+    gsize   size;
+} CacheWindow;
+
+struct _FileCache
 {
     char    filename[MAX_PATH];
     HANDLE  readHandle;
@@ -37,37 +50,160 @@ struct _Cache
 
     gint64  read_position;
     gint64  write_position;
+
+    CacheWindow* window;
+    gboolean     mapped;   // buffers of the current file may still be alive
+    gboolean     use_mmap;
 };
 
-void cache_static_init(void)
+static gboolean cache_set_handler_position(HANDLE handle, guint64 position);
+
+void file_cache_static_init(void)
 {
+    SYSTEM_INFO info;
     DWORD   dwRetVal = GetTempPath(MAX_PATH, tempDir);
     if ((dwRetVal >= MAX_PATH) || (dwRetVal == 0))
     {
         GST_WARNING("GetTempPath failed");
         g_strlcpy(tempDir, ".", MAX_PATH);
     }
+
+    // Views must start at a multiple of the allocation granularity
+    GetSystemInfo(&info);
+    if (info.dwAllocationGranularity > 0)
+        allocationGranularity = info.dwAllocationGranularity;
+}
+
+static void cache_close_file(FileCache* cache)
+{
+    // FILE_FLAG_DELETE_ON_CLOSE removes the file once the last view is unmapped
+    if (cache->writeHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(cache->writeHandle);
+    if (cache->readHandle != INVALID_HANDLE_VALUE)
+        CloseHandle(cache->readHandle);
+    cache->writeHandle = cache->readHandle = INVALID_HANDLE_VALUE;
+}
+
+static gboolean cache_open_file(FileCache* cache)
+{
+    UINT uRetVal = GetTempFileName(tempDir, "jfx", 0, cache->filename);
+    if (uRetVal == 0)
+    {
+        cache->writeHandle = cache->readHandle = INVALID_HANDLE_VALUE;
+        return FALSE;
+    }
+
+    cache->writeHandle = CreateFile(cache->filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ|FILE_SHARE_DELETE, NULL,
+                                    CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
+    cache->readHandle = CreateFile(cache->filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE |FILE_SHARE_DELETE, NULL,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
+    if (cache->writeHandle == INVALID_HANDLE_VALUE || cache->readHandle == INVALID_HANDLE_VALUE)
+    {
+        cache_close_file(cache);
+        return FALSE;
+    }
+
+    cache->mapped = FALSE;
+    return TRUE;
+}
+
+static void cache_window_unref(gpointer data)
+{
+    CacheWindow* window = (CacheWindow*)data;
+
+    if (g_atomic_int_dec_and_test(&window->refcount))
+    {
+        UnmapViewOfFile(window->data);
+        g_free(window);
+    }
+}
+
+static void cache_release_window(FileCache* cache)
+{
+    if (cache->window)
+    {
+        cache_window_unref(cache->window);
+        cache->window = NULL;
+    }
+}
+
+/* Returns the window covering [position, position + size), mapping a new one
+ * if needed. NULL means the data has to be read with ReadFile.
+ */
+static CacheWindow* cache_get_window(FileCache* cache, gint64 position, gsize size)
+{
+    CacheWindow* window = cache->window;
+    LARGE_INTEGER start, end;
+    HANDLE mapping;
+    gsize  length;
+    void*  data;
+
+    if (window && position >= window->start && position + (gint64)size <= window->start + (gint64)window->size)
+        return window;
+
+    if (!cache->use_mmap)
+        return NULL;
+
+    cache_release_window(cache);
+
+    start.QuadPart = position - position % allocationGranularity;
+    length = MAP_WINDOW_SIZE;
+    if ((gint64)length < position - start.QuadPart + (gint64)size)
+        length = (gsize)(position - start.QuadPart + size);
+    end.QuadPart = start.QuadPart + length;
+
+    // A read/write mapping grows the file to the end of the view, so the view also
+    // covers data written later. Only data below write_position is ever wrapped.
+    mapping = CreateFileMapping(cache->writeHandle, NULL, PAGE_READWRITE, end.HighPart, end.LowPart, NULL);
+    if (mapping == NULL)
+    {
+        cache->use_mmap = FALSE;
+        return NULL;
+    }
+
+    data = MapViewOfFile(mapping, FILE_MAP_READ, start.HighPart, start.LowPart, length);
+    CloseHandle(mapping); // the view keeps the mapping alive
+    if (data == NULL)
+    {
+        cache->use_mmap = FALSE;
+        return NULL;
+    }
+
+    window = g_try_new(CacheWindow, 1);
+    if (window == NULL)
+    {
+        UnmapViewOfFile(data);
+        return NULL;
+    }
+
+    window->refcount = 1;
+    window->data = (guint8*)data;
+    window->start = start.QuadPart;
+    window->size = length;
+
+    cache->window = window;
+    cache->mapped = TRUE;
+    return window;
 }
 
-Cache* create_cache()
+static GstBuffer* cache_wrap_window(CacheWindow* window, gint64 position, gsize size)
 {
-    Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
+    g_atomic_int_inc(&window->refcount);
+    return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, window->data, window->size,
+                                       (gsize)(position - window->start), size, window, cache_window_unref);
+}
+
+FileCache* create_file_cache()
+{
+    FileCache* result= (FileCache*)g_try_malloc(sizeof(FileCache));
     if (result)
     {
-        UINT uRetVal = GetTempFileName(tempDir, "jfx", 0, result->filename);
-        if (uRetVal == 0)
+        if (!cache_open_file(result))
             goto _error_exit;
-        else
-        {
-            result->writeHandle = CreateFile(result->filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ|FILE_SHARE_DELETE, NULL,
-                                             CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
-            result->readHandle = CreateFile(result->filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE |FILE_SHARE_DELETE, NULL,
-                                            OPEN_EXISTING, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
-            if(result->writeHandle == INVALID_HANDLE_VALUE || result->readHandle == INVALID_HANDLE_VALUE)
-                goto _error_exit;
-
-            result->read_position = result->write_position = 0;
-        }
+
+        result->read_position = result->write_position = 0;
+        result->window = NULL;
+        result->use_mmap = TRUE;
     }
     return result;
 
@@ -76,15 +212,15 @@ _error_exit:
     return NULL;
 }
 
-void destroy_cache(Cache* instance)
+void destroy_file_cache(FileCache* instance)
 {
-    CloseHandle(instance->writeHandle);
-    CloseHandle(instance->readHandle);
+    cache_release_window(instance);
+    cache_close_file(instance);
 
     g_free(instance);
 }
 
-void cache_write_buffer(Cache* cache, GstBuffer* buffer)
+void file_cache_write_buffer(FileCache* cache, GstBuffer* buffer)
 {
     DWORD written = 0;
     GstMapInfo info;
@@ -96,19 +232,40 @@ void cache_write_buffer(Cache* cache, GstBuffer* buffer)
     }
 }
 
-gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+gint64 file_cache_read_buffer(FileCache* cache, GstBuffer** buffer)
 {
     DWORD read = 0;
     DWORD size = 0;
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
+    gint64 available = cache->write_position - cache->read_position;
+    guint8 *data = NULL;
     *buffer = NULL;
 
-    if ((cache->write_position - cache->read_position) > 0 && (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
-        size = cache->write_position - cache->read_position;
+    if (available > 0)
+    {
+        gsize map_size = available < MAP_READ_SIZE ? (gsize)available : MAP_READ_SIZE;
+        CacheWindow* window = cache_get_window(cache, cache->read_position, map_size);
+        if (window)
+        {
+            *buffer = cache_wrap_window(window, cache->read_position, map_size);
+            if (*buffer != NULL)
+            {
+                GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+                cache->read_position += map_size;
+                return cache->read_position;
+            }
+            return 0;
+        }
+    }
+
+    if (available > 0 && available < DEFAULT_BUFFER_SIZE)
+        size = (DWORD)available;
     else
         size = DEFAULT_BUFFER_SIZE;
 
-    if (data && ReadFile(cache->readHandle, data, size, &read, NULL))
+    // Mapped reads do not move the file pointer of the read handle
+    data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
+    if (data && cache_set_handler_position(cache->readHandle, cache->read_position) &&
+        ReadFile(cache->readHandle, data, size, &read, NULL))
     {
         *buffer = gst_buffer_new_wrapped_full(0, data, DEFAULT_BUFFER_SIZE, 0, read, data, g_free);
         if (*buffer != NULL)
@@ -123,16 +280,36 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
     return 0;
 }
 
-GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+GstFlowReturn file_cache_read_buffer_from_position(FileCache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
     GstFlowReturn result = GST_FLOW_ERROR;
     *buffer = NULL;
 
-    if (cache_set_read_position(cache, start_position))
+    if (file_cache_set_read_position(cache, start_position))
     {
         DWORD  read = 0;
-        guint8 *data = (guint8*)g_try_malloc(size);
-        if (data && ReadFile(cache->readHandle, data, size, &read, NULL))
+        guint8 *data = NULL;
+        CacheWindow* window = NULL;
+
+        // Data up to write_position is in the file, map it rather than copy it
+        if (start_position + size <= cache->write_position)
+            window = cache_get_window(cache, start_position, size);
+
+        if (window)
+        {
+            *buffer = cache_wrap_window(window, start_position, size);
+            if (*buffer != NULL)
+            {
+                GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+                cache->read_position += size;
+                result = GST_FLOW_OK;
+            }
+            return result;
+        }
+
+        data = (guint8*)g_try_malloc(size);
+        if (data && cache_set_handler_position(cache->readHandle, cache->read_position) &&
+            ReadFile(cache->readHandle, data, size, &read, NULL))
         {
             if (read == size)
             {
@@ -163,11 +340,24 @@ static gboolean cache_set_handler_position(HANDLE handle, guint64 position)
     return (li.LowPart != INVALID_SET_FILE_POINTER || GetLastError() == NO_ERROR);
 }
 
-gboolean cache_set_write_position(Cache* cache, gint64 position)
+gboolean file_cache_set_write_position(FileCache* cache, gint64 position)
 {
     gboolean result = (position == cache->write_position);
     if (!result)
     {
+        // Buffers pushed downstream may still wrap a view of the file. Start over
+        // on a new file instead of overwriting the data under them.
+        if (position == 0 && cache->mapped)
+        {
+            cache_release_window(cache);
+            cache_close_file(cache);
+            if (!cache_open_file(cache))
+                return FALSE;
+
+            cache->write_position = 0;
+            return TRUE;
+        }
+
         result = cache_set_handler_position(cache->writeHandle, position);
         if (result)
             cache->write_position = position;
@@ -175,19 +365,16 @@ gboolean cache_set_write_position(Cache* cache, gint64 position)
     return result;
 }
 
-gboolean cache_set_read_position(Cache* cache, gint64 position)
+gboolean file_cache_set_read_position(FileCache* cache, gint64 position)
 {
-    gboolean result = (position == cache->read_position);
-    if (!result)
-    {
-        result = cache_set_handler_position(cache->readHandle, position);
-        if (result)
-            cache->read_position = position;
-    }
+    // The read handle is positioned before each ReadFile, mapped reads need no seek
+    gboolean result = (position >= 0);
+    if (result)
+        cache->read_position = position;
     return result;
 }
 
-gboolean cache_has_enough_data(Cache* cache)
+gboolean file_cache_has_enough_data(FileCache* cache)
 {
     return cache->read_position < cache->write_position;
 }
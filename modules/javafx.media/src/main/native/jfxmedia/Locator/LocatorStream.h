@@ -56,6 +56,19 @@ public:
     /* CopyBlock copies the data from whatever internal buffer to the destination.*/
     virtual void CopyBlock(void* destination, int size) = 0;
 
+    /* ReadNextBlockInto reads next available block of data straight into the
+     * destination, at most size bytes, and returns the number of bytes actually
+     * have been read. Return values are the same as for ReadNextBlock, no
+     * CopyBlock call is needed afterwards.
+     */
+    virtual int  ReadNextBlockInto(void* destination, int size) = 0;
+
+    /* ReadBlockInto reads arbitrary block of data straight into the destination
+     * and returns the number of bytes actually have been read. Return values are
+     * the same as for ReadBlock, no CopyBlock call is needed afterwards.
+     */
+    virtual int  ReadBlockInto(int64_t position, void* destination, int size) = 0;
+
     /* Detects whether the source is seekable.*/
     virtual bool IsSeekable() = 0;
 
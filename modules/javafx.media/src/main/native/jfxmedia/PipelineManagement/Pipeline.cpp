@@ -184,6 +184,17 @@ uint32_t CPipeline::GetAudioSyncDelay(long* plMillis)
     return ERROR_NONE;
 }
 
+uint32_t CPipeline::GetStatistics(int64_t* pllValues, int iCount)
+{
+    if (NULL == pllValues)
+        return ERROR_FUNCTION_PARAM_NULL;
+
+    for (int i = 0; i < iCount; i++)
+        pllValues[i] = 0;
+
+    return ERROR_NONE;
+}
+
 CAudioEqualizer* CPipeline::GetAudioEqualizer()
 {
     return NULL;
@@ -57,6 +57,21 @@ public:
         Error = 7
     };
 
+    // Indices of the values filled in by GetStatistics(), these must match
+    // the ones in PlayerStatistics.java.
+    enum Statistic
+    {
+        FramesRendered = 0,       // video frames sent to Java
+        FramesLate = 1,           // video frames sent late for their time
+        FramesDropped = 2,        // video frames dropped by the sink
+        VideoDecodeTime = 3,      // decode time of last frame, microseconds
+        FrameCallbackTime = 4,    // total time in new frame callback, microseconds
+        FrameCallbackMaxTime = 5, // longest new frame callback, microseconds
+        VideoQueueLevel = 6,      // buffers queued ahead of video decoder
+        AudioQueueLevel = 7,      // buffers queued ahead of audio decoder
+        StatisticCount = 8
+    };
+
 public:
     CPipeline(CPipelineOptions* pOptions=NULL);
     virtual ~CPipeline();
@@ -89,6 +104,8 @@ public:
     virtual uint32_t        SetAudioSyncDelay(long lMillis);
     virtual uint32_t        GetAudioSyncDelay(long* plMillis);
 
+    virtual uint32_t        GetStatistics(int64_t* pllValues, int iCount);
+
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
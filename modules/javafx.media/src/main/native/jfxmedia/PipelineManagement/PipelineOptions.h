@@ -28,10 +28,14 @@
 
 #include <list>
 #include <string>
+#include <stdint.h>
 
 using namespace std;
 typedef list<string> ContentTypesList;
 
+// Streams up to this size are buffered in memory instead of a temp file.
+#define DEFAULT_MEMORY_CACHE_SIZE (2 * 1024 * 1024)
+
 class CPipelineOptions
 {
 public:
@@ -47,7 +51,10 @@ public:
         m_StreamMimeType(-1),
         m_AudioStreamMimeType(-1),
         m_bHLSModeEnabled(false),
-        m_audioFlags(0)
+        m_audioFlags(0),
+        m_MemoryCacheSize(DEFAULT_MEMORY_CACHE_SIZE),
+        m_bLowLatencyEnabled(false),
+        m_bSharedClockEnabled(false)
     {}
 
     virtual ~CPipelineOptions() {}
@@ -73,6 +80,18 @@ public:
     inline void  SetAudioFlags(int audioFlags) { m_audioFlags = audioFlags; }
     inline int  GetAudioFlags() { return m_audioFlags; }
 
+    // Size in bytes up to which progressbuffer keeps the stream in memory, 0 always uses a temp file.
+    inline void    SetMemoryCacheSize(int64_t size) { m_MemoryCacheSize = size; }
+    inline int64_t GetMemoryCacheSize() { return m_MemoryCacheSize; }
+
+    // Live sources: minimal queues, late video frames dropped, no prebuffering.
+    inline void SetLowLatencyEnabled(bool enabled) { m_bLowLatencyEnabled = enabled; }
+    inline bool GetLowLatencyEnabled() { return m_bLowLatencyEnabled; }
+
+    // Pipelines with a shared clock all run on one process wide clock.
+    inline void SetSharedClockEnabled(bool enabled) { m_bSharedClockEnabled = enabled; }
+    inline bool GetSharedClockEnabled() { return m_bSharedClockEnabled; }
+
     // Returns true if we need to force default track ID. For multi source streams
     // two demuxers (qtdemux in case of fMP4 HLS with EXT-X-MEDIA) will report same
     // ID, since two demuxers are not aware of each other and that we actually
@@ -109,6 +128,9 @@ private:
     int         m_AudioStreamMimeType;
     bool        m_bHLSModeEnabled;
     int         m_audioFlags;
+    int64_t     m_MemoryCacheSize;
+    bool        m_bLowLatencyEnabled;
+    bool        m_bSharedClockEnabled;
 
     // Audio parser or demultiplexer for main stream
     string      m_StreamParser;
@@ -27,6 +27,7 @@
 #include "ColorConverter.h"
 #include <stdio.h>
 
+#ifndef ENABLE_SIMD_SSE2
 #if (! TARGET_OS_LINUX || defined(__SSE2__))
 #if defined(TARGET_OS_MAC_ARM64)
 #define ENABLE_SIMD_SSE2 0
@@ -36,6 +37,7 @@
 #else
 #define ENABLE_SIMD_SSE2 0
 #endif
+#endif
 
 // --- Begin macros
 #define TCLAMP_U8(val, dst) dst = pClip[val]
@@ -380,6 +382,579 @@ const uint16_t color_tBU[256] = {
 };
 // --- End tables
 
+// --- Begin shared row kernels
+/*
+ * The kernels below convert whole rows with the same fixed point arithmetic
+ * as the SSE2 code: luma and chroma are scaled by the coefficients below and
+ * summed in 1/32 units before the final shift and saturation.
+ *
+ * A row kernel converts as many pixels as it can from the start of the row
+ * and returns that count; color_convert_420/422 finish the rest of the row
+ * with the scalar kernel, so every kernel sees only the start of a row.
+ */
+#define COLOR_K_Y       0x2543      /* 1.1644  * 8192 */
+#define COLOR_K_BU      0x4097      /* 2.0184  * 8192 */
+#define COLOR_K_GU      0x0c8b      /* abs( -0.3920 * 8192 ) */
+#define COLOR_K_GV      0x1a06      /* abs( -0.8132 * 8192 ) */
+#define COLOR_K_RV      0x3317      /* 1.5966  * 8192 */
+#define COLOR_OFF_B     (-0x22a0)   /* -276.9856 * 32 */
+#define COLOR_OFF_G     0x10f4      /* 135.6352  * 32 */
+#define COLOR_OFF_R     (-0x1be0)   /* -222.9952 * 32 */
+
+#define COLOR_ORDER_ARGB    0
+#define COLOR_ORDER_BGRA    1
+
+#define COLOR_CLAMP_U8(v) ((v) < 0 ? 0 : ((v) > 255 ? 255 : (v)))
+
+#ifndef ENABLE_SIMD_NEON
+#if !ENABLE_SIMD_SSE2 && (defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON))
+#define ENABLE_SIMD_NEON 1
+#else
+#define ENABLE_SIMD_NEON 0
+#endif
+#endif
+
+#ifndef ENABLE_SIMD_AVX2
+#if ENABLE_SIMD_SSE2 && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define ENABLE_SIMD_AVX2 1
+#else
+#define ENABLE_SIMD_AVX2 0
+#endif
+#endif
+
+/*
+ * d1/d2, y1/y2 and a1/a2 are the two rows sharing the u and v samples.
+ * a1 and a2 are NULL when the frame has no alpha plane.
+ */
+typedef int32_t (*ColorRows420Func)(uint8_t *d1, uint8_t *d2,
+                                    const uint8_t *y1, const uint8_t *y2,
+                                    const uint8_t *u, const uint8_t *v,
+                                    const uint8_t *a1, const uint8_t *a2,
+                                    int32_t width, int32_t order,
+                                    int32_t premultiply);
+
+/*
+ * y, u and v point into one packed 4:2:2 row: pixel i has its luma at
+ * y[2 * i] and pixel pair k its chroma at u[4 * k] and v[4 * k].
+ */
+typedef int32_t (*ColorRows422Func)(uint8_t *d,
+                                    const uint8_t *y,
+                                    const uint8_t *u,
+                                    const uint8_t *v,
+                                    int32_t width, int32_t order);
+
+// --- Begin C row kernels
+static void color_store_pixel(uint8_t *d, int32_t y, int32_t cb, int32_t cg,
+                              int32_t cr, int32_t alpha, int32_t order,
+                              int32_t premultiply)
+{
+    int32_t yy = (y * COLOR_K_Y) >> 8;
+    int32_t b = (yy + cb) >> 5;
+    int32_t g = (yy + cg) >> 5;
+    int32_t r = (yy + cr) >> 5;
+
+    b = COLOR_CLAMP_U8(b);
+    g = COLOR_CLAMP_U8(g);
+    r = COLOR_CLAMP_U8(r);
+
+    if (premultiply) {
+        b = (b * (alpha + 1)) >> 8;
+        g = (g * (alpha + 1)) >> 8;
+        r = (r * (alpha + 1)) >> 8;
+    }
+
+    if (order == COLOR_ORDER_ARGB) {
+        d[0] = (uint8_t)alpha;
+        d[1] = (uint8_t)r;
+        d[2] = (uint8_t)g;
+        d[3] = (uint8_t)b;
+    } else {
+        d[0] = (uint8_t)b;
+        d[1] = (uint8_t)g;
+        d[2] = (uint8_t)r;
+        d[3] = (uint8_t)alpha;
+    }
+}
+
+#define COLOR_CHROMA(iu, iv, cb, cg, cr)                                \
+{                                                                       \
+    cb = ((iu * COLOR_K_BU) >> 8) + COLOR_OFF_B;                        \
+    cg = COLOR_OFF_G - ((iu * COLOR_K_GU) >> 8) - ((iv * COLOR_K_GV) >> 8); \
+    cr = ((iv * COLOR_K_RV) >> 8) + COLOR_OFF_R;                        \
+}
+
+static int32_t color_rows420_c(uint8_t *d1, uint8_t *d2,
+                               const uint8_t *y1, const uint8_t *y2,
+                               const uint8_t *u, const uint8_t *v,
+                               const uint8_t *a1, const uint8_t *a2,
+                               int32_t width, int32_t order,
+                               int32_t premultiply)
+{
+    int32_t i;
+
+    for (i = 0; i < width; i += 2) {
+        int32_t iu = u[i >> 1], iv = v[i >> 1], cb, cg, cr;
+
+        COLOR_CHROMA(iu, iv, cb, cg, cr);
+
+        color_store_pixel(d1 + 4 * i, y1[i], cb, cg, cr,
+                          a1 ? a1[i] : 0xff, order, premultiply);
+        color_store_pixel(d1 + 4 * i + 4, y1[i + 1], cb, cg, cr,
+                          a1 ? a1[i + 1] : 0xff, order, premultiply);
+        color_store_pixel(d2 + 4 * i, y2[i], cb, cg, cr,
+                          a2 ? a2[i] : 0xff, order, premultiply);
+        color_store_pixel(d2 + 4 * i + 4, y2[i + 1], cb, cg, cr,
+                          a2 ? a2[i + 1] : 0xff, order, premultiply);
+    }
+
+    return width;
+}
+
+static int32_t color_rows422_c(uint8_t *d,
+                               const uint8_t *y,
+                               const uint8_t *u,
+                               const uint8_t *v,
+                               int32_t width, int32_t order)
+{
+    int32_t i;
+
+    for (i = 0; i < width; i += 2) {
+        int32_t iu = u[2 * i], iv = v[2 * i], cb, cg, cr;
+
+        COLOR_CHROMA(iu, iv, cb, cg, cr);
+
+        color_store_pixel(d + 4 * i, y[2 * i], cb, cg, cr, 0xff, order, 0);
+        color_store_pixel(d + 4 * i + 4, y[2 * i + 2], cb, cg, cr, 0xff, order, 0);
+    }
+
+    return width;
+}
+// --- End C row kernels
+
+#if ENABLE_SIMD_NEON
+// --- Begin NEON row kernels
+#include <arm_neon.h>
+
+/* (x * k) >> 8 for 8 lanes, the result fits in 16 bits for 8-bit x */
+static uint16x8_t color_mul_neon(uint16x8_t x, uint16_t k)
+{
+    uint32x4_t lo = vmull_n_u16(vget_low_u16(x), k);
+    uint32x4_t hi = vmull_n_u16(vget_high_u16(x), k);
+
+    return vcombine_u16(vshrn_n_u32(lo, 8), vshrn_n_u32(hi, 8));
+}
+
+/* chroma terms for 8 u/v samples, i.e. 16 pixels */
+static void color_chroma_neon(uint8x8_t u8, uint8x8_t v8,
+                              int16x8_t *cb, int16x8_t *cg, int16x8_t *cr)
+{
+    uint16x8_t u = vmovl_u8(u8);
+    uint16x8_t v = vmovl_u8(v8);
+    int16x8_t gu = vreinterpretq_s16_u16(color_mul_neon(u, COLOR_K_GU));
+    int16x8_t gv = vreinterpretq_s16_u16(color_mul_neon(v, COLOR_K_GV));
+
+    *cb = vaddq_s16(vreinterpretq_s16_u16(color_mul_neon(u, COLOR_K_BU)),
+                    vdupq_n_s16(COLOR_OFF_B));
+    *cg = vsubq_s16(vsubq_s16(vdupq_n_s16(COLOR_OFF_G), gu), gv);
+    *cr = vaddq_s16(vreinterpretq_s16_u16(color_mul_neon(v, COLOR_K_RV)),
+                    vdupq_n_s16(COLOR_OFF_R));
+}
+
+/* (c * (a + 1)) >> 8 */
+static uint8x16_t color_premultiply_neon(uint8x16_t c, uint8x16_t a)
+{
+    uint16x8_t lo = vaddw_u8(vmull_u8(vget_low_u8(c), vget_low_u8(a)), vget_low_u8(c));
+    uint16x8_t hi = vaddw_u8(vmull_u8(vget_high_u8(c), vget_high_u8(a)), vget_high_u8(c));
+
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+/* converts and stores 16 pixels sharing the chroma terms of 8 samples */
+static void color_row_neon(uint8_t *d, uint8x16_t y, uint8x16_t a,
+                           int16x8_t cb, int16x8_t cg, int16x8_t cr,
+                           int32_t order, int32_t premultiply)
+{
+    int16x8x2_t b2 = vzipq_s16(cb, cb);
+    int16x8x2_t g2 = vzipq_s16(cg, cg);
+    int16x8x2_t r2 = vzipq_s16(cr, cr);
+    int16x8_t ylo = vreinterpretq_s16_u16(color_mul_neon(vmovl_u8(vget_low_u8(y)), COLOR_K_Y));
+    int16x8_t yhi = vreinterpretq_s16_u16(color_mul_neon(vmovl_u8(vget_high_u8(y)), COLOR_K_Y));
+    uint8x16_t b = vcombine_u8(vqshrun_n_s16(vaddq_s16(ylo, b2.val[0]), 5),
+                               vqshrun_n_s16(vaddq_s16(yhi, b2.val[1]), 5));
+    uint8x16_t g = vcombine_u8(vqshrun_n_s16(vaddq_s16(ylo, g2.val[0]), 5),
+                               vqshrun_n_s16(vaddq_s16(yhi, g2.val[1]), 5));
+    uint8x16_t r = vcombine_u8(vqshrun_n_s16(vaddq_s16(ylo, r2.val[0]), 5),
+                               vqshrun_n_s16(vaddq_s16(yhi, r2.val[1]), 5));
+    uint8x16x4_t px;
+
+    if (premultiply) {
+        b = color_premultiply_neon(b, a);
+        g = color_premultiply_neon(g, a);
+        r = color_premultiply_neon(r, a);
+    }
+
+    if (order == COLOR_ORDER_ARGB) {
+        px.val[0] = a;
+        px.val[1] = r;
+        px.val[2] = g;
+        px.val[3] = b;
+    } else {
+        px.val[0] = b;
+        px.val[1] = g;
+        px.val[2] = r;
+        px.val[3] = a;
+    }
+    vst4q_u8(d, px);
+}
+
+static int32_t color_rows420_neon(uint8_t *d1, uint8_t *d2,
+                                  const uint8_t *y1, const uint8_t *y2,
+                                  const uint8_t *u, const uint8_t *v,
+                                  const uint8_t *a1, const uint8_t *a2,
+                                  int32_t width, int32_t order,
+                                  int32_t premultiply)
+{
+    const uint8x16_t opaque = vdupq_n_u8(0xff);
+    int16x8_t cb, cg, cr;
+    int32_t i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        color_chroma_neon(vld1_u8(u + (i >> 1)), vld1_u8(v + (i >> 1)), &cb, &cg, &cr);
+        color_row_neon(d1 + 4 * i, vld1q_u8(y1 + i), a1 ? vld1q_u8(a1 + i) : opaque,
+                       cb, cg, cr, order, premultiply);
+        color_row_neon(d2 + 4 * i, vld1q_u8(y2 + i), a2 ? vld1q_u8(a2 + i) : opaque,
+                       cb, cg, cr, order, premultiply);
+    }
+
+    return i;
+}
+
+static int32_t color_rows422_neon(uint8_t *d,
+                                  const uint8_t *y,
+                                  const uint8_t *u,
+                                  const uint8_t *v,
+                                  int32_t width, int32_t order)
+{
+    int16x8_t cb, cg, cr;
+    int32_t i;
+
+    // each step reads 32 bytes from y, u and v, which start up to 3 bytes
+    // into the 32 bytes of the 16 pixels: stop 2 pixels short of the end
+    for (i = 0; i + 18 <= width; i += 16) {
+        color_chroma_neon(vld4_u8(u + 2 * i).val[0], vld4_u8(v + 2 * i).val[0], &cb, &cg, &cr);
+        color_row_neon(d + 4 * i, vld2q_u8(y + 2 * i).val[0], vdupq_n_u8(0xff),
+                       cb, cg, cr, order, 0);
+    }
+
+    return i;
+}
+// --- End NEON row kernels
+#endif // ENABLE_SIMD_NEON
+
+#if ENABLE_SIMD_AVX2
+// --- Begin AVX2 row kernels
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define COLOR_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define COLOR_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+/* AVX2 needs both CPU support and the OS saving the YMM registers */
+static int color_detect_avx2(void)
+{
+#if defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return 0;
+    __cpuid(info, 1);
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+        return 0;
+    if ((_xgetbv(0) & 6) != 6)
+        return 0;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx, xcr0_lo, xcr0_hi;
+
+    if (__get_cpuid_max(0, NULL) < 7)
+        return 0;
+    __cpuid(1, eax, ebx, ecx, edx);
+    if ((ecx & (1 << 27)) == 0 || (ecx & (1 << 28)) == 0)
+        return 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    if ((xcr0_lo & 6) != 6)
+        return 0;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx & (1 << 5)) != 0;
+#endif
+}
+
+static int color_has_avx2(void)
+{
+    // the detection is idempotent, a racy first call only repeats it
+    static volatile int avx2 = -1;
+
+    if (avx2 < 0)
+        avx2 = color_detect_avx2();
+    return avx2;
+}
+
+/*
+ * Chroma terms for 16 pixels. u16 and v16 hold one 8-bit sample per 16-bit
+ * lane, already repeated for both pixels of a pair.
+ */
+COLOR_TARGET_AVX2
+static void color_chroma_avx2(__m256i u16, __m256i v16,
+                              __m256i *cb, __m256i *cg, __m256i *cr)
+{
+    __m256i u = _mm256_slli_epi16(u16, 8);
+    __m256i v = _mm256_slli_epi16(v16, 8);
+    __m256i gu = _mm256_mulhi_epu16(u, _mm256_set1_epi16(COLOR_K_GU));
+    __m256i gv = _mm256_mulhi_epu16(v, _mm256_set1_epi16(COLOR_K_GV));
+
+    *cb = _mm256_add_epi16(_mm256_mulhi_epu16(u, _mm256_set1_epi16(COLOR_K_BU)),
+                           _mm256_set1_epi16(COLOR_OFF_B));
+    *cg = _mm256_sub_epi16(_mm256_set1_epi16(COLOR_OFF_G), _mm256_add_epi16(gu, gv));
+    *cr = _mm256_add_epi16(_mm256_mulhi_epu16(v, _mm256_set1_epi16(COLOR_K_RV)),
+                           _mm256_set1_epi16(COLOR_OFF_R));
+}
+
+/* clamp((yy + c) >> 5) to 0..255, optionally times (a + 1) >> 8 */
+COLOR_TARGET_AVX2
+static __m256i color_channel_avx2(__m256i yy, __m256i c, __m256i a1,
+                                  int32_t premultiply)
+{
+    __m256i x = _mm256_srai_epi16(_mm256_add_epi16(yy, c), 5);
+
+    x = _mm256_min_epi16(_mm256_max_epi16(x, _mm256_setzero_si256()),
+                         _mm256_set1_epi16(0xff));
+    if (premultiply)
+        x = _mm256_srli_epi16(_mm256_mullo_epi16(x, a1), 8);
+    return x;
+}
+
+/* converts and stores 16 pixels, y16 and a16 hold one sample per lane */
+COLOR_TARGET_AVX2
+static void color_row_avx2(uint8_t *d, __m256i y16, __m256i a16,
+                           __m256i cb, __m256i cg, __m256i cr,
+                           int32_t order, int32_t premultiply)
+{
+    __m256i yy = _mm256_mulhi_epu16(_mm256_slli_epi16(y16, 8),
+                                    _mm256_set1_epi16(COLOR_K_Y));
+    __m256i a1 = _mm256_add_epi16(a16, _mm256_set1_epi16(1));
+    __m256i b = color_channel_avx2(yy, cb, a1, premultiply);
+    __m256i g = color_channel_avx2(yy, cg, a1, premultiply);
+    __m256i r = color_channel_avx2(yy, cr, a1, premultiply);
+    __m256i lo, hi, p0, p1;
+
+    if (order == COLOR_ORDER_ARGB) {
+        lo = _mm256_or_si256(a16, _mm256_slli_epi16(r, 8));
+        hi = _mm256_or_si256(g, _mm256_slli_epi16(b, 8));
+    } else {
+        lo = _mm256_or_si256(b, _mm256_slli_epi16(g, 8));
+        hi = _mm256_or_si256(r, _mm256_slli_epi16(a16, 8));
+    }
+
+    // unpack works per 128-bit lane: p0 holds pixels 0-3 and 8-11,
+    // p1 pixels 4-7 and 12-15
+    p0 = _mm256_unpacklo_epi16(lo, hi);
+    p1 = _mm256_unpackhi_epi16(lo, hi);
+    _mm256_storeu_si256((__m256i*)d, _mm256_permute2x128_si256(p0, p1, 0x20));
+    _mm256_storeu_si256((__m256i*)(d + 32), _mm256_permute2x128_si256(p0, p1, 0x31));
+}
+
+/* 8 chroma samples repeated for both pixels of a pair, one per 16-bit lane */
+COLOR_TARGET_AVX2
+static __m256i color_load_chroma420_avx2(const uint8_t *p)
+{
+    __m128i x = _mm_loadl_epi64((const __m128i*)p);
+
+    return _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(x, x));
+}
+
+COLOR_TARGET_AVX2
+static int32_t color_rows420_avx2(uint8_t *d1, uint8_t *d2,
+                                  const uint8_t *y1, const uint8_t *y2,
+                                  const uint8_t *u, const uint8_t *v,
+                                  const uint8_t *a1, const uint8_t *a2,
+                                  int32_t width, int32_t order,
+                                  int32_t premultiply)
+{
+    const __m256i opaque = _mm256_set1_epi16(0xff);
+    __m256i cb, cg, cr, y16, a16;
+    int32_t i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        color_chroma_avx2(color_load_chroma420_avx2(u + (i >> 1)),
+                          color_load_chroma420_avx2(v + (i >> 1)), &cb, &cg, &cr);
+
+        y16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(y1 + i)));
+        a16 = a1 ? _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(a1 + i))) : opaque;
+        color_row_avx2(d1 + 4 * i, y16, a16, cb, cg, cr, order, premultiply);
+
+        y16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(y2 + i)));
+        a16 = a2 ? _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(a2 + i))) : opaque;
+        color_row_avx2(d2 + 4 * i, y16, a16, cb, cg, cr, order, premultiply);
+    }
+
+    return i;
+}
+
+COLOR_TARGET_AVX2
+static int32_t color_rows422_avx2(uint8_t *d,
+                                  const uint8_t *y,
+                                  const uint8_t *u,
+                                  const uint8_t *v,
+                                  int32_t width, int32_t order)
+{
+    const __m256i mask16 = _mm256_set1_epi16(0xff);
+    const __m256i mask32 = _mm256_set1_epi32(0xff);
+    __m256i cu, cv;
+    __m256i cb, cg, cr;
+    int32_t i;
+
+    // same read pattern as the NEON kernel: stop 2 pixels short of the end
+    for (i = 0; i + 18 <= width; i += 16) {
+        cu = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u + 2 * i)), mask32);
+        cv = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v + 2 * i)), mask32);
+        color_chroma_avx2(_mm256_or_si256(cu, _mm256_slli_epi32(cu, 16)),
+                          _mm256_or_si256(cv, _mm256_slli_epi32(cv, 16)),
+                          &cb, &cg, &cr);
+        color_row_avx2(d + 4 * i,
+                       _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(y + 2 * i)), mask16),
+                       mask16, cb, cg, cr, order, 0);
+    }
+
+    return i;
+}
+// --- End AVX2 row kernels
+#endif // ENABLE_SIMD_AVX2
+
+/* best row kernel for this CPU, NULL when only the scalar code applies */
+static ColorRows420Func color_rows420_kernel(void)
+{
+#if ENABLE_SIMD_NEON
+    return color_rows420_neon;
+#else
+#if ENABLE_SIMD_AVX2
+    if (color_has_avx2())
+        return color_rows420_avx2;
+#endif
+    return NULL;
+#endif
+}
+
+static ColorRows422Func color_rows422_kernel(void)
+{
+#if ENABLE_SIMD_NEON
+    return color_rows422_neon;
+#else
+#if ENABLE_SIMD_AVX2
+    if (color_has_avx2())
+        return color_rows422_avx2;
+#endif
+    return NULL;
+#endif
+}
+
+static int color_convert_420(uint8_t *dst,
+                             int32_t dst_stride,
+                             int32_t width,
+                             int32_t height,
+                             const uint8_t *y,
+                             const uint8_t *v,
+                             const uint8_t *u,
+                             const uint8_t *a,
+                             int32_t y_stride,
+                             int32_t v_stride,
+                             int32_t u_stride,
+                             int32_t a_stride,
+                             int32_t order,
+                             int32_t premultiply,
+                             ColorRows420Func rows)
+{
+    const uint8_t *a1 = NULL, *a2 = NULL;
+    int32_t j, done;
+
+    if (dst == NULL || y == NULL || u == NULL || v == NULL)
+        return 1;
+
+    if (width <= 0 || height <= 0)
+        return 1;
+
+    if ((width | height) & 1)
+        return 1;
+
+    for (j = 0; j < height; j += 2) {
+        uint8_t *d1 = dst + (intptr_t)j * dst_stride;
+        uint8_t *d2 = d1 + dst_stride;
+        const uint8_t *y1 = y + (intptr_t)j * y_stride;
+        const uint8_t *y2 = y1 + y_stride;
+        const uint8_t *pu = u + (intptr_t)(j >> 1) * u_stride;
+        const uint8_t *pv = v + (intptr_t)(j >> 1) * v_stride;
+
+        if (a != NULL) {
+            a1 = a + (intptr_t)j * a_stride;
+            a2 = a1 + a_stride;
+        }
+
+        done = rows ? rows(d1, d2, y1, y2, pu, pv, a1, a2, width, order, premultiply) : 0;
+        if (done < width) {
+            color_rows420_c(d1 + 4 * done, d2 + 4 * done, y1 + done, y2 + done,
+                            pu + (done >> 1), pv + (done >> 1),
+                            a1 ? a1 + done : NULL, a2 ? a2 + done : NULL,
+                            width - done, order, premultiply);
+        }
+    }
+
+    return 0;
+}
+
+static int color_convert_422(uint8_t *dst,
+                             int32_t dst_stride,
+                             int32_t width,
+                             int32_t height,
+                             const uint8_t *y,
+                             const uint8_t *v,
+                             const uint8_t *u,
+                             int32_t y_stride,
+                             int32_t uv_stride,
+                             int32_t order,
+                             ColorRows422Func rows)
+{
+    int32_t j, done;
+
+    if (dst == NULL || y == NULL || u == NULL || v == NULL)
+        return 1;
+
+    if (width <= 0 || height <= 0)
+        return 1;
+
+    if (width & 1)
+        return 1;
+
+    for (j = 0; j < height; j++) {
+        uint8_t *d = dst + (intptr_t)j * dst_stride;
+        const uint8_t *py = y + (intptr_t)j * y_stride;
+        const uint8_t *pu = u + (intptr_t)j * uv_stride;
+        const uint8_t *pv = v + (intptr_t)j * uv_stride;
+
+        done = rows ? rows(d, py, pu, pv, width, order) : 0;
+        if (done < width) {
+            color_rows422_c(d + 4 * done, py + 2 * done, pu + 2 * done, pv + 2 * done,
+                            width - done, order);
+        }
+    }
+
+    return 0;
+}
+// --- End shared row kernels
+
 // --- Begin YCbCr420p conversion functions
 #if ENABLE_SIMD_SSE2
 // --- Begin SSE2 YCbCr420p conversion functions
@@ -458,6 +1033,8 @@ int ColorConvert_YCbCr420p_to_ARGB32(
                                int32_t u_stride,
                                int32_t a_stride)
 {
+    ColorRows420Func rows = color_rows420_kernel();
+
     /* 1.1644  * 8192 */
     const __m128i x_c0 = _mm_set1_epi16(0x2543);
 
@@ -506,6 +1083,12 @@ int ColorConvert_YCbCr420p_to_ARGB32(
     uint8_t *pY1, *pY2, *pU, *pV, *pA1, *pA2, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+    if (rows != NULL)
+        return color_convert_420(argb, argb_stride, width, height, y, v, u, a,
+                                 y_stride, v_stride, u_stride, a_stride,
+                                 COLOR_ORDER_ARGB, 0, rows);
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || ((intptr_t)a % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0 || (a_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -943,6 +1526,8 @@ int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
                                      int32_t v_stride,
                                      int32_t u_stride)
 {
+    ColorRows420Func rows = color_rows420_kernel();
+
     /* 1.1644  * 8192 */
     const __m128i x_c0 = _mm_set1_epi16(0x2543);
 
@@ -990,6 +1575,12 @@ int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
     uint8_t *pY1, *pY2, *pU, *pV, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+    if (rows != NULL)
+        return color_convert_420(argb, argb_stride, width, height, y, v, u, NULL,
+                                 y_stride, v_stride, u_stride, 0,
+                                 COLOR_ORDER_ARGB, 0, rows);
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -1398,6 +1989,8 @@ int ColorConvert_YCbCr420p_to_BGRA32(
                                      int32_t u_stride,
                                      int32_t a_stride)
 {
+    ColorRows420Func rows = color_rows420_kernel();
+
     /* 1.1644  * 8192 */
     const __m128i x_c0 = _mm_set1_epi16(0x2543);
 
@@ -1446,6 +2039,12 @@ int ColorConvert_YCbCr420p_to_BGRA32(
     uint8_t *pY1, *pY2, *pU, *pV, *pA1, *pA2, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+    if (rows != NULL)
+        return color_convert_420(bgra, bgra_stride, width, height, y, v, u, a,
+                                 y_stride, v_stride, u_stride, a_stride,
+                                 COLOR_ORDER_BGRA, 1, rows);
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || ((intptr_t)a % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0 || (a_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -1910,6 +2509,8 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
                                               int32_t v_stride,
                                               int32_t u_stride)
 {
+    ColorRows420Func rows = color_rows420_kernel();
+
     /* 1.1644  * 8192 */
     const __m128i x_c0 = _mm_set1_epi16(0x2543);
 
@@ -1957,6 +2558,12 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
     uint8_t *pY1, *pY2, *pU, *pV, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+    if (rows != NULL)
+        return color_convert_420(bgra, bgra_stride, width, height, y, v, u, NULL,
+                                 y_stride, v_stride, u_stride, 0,
+                                 COLOR_ORDER_BGRA, 0, rows);
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -2369,7 +2976,9 @@ int ColorConvert_YCbCr420p_to_ARGB32(
                                int32_t u_stride,
                                int32_t a_stride)
 {
-    return 1; // NOTE: Not implemented
+    return color_convert_420(argb, argb_stride, width, height, y, v, u, a,
+                             y_stride, v_stride, u_stride, a_stride,
+                             COLOR_ORDER_ARGB, 0, color_rows420_kernel());
 }
 
 int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
@@ -2384,7 +2993,9 @@ int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
                                      int32_t v_stride,
                                      int32_t u_stride)
 {
-    return 1; // NOTE: Not implemented
+    return color_convert_420(argb, argb_stride, width, height, y, v, u, NULL,
+                             y_stride, v_stride, u_stride, 0,
+                             COLOR_ORDER_ARGB, 0, color_rows420_kernel());
 }
 
 int ColorConvert_YCbCr420p_to_BGRA32(uint8_t *bgra,
@@ -2408,6 +3019,12 @@ int ColorConvert_YCbCr420p_to_BGRA32(uint8_t *bgra,
     int32_t RRi = 446;
 
     uint8_t *const pClip = (uint8_t *const)color_tClip + 288 * 2;
+    ColorRows420Func rows = color_rows420_kernel();
+
+    if (rows != NULL)
+        return color_convert_420(bgra, bgra_stride, width, height, y, v, u, a,
+                                 y_stride, v_stride, u_stride, a_stride,
+                                 COLOR_ORDER_BGRA, 1, rows);
 
     if (bgra == NULL || y == NULL || u == NULL || v == NULL)
         return 1;
@@ -2517,6 +3134,12 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
     int32_t RRi = 446;
 
     uint8_t *const pClip = (uint8_t *const)color_tClip + 288 * 2;
+    ColorRows420Func rows = color_rows420_kernel();
+
+    if (rows != NULL)
+        return color_convert_420(bgra, bgra_stride, width, height, y, v, u, NULL,
+                                 y_stride, v_stride, u_stride, 0,
+                                 COLOR_ORDER_BGRA, 0, rows);
 
     if (bgra == NULL || y == NULL || u == NULL || v == NULL)
         return 1;
@@ -2607,7 +3230,9 @@ int ColorConvert_YCbCr422p_to_ARGB32_no_alpha(uint8_t *argb,
                                               int32_t y_stride,
                                               int32_t uv_stride)
 {
-    return 1; // NOTE: Not implemented
+    return color_convert_422(argb, argb_stride, width, height, y, v, u,
+                             y_stride, uv_stride,
+                             COLOR_ORDER_ARGB, color_rows422_kernel());
 }
 
 int ColorConvert_YCbCr422p_to_BGRA32_no_alpha(uint8_t *bgra,
@@ -2628,6 +3253,12 @@ int ColorConvert_YCbCr422p_to_BGRA32_no_alpha(uint8_t *bgra,
     int32_t RRi = 446;
 
     uint8_t *const pClip = (uint8_t *const)color_tClip + 288 * 2;
+    ColorRows422Func rows = color_rows422_kernel();
+
+    if (rows != NULL)
+        return color_convert_422(bgra, bgra_stride, width, height, y, v, u,
+                                 y_stride, uv_stride,
+                                 COLOR_ORDER_BGRA, rows);
 
     if (bgra == NULL || y == NULL || u == NULL || v == NULL)
         return 1;
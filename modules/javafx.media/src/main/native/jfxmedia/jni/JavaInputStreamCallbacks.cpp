@@ -35,6 +35,8 @@ jfieldID  CJavaInputStreamCallbacks::m_BufferFID = 0;
 jmethodID CJavaInputStreamCallbacks::m_NeedBufferMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_ReadNextBlockMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_ReadBlockMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_ReadNextBlockIntoMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_ReadBlockIntoMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_IsSeekableMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_IsRandomAccessMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_SeekMID = 0;
@@ -103,6 +105,18 @@ bool CJavaInputStreamCallbacks::Init(JNIEnv *env, jobject jConnectionHolder)
             hasException = (javaEnv.reportException() || (NULL == m_ReadBlockMID));
         }
 
+        if (!hasException)
+        {
+            m_ReadNextBlockIntoMID = env->GetMethodID(klass, "readNextBlock", "(Ljava/nio/ByteBuffer;)I");
+            hasException = (javaEnv.reportException() || (NULL == m_ReadNextBlockIntoMID));
+        }
+
+        if (!hasException)
+        {
+            m_ReadBlockIntoMID = env->GetMethodID(klass, "readBlock", "(JLjava/nio/ByteBuffer;)I");
+            hasException = (javaEnv.reportException() || (NULL == m_ReadBlockIntoMID));
+        }
+
         if (!hasException)
         {
             m_IsSeekableMID = env->GetMethodID(klass, "isSeekable", "()Z");
@@ -218,6 +232,55 @@ void CJavaInputStreamCallbacks::CopyBlock(void* destination, int size)
     }
  }
 
+int CJavaInputStreamCallbacks::ReadNextBlockInto(void* destination, int size)
+{
+    int result = -1;
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            // Wrap the destination, Java reads into it without a CopyBlock round trip
+            jobject buffer = pEnv->NewDirectByteBuffer(destination, (jlong)size);
+            if (buffer) {
+                result = pEnv->CallIntMethod(connection, m_ReadNextBlockIntoMID, buffer);
+                pEnv->DeleteLocalRef(buffer);
+            }
+            if (javaEnv.clearException()) {
+                result = -2;
+            }
+            pEnv->DeleteLocalRef(connection);
+        }
+    }
+
+    return result;
+}
+
+int CJavaInputStreamCallbacks::ReadBlockInto(int64_t position, void* destination, int size)
+{
+    int result = -1;
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            jobject buffer = pEnv->NewDirectByteBuffer(destination, (jlong)size);
+            if (buffer) {
+                result = pEnv->CallIntMethod(connection, m_ReadBlockIntoMID, (jlong)position, buffer);
+                pEnv->DeleteLocalRef(buffer);
+            }
+            if (javaEnv.clearException()) {
+                result = -2;
+            }
+            pEnv->DeleteLocalRef(connection);
+        }
+    }
+
+    return result;
+}
+
 bool CJavaInputStreamCallbacks::IsSeekable()
 {
     CJavaEnvironment javaEnv(m_jvm);
@@ -39,7 +39,7 @@ jmethodID CJavaPlayerEventDispatcher::m_SendWarningMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendPlayerMediaErrorEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendPlayerHaltEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendPlayerStateEventMethod = 0;
-jmethodID CJavaPlayerEventDispatcher::m_SendNewFrameEventMethod = 0;
+jmethodID CJavaPlayerEventDispatcher::m_SendFrameAvailableEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendFrameSizeChangedEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendAudioTrackEventMethod = 0;
 jmethodID CJavaPlayerEventDispatcher::m_SendVideoTrackEventMethod = 0;
@@ -52,13 +52,19 @@ jmethodID CJavaPlayerEventDispatcher::m_SendAudioSpectrumEventMethod = 0;
 CJavaPlayerEventDispatcher::CJavaPlayerEventDispatcher()
 : m_PlayerVM(NULL),
   m_PlayerInstance(NULL),
-  m_MediaReference(0L)
+  m_MediaReference(0L),
+  m_pFrameLock(CJfxCriticalSection::Create()),
+  m_pPendingFrame(NULL),
+  m_bFrameEventPending(false)
 {
 }
 
 CJavaPlayerEventDispatcher::~CJavaPlayerEventDispatcher()
 {
     Dispose();
+
+    if (m_pFrameLock)
+        delete m_pFrameLock;
 }
 
 void CJavaPlayerEventDispatcher::Init(JNIEnv *env, jobject PlayerInstance, CMedia* pMedia)
@@ -107,8 +113,8 @@ void CJavaPlayerEventDispatcher::Init(JNIEnv *env, jobject PlayerInstance, CMedi
 
         if (!hasException)
         {
-            m_SendNewFrameEventMethod = env->GetMethodID(klass, "sendNewFrameEvent", "(J)V");
-            hasException = (javaEnv.reportException() || (NULL == m_SendNewFrameEventMethod));
+            m_SendFrameAvailableEventMethod = env->GetMethodID(klass, "sendFrameAvailableEvent", "(J)V");
+            hasException = (javaEnv.reportException() || (NULL == m_SendFrameAvailableEventMethod));
         }
 
         if (!hasException)
@@ -177,6 +183,18 @@ void CJavaPlayerEventDispatcher::Dispose()
         m_PlayerInstance = NULL; // prevent further calls to this object
     }
 
+    if (m_pFrameLock)
+    {
+        m_pFrameLock->Enter();
+        if (m_pPendingFrame)
+        {
+            delete m_pPendingFrame;
+            m_pPendingFrame = NULL;
+        }
+        m_bFrameEventPending = false;
+        m_pFrameLock->Exit();
+    }
+
     LOWLEVELPERF_EXECTIMESTOP("CJavaPlayerEventDispatcher::Dispose()");
 }
 
@@ -302,25 +320,89 @@ bool CJavaPlayerEventDispatcher::SendNewFrameEvent(CVideoFrame* pVideoFrame)
 {
     LOWLEVELPERF_EXECTIMESTART("CJavaPlayerEventDispatcher::SendNewFrameEvent()");
     bool bSucceeded = false;
+    bool bNotify = false;
+    CVideoFrame* pDroppedFrame = NULL;
+
+    if (NULL == m_pFrameLock)
+    {
+        delete pVideoFrame;
+        LOWLEVELPERF_EXECTIMESTOP("CJavaPlayerEventDispatcher::SendNewFrameEvent()");
+        return false;
+    }
+
+    // Latest frame wins. Only the first frame after a take crosses JNI, the
+    // event thread picks up whichever frame is pending when it gets to it.
+    m_pFrameLock->Enter();
+    pDroppedFrame = m_pPendingFrame;
+    m_pPendingFrame = pVideoFrame;
+    bNotify = !m_bFrameEventPending;
+    m_bFrameEventPending = true;
+    m_pFrameLock->Exit();
+
+    if (pDroppedFrame)
+    {
+        delete pDroppedFrame;
+        LOWLEVELPERF_RESETCOUNTER("DroppedFramesBeforeJNI");
+    }
+
+    if (!bNotify)
+    {
+        LOWLEVELPERF_EXECTIMESTOP("CJavaPlayerEventDispatcher::SendNewFrameEvent()");
+        return true;
+    }
 
     CJavaEnvironment jenv(m_PlayerVM);
     JNIEnv *pEnv = jenv.getEnvironment();
     if (pEnv) {
         jobject localPlayer = pEnv->NewLocalRef(m_PlayerInstance);
         if (localPlayer) {
-            // SendNewFrameEvent will create the NativeVideoBuffer wrapper for the java side
-            pEnv->CallVoidMethod(localPlayer, m_SendNewFrameEventMethod, ptr_to_jlong(pVideoFrame));
+            // Java calls back into TakeNewFrame() from its event thread and
+            // creates the NativeVideoBuffer wrapper there
+            pEnv->CallVoidMethod(localPlayer, m_SendFrameAvailableEventMethod, ptr_to_jlong(this));
             pEnv->DeleteLocalRef(localPlayer);
 
             bSucceeded = !jenv.reportException();
         }
     }
 
+    if (!bSucceeded)
+    {
+        // Nobody will take the frame, drop it so the next one notifies again
+        m_pFrameLock->Enter();
+        pDroppedFrame = m_pPendingFrame;
+        m_pPendingFrame = NULL;
+        m_bFrameEventPending = false;
+        m_pFrameLock->Exit();
+
+        if (pDroppedFrame)
+            delete pDroppedFrame;
+    }
+
     LOWLEVELPERF_EXECTIMESTOP("CJavaPlayerEventDispatcher::SendNewFrameEvent()");
 
     return bSucceeded;
 }
 
+/**
+ * Hands the pending frame over to Java, which then owns it. Returns NULL if
+ * there is no frame, which happens once the dispatcher is disposed.
+ */
+CVideoFrame* CJavaPlayerEventDispatcher::TakeNewFrame()
+{
+    CVideoFrame* pVideoFrame = NULL;
+
+    if (m_pFrameLock)
+    {
+        m_pFrameLock->Enter();
+        pVideoFrame = m_pPendingFrame;
+        m_pPendingFrame = NULL;
+        m_bFrameEventPending = false;
+        m_pFrameLock->Exit();
+    }
+
+    return pVideoFrame;
+}
+
 bool CJavaPlayerEventDispatcher::SendFrameSizeChangedEvent(int width, int height)
 {
     bool bSucceeded = false;
@@ -637,3 +719,18 @@ jobject CJavaPlayerEventDispatcher::CreateDuration(JNIEnv *env, jlong duration)
 
     return result;
 }
+
+/*
+ * Class:     com_sun_media_jfxmediaimpl_NativeMediaPlayer
+ * Method:    nativeTakeNewFrame
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_media_jfxmediaimpl_NativeMediaPlayer_nativeTakeNewFrame
+    (JNIEnv *env, jclass klass, jlong dispatcherRef)
+{
+    CJavaPlayerEventDispatcher* pDispatcher = (CJavaPlayerEventDispatcher*)jlong_to_ptr(dispatcherRef);
+    if (pDispatcher == NULL)
+        return 0;
+
+    return ptr_to_jlong(pDispatcher->TakeNewFrame());
+}
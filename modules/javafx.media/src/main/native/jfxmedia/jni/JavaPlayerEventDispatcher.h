@@ -36,6 +36,7 @@
 #include <PipelineManagement/VideoFrame.h>
 #include <MediaManagement/Media.h>
 #include <MediaManagement/MediaWarningListener.h>
+#include <Utils/JfxCriticalSection.h>
 
 using namespace std;
 
@@ -62,17 +63,25 @@ public:
     virtual bool SendAudioSpectrumEvent(double time, double duration, bool queryTimestamp);
     virtual void Warning(int warningCode, const char* warningMessage);
 
+    CVideoFrame* TakeNewFrame();
+
 private:
     JavaVM *m_PlayerVM;
     jobject m_PlayerInstance;
     jlong   m_MediaReference; // FIXME: Nuke this field, it's completely unused
 
+    // Latest decoded frame not yet taken by Java. Frames that arrive while
+    // one is pending replace it, so Java never sees frames it cannot show.
+    CJfxCriticalSection* m_pFrameLock;
+    CVideoFrame*         m_pPendingFrame;
+    bool                 m_bFrameEventPending; // Java has been told and not taken yet
+
     static jmethodID m_SendWarningMethod;
 
     static jmethodID m_SendPlayerMediaErrorEventMethod;
     static jmethodID m_SendPlayerHaltEventMethod;
     static jmethodID m_SendPlayerStateEventMethod;
-    static jmethodID m_SendNewFrameEventMethod;
+    static jmethodID m_SendFrameAvailableEventMethod;
     static jmethodID m_SendFrameSizeChangedEventMethod;
     static jmethodID m_SendAudioTrackEventMethod;
     static jmethodID m_SendVideoTrackEventMethod;
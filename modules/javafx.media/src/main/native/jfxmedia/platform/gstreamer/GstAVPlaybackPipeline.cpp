@@ -40,6 +40,9 @@
 #define MAX_SIZE_BUFFERS_LIMIT 25
 #define MAX_SIZE_BUFFERS_INC   5
 
+// Frames reaching appsink later than this after their render time are counted as late
+#define LATE_FRAME_THRESHOLD   (20 * GST_MSECOND)
+
 //*************************************************************************************************
 //********** class CGstAVPlaybackPipeline
 //*************************************************************************************************
@@ -167,6 +170,9 @@ void CGstAVPlaybackPipeline::Dispose()
 
     if (!m_bHasVideo && m_Elements[VIDEO_BIN] != NULL)
         gst_object_unref(m_Elements[VIDEO_BIN]);
+
+    if (m_bHasVideo)
+        CGstVideoFrame::ReleaseBufferCache();
 }
 
 bool CGstAVPlaybackPipeline::IsCodecSupported(GstCaps *pCaps)
@@ -321,6 +327,17 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
 {
     LOWLEVELPERF_RESETCOUNTER("FPS");
 
+#if ENABLE_LOWLEVELPERF
+    // Time libavcodec spent on this frame, reported by the av video decoder only.
+    GstElement* pVideoDecoder = pPipeline->m_Elements[VIDEO_DECODER];
+    if (pVideoDecoder != NULL && g_object_class_find_property(G_OBJECT_GET_CLASS(pVideoDecoder), "decode-time") != NULL)
+    {
+        gint64 decodeTime = 0;
+        g_object_get(pVideoDecoder, "decode-time", &decodeTime, NULL);
+        LOWLEVELPERF_LOGVALUE("VideoDecodeTime", (long)decodeTime, "us", 1);
+    }
+#endif // ENABLE_LOWLEVELPERF
+
     //***** get the buffer from appsink
     GstSample* pSample = gst_app_sink_pull_sample(GST_APP_SINK (pElem));
     if (pSample == NULL)
@@ -336,6 +353,8 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
     if (pPipeline->m_SendFrameSizeEvent || GST_BUFFER_IS_DISCONT(pBuffer))
         OnAppSinkVideoFrameDiscont(pPipeline, pSample);
 
+    pPipeline->CountLateFrame(pElem, pSample);
+
     // Update PTS in pBuffer, so first buffer starts with 0. Our rendering
     // code expects PTS between 0 and duration and will not render anything
     // beyond duration. For fragmented MP4 PTS starts with N value (usually 10
@@ -362,6 +381,7 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
         CPlayerEventDispatcher* pEventDispatcher = pPipeline->m_pEventDispatcher;
 
         // Send new frame which Java will delete later.
+        gint64 callbackStart = g_get_monotonic_time();
         if (!pEventDispatcher->SendNewFrameEvent(pVideoFrame))
         {
             if(!pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_NEW_FRAME_EVENT))
@@ -369,6 +389,14 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
                 LOGGER_LOGMSG(LOGGER_ERROR, "Cannot send media error event.\n");
             }
         }
+        else
+        {
+            int64_t callbackTime = g_get_monotonic_time() - callbackStart;
+            pPipeline->m_Statistics[FramesRendered].fetch_add(1, std::memory_order_relaxed);
+            pPipeline->m_Statistics[FrameCallbackTime].fetch_add(callbackTime, std::memory_order_relaxed);
+            if (callbackTime > pPipeline->m_Statistics[FrameCallbackMaxTime].load(std::memory_order_relaxed))
+                pPipeline->m_Statistics[FrameCallbackMaxTime].store(callbackTime, std::memory_order_relaxed);
+        }
     }
     else
     {
@@ -457,6 +485,36 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkPreroll(GstElement* pElem, CGstAV
     return GST_FLOW_OK;
 }
 
+/**
+ * CGstAVPlaybackPipeline::CountLateFrame()
+ *
+ * Counts the frame as late if appsink hands it over noticeably after the
+ * clock reached its render time.
+ */
+void CGstAVPlaybackPipeline::CountLateFrame(GstElement* pElem, GstSample* pSample)
+{
+    GstBuffer* pBuffer = gst_sample_get_buffer(pSample);
+    GstSegment* pSegment = gst_sample_get_segment(pSample);
+    if (NULL == pSegment || pSegment->format != GST_FORMAT_TIME || !GST_BUFFER_PTS_IS_VALID(pBuffer))
+        return;
+
+    GstClock* pClock = gst_element_get_clock(pElem);
+    if (NULL == pClock)
+        return;
+
+    GstClockTime renderTime = gst_segment_to_running_time(pSegment, GST_FORMAT_TIME, GST_BUFFER_PTS(pBuffer));
+    GstClockTime now = gst_clock_get_time(pClock);
+    GstClockTime baseTime = gst_element_get_base_time(pElem);
+    gst_object_unref(pClock);
+
+    if (!GST_CLOCK_TIME_IS_VALID(renderTime) || now < baseTime)
+        return;
+
+    renderTime += gst_base_sink_get_latency(GST_BASE_SINK(pElem));
+    if (now - baseTime > renderTime + LATE_FRAME_THRESHOLD)
+        m_Statistics[FramesLate].fetch_add(1, std::memory_order_relaxed);
+}
+
 void CGstAVPlaybackPipeline::OnAppSinkVideoFrameDiscont(CGstAVPlaybackPipeline* pPipeline, GstSample *pSample)
 {
     gint width, height;
@@ -91,6 +91,9 @@ CGstAudioPlaybackPipeline::CGstAudioPlaybackPipeline(const GstElementContainer&
 
     m_audioCodecErrorCode = ERROR_NONE;
 
+    for (int i = 0; i < StatisticCount; i++)
+        m_Statistics[i].store(0, std::memory_order_relaxed);
+
     m_pBusCallbackContent = NULL;
 }
 
@@ -162,6 +165,13 @@ uint32_t CGstAudioPlaybackPipeline::Init()
 
     ((CGstMediaManager*)pManager)->StartMainLoop();
 
+    // Keep the shared clock, instead of switching to the audio sink clock below.
+    if (m_pOptions->GetSharedClockEnabled() && ((CGstMediaManager*)pManager)->m_pSharedClock != NULL)
+    {
+        gst_pipeline_use_clock(GST_PIPELINE(m_Elements[PIPELINE]), ((CGstMediaManager*)pManager)->m_pSharedClock);
+        m_bIsClockSet = true;
+    }
+
     // Check if we have static pipeline
 #if TARGET_OS_LINUX | TARGET_OS_MAC | TARGET_OS_WIN32
     if (m_pOptions->GetPipelineType() == CPipelineOptions::kAudioSourcePipeline)
@@ -988,6 +998,45 @@ uint32_t CGstAudioPlaybackPipeline::GetAudioSyncDelay(long* audioSyncDelay)
     return ERROR_NONE;
 }
 
+/**
+ * CGstAudioPlaybackPipeline::GetStatistics()
+ *
+ * Takes a snapshot of the playback counters, see CPipeline::Statistic. Queue
+ * levels and decode time are read from the elements at the time of the call.
+ */
+uint32_t CGstAudioPlaybackPipeline::GetStatistics(int64_t* pllValues, int iCount)
+{
+    if (NULL == pllValues)
+        return ERROR_FUNCTION_PARAM_NULL;
+
+    for (int i = 0; i < iCount; i++)
+        pllValues[i] = i < StatisticCount ? m_Statistics[i].load(std::memory_order_relaxed) : 0;
+
+    GstElement* pVideoDecoder = m_Elements[VIDEO_DECODER];
+    if (iCount > VideoDecodeTime && NULL != pVideoDecoder &&
+        NULL != g_object_class_find_property(G_OBJECT_GET_CLASS(pVideoDecoder), "decode-time"))
+    {
+        gint64 decodeTime = 0;
+        g_object_get(pVideoDecoder, "decode-time", &decodeTime, NULL);
+        pllValues[VideoDecodeTime] = decodeTime;
+    }
+
+    guint level = 0;
+    if (iCount > VideoQueueLevel && NULL != m_Elements[VIDEO_QUEUE])
+    {
+        g_object_get(m_Elements[VIDEO_QUEUE], "current-level-buffers", &level, NULL);
+        pllValues[VideoQueueLevel] = level;
+    }
+
+    if (iCount > AudioQueueLevel && NULL != m_Elements[AUDIO_QUEUE])
+    {
+        g_object_get(m_Elements[AUDIO_QUEUE], "current-level-buffers", &level, NULL);
+        pllValues[AudioQueueLevel] = level;
+    }
+
+    return ERROR_NONE;
+}
+
 CAudioEqualizer* CGstAudioPlaybackPipeline::GetAudioEqualizer()
 {
     return m_pAudioEqualizer;
@@ -1522,20 +1571,25 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
 
                 if (bandsNum > 0)
                 {
-                    float *magnitudes = new float[bandsNum];
-                    float *phases = new float[bandsNum];
-
-                    const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
-                    const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-                    for (int i=0; i < bandsNum; i++)
+                    // Bands come as blocks of floats, see gst_spectrum_message_new()
+                    GBytes *magnitudes = NULL;
+                    GBytes *phases = NULL;
+                    gsize magnitudesSize = 0;
+                    gsize phasesSize = 0;
+
+                    if (gst_structure_get(pStr, "magnitude", G_TYPE_BYTES, &magnitudes,
+                                                "phase", G_TYPE_BYTES, &phases, NULL))
                     {
-                        magnitudes[i] = g_value_get_float( gst_value_list_get_value (magnitudes_value, i));
-                        phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
+                        const float *pMagnitudes = (const float*)g_bytes_get_data(magnitudes, &magnitudesSize);
+                        const float *pPhases = (const float*)g_bytes_get_data(phases, &phasesSize);
+                        if (magnitudesSize == bandsNum * sizeof(float) && phasesSize == bandsNum * sizeof(float))
+                            pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, pMagnitudes, pPhases);
                     }
-                    pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, magnitudes, phases);
 
-                    delete [] magnitudes;
-                    delete [] phases;
+                    if (magnitudes != NULL)
+                        g_bytes_unref(magnitudes);
+                    if (phases != NULL)
+                        g_bytes_unref(phases);
                 }
 
                 if (!pPipeline->m_pEventDispatcher->SendAudioSpectrumEvent(GST_TIME_AS_SECONDS((double)timestamp),
@@ -1563,6 +1617,20 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
             gst_bin_recalculate_latency (GST_BIN(pPipeline->m_Elements[PIPELINE]));
             break;
 
+        case GST_MESSAGE_QOS:
+        {
+            // Video sinks with QoS enabled report how many frames they dropped so far.
+            GstFormat format;
+            guint64 dropped = 0;
+            gst_message_parse_qos_stats(msg, &format, NULL, &dropped);
+            if (format == GST_FORMAT_BUFFERS && NULL != pPipeline->m_Elements[VIDEO_SINK] &&
+                GST_MESSAGE_SRC(msg) == GST_OBJECT(pPipeline->m_Elements[VIDEO_SINK]))
+            {
+                pPipeline->m_Statistics[FramesDropped].store((int64_t)dropped, std::memory_order_relaxed);
+            }
+        }
+            break;
+
         default:
             break;
     }
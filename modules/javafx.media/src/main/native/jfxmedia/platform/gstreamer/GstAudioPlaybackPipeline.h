@@ -37,6 +37,7 @@
 #include "GstAudioEqualizer.h"
 #include "GstAudioSpectrum.h"
 #include <string>
+#include <atomic>
 
 using namespace std;
 
@@ -103,6 +104,8 @@ public:
     virtual uint32_t    SetAudioSyncDelay(long millis);
     virtual uint32_t    GetAudioSyncDelay(long* millis);
 
+    virtual uint32_t    GetStatistics(int64_t* pllValues, int iCount);
+
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
@@ -139,6 +142,9 @@ protected:
     // Stall handling stuff
     volatile bool        m_StallOnPause; // True if paused because of stall condition
 
+    // Counters reported by GetStatistics(), updated from streaming threads
+    std::atomic<int64_t> m_Statistics[StatisticCount];
+
 #if ENABLE_LOWLEVELPERF
     // Proportion value of QoS event if enabled:
     // http://gstreamer.freedesktop.org/data/doc/gstreamer/head/gstreamer/html/gstreamer-GstEvent.html#gst-event-new-qos
@@ -179,11 +179,21 @@ extern "C" {
      * @return  Media reference.  This reference must be used when calling GSTMediaPlayer function.
      */
     JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMedia_gstInitNativeMedia
-    (JNIEnv *env, jobject obj, jobject jLocator, jstring jContentType, jlong jSizeHint, jlongArray jlMediaHandle)
+    (JNIEnv *env, jobject obj, jobject jLocator, jstring jContentType, jlong jSizeHint, jboolean jLowLatency,
+     jboolean jSharedClock, jlongArray jlMediaHandle)
     {
         LOWLEVELPERF_EXECTIMESTART("gstInitNativeMediaToSendToJavaPlayerStateEventPaused");
         LOWLEVELPERF_EXECTIMESTART("gstInitNativeMedia()");
-        uint32_t result = InitMedia(env, NULL, jLocator, jContentType, jSizeHint, jlMediaHandle);
+        CPipelineOptions* pOptions = NULL;
+        if (jLowLatency || jSharedClock)
+        {
+            pOptions = new (nothrow) CPipelineOptions();
+            if (NULL == pOptions)
+                return ERROR_MEMORY_ALLOCATION;
+            pOptions->SetLowLatencyEnabled(jLowLatency);
+            pOptions->SetSharedClockEnabled(jSharedClock);
+        }
+        uint32_t result = InitMedia(env, pOptions, jLocator, jContentType, jSizeHint, jlMediaHandle);
         LOWLEVELPERF_EXECTIMESTOP("gstInitNativeMedia()");
 
         return result;
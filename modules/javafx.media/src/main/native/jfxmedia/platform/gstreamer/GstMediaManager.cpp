@@ -24,6 +24,7 @@
  */
 
 #include "GstMediaManager.h"
+#include "GstPipelineFactory.h"
 #include <jfxmedia_errors.h>
 #include <jni/Logger.h>
 #include <Common/VSMemory.h>
@@ -42,7 +43,8 @@ volatile bool CGstMediaManager::m_bStopGlibLogFunc = false;
  */
 CGstMediaManager::CGstMediaManager()
     : m_bMainLoopCreateFailed(false), m_pMainContext(NULL), m_pMainLoop(NULL),
-      m_pMainLoopThread(NULL), m_bClearRunloopMutex(false), m_bClearRunloopCond(false)
+      m_pMainLoopThread(NULL), m_bClearRunloopMutex(false), m_bClearRunloopCond(false),
+      m_pSharedClock(NULL)
 {
     m_bClearStartLoopMutex = false;
     m_bClearStartLoopCond = false;
@@ -86,6 +88,12 @@ CGstMediaManager::~CGstMediaManager()
         m_pMainContext = NULL;
     }
 
+    if (NULL != m_pSharedClock)
+    {
+        gst_object_unref(m_pSharedClock);
+        m_pSharedClock = NULL;
+    }
+
     if (m_bClearStartLoopMutex)
     {
         g_mutex_clear(&m_StartLoopMutex);
@@ -137,6 +145,10 @@ uint32_t CGstMediaManager::Init()
     }
     LOWLEVELPERF_EXECTIMESTOP("gst_init_check()");
 
+    // Players asking for a shared clock run on the system clock instead of
+    // their audio sink's, so a video wall stays in step.
+    m_pSharedClock = gst_system_clock_obtain();
+
 #if ENABLE_VISUAL_STUDIO_MEMORY_LEAKS_DETECTION && TARGET_OS_WIN32
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif // ENABLE_VISUAL_STUDIO_MEMORY_LEAKS_DETECTION
@@ -195,6 +207,9 @@ uint32_t CGstMediaManager::Init()
     // Set the default Glib log handler.
     g_log_set_default_handler (GlibLogFunc, this);
 
+    if (ERROR_NONE == uRetCode)
+        CGstPipelineFactory::Prewarm();
+
     return uRetCode;
 }
 
@@ -69,6 +69,9 @@ private:
     bool          m_bClearStartLoopCond;
 
     volatile bool m_bStartMainLoop;
+
+    // Clock of the pipelines created with a shared clock.
+    GstClock*     m_pSharedClock;
 };
 
 #endif // _GST_MEDIA_MANAGER_H_
@@ -169,6 +169,43 @@ JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMed
     return iRet;
 }
 
+/**
+ * gstGetStatistics()
+ *
+ * Gets a snapshot of the playback counters of the media.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstGetStatistics
+(JNIEnv *env, jobject obj, jlong ref_media, jlongArray jrglStatistics)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return ERROR_MEDIA_NULL;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return ERROR_PIPELINE_NULL;
+
+    int64_t llStatistics[CPipeline::StatisticCount];
+    uint32_t uErrCode = pPipeline->GetStatistics(llStatistics, CPipeline::StatisticCount);
+    if (ERROR_NONE != uErrCode)
+        return (jint)uErrCode;
+
+    jlong jlStatistics[CPipeline::StatisticCount];
+    for (int i = 0; i < CPipeline::StatisticCount; i++)
+        jlStatistics[i] = (jlong)llStatistics[i];
+
+    jsize length = env->GetArrayLength(jrglStatistics);
+    if (length > CPipeline::StatisticCount)
+        length = CPipeline::StatisticCount;
+    env->SetLongArrayRegion(jrglStatistics, 0, length, jlStatistics);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return ERROR_JNI_UNEXPECTED;
+    }
+
+    return ERROR_NONE;
+}
+
 /**
  * gstPlay()
  *
@@ -28,6 +28,7 @@
 #include "GstAVPlaybackPipeline.h"
 
 #include <string>
+#include <stdlib.h>
 #include <Common/ProductFlags.h>
 #include <Common/VSMemory.h>
 #include <MediaManagement/MediaTypes.h>
@@ -48,6 +49,24 @@
 #define HLS_VALUE_MIMETYPE_FMP4 3
 #define HLS_VALUE_MIMETYPE_AAC  4
 
+// Low latency pipeline tuning, see ConfigureLowLatency()
+#define LOW_LATENCY_QUEUE_BUFFERS     2
+#define LOW_LATENCY_MAX_LATENESS      (20 * GST_MSECOND)
+#define LOW_LATENCY_AUDIO_BUFFER_TIME (40 * G_TIME_SPAN_MILLISECOND) // microseconds
+
+// Elements created once by Prewarm(), so the first open does not pay for
+// loading their plugins and codec libraries.
+static const char* const s_PrewarmElements[] = {
+    "javasource", "progressbuffer", "queue", "audioconvert", "equalizer-nbands",
+    "spectrum", "audiopanorama", "volume", "wavparse", "aiffparse",
+#if TARGET_OS_WIN32
+    "qtdemux", "mpegaudioparse", "dshowwrapper", "directsoundsink",
+#elif TARGET_OS_LINUX
+    "qtdemux", "mpegaudioparse", "avaudiodecoder", "avvideodecoder", "alsasink",
+#endif // TARGET_OS_WIN32
+    NULL
+};
+
 
 //*************************************************************************************************
 //********** class CGstPipelineFactory
@@ -96,6 +115,12 @@ uint32_t CGstPipelineFactory::CreatePlayerPipeline(CLocator* locator, CPipelineO
     int streamMimeType = callbacks->Property(HLS_PROP_GET_MIMETYPE, 0);
     pOptions->SetStreamMimeType(streamMimeType);
 
+    // JFXMEDIA_MEMORY_CACHE_SIZE overrides the size in bytes up to which
+    // progressive downloads are kept in memory, 0 always uses a temp file.
+    const char* memoryCacheSize = getenv("JFXMEDIA_MEMORY_CACHE_SIZE");
+    if (memoryCacheSize != NULL && *memoryCacheSize != '\0')
+        pOptions->SetMemoryCacheSize(max((int64_t)0, (int64_t)strtoll(memoryCacheSize, NULL, 10)));
+
     // Create main source.
     GstElement* pSource = NULL;
     GstElement* pBuffer = NULL;
@@ -212,6 +237,8 @@ uint32_t CGstPipelineFactory::CreatePipeline(CPipelineOptions *pOptions, GstElem
 
     if (NULL == *ppPipeline)
         uRetCode = ERROR_PIPELINE_CREATION;
+    else if (pOptions->GetLowLatencyEnabled())
+        ConfigureLowLatency(pElements);
 
     LOWLEVELPERF_EXECTIMESTOP("CGstPipelineFactory::CreatePipeline()");
 
@@ -244,12 +271,16 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
 
     g_signal_connect(javaSource, "read-next-block", G_CALLBACK(SourceReadNextBlock), callbacks);
     g_signal_connect(javaSource, "copy-block", G_CALLBACK(SourceCopyBlock), callbacks);
+    g_signal_connect(javaSource, "read-next-block-into", G_CALLBACK(SourceReadNextBlockInto), callbacks);
     g_signal_connect(javaSource, "seek-data", G_CALLBACK(SourceSeekData), callbacks);
     g_signal_connect(javaSource, "close-connection", G_CALLBACK(SourceCloseConnection), callbacks);
     g_signal_connect(javaSource, "property", G_CALLBACK(SourceProperty), callbacks);
 
     if (isRandomAccess)
+    {
         g_signal_connect(javaSource, "read-block", G_CALLBACK(SourceReadBlock), callbacks);
+        g_signal_connect(javaSource, "read-block-into", G_CALLBACK(SourceReadBlockInto), callbacks);
+    }
 
     if (pOptions->GetHLSModeEnabled())
         g_object_set(javaSource, "hls-mode", TRUE, NULL);
@@ -268,6 +299,7 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
                  "is-seekable", (gboolean)callbacks->IsSeekable(),
                  "is-random-access", (gboolean)isRandomAccess,
                  "location", locator->GetLocation().c_str(),
+                 "direct-read", TRUE,
                  NULL);
 
     bool needBuffer = callbacks->NeedBuffer();
@@ -288,6 +320,14 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
         if (NULL == buffer)
             return ERROR_GSTREAMER_ELEMENT_CREATE;
 
+        if (!pOptions->GetHLSModeEnabled())
+        {
+            g_object_set(buffer, "memory-cache-size", (guint64)pOptions->GetMemoryCacheSize(), NULL);
+            // Start playback as soon as data arrives, live sources never catch up with a prebuffer.
+            if (pOptions->GetLowLatencyEnabled())
+                g_object_set(buffer, "prebuffer-time", (gdouble)0.0, NULL);
+        }
+
         gst_bin_add_many(GST_BIN(source), javaSource, buffer, NULL);
 
         if (!gst_element_link(javaSource, buffer))
@@ -319,6 +359,16 @@ void CGstPipelineFactory::SourceCopyBlock(GstElement *src, gpointer buffer, int
     ((CStreamCallbacks*)data)->CopyBlock(buffer, size);
 }
 
+gint CGstPipelineFactory::SourceReadNextBlockInto(GstElement *src, gpointer buffer, int size, gpointer data)
+{
+    return ((CStreamCallbacks*)data)->ReadNextBlockInto(buffer, size);
+}
+
+gint CGstPipelineFactory::SourceReadBlockInto(GstElement *src, guint64 position, gpointer buffer, int size, gpointer data)
+{
+    return ((CStreamCallbacks*)data)->ReadBlockInto((int64_t)position, buffer, size);
+}
+
 gint64 CGstPipelineFactory::SourceSeekData(GstElement *src, guint64 offset, gpointer data)
 {
     return (gint64)((CStreamCallbacks*)data)->Seek((int64_t)offset);
@@ -336,6 +386,8 @@ void CGstPipelineFactory::SourceCloseConnection(GstElement *src, gpointer data)
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadNextBlock), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadBlock), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceCopyBlock), callbacks);
+    g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadNextBlockInto), callbacks);
+    g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadBlockInto), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceSeekData), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceCloseConnection), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceProperty), callbacks);
@@ -1050,6 +1102,73 @@ uint32_t CGstPipelineFactory::CreateVideoBin(const char* strDecoderName, GstElem
     return ERROR_NONE;
 }
 
+/**
+ * void ConfigureLowLatency(GstElementContainer* pElements)
+ *
+ * Tunes a created pipeline for live sources. Queues hold only a couple of
+ * buffers and the video queue drops the oldest one when full. Video frames
+ * later than LOW_LATENCY_MAX_LATENESS are dropped by the sink, which keeps
+ * only the newest frame for Java. The audio device buffer is kept short.
+ */
+void CGstPipelineFactory::ConfigureLowLatency(GstElementContainer* pElements)
+{
+    GstElement* videoQueue = (*pElements)[VIDEO_QUEUE];
+    GstElement* audioQueue = (*pElements)[AUDIO_QUEUE];
+    GstElement* videoSink = (*pElements)[VIDEO_SINK];
+    GstElement* audioSink = (*pElements)[AUDIO_SINK];
+
+    if (NULL != videoQueue)
+        g_object_set(videoQueue, "max-size-buffers", (guint)LOW_LATENCY_QUEUE_BUFFERS,
+                     "leaky", 2 /* GST_QUEUE_LEAK_DOWNSTREAM */, NULL);
+
+    // Audio is not leaky, dropped audio is far more noticeable than late audio.
+    if (NULL != audioQueue)
+        g_object_set(audioQueue, "max-size-buffers", (guint)LOW_LATENCY_QUEUE_BUFFERS, NULL);
+
+    if (NULL != videoSink)
+    {
+        g_object_set(videoSink, "qos", TRUE, "max-lateness", (gint64)LOW_LATENCY_MAX_LATENESS, NULL);
+        if (NULL != g_object_class_find_property(G_OBJECT_GET_CLASS(videoSink), "drop"))
+            g_object_set(videoSink, "max-buffers", (guint)1, "drop", TRUE, NULL);
+    }
+
+    if (NULL != audioSink && NULL != g_object_class_find_property(G_OBJECT_GET_CLASS(audioSink), "buffer-time"))
+        g_object_set(audioSink, "buffer-time", (gint64)LOW_LATENCY_AUDIO_BUFFER_TIME, NULL);
+}
+
+// Pre-warming is opt-in with JFXMEDIA_PREWARM=yes, since it loads codec
+// libraries an application playing only one format never needs. Elements
+// are created on a separate thread, so media manager init does not wait.
+void CGstPipelineFactory::Prewarm()
+{
+    const char* value = getenv("JFXMEDIA_PREWARM");
+    if (value == NULL || g_ascii_strncasecmp(value, "yes", 3) != 0)
+        return;
+
+    GThread* pThread = g_thread_try_new("Prewarm", PrewarmElements, NULL, NULL);
+    if (NULL != pThread)
+        g_thread_unref(pThread);
+}
+
+gpointer CGstPipelineFactory::PrewarmElements(gpointer data)
+{
+    LOWLEVELPERF_EXECTIMESTART("CGstPipelineFactory::PrewarmElements()");
+
+    for (int i = 0; NULL != s_PrewarmElements[i]; i++)
+    {
+        GstElement* element = gst_element_factory_make(s_PrewarmElements[i], NULL);
+        if (NULL != element)
+        {
+            gst_object_ref_sink(element);
+            gst_object_unref(element);
+        }
+    }
+
+    LOWLEVELPERF_EXECTIMESTOP("CGstPipelineFactory::PrewarmElements()");
+
+    return NULL;
+}
+
 GstElement* CGstPipelineFactory::CreateElement(const char* strFactoryName)
 {
     if (strFactoryName == NULL)
@@ -43,6 +43,7 @@ class CGstPipelineFactory : public CPipelineFactory
 public:
     uint32_t           CreatePlayerPipeline(CLocator* locator, CPipelineOptions *pOptions, CPipeline** ppPipeline);
     static GstElement* GetByFactoryName(GstElement* bin, const char* strFactoryName);
+    static void        Prewarm();
 
     virtual ~CGstPipelineFactory();
 
@@ -76,8 +77,12 @@ private:
     uint32_t    CreateVideoBin(const char* strDecoderName, GstElement* pVideoSink,
                                GstElementContainer* elements, GstElement** ppVideobin);
 
+    void        ConfigureLowLatency(GstElementContainer* pElements);
+
     GstElement* CreateElement(const char* strFactoryName);
 
+    static gpointer PrewarmElements(gpointer data);
+
     // progressbuffer on-pad-added
     static void OnBufferPadAdded(GstElement* element, GstPad* pad, GstElement* peer);
 
@@ -85,6 +90,8 @@ private:
     static gint     SourceReadNextBlock(GstElement *src, gpointer data);
     static gint     SourceReadBlock(GstElement *src, guint64 position, guint size, gpointer data);
     static void     SourceCopyBlock(GstElement *src, gpointer buffer, int size, gpointer data);
+    static gint     SourceReadNextBlockInto(GstElement *src, gpointer buffer, int size, gpointer data);
+    static gint     SourceReadBlockInto(GstElement *src, guint64 position, gpointer buffer, int size, gpointer data);
     static gint64   SourceSeekData(GstElement *src, guint64 offset, gpointer data);
     static void     SourceCloseConnection(GstElement *src, gpointer data);
     static int      SourceProperty(GstElement *src, int prop, int value, gpointer data);
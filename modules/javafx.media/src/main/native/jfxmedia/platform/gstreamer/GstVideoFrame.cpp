@@ -41,36 +41,108 @@ static inline guint32 swap_uint32(guint32 x)
         ((x & 0xff000000U) >> 24);
 }
 
+/*
+ * Converted frames are disposed from Java (NativeVideoBuffer.nativeDisposeBuffer)
+ * about as fast as new ones are made, all of them the same size. Their memory
+ * is kept in a small cache keyed by size and handed to the next conversion, so
+ * steady playback does not allocate. The cache is emptied when a pipeline is
+ * disposed, see CGstVideoFrame::ReleaseBufferCache().
+ */
+#define MAX_CACHED_BLOCKS 4
+
+typedef struct {
+    guint8 *data;   // as returned by g_try_malloc
+    guint   size;   // usable size after alignment
+} AlignedBlock;
+
+static GMutex block_cache_lock;
+static GQueue block_cache = G_QUEUE_INIT; // most recently released first
+
+static void free_aligned_block(AlignedBlock *block)
+{
+    g_free(block->data);
+    g_free(block);
+}
+
 static void free_aligned_buffer(gpointer ptr)
 {
-    if (ptr != NULL) {
-        g_free(ptr);
+    AlignedBlock *block = (AlignedBlock*)ptr;
+    AlignedBlock *evicted = NULL;
+
+    if (block == NULL) {
+        return;
+    }
+
+    g_mutex_lock(&block_cache_lock);
+    g_queue_push_head(&block_cache, block);
+    if (g_queue_get_length(&block_cache) > MAX_CACHED_BLOCKS) {
+        evicted = (AlignedBlock*)g_queue_pop_tail(&block_cache);
+    }
+    g_mutex_unlock(&block_cache_lock);
+
+    if (evicted != NULL) {
+        free_aligned_block(evicted);
+    }
+}
+
+static AlignedBlock *get_cached_block(guint size)
+{
+    AlignedBlock *block = NULL;
+    GList *link;
+
+    g_mutex_lock(&block_cache_lock);
+    for (link = block_cache.head; link != NULL; link = link->next) {
+        if (((AlignedBlock*)link->data)->size == size) {
+            block = (AlignedBlock*)link->data;
+            g_queue_delete_link(&block_cache, link);
+            break;
+        }
     }
+    g_mutex_unlock(&block_cache_lock);
+
+    return block;
 }
 
 static GstBuffer *alloc_aligned_buffer(guint size)
 {
     // allocate a new GstBuffer of the given size plus some for padding and alignment
-    guint8 *newData;
+    AlignedBlock *block;
     guint8 *alignedData;
-    guint alignedSize;
 
-    // allocate a buffer large enough to accommodate 16 byte alignment
-    alignedSize = size;
-    if (size <= (G_MAXUINT - 16)) {
-        size += 16;
-    } else {
-        return NULL;
-    }
+    block = get_cached_block(size);
+    if (NULL == block) {
+        // allocate a buffer large enough to accommodate 16 byte alignment
+        if (size > (G_MAXUINT - 16)) {
+            return NULL;
+        }
 
-    newData = (guint8*)g_try_malloc(size);
-    if (NULL == newData) {
-        return NULL;
+        block = g_try_new(AlignedBlock, 1);
+        if (NULL == block) {
+            return NULL;
+        }
+
+        block->data = (guint8*)g_try_malloc(size + 16);
+        if (NULL == block->data) {
+            g_free(block);
+            return NULL;
+        }
+        block->size = size;
     }
 
-    alignedData = (guint8*)(((intptr_t)newData + 15) & ~15);
+    alignedData = (guint8*)(((intptr_t)block->data + 15) & ~15);
 
-    return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, alignedSize, 0, alignedSize, newData, free_aligned_buffer);
+    return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, size, 0, size, block, free_aligned_buffer);
+}
+
+void CGstVideoFrame::ReleaseBufferCache()
+{
+    AlignedBlock *block;
+
+    g_mutex_lock(&block_cache_lock);
+    while ((block = (AlignedBlock*)g_queue_pop_head(&block_cache)) != NULL) {
+        free_aligned_block(block);
+    }
+    g_mutex_unlock(&block_cache_lock);
 }
 
 GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height, guint encodedWidth, guint encodedHeight, guint stride)
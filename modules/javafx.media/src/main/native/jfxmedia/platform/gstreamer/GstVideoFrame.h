@@ -58,6 +58,12 @@ public:
 
     virtual CVideoFrame *ConvertToFormat(FrameType type);
 
+    /*
+     * Frees the memory kept for reuse by converted frames. Frames that are
+     * still alive are not affected, their memory is freed when they go away.
+     */
+    static void ReleaseBufferCache();
+
 private:
     void SetFrameCaps(GstCaps *newCaps);
 
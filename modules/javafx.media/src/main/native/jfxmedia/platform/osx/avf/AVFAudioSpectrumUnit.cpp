@@ -242,19 +242,27 @@ static gboolean PostMessageCallback(GstElement * element, GstMessage * message)
         size_t bandsNum = pSpectrumUnit->GetBands();
 
         if (bandsNum > 0) {
-            float *magnitudes = new float[bandsNum];
-            float *phases = new float[bandsNum];
-
-            const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
-            const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-            for (int i = 0; i < bandsNum; i++) {
-                magnitudes[i] = g_value_get_float(gst_value_list_get_value(magnitudes_value, i));
-                phases[i] = g_value_get_float(gst_value_list_get_value(phases_value, i));
+            // Bands come as blocks of floats, see gst_spectrum_message_new()
+            GBytes *magnitudes = NULL;
+            GBytes *phases = NULL;
+            gsize magnitudesSize = 0;
+            gsize phasesSize = 0;
+
+            if (gst_structure_get(pStr, "magnitude", G_TYPE_BYTES, &magnitudes,
+                                        "phase", G_TYPE_BYTES, &phases, NULL)) {
+                const float *pMagnitudes = (const float*)g_bytes_get_data(magnitudes, &magnitudesSize);
+                const float *pPhases = (const float*)g_bytes_get_data(phases, &phasesSize);
+                if (magnitudesSize == bandsNum * sizeof(float) && phasesSize == bandsNum * sizeof(float)) {
+                    pSpectrumUnit->UpdateBands((int) bandsNum, pMagnitudes, pPhases);
+                }
             }
-            pSpectrumUnit->UpdateBands((int) bandsNum, magnitudes, phases);
 
-            delete [] magnitudes;
-            delete [] phases;
+            if (magnitudes != NULL) {
+                g_bytes_unref(magnitudes);
+            }
+            if (phases != NULL) {
+                g_bytes_unref(phases);
+            }
         }
     }
 
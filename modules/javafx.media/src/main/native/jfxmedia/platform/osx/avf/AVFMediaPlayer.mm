@@ -49,6 +49,13 @@ static void *AVFMediaPlayerItemStatusContext = &AVFMediaPlayerItemStatusContext;
 static void *AVFMediaPlayerItemDurationContext = &AVFMediaPlayerItemDurationContext;
 static void *AVFMediaPlayerItemTracksContext = &AVFMediaPlayerItemTracksContext;
 
+// Ask for IOSurface backed, GL compatible pixel buffers. AVFoundation can
+// then hand out buffers from the decoder's surface pool instead of copying
+// each frame into a malloc'ed buffer, and CVVideoFrame locks map the surface.
+#define VO_SURFACE_ATTRIBUTES \
+    (id)kCVPixelBufferIOSurfacePropertiesKey: @{},\
+    (id)kCVPixelBufferOpenGLCompatibilityKey: @YES
+
 // See JDK-8328603. For some streams if we let AVFoundation to decide
 // the format and decided format is not supported video will not be outputed
 // after we force AVFoundation to supported format (FALLBACK_VO_FORMAT).
@@ -60,7 +67,8 @@ static void *AVFMediaPlayerItemTracksContext = &AVFMediaPlayerItemTracksContext;
 // Note: This array should match CVVideoFrame::IsFormatSupported().
 #define VO_FORMATS @{(id)kCVPixelBufferPixelFormatTypeKey: @[@(kCVPixelFormatType_422YpCbCr8),\
                                                            @(kCVPixelFormatType_420YpCbCr8Planar),\
-                                                           @(kCVPixelFormatType_32BGRA)]}
+                                                           @(kCVPixelFormatType_32BGRA)],\
+                     VO_SURFACE_ATTRIBUTES}
 // Uncomment to let AVFoundation decide the format...
 //#define VO_FORMATS @{}
 
@@ -253,7 +261,8 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
         LOGGER_DEBUGMSG(([[NSString stringWithFormat:@"Falling back on video format: %@", FourCCToNSString(FALLBACK_VO_FORMAT)] UTF8String]));
         AVPlayerItemVideoOutput *newOutput =
         [[AVPlayerItemVideoOutput alloc] initWithPixelBufferAttributes:
-         @{(id)kCVPixelBufferPixelFormatTypeKey: @(FALLBACK_VO_FORMAT)}];
+         @{(id)kCVPixelBufferPixelFormatTypeKey: @(FALLBACK_VO_FORMAT),
+           VO_SURFACE_ATTRIBUTES}];
 
         if (newOutput) {
             newOutput.suppressesPlayerRendering = YES;
@@ -283,7 +292,8 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
             // kCVPixelFormatType_420YpCbCr8Planar
             _playerOutput = [[AVPlayerItemVideoOutput alloc] initWithPixelBufferAttributes:
 #if FORCE_VO_FORMAT
-                             @{(id)kCVPixelBufferPixelFormatTypeKey: @(FORCED_VO_FORMAT)}];
+                             @{(id)kCVPixelBufferPixelFormatTypeKey: @(FORCED_VO_FORMAT),
+                               VO_SURFACE_ATTRIBUTES}];
 #else
                              VO_FORMATS];
 #endif
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Micro-benchmark for the jfxmedia color converters.
+ *
+ * Times every converter of Utils/ColorConverter.h on one synthetic frame and
+ * prints the time per frame and a checksum of the output. Build it against
+ * the converter sources, e.g. on Linux:
+ *
+ *   cc -O2 -DLINUX -I../../main/native/jfxmedia colorconverter-bench.c \
+ *       ../../main/native/jfxmedia/Utils/ColorConverter.c -o colorconverter-bench
+ *   ./colorconverter-bench [width height iterations]
+ *
+ * The converters pick the NEON or AVX2 kernels at run time. Adding
+ * -DENABLE_SIMD_AVX2=0, -DENABLE_SIMD_NEON=0 or -DENABLE_SIMD_SSE2=0 to the
+ * build times the SSE2 or scalar code instead; the checksums of the builds
+ * should match except for the last bit of rounding in the table based C code.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include <Utils/ColorConverter.h>
+
+#define ALIGN 64
+
+typedef struct {
+    int32_t width, height;
+    int32_t y_stride, uv_stride, a_stride, packed_stride, dst_stride;
+    uint8_t *y, *u, *v, *a, *packed, *dst;
+} Frame;
+
+static double now_ms(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, count;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart * 1000.0 / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#endif
+}
+
+static uint8_t *alloc_plane(int32_t stride, int32_t rows, uint32_t *seed)
+{
+    size_t size = (size_t)stride * rows;
+    uint8_t *base = (uint8_t*)malloc(size + ALIGN + sizeof(uint8_t*));
+    uint8_t *p;
+    size_t i;
+
+    if (base == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    // keep the base pointer just in front of the aligned plane
+    p = (uint8_t*)(((uintptr_t)base + sizeof(uint8_t*) + ALIGN - 1) & ~(uintptr_t)(ALIGN - 1));
+    ((uint8_t**)p)[-1] = base;
+    for (i = 0; i < size; i++) {
+        *seed = *seed * 1103515245u + 12345u;
+        p[i] = (uint8_t)(*seed >> 16);
+    }
+    return p;
+}
+
+static void free_plane(uint8_t *p)
+{
+    free(((uint8_t**)p)[-1]);
+}
+
+static uint32_t checksum(const Frame *f)
+{
+    uint32_t h = 2166136261u;
+    int32_t i, j;
+
+    for (j = 0; j < f->height; j++) {
+        const uint8_t *row = f->dst + (size_t)j * f->dst_stride;
+
+        for (i = 0; i < f->width * 4; i++)
+            h = (h ^ row[i]) * 16777619u;
+    }
+    return h;
+}
+
+static int convert(const Frame *f, int kernel)
+{
+    switch (kernel) {
+        case 0:
+            return ColorConvert_YCbCr420p_to_ARGB32(f->dst, f->dst_stride, f->width, f->height,
+                f->y, f->v, f->u, f->a, f->y_stride, f->uv_stride, f->uv_stride, f->a_stride);
+        case 1:
+            return ColorConvert_YCbCr420p_to_ARGB32_no_alpha(f->dst, f->dst_stride, f->width, f->height,
+                f->y, f->v, f->u, f->y_stride, f->uv_stride, f->uv_stride);
+        case 2:
+            return ColorConvert_YCbCr420p_to_BGRA32(f->dst, f->dst_stride, f->width, f->height,
+                f->y, f->v, f->u, f->a, f->y_stride, f->uv_stride, f->uv_stride, f->a_stride);
+        case 3:
+            return ColorConvert_YCbCr420p_to_BGRA32_no_alpha(f->dst, f->dst_stride, f->width, f->height,
+                f->y, f->v, f->u, f->y_stride, f->uv_stride, f->uv_stride);
+        // packed UYVY, the layout GstVideoFrame passes in
+        case 4:
+            return ColorConvert_YCbCr422p_to_ARGB32_no_alpha(f->dst, f->dst_stride, f->width, f->height,
+                f->packed + 1, f->packed + 2, f->packed, f->packed_stride, f->packed_stride);
+        case 5:
+            return ColorConvert_YCbCr422p_to_BGRA32_no_alpha(f->dst, f->dst_stride, f->width, f->height,
+                f->packed + 1, f->packed + 2, f->packed, f->packed_stride, f->packed_stride);
+    }
+    return 1;
+}
+
+static const char *kernel_names[] = {
+    "YCbCr420p_to_ARGB32",
+    "YCbCr420p_to_ARGB32_no_alpha",
+    "YCbCr420p_to_BGRA32",
+    "YCbCr420p_to_BGRA32_no_alpha",
+    "YCbCr422p_to_ARGB32_no_alpha",
+    "YCbCr422p_to_BGRA32_no_alpha",
+};
+
+int main(int argc, char **argv)
+{
+    Frame f;
+    uint32_t seed = 1;
+    int32_t iterations = 200;
+    int kernel, n;
+
+    memset(&f, 0, sizeof(f));
+    f.width = 1920;
+    f.height = 1080;
+    if (argc >= 3) {
+        f.width = atoi(argv[1]);
+        f.height = atoi(argv[2]);
+    }
+    if (argc >= 4)
+        iterations = atoi(argv[3]);
+    if (f.width <= 0 || f.height <= 0 || ((f.width | f.height) & 1) || iterations <= 0) {
+        fprintf(stderr, "usage: %s [width height iterations], even sizes only\n", argv[0]);
+        return 1;
+    }
+
+    f.y_stride = f.a_stride = (f.width + ALIGN - 1) & ~(ALIGN - 1);
+    f.uv_stride = (f.width / 2 + ALIGN - 1) & ~(ALIGN - 1);
+    f.packed_stride = (f.width * 2 + ALIGN - 1) & ~(ALIGN - 1);
+    f.dst_stride = (f.width * 4 + ALIGN - 1) & ~(ALIGN - 1);
+    f.y = alloc_plane(f.y_stride, f.height, &seed);
+    f.a = alloc_plane(f.a_stride, f.height, &seed);
+    f.u = alloc_plane(f.uv_stride, f.height / 2, &seed);
+    f.v = alloc_plane(f.uv_stride, f.height / 2, &seed);
+    f.packed = alloc_plane(f.packed_stride, f.height, &seed);
+    f.dst = alloc_plane(f.dst_stride, f.height, &seed);
+
+    printf("%dx%d, %d iterations\n", f.width, f.height, iterations);
+    for (kernel = 0; kernel < (int)(sizeof(kernel_names) / sizeof(kernel_names[0])); kernel++) {
+        double start;
+
+        if (convert(&f, kernel) != 0) {
+            printf("%-30s not implemented\n", kernel_names[kernel]);
+            continue;
+        }
+        start = now_ms();
+        for (n = 0; n < iterations; n++)
+            convert(&f, kernel);
+        printf("%-30s %8.3f ms/frame  checksum %08x\n", kernel_names[kernel],
+               (now_ms() - start) / iterations, checksum(&f));
+    }
+
+    free_plane(f.y);
+    free_plane(f.a);
+    free_plane(f.u);
+    free_plane(f.v);
+    free_plane(f.packed);
+    free_plane(f.dst);
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.webkit.prism;
+
+import com.sun.javafx.geom.Path2D;
+import com.sun.javafx.geom.Shape;
+import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.prism.BasicStroke;
+import com.sun.prism.CompositeMode;
+import com.sun.prism.Graphics;
+import com.sun.prism.RTTexture;
+import com.sun.prism.Texture;
+import com.sun.prism.paint.Color;
+import com.sun.prism.paint.Paint;
+import java.util.Arrays;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * The fill or the stroke of a path rasterized in device space, so that a
+ * path painted again unchanged, possibly moved by whole pixels, is only
+ * composited. A raster is made the second time the path is painted the
+ * same way; one-off paints are drawn directly. The path itself is part of
+ * the key, so a path that was modified in between is painted again.
+ *
+ * All methods but {@link #dispose} are called on the render thread.
+ */
+final class PathRaster {
+    // Number of coordinates per Path2D segment type.
+    private final static int[] SEG_COORDS = {2, 2, 4, 6, 0};
+
+    // Cheaper shapes are not worth a texture.
+    private final static int MIN_COMMANDS = 8;
+    // Limits for a single raster, in device pixels, and for all of them.
+    private final static int MAX_AREA = 512 * 512;
+    private final static int MAX_TEXTURES = 256;
+    private final static AtomicInteger textureCount = new AtomicInteger(0);
+
+    // What the raster was (or will be) made for, see matches().
+    private boolean hasKey;
+    private byte[] commands;
+    private float[] coords;
+    private int windingRule;
+    private double mxx, myx, mxy, myy;
+    private double dx, dy;
+    private int width, height;
+    private Color color;
+    private BasicStroke stroke;
+
+    private RTTexture texture;
+
+    private final float[] bbox = new float[4];
+
+    /**
+     * Paints {@code path} from the raster and returns {@code true}, or
+     * returns {@code false} if the caller has to paint it.
+     */
+    boolean draw(Graphics g, Path2D path, Paint paint, BasicStroke stroke) {
+        if (!(paint instanceof Color)
+                || path.getNumCommands() < MIN_COMMANDS
+                || g.getCompositeMode() != CompositeMode.SRC_OVER) {
+            return false;
+        }
+        BaseTransform tx = g.getTransformNoClone();
+        if (!tx.is2D()) {
+            return false;
+        }
+
+        bbox[0] = bbox[1] = Float.POSITIVE_INFINITY;
+        bbox[2] = bbox[3] = Float.NEGATIVE_INFINITY;
+        if (stroke == null) {
+            Shape.accumulate(bbox, path, tx);
+        } else {
+            stroke.accumulateShapeBounds(bbox, path, tx);
+        }
+        if (!(bbox[0] <= bbox[2] && bbox[1] <= bbox[3])) {
+            return false;
+        }
+        // One pixel of slack for antialiasing.
+        int x0 = (int) Math.floor(bbox[0]) - 1;
+        int y0 = (int) Math.floor(bbox[1]) - 1;
+        int w = (int) Math.ceil(bbox[2]) + 1 - x0;
+        int h = (int) Math.ceil(bbox[3]) + 1 - y0;
+        if ((long) w * h > MAX_AREA) {
+            return false;
+        }
+
+        double offx = tx.getMxt() - x0;
+        double offy = tx.getMyt() - y0;
+        if (!matches(path, tx, offx, offy, w, h, (Color) paint, stroke)) {
+            dispose();
+            setKey(path, tx, offx, offy, w, h, (Color) paint, stroke);
+            return false;
+        }
+
+        if (texture != null && texture.isSurfaceLost()) {
+            dispose();
+        }
+        if (texture == null && !rasterize(g, path)) {
+            return false;
+        }
+
+        BaseTransform saved = tx.copy();
+        g.setTransform(BaseTransform.IDENTITY_TRANSFORM);
+        g.drawTexture(texture, x0, y0, x0 + w, y0 + h, 0, 0, w, h);
+        g.setTransform(saved);
+        return true;
+    }
+
+    private static int coordCount(byte[] commands, int numCommands) {
+        int n = 0;
+        for (int i = 0; i < numCommands; i++) {
+            n += SEG_COORDS[commands[i]];
+        }
+        return n;
+    }
+
+    private boolean matches(Path2D path, BaseTransform tx, double offx, double offy,
+                            int w, int h, Color color, BasicStroke stroke)
+    {
+        // The offset within the raster is recomputed from a translated
+        // transform, allow for rounding.
+        final double eps = 1e-4;
+        if (!hasKey
+                || windingRule != path.getWindingRule()
+                || !Arrays.equals(commands, 0, commands.length,
+                                  path.getCommandsNoClone(), 0, path.getNumCommands())
+                || !Arrays.equals(coords, 0, coords.length,
+                                  path.getFloatCoordsNoClone(), 0, coords.length))
+        {
+            return false;
+        }
+        return true
+                && mxx == tx.getMxx() && myx == tx.getMyx()
+                && mxy == tx.getMxy() && myy == tx.getMyy()
+                && Math.abs(dx - offx) < eps && Math.abs(dy - offy) < eps
+                && width == w && height == h
+                && this.color.equals(color)
+                && (stroke == null ? this.stroke == null : stroke.equals(this.stroke));
+    }
+
+    private void setKey(Path2D path, BaseTransform tx, double offx, double offy,
+                        int w, int h, Color color, BasicStroke stroke)
+    {
+        hasKey = true;
+        commands = Arrays.copyOf(path.getCommandsNoClone(), path.getNumCommands());
+        coords = Arrays.copyOf(path.getFloatCoordsNoClone(),
+                               coordCount(commands, commands.length));
+        windingRule = path.getWindingRule();
+        mxx = tx.getMxx();
+        myx = tx.getMyx();
+        mxy = tx.getMxy();
+        myy = tx.getMyy();
+        dx = offx;
+        dy = offy;
+        width = w;
+        height = h;
+        this.color = color;
+        this.stroke = (stroke != null) ? stroke.copy() : null;
+    }
+
+    private boolean rasterize(Graphics g, Path2D path) {
+        if (textureCount.incrementAndGet() > MAX_TEXTURES) {
+            textureCount.decrementAndGet();
+            return false;
+        }
+        RTTexture t = g.getResourceFactory().createRTTexture(
+                width, height, Texture.WrapMode.CLAMP_NOT_NEEDED);
+        if (t == null) {
+            textureCount.decrementAndGet();
+            return false;
+        }
+        t.contentsUseful();
+        t.makePermanent();
+
+        Graphics tg = t.createGraphics();
+        tg.clear();
+        tg.setTransform(mxx, myx, mxy, myy, dx, dy);
+        tg.setPaint(color);
+        if (stroke != null) {
+            tg.setStroke(stroke);
+            tg.draw(path);
+        } else {
+            tg.fill(path);
+        }
+        texture = t;
+        return true;
+    }
+
+    void dispose() {
+        if (texture != null) {
+            texture.dispose();
+            texture = null;
+            textureCount.decrementAndGet();
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,6 +51,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
     private final int width, height;
     private WeakReference<ResourceFactory> registeredWithFactory = null;
     private ByteBuffer pixelBuffer;
+    private volatile boolean pixelBufferValid; // false once [txt] is drawn to
     private float pixelScale;
 
     private final static PlatformLogger log =
@@ -90,6 +91,15 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
 
     @Override
     Graphics getGraphics() {
+        invalidatePixelBuffer();
+        return createGraphics();
+    }
+
+    void invalidatePixelBuffer() {
+        pixelBufferValid = false;
+    }
+
+    private Graphics createGraphics() {
         RTTexture texture = getTexture();
         if (texture == null) {
             return null;
@@ -199,7 +209,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                 isNew = true;
             }
         }
-        if (isNew || isDirty()) {
+        if (isNew || isDirty() || !pixelBufferValid) {
             PrismInvoker.runOnRenderThread(() -> {
                 final ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
                 if (f == null || f.isDisposed()) {
@@ -235,35 +245,36 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                     if (t != txt) {
                         t.dispose();
                     }
+                    pixelBufferValid = true;
                 }
             });
         }
         return pixelBuffer;
     }
 
-    // This method is called from native [ImageBufferData::update]
-    // while lazy painting procedure
+    // This method is called while decoding the image's render queue, after
+    // native [ImageBufferJavaBackend::putPixelBuffer] has written the
+    // given rectangle of [pixelBuffer].
     @Override
-    protected void drawPixelBuffer() {
-        PrismInvoker.invokeOnRenderThread(new Runnable() {
-            @Override
-            public void run() {
-                //[g] field can be null if it is the first paint
-                //from synthetic ImageData or if the resource factory is disposed
-                Graphics g = getGraphics();
-                if (g != null && pixelBuffer != null) {
-                    pixelBuffer.rewind();//critical!
-                    Image img = Image.fromByteBgraPreData(
-                            pixelBuffer,
-                            width,
-                            height);
-                    Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
-                    txt.dispose();
-                }
-            }
-        });
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
+        //[g] can be null if it is the first paint
+        //from synthetic ImageData or if the resource factory is disposed
+        Graphics g = createGraphics();
+        if (g == null || pixelBuffer == null || w <= 0 || h <= 0) {
+            return;
+        }
+        Texture t = g.getResourceFactory().createTexture(
+                PixelFormat.BYTE_BGRA_PRE, Texture.Usage.DEFAULT,
+                Texture.WrapMode.CLAMP_NOT_NEEDED, w, h);
+        if (t == null) {
+            return;
+        }
+        pixelBuffer.rewind();//critical!
+        t.update(pixelBuffer, PixelFormat.BYTE_BGRA_PRE,
+                0, 0, x, y, w, h, width * 4, false);
+        g.setCompositeMode(CompositeMode.SRC);
+        g.drawTexture(t, x, y, x + w, y + h, 0, 0, w, h);
+        t.dispose();
     }
 
     @Override public void factoryReset() {
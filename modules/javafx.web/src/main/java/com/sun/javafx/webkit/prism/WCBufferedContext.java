@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -63,6 +63,10 @@ final class WCBufferedContext extends WCGraphicsPrismContext {
         init();
         if (baseGraphics == null) {
             baseGraphics = img.getGraphics();
+        } else if (img instanceof RTImage) {
+            // Whatever is drawn through [baseGraphics] makes the pixel
+            // buffer out of date.
+            ((RTImage) img).invalidatePixelBuffer();
         }
         return super.getGraphics(checkClip);
     }
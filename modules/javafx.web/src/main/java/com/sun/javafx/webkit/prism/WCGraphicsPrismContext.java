@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -555,6 +555,48 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         }.paint();
     }
 
+    @Override
+    public void fillRects(final float[] rects, final int count, final Color color) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine(String.format("fillRects(%d, %s)", count, color));
+        }
+        if (!canBatch() || !state.getPerspectiveTransformNoClone().isIdentity()) {
+            for (int i = 0; i < 4 * count; i += 4) {
+                fillRect(rects[i], rects[i + 1], rects[i + 2], rects[i + 3], color);
+            }
+            return;
+        }
+        if (!shouldRenderAnyRect(rects, 4, count)) {
+            return;
+        }
+        // One composite and one paint for the whole list; Prism batches
+        // the quads until the state changes.
+        new Composite() {
+            @Override void doPaint(Graphics g) {
+                g.setPaint((color != null) ? color : state.getPaintNoClone());
+                for (int i = 0; i < 4 * count; i += 4) {
+                    g.fillRect(rects[i], rects[i + 1], rects[i + 2], rects[i + 3]);
+                }
+            }
+        }.paint();
+    }
+
+    // Shadows and blended composites are rendered per primitive.
+    private boolean canBatch() {
+        int op = state.getCompositeOperation();
+        return state.getShadowNoClone() == null
+                && (op == COMPOSITE_COPY || op == COMPOSITE_SOURCE_OVER);
+    }
+
+    private boolean shouldRenderAnyRect(float[] rects, int stride, int count) {
+        for (int i = 0; i < stride * count; i += stride) {
+            if (shouldRenderRect(rects[i], rects[i + 1], rects[i + 2], rects[i + 3], null, null)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     @Override
     public void fillRoundedRect(final float x, final float y, final float w, final float h,
         final float topLeftW, final float topLeftH, final float topRightW, final float topRightH,
@@ -864,6 +906,101 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         }
     }
 
+    @Override
+    public void drawImages(final WCImage img, final float[] rects, final int count) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("drawImages(img, {0})", new Object[] {count});
+        }
+        if (!(img instanceof PrismImage)) {
+            return;
+        }
+        if (!canBatch()) {
+            for (int i = 0; i < 8 * count; i += 8) {
+                drawImage(img, rects[i], rects[i + 1], rects[i + 2], rects[i + 3],
+                        rects[i + 4], rects[i + 5], rects[i + 6], rects[i + 7]);
+            }
+            return;
+        }
+        if (!shouldRenderAnyRect(rects, 8, count)) {
+            return;
+        }
+        new Composite() {
+            @Override void doPaint(Graphics g) {
+                PrismImage pi = (PrismImage) img;
+                for (int i = 0; i < 8 * count; i += 8) {
+                    float dstx = rects[i], dsty = rects[i + 1];
+                    float srcx = rects[i + 4], srcy = rects[i + 5];
+                    pi.draw(g,
+                            (int) dstx, (int) dsty,
+                            (int) (dstx + rects[i + 2]), (int) (dsty + rects[i + 3]),
+                            (int) srcx, (int) srcy,
+                            (int) (srcx + rects[i + 6]), (int) (srcy + rects[i + 7]));
+                }
+            }
+        }.paint();
+    }
+
+    @Override
+    public void drawFilteredImage(final WCImage img,
+                                  final float dstx, final float dsty, final float dstw, final float dsth,
+                                  final int[] types, final float[] params)
+    {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("drawFilteredImage(img, dst({0},{1},{2},{3}), filters: {4})",
+                    new Object[] {dstx, dsty, dstw, dsth, types.length});
+        }
+        if (!(img instanceof PrismImage)) {
+            return;
+        }
+        // Build the Decora effect chain; the effects pick hardware peers
+        // when available, so the filters run on the GPU.
+        Effect chain = null;
+        float opacity = 1f;
+        int p = 0;
+        for (int type : types) {
+            switch (type) {
+                case GraphicsDecoder.FILTER_BLUR:
+                    chain = new GaussianBlur(clampRadius(3f * params[p++], 63f), chain);
+                    break;
+                case GraphicsDecoder.FILTER_DROP_SHADOW: {
+                    DropShadow shadow = new DropShadow(chain);
+                    shadow.setOffsetX((int) params[p++]);
+                    shadow.setOffsetY((int) params[p++]);
+                    shadow.setRadius(clampRadius(3f * params[p++], 127f));
+                    shadow.setColor(new Color4f(params[p++], params[p++], params[p++], params[p++]));
+                    chain = shadow;
+                    break;
+                }
+                case GraphicsDecoder.FILTER_OPACITY:
+                    opacity *= params[p++];
+                    break;
+                default:
+                    log.fine("drawFilteredImage: unknown filter type {0}", type);
+                    return;
+            }
+        }
+        final Effect effect = chain;
+        final float alpha = opacity;
+        new Composite() {
+            @Override void doPaint(Graphics g) {
+                NGImageView node = new NGImageView();
+                node.setImage(((PrismImage) img).getImage());
+                node.setX(dstx);
+                node.setY(dsty);
+                node.setViewport(0, 0, dstw, dsth, dstw, dsth);
+                node.setContentBounds(new RectBounds(dstx, dsty, dstx + dstw, dsty + dsth));
+                float extraAlpha = g.getExtraAlpha();
+                g.setExtraAlpha(extraAlpha * alpha);
+                render(g, effect, null, null, node);
+                g.setExtraAlpha(extraAlpha);
+            }
+        }.paint();
+    }
+
+    private static float clampRadius(float radius, float max) {
+        return (radius < 0f) ? 0f : (radius > max) ? max : radius;
+    }
+
     @Override
     public void drawBitmapImage(final ByteBuffer image, final int x, final int y, final int w, final int h) {
         if (!shouldRenderRect(x, y, w, h, null, null)) {
@@ -1790,9 +1927,13 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
                         if (paint == null) {
                             paint = state.getPaintNoClone();
                         }
-                        g.setPaint(paint);
-                        g.setStroke(stroke);
-                        g.draw(p2d);
+                        if (!((WCPathImpl) path).strokeRaster()
+                                .draw(g, p2d, paint, stroke))
+                        {
+                            g.setPaint(paint);
+                            g.setStroke(stroke);
+                            g.draw(p2d);
+                        }
                     }
                 }
             }.paint();
@@ -1817,7 +1958,9 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
                         final NGPath node = new NGPath();
                         node.updateWithPath2d(p2d);
                         render(g, shadow, paint, null, node);
-                    } else {
+                    } else if (!((WCPathImpl) path).fillRaster()
+                                .draw(g, p2d, paint, null))
+                    {
                         g.setPaint(paint);
                         g.fill(p2d);
                     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@ import com.sun.webkit.graphics.WCImageFrame;
 import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
+import java.nio.ByteBuffer;
 import java.util.Arrays;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
@@ -56,6 +57,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private int frameCount = 0; // keeps frame count when decoded frames are temporarily destroyed
     private boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
+    private int framesSubsamplingLevel = 0; // subsampling level the frames were decoded at
     private PrismImage[] images;
     private volatile byte[] data;
     private volatile int dataSize = 0;
@@ -82,6 +84,22 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         framesDecoded = false;
     }
 
+    /*
+     * Called when WebCore drops its decoded copy of the image. Animated
+     * images are decoded all at once, so only single frame images, whose
+     * frame is cheap to get back from the encoded data, are released here.
+     */
+    @Override protected synchronized void destroyDecodedData() {
+        if (fullDataReceived && frameCount <= 1 && frames != null) {
+            if (log.isLoggable(Level.FINE)) {
+                log.fine(String.format("%X Destroy decoded data", hashCode()));
+            }
+            frames = null;
+            images = null;
+            framesDecoded = false;
+        }
+    }
+
     @Override protected String getFilenameExtension() {
         return "." + fileNameExtension;
     }
@@ -90,20 +108,19 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    @Override protected void addImageData(ByteBuffer dataPortion, int totalSize) {
         if (dataPortion != null) {
             fullDataReceived = false;
+            int length = dataPortion.remaining();
+            int newDataSize = dataSize + length;
             if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
-            } else {
-                int newDataSize = dataSize + dataPortion.length;
-                if (newDataSize > data.length) {
-                    resizeDataArray(Math.max(newDataSize, data.length * 2));
-                }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
-                dataSize = newDataSize;
+                data = new byte[Math.max(totalSize, newDataSize)];
+            } else if (newDataSize > data.length) {
+                resizeDataArray(Math.max(Math.max(totalSize, newDataSize), data.length * 2));
             }
+            // [dataPortion] is only valid during this call.
+            dataPortion.get(data, dataSize, length);
+            dataSize = newDataSize;
             // Try to decode the partial data until we get image size.
             if (!imageSizeAvilable()) {
                 loadFrames();
@@ -170,14 +187,24 @@ final class WCImageDecoderImpl extends WCImageDecoder {
             return;
         }
 
-        setFrames(loadFrames(in));
+        setFrames(loadFrames(in, 0));
     }
 
-    private synchronized ImageFrame[] loadFrames(InputStream in) {
+    private synchronized ImageFrame[] loadFrames(InputStream in, int subsamplingLevel) {
         if (log.isLoggable(Level.FINE)) {
-            log.fine(String.format("%X Decoding frames", hashCode()));
+            log.fine(String.format("%X Decoding frames, subsampling level %d",
+                    hashCode(), subsamplingLevel));
         }
         try {
+            if (subsamplingLevel > 0 && imageSizeAvilable()) {
+                // Let the loader scale while decoding so that the full size
+                // image is never resident. The size must match what
+                // ImageDecoderJava reports for this subsampling level.
+                int round = (1 << subsamplingLevel) - 1;
+                int w = (imageWidth + round) >> subsamplingLevel;
+                int h = (imageHeight + round) >> subsamplingLevel;
+                return ImageStorage.getInstance().loadAll(in, readerListener, w, h, false, 1.0f, true);
+            }
             return ImageStorage.getInstance().loadAll(in, readerListener, 0, 0, true, 1.0f, false);
         } catch (ImageStorageException e) {
             return null; // consider image missing
@@ -191,7 +218,11 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     }
 
     private ImageFrame[] loadFrames() {
-        return loadFrames(new ByteArrayInputStream(this.data, 0, this.dataSize));
+        return loadFrames(0);
+    }
+
+    private ImageFrame[] loadFrames(int subsamplingLevel) {
+        return loadFrames(new ByteArrayInputStream(this.data, 0, this.dataSize), subsamplingLevel);
     }
 
     private final ImageLoadListener readerListener = new ImageLoadListener() {
@@ -263,15 +294,15 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         // be any performance degrade while initiating a
         // full decode.
         if (fullDataReceived) {
-            getImageFrame(0);
+            getImageFrame(0, framesSubsamplingLevel);
         }
         return frameCount;
     }
 
     // Avoid redundant decoding by async decoder threads, currently we don't
     // support per frame decoding.
-    @Override protected synchronized WCImageFrame getFrame(int idx) {
-        ImageFrame frame = getImageFrame(idx);
+    @Override protected synchronized WCImageFrame getFrame(int idx, int subsamplingLevel) {
+        ImageFrame frame = getImageFrame(idx, subsamplingLevel);
         if (frame != null) {
             if (log.isLoggable(Level.FINE)) {
                 ImageStorage.ImageType type = frame.getImageType();
@@ -326,12 +357,15 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return getFrameMetadata(idx) != null && framesDecoded;
     }
 
-    private synchronized ImageFrame getImageFrame(int idx) {
+    private synchronized ImageFrame getImageFrame(int idx, int subsamplingLevel) {
         if (!fullDataReceived) {
+            // Partial data is always decoded at full size.
             startLoader();
-        } else if (fullDataReceived && !framesDecoded) {
+        } else if (!framesDecoded || subsamplingLevel != framesSubsamplingLevel) {
             destroyLoader();
-            setFrames(loadFrames()); // re-decode frames if they have been destroyed
+            // re-decode frames if they have been destroyed or are needed at another size
+            setFrames(loadFrames(subsamplingLevel));
+            framesSubsamplingLevel = subsamplingLevel;
             framesDecoded = true;
         }
         return (idx >= 0) && (this.frames != null) && (this.frames.length > idx)
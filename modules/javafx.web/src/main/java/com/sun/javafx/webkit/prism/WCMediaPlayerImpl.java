@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -358,6 +358,14 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
     }
 
 
+    /*
+     * Frames are handed to Prism in the decoder's native layout: planar
+     * YCbCr 4:2:0 and 4:2:2 frames are uploaded as-is and converted to RGB
+     * by the Prism shaders, so no per-pixel work is done on the CPU here.
+     * PrismMediaFrameHandler only re-uploads a texture when the frame
+     * timestamp changes, so repaints of the same frame are a plain draw.
+     * Decoding itself (and any hardware surfaces) is up to jfxmedia.
+     */
     private void renderImpl(WCGraphicsContext gc, int x, int y, int w, int h) {
         log.finer(">>(Prism)renderImpl");
         Graphics g = (Graphics)gc.getPlatformGraphics();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,6 +44,9 @@ import java.util.Arrays;
 final class WCPathImpl extends WCPath<Path2D> {
     private final Path2D path;
     private boolean hasCP = false;
+    // Rasterized fill and stroke, created on first use on the render thread.
+    private PathRaster fillRaster;
+    private PathRaster strokeRaster;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(WCPathImpl.class.getName());
@@ -266,6 +269,39 @@ final class WCPathImpl extends WCPath<Path2D> {
         this.path.setWindingRule(1 - rule); // convert webkit to prism
     }
 
+    PathRaster fillRaster() {
+        if (fillRaster == null) {
+            fillRaster = new PathRaster();
+        }
+        return fillRaster;
+    }
+
+    PathRaster strokeRaster() {
+        if (strokeRaster == null) {
+            strokeRaster = new PathRaster();
+        }
+        return strokeRaster;
+    }
+
+    @Override
+    public synchronized void deref() {
+        super.deref();
+        if (!hasRefs() && (fillRaster != null || strokeRaster != null)) {
+            final PathRaster fr = fillRaster;
+            final PathRaster sr = strokeRaster;
+            fillRaster = null;
+            strokeRaster = null;
+            PrismInvoker.invokeOnRenderThread(() -> {
+                if (fr != null) {
+                    fr.dispose();
+                }
+                if (sr != null) {
+                    sr.dispose();
+                }
+            });
+        }
+    }
+
     @Override
     public Path2D getPlatformPath() {
         if (log.isLoggable(Level.FINE)) {
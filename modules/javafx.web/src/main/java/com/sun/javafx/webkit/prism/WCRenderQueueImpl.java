@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,11 @@ final class WCRenderQueueImpl extends WCRenderQueue {
         }
     }
 
+    @Override
+    protected void runOnRenderThread(Runnable r) {
+        PrismInvoker.runOnRenderThread(r);
+    }
+
     @Override
     protected void disposeGraphics() {
         PrismInvoker.invokeOnRenderThread(() -> {
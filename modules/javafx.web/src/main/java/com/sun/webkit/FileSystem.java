@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,9 +33,13 @@ import java.io.RandomAccessFile;
 import static java.lang.String.format;
 import java.nio.ByteBuffer;
 import java.nio.channels.FileChannel;
+import java.nio.file.AtomicMoveNotSupportedException;
 import java.nio.file.Files;
 import java.nio.file.InvalidPathException;
+import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
 
 final class FileSystem {
 
@@ -83,6 +87,21 @@ final class FileSystem {
         return -1;
     }
 
+    private static ByteBuffer fwkMapFile(RandomAccessFile raf) {
+        try {
+            FileChannel fc = raf.getChannel();
+            long size = fc.size();
+            if (size > Integer.MAX_VALUE) {
+                return null;
+            }
+            // The mapping stays valid after the file is closed
+            return fc.map(FileChannel.MapMode.READ_ONLY, 0, size);
+        } catch (IOException | UnsupportedOperationException ex) {
+            logger.fine(format("Error while mapping RandomAccessFile for file [%s]", raf), ex);
+        }
+        return null;
+    }
+
     private static void fwkSeekFile(RandomAccessFile raf, long pos) {
         try {
             raf.seek(pos);
@@ -140,6 +159,51 @@ final class FileSystem {
         }
     }
 
+    private static boolean fwkDeleteFile(String path) {
+        try {
+            return Files.deleteIfExists(Paths.get(path));
+        } catch (InvalidPathException|IOException|SecurityException ex) {
+            logger.fine(format("Error deleting file [%s]", path), ex);
+            return false;
+        }
+    }
+
+    // Writes to a sibling temporary file first so that a reader never sees
+    // a partially written file at path.
+    private static int fwkOverwriteEntireFile(String path, ByteBuffer data) {
+        Path tempFile = null;
+        try {
+            Path target = Paths.get(path).toAbsolutePath();
+            tempFile = Files.createTempFile(target.getParent(), ".webkit", ".tmp");
+            int length = data.remaining();
+            try (FileChannel channel = FileChannel.open(tempFile,
+                    StandardOpenOption.WRITE)) {
+                while (data.hasRemaining()) {
+                    channel.write(data);
+                }
+            }
+            try {
+                Files.move(tempFile, target, StandardCopyOption.ATOMIC_MOVE,
+                        StandardCopyOption.REPLACE_EXISTING);
+            } catch (AtomicMoveNotSupportedException ex) {
+                Files.move(tempFile, target, StandardCopyOption.REPLACE_EXISTING);
+            }
+            tempFile = null;
+            return length;
+        } catch (InvalidPathException|IOException|SecurityException ex) {
+            logger.fine(format("Error writing file [%s]", path), ex);
+            return -1;
+        } finally {
+            if (tempFile != null) {
+                try {
+                    Files.deleteIfExists(tempFile);
+                } catch (IOException|SecurityException ex) {
+                    logger.fine(format("Error deleting file [%s]", tempFile), ex);
+                }
+            }
+        }
+    }
+
     private static String fwkPathGetFileName(String path) {
         return new File(path).getName();
     }
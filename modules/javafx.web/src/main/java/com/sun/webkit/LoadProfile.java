@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * Network load timing summed over the resources a page has loaded since
+ * it was created or since the last {@link #reset}. Times are totals over
+ * all resources, in milliseconds; the loaders only report the phases
+ * they can observe, so a resource may add to some phases and not others.
+ * May be used on any thread.
+ */
+public final class LoadProfile {
+
+    private int resourceCount;
+    private int failedCount;
+    private long bytesReceived;
+    private long connectTime;
+    private long waitingTime;
+    private long receivingTime;
+    private long deliveryTime;
+    private long totalTime;
+    private long longestTime;
+
+    LoadProfile() {
+    }
+
+    /**
+     * Adds a finished load. Durations are in nanoseconds, negative where
+     * unknown. Called by the network loaders on the event thread.
+     *
+     * @param failed whether the load failed
+     * @param connect time spent connecting, DNS and TLS included
+     * @param waiting time from sending the request to the response headers
+     * @param receiving time from the response headers to the last byte
+     * @param delivery time received data waited for the event thread
+     * @param total time from the start of the load to its end
+     * @param bytes number of body bytes delivered to WebCore
+     */
+    public synchronized void add(boolean failed, long connect, long waiting,
+                                 long receiving, long delivery, long total,
+                                 long bytes)
+    {
+        resourceCount++;
+        if (failed) {
+            failedCount++;
+        }
+        connectTime += Math.max(connect, 0);
+        waitingTime += Math.max(waiting, 0);
+        receivingTime += Math.max(receiving, 0);
+        deliveryTime += Math.max(delivery, 0);
+        totalTime += Math.max(total, 0);
+        longestTime = Math.max(longestTime, total);
+        bytesReceived += bytes;
+    }
+
+    /**
+     * Clears the profile.
+     */
+    public synchronized void reset() {
+        resourceCount = 0;
+        failedCount = 0;
+        bytesReceived = 0;
+        connectTime = 0;
+        waitingTime = 0;
+        receivingTime = 0;
+        deliveryTime = 0;
+        totalTime = 0;
+        longestTime = 0;
+    }
+
+    /** Returns the number of loads that finished or failed. */
+    public synchronized int getResourceCount() {
+        return resourceCount;
+    }
+
+    /** Returns the number of loads that failed. */
+    public synchronized int getFailedCount() {
+        return failedCount;
+    }
+
+    /** Returns the number of body bytes delivered to the page. */
+    public synchronized long getBytesReceived() {
+        return bytesReceived;
+    }
+
+    /** Returns the time spent connecting, DNS and TLS included. */
+    public synchronized double getConnectTime() {
+        return toMillis(connectTime);
+    }
+
+    /** Returns the time spent waiting for response headers. */
+    public synchronized double getWaitingTime() {
+        return toMillis(waitingTime);
+    }
+
+    /** Returns the time spent receiving response bodies. */
+    public synchronized double getReceivingTime() {
+        return toMillis(receivingTime);
+    }
+
+    /** Returns the time received data waited for the event thread. */
+    public synchronized double getDeliveryTime() {
+        return toMillis(deliveryTime);
+    }
+
+    /** Returns the time from the start to the end of the loads. */
+    public synchronized double getTotalTime() {
+        return toMillis(totalTime);
+    }
+
+    /** Returns the duration of the longest load. */
+    public synchronized double getLongestTime() {
+        return toMillis(longestTime);
+    }
+
+    private static double toMillis(long nanos) {
+        return nanos / 1e6;
+    }
+
+    @Override
+    public synchronized String toString() {
+        return String.format("LoadProfile[resources=%d, failed=%d, bytes=%d, "
+                + "connect=%.1fms, waiting=%.1fms, receiving=%.1fms, "
+                + "delivery=%.1fms, total=%.1fms, longest=%.1fms]",
+                resourceCount, failedCount, bytesReceived,
+                getConnectTime(), getWaitingTime(), getReceivingTime(),
+                getDeliveryTime(), getTotalTime(), getLongestTime());
+    }
+}
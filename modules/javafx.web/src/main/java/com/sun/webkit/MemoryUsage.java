@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * A collection of static methods for memory usage reporting and release.
+ * The memory is shared by all web pages in the process.
+ */
+public final class MemoryUsage {
+
+    /**
+     * The private default constructor. Ensures non-instantiability.
+     */
+    private MemoryUsage() {
+        throw new AssertionError();
+    }
+
+
+    /**
+     * Returns the dirty anonymous memory of the process, in bytes. This
+     * covers the native heaps of WebKit and the JavaScript heap, and also
+     * the Java heap and the native memory of the JVM.
+     */
+    public static long getProcessFootprint() {
+        return twkGetProcessFootprint();
+    }
+
+    /**
+     * Returns the memory used by live objects in the JavaScript heap, in
+     * bytes, as of the last collection.
+     */
+    public static long getJavaScriptHeapSize() {
+        return twkGetJavaScriptHeapSize();
+    }
+
+    /**
+     * Returns the memory committed to the JavaScript heap, in bytes.
+     */
+    public static long getJavaScriptHeapCapacity() {
+        return twkGetJavaScriptHeapCapacity();
+    }
+
+    /**
+     * Returns the memory held outside the JavaScript heap by JavaScript
+     * objects, such as array buffers, in bytes.
+     */
+    public static long getJavaScriptExtraMemorySize() {
+        return twkGetJavaScriptExtraMemorySize();
+    }
+
+    /**
+     * Returns the memory used by the resources in the memory cache, in
+     * bytes.
+     */
+    public static long getMemoryCacheSize() {
+        return twkGetMemoryCacheSize();
+    }
+
+    /**
+     * Returns the memory used by the decoded data of the images in the
+     * memory cache, in bytes.
+     */
+    public static long getDecodedImageSize() {
+        return twkGetDecodedImageSize();
+    }
+
+    /**
+     * Returns the number of live documents, including those of frames,
+     * of pages in the back/forward cache and of documents that are no
+     * longer displayed but not yet collected. A count that keeps growing
+     * while pages are reloaded points to a leaked document.
+     */
+    public static int getDocumentCount() {
+        return twkGetDocumentCount();
+    }
+
+    /**
+     * Returns the number of fonts held by the font cache.
+     */
+    public static int getFontCount() {
+        return twkGetFontCount();
+    }
+
+    /**
+     * Runs a full collection of the JavaScript heap and returns a snapshot
+     * of every live cell and of the references between cells, as JSON in
+     * the format of the Web Inspector heap snapshots. The snapshot can be
+     * large for big pages.
+     */
+    public static String takeJavaScriptHeapSnapshot() {
+        Invoker.getInvoker().checkEventThread();
+        return twkTakeJavaScriptHeapSnapshot();
+    }
+
+    /**
+     * Returns the number of resource requests served from the memory cache
+     * without contacting the network, since startup.
+     */
+    public static long getMemoryCacheHitCount() {
+        return twkGetMemoryCacheHitCount();
+    }
+
+    /**
+     * Returns the number of cacheable resource requests that found no
+     * usable entry in the memory cache, since startup.
+     */
+    public static long getMemoryCacheMissCount() {
+        return twkGetMemoryCacheMissCount();
+    }
+
+    /**
+     * Returns the number of resource requests whose memory cache entry had
+     * to be revalidated with the server, since startup.
+     */
+    public static long getMemoryCacheRevalidationCount() {
+        return twkGetMemoryCacheRevalidationCount();
+    }
+
+    /**
+     * Returns the number of unused resources evicted from the memory cache
+     * to keep it within its capacity, since startup.
+     */
+    public static long getMemoryCacheEvictionCount() {
+        return twkGetMemoryCacheEvictionCount();
+    }
+
+    /**
+     * Returns the number of history items held by the back/forward lists
+     * of all pages, counting the items of subframes.
+     */
+    public static int getHistoryItemCount() {
+        return twkGetHistoryItemCount();
+    }
+
+    /**
+     * Returns the number of pages kept alive in the back/forward cache.
+     */
+    public static int getBackForwardCachePageCount() {
+        return twkGetBackForwardCachePageCount();
+    }
+
+    /**
+     * Collects the JavaScript heap and returns the free memory of the
+     * native heaps to the system. An aggressive scavenge also drops the
+     * compiled code, the page cache, the memory cache and other caches
+     * first, as on a critical memory pressure signal, and clears the saved
+     * form state of every history item other than the current one.
+     */
+    public static void scavenge(boolean aggressive) {
+        Invoker.getInvoker().checkEventThread();
+        twkScavenge(aggressive);
+    }
+
+    native private static long twkGetProcessFootprint();
+    native private static long twkGetJavaScriptHeapSize();
+    native private static long twkGetJavaScriptHeapCapacity();
+    native private static long twkGetJavaScriptExtraMemorySize();
+    native private static long twkGetMemoryCacheSize();
+    native private static long twkGetDecodedImageSize();
+    native private static int twkGetDocumentCount();
+    native private static int twkGetFontCount();
+    native private static String twkTakeJavaScriptHeapSnapshot();
+    native private static long twkGetMemoryCacheHitCount();
+    native private static long twkGetMemoryCacheMissCount();
+    native private static long twkGetMemoryCacheRevalidationCount();
+    native private static long twkGetMemoryCacheEvictionCount();
+    native private static int twkGetHistoryItemCount();
+    native private static int twkGetBackForwardCachePageCount();
+    native private static void twkScavenge(boolean aggressive);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,6 +59,84 @@ public final class PageCache {
         twkSetCapacity(capacity);
     }
 
+    /**
+     * Returns the memory capacity of the page cache.
+     * @return the upper bound for the estimated memory used by the cached
+     *         pages, in bytes, or zero if only the page count is limited.
+     */
+    public static long getMemoryCapacity() {
+        return twkGetMemoryCapacity();
+    }
+
+    /**
+     * Sets the memory capacity of the page cache. The least recently
+     * cached pages are evicted while the estimated memory used by the
+     * cached pages exceeds the capacity.
+     * @param capacity specifies the new memory capacity of the page cache,
+     *        in bytes, or zero to limit the page count only.
+     * @throws IllegalArgumentException if {@code capacity} is negative.
+     */
+    public static void setMemoryCapacity(long capacity) {
+        if (capacity < 0) {
+            throw new IllegalArgumentException(
+                    "capacity is negative:" + capacity);
+        }
+        twkSetMemoryCapacity(capacity);
+    }
+
+    /**
+     * Returns the estimated memory used by the cached pages, in bytes.
+     */
+    public static long getMemoryCost() {
+        return twkGetMemoryCost();
+    }
+
+    /**
+     * Returns the number of pages currently in the page cache.
+     */
+    public static int getPageCount() {
+        return twkGetPageCount();
+    }
+
+    /**
+     * Returns the number of back/forward navigations served from the
+     * page cache since the statistics were last reset.
+     */
+    public static int getHitCount() {
+        return twkGetHitCount();
+    }
+
+    /**
+     * Returns the number of back/forward navigations that found no usable
+     * page in the page cache since the statistics were last reset.
+     */
+    public static int getMissCount() {
+        return twkGetMissCount();
+    }
+
+    /**
+     * Returns the number of pages evicted from the page cache since the
+     * statistics were last reset.
+     */
+    public static int getEvictionCount() {
+        return twkGetEvictionCount();
+    }
+
+    /**
+     * Resets the hit, miss and eviction counts.
+     */
+    public static void resetStatistics() {
+        twkResetStatistics();
+    }
+
     native private static int twkGetCapacity();
     native private static void twkSetCapacity(int capacity);
+    native private static long twkGetMemoryCapacity();
+    native private static void twkSetMemoryCapacity(long capacity);
+    native private static long twkGetMemoryCost();
+    native private static int twkGetPageCount();
+    native private static int twkGetHitCount();
+    native private static int twkGetMissCount();
+    native private static int twkGetEvictionCount();
+    native private static void twkResetStatistics();
 }
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * The rendering work done for a page, taken from the counters WebCore
+ * keeps while rendering profiling is enabled for the page. Times are in
+ * milliseconds and inclusive, so a layout forced by a style recalc adds
+ * to both. Instances are snapshots and do not change.
+ */
+public final class RenderingProfile {
+
+    /**
+     * The phases of rendering a page, in the order of the native
+     * RenderingProfileJava::Phase.
+     */
+    public enum Phase {
+        /** Recalculating styles. */
+        STYLE,
+        /** Laying out the render tree. */
+        LAYOUT,
+        /** Painting into the render queue. */
+        PAINT,
+        /** Updating and painting composited layers. */
+        COMPOSITE,
+        /** The whole rendering update, animations and callbacks included. */
+        RENDERING_UPDATE
+    }
+
+    // Layout of the values, as filled in by twkGetRenderingProfile: count,
+    // time and longest time of each phase, then the counters below
+    private static final int PHASE_STRIDE = 3;
+    private static final int RESTYLED = Phase.values().length * PHASE_STRIDE;
+    private static final int MATCHED_DECLARATIONS_HITS = RESTYLED + 1;
+    private static final int MATCHED_DECLARATIONS_MISSES = RESTYLED + 2;
+    private static final int STYLE_SHARING_HITS = RESTYLED + 3;
+    private static final int STYLE_SHARING_MISSES = RESTYLED + 4;
+    private static final int LAYOUTS_IN_RENDERING_UPDATES = RESTYLED + 5;
+    private static final int MAX_LAYOUTS_PER_RENDERING_UPDATE = RESTYLED + 6;
+
+    private final double[] values;
+
+    RenderingProfile(double[] values) {
+        this.values = values;
+    }
+
+    private double get(Phase phase, int offset) {
+        return values[phase.ordinal() * PHASE_STRIDE + offset];
+    }
+
+    /** Returns how many times {@code phase} ran. */
+    public long getCount(Phase phase) {
+        return (long) get(phase, 0);
+    }
+
+    /** Returns the total time spent in {@code phase}. */
+    public double getTime(Phase phase) {
+        return get(phase, 1);
+    }
+
+    /** Returns the longest single run of {@code phase}. */
+    public double getLongestTime(Phase phase) {
+        return get(phase, 2);
+    }
+
+    /** Returns the number of elements whose style was recalculated. */
+    public long getRestyledElementCount() {
+        return (long) values[RESTYLED];
+    }
+
+    /**
+     * Returns the share of style resolutions that could start from the
+     * style of an element with the same matched declarations, or -1 if
+     * there were none.
+     */
+    public double getMatchedDeclarationsCacheHitRate() {
+        return rate(values[MATCHED_DECLARATIONS_HITS],
+                values[MATCHED_DECLARATIONS_MISSES]);
+    }
+
+    /**
+     * Returns the share of elements that shared the style of a sibling
+     * instead of having their own resolved, or -1 if there were none.
+     */
+    public double getStyleSharingHitRate() {
+        return rate(values[STYLE_SHARING_HITS], values[STYLE_SHARING_MISSES]);
+    }
+
+    /** Returns the average number of layouts per rendering update. */
+    public double getLayoutsPerRenderingUpdate() {
+        long updates = getCount(Phase.RENDERING_UPDATE);
+        return updates > 0 ? values[LAYOUTS_IN_RENDERING_UPDATES] / updates : 0;
+    }
+
+    /** Returns the largest number of layouts in one rendering update. */
+    public int getMaxLayoutsPerRenderingUpdate() {
+        return (int) values[MAX_LAYOUTS_PER_RENDERING_UPDATE];
+    }
+
+    private static double rate(double hits, double misses) {
+        double total = hits + misses;
+        return total > 0 ? hits / total : -1;
+    }
+
+    @Override
+    public String toString() {
+        StringBuilder sb = new StringBuilder("RenderingProfile[");
+        for (Phase phase : Phase.values()) {
+            sb.append(String.format("%s=%d/%.1fms/%.1fms, ",
+                    phase.name().toLowerCase(), getCount(phase),
+                    getTime(phase), getLongestTime(phase)));
+        }
+        sb.append(String.format("restyled=%d, mdcHitRate=%.2f, "
+                + "sharingHitRate=%.2f, layoutsPerUpdate=%.2f, "
+                + "maxLayoutsPerUpdate=%d]",
+                getRestyledElementCount(),
+                getMatchedDeclarationsCacheHitRate(),
+                getStyleSharingHitRate(),
+                getLayoutsPerRenderingUpdate(),
+                getMaxLayoutsPerRenderingUpdate()));
+        return sb.toString();
+    }
+}
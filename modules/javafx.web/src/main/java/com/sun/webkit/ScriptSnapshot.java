@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package com.sun.webkit;
+
+import java.lang.annotation.Native;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.Date;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Decodes the snapshot of a script result produced by
+ * {@link WebPage#executeScriptSnapshot}. The native side walks the result
+ * once and writes it into a buffer of tagged values, so that reading the
+ * snapshot from Java costs no further calls into JavaScript.
+ * <p>
+ * Values are mapped as follows:
+ * <ul>
+ * <li>JavaScript Int32 to {@code java.lang.Integer}, other numbers to
+ *     {@code java.lang.Double}
+ * <li>strings and BigInts to {@code java.lang.String}
+ * <li>booleans to {@code java.lang.Boolean}
+ * <li>{@code null} and {@code undefined} to {@code null}
+ * <li>{@code Date} objects to {@code java.util.Date}
+ * <li>arrays to {@code java.util.List}
+ * <li>other objects to a {@code java.util.Map} of their own enumerable
+ *     properties, in enumeration order
+ * </ul>
+ * Functions and symbols are left out of objects and become {@code null}
+ * in arrays. An object reached more than once, including through a cycle,
+ * maps to the same Java instance each time.
+ */
+final class ScriptSnapshot {
+
+    @Native static final int TAG_NULL = 0;
+    @Native static final int TAG_FALSE = 1;
+    @Native static final int TAG_TRUE = 2;
+    @Native static final int TAG_INT = 3;
+    @Native static final int TAG_DOUBLE = 4;
+    @Native static final int TAG_STRING = 5;
+    @Native static final int TAG_DATE = 6;
+    @Native static final int TAG_ARRAY = 7;
+    @Native static final int TAG_OBJECT = 8;
+    @Native static final int TAG_REFERENCE = 9;
+
+    private final ByteBuffer buffer;
+    private final List<Object> objects = new ArrayList<>();
+
+    private ScriptSnapshot(ByteBuffer buffer) {
+        this.buffer = buffer.order(ByteOrder.nativeOrder());
+    }
+
+    private Object readValue() {
+        int tag = buffer.get();
+        switch (tag) {
+            case TAG_NULL: return null;
+            case TAG_FALSE: return Boolean.FALSE;
+            case TAG_TRUE: return Boolean.TRUE;
+            case TAG_INT: return buffer.getInt();
+            case TAG_DOUBLE: return buffer.getDouble();
+            case TAG_STRING: return readString();
+            case TAG_DATE: return new Date((long) buffer.getDouble());
+            case TAG_ARRAY: {
+                int length = buffer.getInt();
+                List<Object> list = new ArrayList<>(length);
+                objects.add(list);
+                for (int i = 0; i < length; i++) {
+                    list.add(readValue());
+                }
+                return list;
+            }
+            case TAG_OBJECT: {
+                int size = buffer.getInt();
+                Map<String, Object> map = new LinkedHashMap<>();
+                objects.add(map);
+                for (int i = 0; i < size; i++) {
+                    String key = readString();
+                    map.put(key, readValue());
+                }
+                return map;
+            }
+            case TAG_REFERENCE: return objects.get(buffer.getInt());
+            default:
+                throw new IllegalStateException("Invalid snapshot tag: " + tag);
+        }
+    }
+
+    private String readString() {
+        int length = buffer.getInt();
+        char[] chars = new char[length];
+        buffer.asCharBuffer().get(chars);
+        buffer.position(buffer.position() + length * Character.BYTES);
+        return new String(chars);
+    }
+
+    // Called from native with a buffer that is only valid during the call
+    private static Object fwkDecode(ByteBuffer buffer) {
+        return new ScriptSnapshot(buffer).readValue();
+    }
+}
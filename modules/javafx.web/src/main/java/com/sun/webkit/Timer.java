@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -94,14 +94,10 @@ public class Timer {
     }
 
     /**
-     * @param fireTime time to wait in seconds
+     * @param fireTime absolute fire time in milliseconds since the epoch
      */
-    private static void fwkSetFireTime(double fireTime) {
-        getTimer().setFireTime((long)Math.ceil(fireTime * 1000));
-    }
-
-    private static void fwkStopTimer() {
-        getTimer().setFireTime(0);
+    private static void fwkSetFireTime(long fireTime) {
+        getTimer().setFireTime(fireTime);
     }
 
     private static native void twkFireTimerEvent();
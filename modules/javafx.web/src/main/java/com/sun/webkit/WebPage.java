@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,8 +38,11 @@ import com.sun.webkit.event.WCKeyEvent;
 import com.sun.webkit.event.WCMouseEvent;
 import com.sun.webkit.event.WCMouseWheelEvent;
 import com.sun.webkit.graphics.*;
+import com.sun.webkit.network.ContentLoader;
 import com.sun.webkit.network.CookieManager;
 import static com.sun.webkit.network.URLs.newURL;
+import java.io.IOException;
+import java.io.InputStream;
 import java.net.CookieHandler;
 import java.net.MalformedURLException;
 import java.net.URL;
@@ -92,6 +95,9 @@ public final class WebPage {
     // A flag to distinguish whether the web page hasn't been created
     // yet or had been already disposed - in both cases pPage is 0
     private boolean isDisposed = false;
+    private boolean visible = true;
+    // Set in the layout-only mode, see setLayoutOnly
+    private volatile boolean layoutOnly = false;
 
     private int width, height;
 
@@ -133,6 +139,16 @@ public final class WebPage {
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
+    // Whether the page content is painted through retained tile recordings.
+    private static boolean useRetainedPaint;
+
+    // Progressive rendering while a document is parsed: the minimum time
+    // between two layouts, in milliseconds, and the amount of the document,
+    // in KB, that has to arrive before the first paint unless the content
+    // qualifies as visually non-empty earlier. 0 disables either.
+    private static int minLayoutInterval;
+    private static int firstPaintThreshold;
+
     static {
         @SuppressWarnings("removal")
         var dummy = AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
@@ -152,14 +168,63 @@ public final class WebPage {
                     "com.sun.webkit.useJIT", "true"));
             final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useDFGJIT", "false"));
+            // The FTL tier sits on top of the DFG and needs it enabled too.
+            final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useFTLJIT", "false"));
+
+            useRetainedPaint = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.retainedPaint", "false"));
+
+            minLayoutInterval = Integer.getInteger(
+                    "com.sun.webkit.minLayoutInterval", 0);
+            firstPaintThreshold = Integer.getInteger(
+                    "com.sun.webkit.firstPaintThreshold", 0);
+
+            // Total size of the memory cache in MB, encoded and decoded
+            // resources included. 0 sizes the cache after the memory of the
+            // machine and the number of live pages.
+            final int memoryCacheSize = Integer.getInteger(
+                    "com.sun.webkit.memoryCacheSize", 0);
 
             // TODO: Enable CSS3D by default once it is stabilized.
             boolean useCSS3D = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useCSS3D", "false"));
             useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
+            // JavaScript heap tuning, shared by all pages since they run in
+            // one VM. 0 keeps the JavaScriptCore default. The marker thread
+            // count includes the collector thread, the minimum heap size is
+            // in MB and the growth factor is applied after a full collection.
+            final int gcMarkerThreads = Integer.getInteger(
+                    "com.sun.webkit.gcMarkerThreads", 0);
+            final int gcMinHeapSize = Integer.getInteger(
+                    "com.sun.webkit.gcMinHeapSize", 0);
+            double gcHeapGrowthFactor = 0;
+            try {
+                gcHeapGrowthFactor = Double.parseDouble(System.getProperty(
+                        "com.sun.webkit.gcHeapGrowthFactor", "0"));
+            } catch (NumberFormatException ex) {
+                log.warning("Ignoring invalid com.sun.webkit.gcHeapGrowthFactor");
+            }
+            // Without generational collection every collection is a full one.
+            final boolean gcGenerational = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.gcGenerational", "true"));
+            twkSetHeapOptions(gcMarkerThreads,
+                    (int) Math.min((long) gcMinHeapSize * 1024 * 1024, Integer.MAX_VALUE),
+                    gcHeapGrowthFactor, gcGenerational);
+
+            // Amount of script source, in MB, whose compiled code is kept in
+            // the code cache shared by all pages even when it is not used
+            // for a while. Pages loading the same scripts then compile them
+            // once. 0 leaves the cache size to JavaScriptCore.
+            final int codeCacheSize = Integer.getInteger(
+                    "com.sun.webkit.codeCacheSize", 0);
+            twkSetCodeCacheSize(
+                    (int) Math.min((long) codeCacheSize * 1024 * 1024, Integer.MAX_VALUE));
+
             // Initialize WTF, WebCore and JavaScriptCore.
-            twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+            twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useCSS3D,
+                    (int) Math.min((long) memoryCacheSize * 1024 * 1024, Integer.MAX_VALUE));
 
             // Inform the native webkit code when either the JVM or the
             // JavaFX runtime is being shutdown
@@ -218,6 +283,13 @@ public final class WebPage {
         pPage = twkCreatePage(editable);
 
         twkInit(pPage, false, WCGraphicsManager.getGraphicsManager().getDevicePixelScale());
+        if (useRetainedPaint) {
+            twkSetRetainedPaintEnabled(pPage, true);
+        }
+        if (minLayoutInterval > 0 || firstPaintThreshold > 0) {
+            twkSetProgressiveRendering(pPage, minLayoutInterval,
+                    (int) Math.min((long) firstPaintThreshold * 1024, Integer.MAX_VALUE));
+        }
 
         if (pageClient != null && pageClient.isBackBufferSupported()) {
             backbuffer = pageClient.createBackBuffer();
@@ -241,6 +313,14 @@ public final class WebPage {
         return hostWindow;
     }
 
+    // Called from the native code to record a tile in the retained painting mode
+    private WCRenderQueue fwkCreateRetainedRenderQueue(int x, int y, int w, int h) {
+        WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
+                .createRenderQueue(new WCRectangle(x, y, w, h), false);
+        rq.setRetained();
+        return rq;
+    }
+
     /**
      * Returns the access control context associated with this object.
      * May be called on any thread.
@@ -251,6 +331,15 @@ public final class WebPage {
         return accessControlContext;
     }
 
+    /**
+     * Returns the network load timing of this page.
+     * May be called on any thread.
+     * @return the load profile of this page
+     */
+    public LoadProfile getLoadProfile() {
+        return loadProfile;
+    }
+
     static boolean lockPage() {
         return Invoker.getInvoker().lock(PAGE_LOCK);
     }
@@ -310,7 +399,7 @@ public final class WebPage {
                     new Object[] {dirtyRects, currentFrame});
         }
 
-        if (isDisposed || width <= 0 || height <= 0) {
+        if (isDisposed || layoutOnly || width <= 0 || height <= 0) {
             // If there're any dirty rects left, they are invalid.
             // Clear the list so that the platform doesn't consider
             // the page dirty.
@@ -320,9 +409,15 @@ public final class WebPage {
         if (clip == null) {
             clip = new WCRectangle(0, 0, width, height);
         }
+        if (!twkPrePaint(getPage(), true)) {
+            // The page is still loading and not worth a layout yet. Keep
+            // the dirty rects and retry on the next pulse.
+            paintLog.finest("Paint deferred by the progressive rendering policy");
+            Toolkit.getToolkit().requestNextPulse();
+            return;
+        }
         List<WCRectangle> oldDirtyRects = dirtyRects;
         dirtyRects = new LinkedList<>();
-        twkPrePaint(getPage());
         while (!oldDirtyRects.isEmpty()) {
             WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
             if (r.getWidth() <= 0 || r.getHeight() <= 0) {
@@ -514,6 +609,7 @@ public final class WebPage {
     private InputMethodClient imClient;
     private final List<LoadListenerClient> loadListenerClients =
         new LinkedList<>();
+    private final LoadProfile loadProfile = new LoadProfile();
     private final InspectorClient inspectorClient;
     private final RenderTheme renderTheme;
     private final ScrollBarTheme scrollbarTheme;
@@ -681,6 +777,37 @@ public final class WebPage {
         twkUpdateRendering(getPage());
     }
 
+    /**
+     * Switches the page to or from the layout-only mode, meant for pages
+     * that are only used to measure content. In this mode no render queues
+     * are created, nothing is painted or composited, and repaint requests
+     * are dropped; style, layout and rendering updates run as usual, so
+     * geometry queries such as {@link #getBorderBoxes} stay accurate. The
+     * whole page is repainted when the mode is switched off.
+     */
+    public void setLayoutOnly(boolean layoutOnly) {
+        lockPage();
+        try {
+            log.fine("setLayoutOnly: {0}", layoutOnly);
+            if (isDisposed || this.layoutOnly == layoutOnly) {
+                return;
+            }
+            this.layoutOnly = layoutOnly;
+            twkSetLayoutOnly(getPage(), layoutOnly);
+            if (layoutOnly) {
+                dirtyRects.clear();
+            } else {
+                repaintAll();
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
+    public boolean isLayoutOnly() {
+        return layoutOnly;
+    }
+
     public int getUpdateContentCycleID() {
         return updateContentCycleID;
     }
@@ -726,12 +853,43 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Paints the given rectangle of the page into an offscreen image and
+     * returns its pixels, premultiplied BGRA in native byte order, or
+     * {@code null} if nothing could be painted. Unlike {@link #paint} this
+     * bypasses the frame queue and the page back buffer, so it works for
+     * pages that are not shown in a scene and does not wait for a pulse.
+     *
+     * Executed on the Event Thread.
+     */
+    public ByteBuffer paintToPixels(int x, int y, int w, int h) {
+        WCRenderQueue rq;
+        lockPage();
+        try {
+            if (isDisposed || w <= 0 || h <= 0) {
+                return null;
+            }
+            rq = WCGraphicsManager.getGraphicsManager().createRenderQueue(
+                    new WCRectangle(x, y, w, h), true);
+            twkPrePaint(getPage(), false);
+            twkUpdateContent(getPage(), rq, x, y, w, h);
+        } finally {
+            unlockPage();
+        }
+        // The page lock is released first: the render thread takes it to
+        // paint the page while we wait for it to decode the queue.
+        return rq.decodeToPixels();
+    }
+
     /*
      * Executed on the Render Thread.
      */
     public void paint(WCGraphicsContext gc, int x, int y, int w, int h) {
         lockPage();
         try {
+            if (layoutOnly) {
+                return;
+            }
             if (pageClient != null && pageClient.isBackBufferSupported()) {
                 if (!backbuffer.validate(width, height)) {
                     // We need to repaint the whole page on the next turn
@@ -1173,6 +1331,62 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Starts extracting the text of a frame for {@link #extractText}.
+     * The text is taken from the DOM in document order without a layout;
+     * markup whitespace is collapsed, block elements and line breaks
+     * become new lines and script and style contents are left out. A
+     * previous extraction from the same frame is abandoned.
+     *
+     * @param frameID the frame to extract the text of
+     * @param skipInvisible whether to leave out text that is not rendered,
+     *        which costs a style update but still no layout
+     * @return {@code false} if the frame is gone
+     */
+    public boolean beginTextExtraction(long frameID, boolean skipInvisible) {
+        lockPage();
+        try {
+            log.fine("Begin text extraction: frame = " + frameID);
+            if (isDisposed || !frames.contains(frameID)) {
+                return false;
+            }
+            return twkBeginTextExtraction(frameID, skipInvisible);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Writes the next piece of the text of a frame, as UTF-8, into
+     * {@code dst} from its position on and advances the position. Pieces
+     * never split a character, so each one decodes on its own. The walk
+     * is done in steps on the event thread; the DOM may change between
+     * calls, and text removed in between ends the extraction early.
+     *
+     * @param frameID the frame passed to {@link #beginTextExtraction}
+     * @param dst a direct buffer with room for at least four bytes
+     * @return the number of bytes written, or -1 if there is no more text
+     */
+    public int extractText(long frameID, ByteBuffer dst) {
+        if (!dst.isDirect() || dst.remaining() < 4) {
+            throw new IllegalArgumentException(
+                    "a direct buffer with at least 4 bytes remaining is required");
+        }
+        lockPage();
+        try {
+            if (isDisposed || !frames.contains(frameID)) {
+                return -1;
+            }
+            int count = twkExtractText(frameID, dst, dst.position(), dst.remaining());
+            if (count > 0) {
+                dst.position(dst.position() + count);
+            }
+            return count;
+        } finally {
+            unlockPage();
+        }
+    }
+
     // DRT support
     public String getRenderTree(long frameID) {
         lockPage();
@@ -1332,6 +1546,45 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Loads content read from {@code stream} into a frame. Unlike
+     * {@link #load(long, String, String)}, the content is read on a loader
+     * thread and handed to the parser piece by piece, so large documents
+     * do not block the event thread while they are decoded and parsed.
+     * The document gets a URL of its own, with an opaque origin. The
+     * stream is closed once it is read or the load is abandoned.
+     *
+     * @param frameID the frame to load into
+     * @param stream the content
+     * @param contentType the MIME type of the content
+     * @param encoding the character encoding of the content, or
+     *        {@code null} to take it from {@code contentType} or the content
+     */
+    public void load(final long frameID, final InputStream stream,
+                     final String contentType, final String encoding) {
+        lockPage();
+        try {
+            log.fine("Load stream: frame = " + frameID);
+            if (stream == null) {
+                return;
+            }
+            if (isDisposed || !frames.contains(frameID)) {
+                log.fine("load() request for a disposed web page or frame.");
+                try {
+                    stream.close();
+                } catch (IOException ex) {
+                    log.fine("Cannot close content stream", ex);
+                }
+                return;
+            }
+            final String url =
+                    ContentLoader.register(stream, contentType, encoding);
+            open(frameID, url);
+        } finally {
+            unlockPage();
+        }
+    }
+
     public void stop(final long frameID) {
         lockPage();
         try {
@@ -1484,6 +1737,84 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Finds all occurrences of a string in a frame. The text of the frame
+     * is indexed on the first search and kept until its DOM changes, so
+     * incremental searches over a large document are cheap. Matches are
+     * character offsets into that text; pass one to
+     * {@link #selectFindMatch} to select it and scroll it into view.
+     *
+     * @param frameID the frame to search
+     * @param stringToFind the string to find
+     * @param matchCase whether matching is case sensitive
+     * @param maxMatches the maximum number of matches to return
+     * @return the total number of matches, followed by the offset and the
+     *         length of each match returned, or {@code null} if the frame
+     *         is gone
+     */
+    public int[] findAll(long frameID, String stringToFind, boolean matchCase,
+                         int maxMatches)
+    {
+        lockPage();
+        try {
+            log.fine("Find all in frame: stringToFind = " + stringToFind
+                    + (matchCase ? ", matchCase" : ""));
+            if (isDisposed) {
+                log.fine("findAll() request for a disposed web page.");
+                return null;
+            }
+            if (!frames.contains(frameID) || stringToFind == null) {
+                return null;
+            }
+            return twkFindAllInFrame(frameID, stringToFind, matchCase, maxMatches);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Selects a match returned by {@link #findAll} and scrolls it into
+     * view.
+     *
+     * @return {@code false} if the frame changed so that the match is
+     *         no longer where it was found
+     */
+    public boolean selectFindMatch(long frameID, int offset, int length) {
+        lockPage();
+        try {
+            if (isDisposed || !frames.contains(frameID)) {
+                return false;
+            }
+            return twkSelectFindMatch(frameID, offset, length);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns the border boxes of the elements in a frame that match the
+     * given selectors, in document order. Layout is brought up to date once
+     * for the whole batch.
+     *
+     * @param frameID the frame to query
+     * @param selectors a group of CSS selectors
+     * @return x, y, width and height of each matching element in CSS
+     *         pixels relative to the frame's document, {@code NaN} for
+     *         elements that are not rendered; or {@code null} if the frame
+     *         is gone or the selectors are invalid
+     */
+    public float[] getBorderBoxes(long frameID, String selectors) {
+        lockPage();
+        try {
+            if (isDisposed || !frames.contains(frameID) || selectors == null) {
+                return null;
+            }
+            return twkGetBorderBoxes(frameID, selectors);
+        } finally {
+            unlockPage();
+        }
+    }
+
     public void overridePreference(String key, String value) {
         lockPage();
         try {
@@ -1580,6 +1911,31 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Executes a script like {@link #executeScript} but returns a detached
+     * copy of the result instead of live {@code JSObject} peers. The
+     * result graph is serialized once on the native side, so reading it
+     * does not call back into JavaScript. See {@link ScriptSnapshot} for
+     * how values are mapped.
+     */
+    public Object executeScriptSnapshot(long frameID, String script) throws JSException {
+        lockPage();
+        try {
+            log.fine("execute script snapshot: \"" + script + "\" in frame = " + frameID);
+            if (isDisposed) {
+                log.fine("executeScriptSnapshot() request for a disposed web page.");
+                return null;
+            }
+            if ((frameID == 0) || !frames.contains(frameID)) {
+                return null;
+            }
+            return twkExecuteScriptSnapshot(frameID, script);
+
+        } finally {
+            unlockPage();
+        }
+    }
+
     public long getMainFrame() {
         lockPage();
         try {
@@ -1991,6 +2347,165 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Tells the page whether it is currently shown. A hidden page has its
+     * timers throttled and its animations and media suspended.
+     */
+    public void setVisible(boolean visible) {
+        lockPage();
+        try {
+            if (isDisposed || this.visible == visible) {
+                return;
+            }
+            this.visible = visible;
+            twkSetVisible(getPage(), visible);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Asks WebKit to release the memory it can give up, as if the system
+     * had signalled memory pressure. A critical release also drops the
+     * back/forward and memory caches.
+     */
+    public static void releaseMemory(boolean critical) {
+        Invoker.getInvoker().checkEventThread();
+        lockPage();
+        try {
+            twkReleaseMemory(critical);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Runs a full, synchronous collection of the JavaScript heap shared by
+     * all pages.
+     */
+    public static void collectAllGarbage() {
+        Invoker.getInvoker().checkEventThread();
+        lockPage();
+        try {
+            twkDoJSCGarbageCollection();
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Drops the compiled JavaScript code, collects the JavaScript heap and
+     * returns the freed memory to the system. The work is deferred until no
+     * script is running.
+     */
+    public static void shrinkFootprint() {
+        Invoker.getInvoker().checkEventThread();
+        lockPage();
+        try {
+            twkShrinkJSCFootprint();
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Starts sampling the JavaScript stacks of all pages. At an interval
+     * of a few milliseconds the overhead is low enough to leave the
+     * profiler running in production.
+     *
+     * @param intervalMicros the time between two samples
+     * @return {@code false} if this build has no sampling profiler
+     */
+    public static boolean startSamplingProfiler(int intervalMicros) {
+        Invoker.getInvoker().checkEventThread();
+        lockPage();
+        try {
+            return twkStartSamplingProfiler(intervalMicros);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Stops the sampling profiler and returns the samples taken since it
+     * was started, as JSON. Identical stacks are merged into one entry of
+     * {@code stacks} with the number of samples that hit it; the frames of
+     * each stack are listed innermost first, with the tier the code ran in.
+     *
+     * @return the samples, or {@code null} if the profiler was not started
+     */
+    public static String stopSamplingProfiler() {
+        Invoker.getInvoker().checkEventThread();
+        lockPage();
+        try {
+            return twkStopSamplingProfiler();
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Enables or disables the rendering profile of this page. Enabling it
+     * again starts a new profile.
+     *
+     * @param enabled whether WebCore counts the rendering work of the page
+     * @param keepTrace whether the individual phases are kept for
+     *        {@link #getRenderingTrace}, up to a bounded number
+     */
+    public void setRenderingProfileEnabled(boolean enabled, boolean keepTrace) {
+        lockPage();
+        try {
+            log.fine("Setting renderingProfileEnabled, value: [{0}], trace: [{1}]",
+                    enabled, keepTrace);
+            twkSetRenderingProfileEnabled(getPage(), enabled, keepTrace);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns the rendering work counted since the profile was enabled or
+     * last reset.
+     *
+     * @return the rendering profile, or {@code null} if it is not enabled
+     */
+    public RenderingProfile getRenderingProfile() {
+        lockPage();
+        try {
+            double[] values = twkGetRenderingProfile(getPage());
+            return values != null ? new RenderingProfile(values) : null;
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Clears the rendering profile and trace of this page.
+     */
+    public void resetRenderingProfile() {
+        lockPage();
+        try {
+            twkResetRenderingProfile(getPage());
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns the kept rendering phases as JSON in the Trace Event Format,
+     * which Perfetto and {@code chrome://tracing} open directly.
+     *
+     * @return the trace, or {@code null} if the profile is not enabled
+     */
+    public String getRenderingTrace() {
+        lockPage();
+        try {
+            return twkGetRenderingTrace(getPage());
+        } finally {
+            unlockPage();
+        }
+    }
+
     /**
      * Sets the usePageCache settings field.
      * @param usePageCache {@code true} to use the page cache,
@@ -2098,6 +2613,33 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the directory IndexedDB databases are stored in. Only the first
+     * call made before any database is opened takes effect, databases are
+     * kept in memory otherwise.
+     */
+    public void setIndexedDatabasePath(String path) {
+        lockPage();
+        try {
+            twkSetIndexedDatabasePath(getPage(), path);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Sets the directory the bytecode of page scripts is cached in across
+     * launches. Only the first call takes effect.
+     */
+    public void setBytecodeCachePath(String path) {
+        lockPage();
+        try {
+            twkSetBytecodeCachePath(getPage(), path);
+        } finally {
+            unlockPage();
+        }
+    }
+
     public void setLocalStorageEnabled(boolean enabled) {
         lockPage();
         try {
@@ -2167,6 +2709,9 @@ public final class WebPage {
     private void fwkRepaint(int x, int y, int w, int h) {
         lockPage();
         try {
+            if (layoutOnly) {
+                return;
+            }
             if (paintLog.isLoggable(Level.FINEST)) {
                 paintLog.finest("x: {0}, y: {1}, w: {2}, h: {3}",
                         new Object[] {x, y, w, h});
@@ -2181,6 +2726,9 @@ public final class WebPage {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Scroll: " + x + " " + y + " " + w + " " + h + "  " + deltaX + " " + deltaY);
         }
+        if (layoutOnly) {
+            return;
+        }
         if (pageClient == null || !pageClient.isBackBufferSupported()) {
             paintLog.finest("blit scrolling is switched off");
             // TODO: check why we return void, not boolean (see ScrollView::m_canBlitOnScroll)
@@ -2621,7 +3169,9 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkSetHeapOptions(int markerThreads, int minHeapSize, double heapGrowthFactor, boolean generational);
+    private static native void twkSetCodeCacheSize(int reservedSize);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useFTLJIT, boolean useCSS3D, int memoryCacheCapacity);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2634,6 +3184,8 @@ public final class WebPage {
     private native String twkGetURL(long pFrame);
     private native String twkGetInnerText(long pFrame);
     private native String twkGetRenderTree(long pFrame);
+    private native boolean twkBeginTextExtraction(long pFrame, boolean skipInvisible);
+    private native int twkExtractText(long pFrame, ByteBuffer buffer, int position, int length);
     private native String twkGetContentType(long pFrame);
     private native String twkGetTitle(long pFrame);
     private native String twkGetIconURL(long pFrame);
@@ -2658,11 +3210,16 @@ public final class WebPage {
     private native boolean twkFindInFrame(long pFrame,
                                           String stringToFind, boolean forward,
                                           boolean wrap, boolean matchCase);
+    private native int[] twkFindAllInFrame(long pFrame, String stringToFind,
+                                           boolean matchCase, int maxMatches);
+    private native boolean twkSelectFindMatch(long pFrame, int offset, int length);
+    private native float[] twkGetBorderBoxes(long pFrame, String selectors);
 
     private native float twkGetZoomFactor(long pFrame, boolean textOnly);
     private native void twkSetZoomFactor(long pFrame, float zoomFactor, boolean textOnly);
 
     private native Object twkExecuteScript(long pFrame, String script);
+    private native Object twkExecuteScriptSnapshot(long pFrame, String script);
 
     private native void twkReset(long pFrame);
 
@@ -2679,9 +3236,13 @@ public final class WebPage {
     private native void twkSetBackgroundColor(long pFrame, int backgroundColor);
 
     private native void twkSetBounds(long pPage, int x, int y, int w, int h);
-    private native void twkPrePaint(long pPage);
+    private native boolean twkPrePaint(long pPage, boolean allowDefer);
     private native void twkUpdateContent(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
     private native void twkUpdateRendering(long pPage);
+    private native void twkSetLayoutOnly(long pPage, boolean layoutOnly);
+    private native void twkSetRetainedPaintEnabled(long pPage, boolean enabled);
+    private native void twkSetProgressiveRendering(long pPage, int minLayoutInterval,
+                                                   int firstPaintThreshold);
     private native void twkPostPaint(long pPage, WCRenderQueue rq,
                                      int x, int y, int w, int h);
 
@@ -2731,6 +3292,8 @@ public final class WebPage {
 
     private native boolean twkGetUsePageCache(long page);
     private native void twkSetUsePageCache(long page, boolean usePageCache);
+    private native void twkSetVisible(long page, boolean visible);
+    private static native void twkReleaseMemory(boolean critical);
     private native boolean twkGetDeveloperExtrasEnabled(long page);
     private native void twkSetDeveloperExtrasEnabled(long page,
                                                      boolean enabled);
@@ -2743,6 +3306,8 @@ public final class WebPage {
     private native void twkSetUserAgent(long page, String userAgent);
     private native void twkSetLocalStorageDatabasePath(long page, String path);
     private native void twkSetLocalStorageEnabled(long page, boolean enabled);
+    private native void twkSetIndexedDatabasePath(long page, String path);
+    private native void twkSetBytecodeCachePath(long page, String path);
 
     private native int twkGetUnloadEventListenersCount(long pFrame);
 
@@ -2751,4 +3316,11 @@ public final class WebPage {
     private native void twkDispatchInspectorMessageFromFrontend(long pPage,
                                                                 String message);
     private static native void twkDoJSCGarbageCollection();
+    private static native void twkShrinkJSCFootprint();
+    private static native boolean twkStartSamplingProfiler(int intervalMicros);
+    private static native String twkStopSamplingProfiler();
+    private native void twkSetRenderingProfileEnabled(long pPage, boolean enabled, boolean keepTrace);
+    private native double[] twkGetRenderingProfile(long pPage);
+    private native void twkResetRenderingProfile(long pPage);
+    private native String twkGetRenderingTrace(long pPage);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,18 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    @Native public final static int FILLRECT_LIST_FFFF     = 57;
+    @Native public final static int FILLRECT_LIST_FFFFI    = 58;
+    @Native public final static int REPLAYRQ               = 59;
+    @Native public final static int DRAWIMAGE_FILTERED     = 60;
+    @Native public final static int UPDATE_PIXEL_BUFFER    = 61;
+    @Native public final static int DRAWIMAGE_LIST         = 62;
+    @Native public final static int DRAWGLYPHS             = 63;
+
+    // Filter operation types carried by DRAWIMAGE_FILTERED
+    @Native public final static int FILTER_BLUR            = 0;
+    @Native public final static int FILTER_DROP_SHADOW     = 1;
+    @Native public final static int FILTER_OPACITY         = 2;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
@@ -98,7 +110,8 @@ public final class GraphicsDecoder  {
             return;
         }
 
-        ByteBuffer buf = bdata.getBuffer();
+        // A retained queue is decoded several times, so its buffer is not consumed.
+        ByteBuffer buf = bdata.getBuffer().duplicate();
         buf.order(ByteOrder.nativeOrder());
         while (buf.remaining() > 0) {
             int op = buf.getInt();
@@ -119,6 +132,17 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         getColor(buf));
                     break;
+                case FILLRECT_LIST_FFFF: {
+                    int n = buf.getInt();
+                    gc.fillRects(getFloats(buf, 4 * n), n, null);
+                    break;
+                }
+                case FILLRECT_LIST_FFFFI: {
+                    int n = buf.getInt();
+                    Color color = getColor(buf);
+                    gc.fillRects(getFloats(buf, 4 * n), n, color);
+                    break;
+                }
                 case FILL_ROUNDED_RECT:
                     gc.fillRoundedRect(
                         // base rectangle
@@ -201,6 +225,12 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         buf.getFloat());
                     break;
+                case DRAWIMAGE_LIST: {
+                    Object imgFrame = gm.getRef(buf.getInt());
+                    int n = buf.getInt();
+                    drawImages(gc, imgFrame, getFloats(buf, 8 * n), n);
+                    break;
+                }
                 case DRAWICON:
                     gc.drawIcon((WCIcon)gm.getRef(buf.getInt()),
                         buf.getInt(),
@@ -227,8 +257,10 @@ public final class GraphicsDecoder  {
                     gc.restoreState();
                     break;
                 case CLIP_PATH:
+                    // The clip takes over and modifies the path, and native
+                    // code may refer to the same path from later commands.
                     gc.setClip(
-                        getPath(gm, buf),
+                        gm.createWCPath(getPath(gm, buf)),
                         buf.getInt()>0);
                     break;
                 case SETCLIP_IIII:
@@ -310,6 +342,15 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         buf.getFloat());
                     break;
+                case DRAWGLYPHS: {
+                    WCFont font = (WCFont) gm.getRef(buf.getInt());
+                    int n = buf.getInt();
+                    float x = buf.getFloat();
+                    float y = buf.getFloat();
+                    int[] glyphs = getInts(buf, n);
+                    gc.drawString(font, glyphs, getFloats(buf, n), x, y);
+                    break;
+                }
                 case DRAWWIDGET:
                     gc.drawWidget((RenderTheme)(gm.getRef(buf.getInt())),
                         gm.getRef(buf.getInt()), buf.getInt(), buf.getInt());
@@ -353,6 +394,30 @@ public final class GraphicsDecoder  {
                     WCRenderQueue _rq = (WCRenderQueue)gm.getRef(buf.getInt());
                     _rq.decode(gc.getFontSmoothingType());
                     break;
+                case REPLAYRQ:
+                    ((WCRenderQueue)gm.getRef(buf.getInt())).replay(gc);
+                    break;
+                case DRAWIMAGE_FILTERED: {
+                    Object imgFrame = gm.getRef(buf.getInt());
+                    WCRectangle dst = getRectangle(buf);
+                    int[] types = new int[buf.getInt()];
+                    for (int i = 0; i < types.length; i++) {
+                        types[i] = buf.getInt();
+                    }
+                    float[] params = getFloatArray(buf);
+                    WCImage img = WCImage.getImage(imgFrame);
+                    if (img != null) {
+                        gc.drawFilteredImage(img,
+                            dst.getX(), dst.getY(), dst.getWidth(), dst.getHeight(),
+                            types, params);
+                    }
+                    break;
+                }
+                case UPDATE_PIXEL_BUFFER: {
+                    WCImage img = (WCImage)gm.getRef(buf.getInt());
+                    img.drawPixelBuffer(buf.getInt(), buf.getInt(), buf.getInt(), buf.getInt());
+                    break;
+                }
                 case ROTATE:
                     gc.rotate(buf.getFloat());
                     break;
@@ -448,6 +513,36 @@ public final class GraphicsDecoder  {
         }
     }
 
+    private static void drawImages(
+            WCGraphicsContext gc,
+            Object imgFrame,
+            float[] rects, int count)
+    {
+        WCImage img = WCImage.getImage(imgFrame);
+        if (img != null) {
+            // See drawImage() above.
+            try {
+                gc.drawImages(img, rects, count);
+            } catch (OutOfMemoryError error) {
+                error.printStackTrace();
+            }
+        }
+    }
+
+    private static int[] getInts(ByteBuffer buf, int length) {
+        int[] a = new int[length];
+        buf.asIntBuffer().get(a);
+        buf.position(buf.position() + 4 * length);
+        return a;
+    }
+
+    private static float[] getFloats(ByteBuffer buf, int length) {
+        float[] a = new float[length];
+        buf.asFloatBuffer().get(a);
+        buf.position(buf.position() + 4 * length);
+        return a;
+    }
+
     private static boolean getBoolean(ByteBuffer buf) {
         return 0 != buf.getInt();
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,6 +51,12 @@ public class Ref {
         }
     }
 
+    // Called from native code to take a reference and learn the id in one call.
+    private int fwkRef() {
+        ref();
+        return id;
+    }
+
     public boolean hasRefs() {
         return count > 0;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -253,7 +253,7 @@ final class RenderMediaControls {
             WCImageDecoder decoder =
                     WCGraphicsManager.getGraphicsManager().getImageDecoder();
             decoder.loadFromResource(resName);
-            WCImageFrame frame = decoder.getFrame(0);
+            WCImageFrame frame = decoder.getFrame(0, 0);
             if (frame != null) {
                 image = frame.getFrame();
                 controlImages.put(resName, image);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,13 @@ public abstract class WCGraphicsContext {
     public static final int COMPOSITE_PLUS_LIGHTER        = 13;
 
     public abstract void fillRect(float x, float y, float w, float h, Color color);
+
+    /**
+     * Fills {@code count} rectangles stored as {x, y, w, h} in {@code rects}
+     * with the same paint, as consecutive {@link #fillRect} calls would.
+     */
+    public abstract void fillRects(float[] rects, int count, Color color);
+
     public abstract void clearRect(float x, float y, float w, float h);
     public abstract void setFillColor(Color color);
     public abstract void setFillGradient(WCGradient gradient);
@@ -77,6 +84,22 @@ public abstract class WCGraphicsContext {
                           float dstx, float dsty, float dstw, float dsth,
                           float srcx, float srcy, float srcw, float srch);
 
+    /**
+     * Draws {@code count} parts of {@code img} stored as
+     * {dstx, dsty, dstw, dsth, srcx, srcy, srcw, srch} in {@code rects},
+     * as consecutive {@link #drawImage} calls would.
+     */
+    public abstract void drawImages(WCImage img, float[] rects, int count);
+
+    /**
+     * Draws {@code img} with a chain of CSS filter operations applied.
+     * {@code types} holds {@code GraphicsDecoder.FILTER_*} values and
+     * {@code params} their arguments, in order.
+     */
+    public abstract void drawFilteredImage(WCImage img,
+                          float dstx, float dsty, float dstw, float dsth,
+                          int[] types, float[] params);
+
     public abstract void drawIcon(WCIcon icon, int x, int y);
 
     public abstract void drawPattern(WCImage texture, WCRectangle srcRect,
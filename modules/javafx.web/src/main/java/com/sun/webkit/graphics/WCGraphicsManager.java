@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -90,6 +90,12 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCPath createWCPath(WCPath path);
 
+    private WCPath createWCPath(int[] commands, double[] coords) {
+        WCPath path = createWCPath();
+        path.addSegments(commands, coords);
+        return path;
+    }
+
     protected abstract WCImage createWCImage(int w, int h);
 
     protected abstract WCImage createRTImage(int w, int h);
@@ -163,5 +169,15 @@ public abstract class WCGraphicsManager {
         return refMap.get(id);
     }
 
+    // Native references are released in batches, see RQRef.cpp.
+    private void fwkDerefAll(int[] ids) {
+        for (int id : ids) {
+            Ref ref = getRef(id);
+            if (ref != null) {
+                ref.deref();
+            }
+        }
+    }
+
     private static native void append(long bufPtr, byte[] data, int count);
 }
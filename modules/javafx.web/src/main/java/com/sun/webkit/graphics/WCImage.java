@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,7 +52,10 @@ public abstract class WCImage extends Ref {
 
     public ByteBuffer getPixelBuffer() {return null;}
 
-    protected void drawPixelBuffer() {}
+    /**
+     * Uploads the given rectangle of the pixel buffer to the image.
+     */
+    protected void drawPixelBuffer(int x, int y, int width, int height) {}
 
     public synchronized void setRQ(WCRenderQueue rq) {
         this.rq = rq;
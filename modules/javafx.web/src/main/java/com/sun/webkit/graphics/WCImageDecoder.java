@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
 
 public abstract class WCImageDecoder {
 
@@ -32,9 +33,12 @@ public abstract class WCImageDecoder {
      * Receives a portion of image data.
      *
      * @param data  a portion of image data,
-     *              or {@code null} if all data received
+     *              or {@code null} if all data received.
+     *              The buffer wraps native memory in place and is only
+     *              valid for the duration of the call.
+     * @param totalSize  the size of all the data received so far
      */
-    protected abstract void addImageData(byte[] data);
+    protected abstract void addImageData(ByteBuffer data, int totalSize);
 
     /**
      * Returns image size.
@@ -51,8 +55,10 @@ public abstract class WCImageDecoder {
     /**
      * Returns image frame at the specified index.
      * @param index frame index
+     * @param subsamplingLevel number of times both image dimensions
+     *                         are halved, rounding up
      */
-    protected abstract WCImageFrame getFrame(int index);
+    protected abstract WCImageFrame getFrame(int index, int subsamplingLevel);
 
     /**
      * Returns frame duration in ms
@@ -77,6 +83,11 @@ public abstract class WCImageDecoder {
 
     protected abstract void destroy();
 
+    /**
+     * Releases decoded frames that can be decoded again from the image data.
+     */
+    protected abstract void destroyDecodedData();
+
     protected abstract String getFilenameExtension();
 
 }
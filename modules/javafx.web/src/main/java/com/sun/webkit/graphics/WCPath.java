@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,6 +53,74 @@ public abstract class WCPath<P> extends Ref {
      */
     @Native public static final int RULE_EVENODD = 1;
 
+    /*
+     * Segment commands of a path recorded natively, see [addSegments].
+     * Each is followed by its arguments in the coordinate array.
+     */
+    @Native public static final int SEG_MOVETO = 0;    // x, y
+    @Native public static final int SEG_LINETO = 1;    // x, y
+    @Native public static final int SEG_QUADTO = 2;    // x0, y0, x1, y1
+    @Native public static final int SEG_CUBICTO = 3;   // x0, y0, x1, y1, x2, y2
+    @Native public static final int SEG_ARCTO = 4;     // x1, y1, x2, y2, r
+    @Native public static final int SEG_ARC = 5;       // x, y, r, startAngle, endAngle, aclockwise
+    @Native public static final int SEG_ELLIPSE = 6;   // x, y, w, h
+    @Native public static final int SEG_RECT = 7;      // x, y, w, h
+    @Native public static final int SEG_CLOSE = 8;
+    @Native public static final int SEG_TRANSFORM = 9; // mxx, myx, mxy, myy, mxt, myt
+
+    /**
+     * Appends the segments built by native code in one go, in place of
+     * one call per segment.
+     */
+    public void addSegments(int[] commands, double[] c) {
+        int i = 0;
+        for (int command : commands) {
+            switch (command) {
+                case SEG_MOVETO:
+                    moveTo(c[i], c[i + 1]);
+                    i += 2;
+                    break;
+                case SEG_LINETO:
+                    addLineTo(c[i], c[i + 1]);
+                    i += 2;
+                    break;
+                case SEG_QUADTO:
+                    addQuadCurveTo(c[i], c[i + 1], c[i + 2], c[i + 3]);
+                    i += 4;
+                    break;
+                case SEG_CUBICTO:
+                    addBezierCurveTo(c[i], c[i + 1], c[i + 2], c[i + 3], c[i + 4], c[i + 5]);
+                    i += 6;
+                    break;
+                case SEG_ARCTO:
+                    addArcTo(c[i], c[i + 1], c[i + 2], c[i + 3], c[i + 4]);
+                    i += 5;
+                    break;
+                case SEG_ARC:
+                    addArc(c[i], c[i + 1], c[i + 2], c[i + 3], c[i + 4], c[i + 5] != 0);
+                    i += 6;
+                    break;
+                case SEG_ELLIPSE:
+                    addEllipse(c[i], c[i + 1], c[i + 2], c[i + 3]);
+                    i += 4;
+                    break;
+                case SEG_RECT:
+                    addRect(c[i], c[i + 1], c[i + 2], c[i + 3]);
+                    i += 4;
+                    break;
+                case SEG_CLOSE:
+                    closeSubpath();
+                    break;
+                case SEG_TRANSFORM:
+                    transform(c[i], c[i + 1], c[i + 2], c[i + 3], c[i + 4], c[i + 5]);
+                    i += 6;
+                    break;
+                default:
+                    throw new IllegalArgumentException("Unknown segment: " + command);
+            }
+        }
+    }
+
     public abstract void addRect(double x, double y, double w, double h);
 
     public abstract void addEllipse(double x, double y, double w, double h);
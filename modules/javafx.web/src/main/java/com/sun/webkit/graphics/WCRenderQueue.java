@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,18 @@ public abstract class WCRenderQueue extends Ref {
     private final WCRectangle clip;
     private int size = 0;
     private final boolean opaque;
+    private boolean retained;
+
+    // Rasterized contents of a retained queue, composited by replay().
+    private WCImage rasterImage;
+    private boolean rasterFailed;
+
+    // Bounds the render targets held by rasterized retained queues.
+    private final static int MAX_RASTER_IMAGES = 192;
+    private final static AtomicInteger rasterImageCount = new AtomicInteger(0);
+
+    // javafx.scene.text.FontSmoothingType.LCD.ordinal()
+    private final static int FONT_SMOOTHING_LCD = 1;
 
     // Associated graphics context (currently used to draw to a buffered image).
     protected final WCGraphicsContext gc;
@@ -73,7 +85,7 @@ public abstract class WCRenderQueue extends Ref {
         currentBuffer.setBuffer(buffer);
         buffers.addLast(currentBuffer);
         currentBuffer = new BufferData();
-        size += buffer.capacity();
+        size += buffer.remaining();
         if (size > MAX_QUEUE_SIZE && gc!=null) {
             // It is isolated queue over the canvas image [image-gc!=null].
             // We need to flush the changes periodically
@@ -121,13 +133,150 @@ public abstract class WCRenderQueue extends Ref {
         decode();
     }
 
+    /**
+     * Marks this queue as retained: it is replayed by reference from other
+     * queues (see {@link GraphicsDecoder#REPLAYRQ}) and keeps its buffers once
+     * decoded. The buffers, and the image the queue is rasterized into, are
+     * released when the last reference is dropped.
+     */
+    public synchronized void setRetained() {
+        retained = true;
+    }
+
+    public synchronized void replay(WCGraphicsContext gc) {
+        if (gc == null || !gc.isValid()) {
+            log.fine("WCRenderQueue::replay : GC is " + (gc == null ? "null" : " invalid"));
+            return;
+        }
+
+        // A retained queue does not change once recorded, so it is rasterized
+        // the first time it is replayed and only composited afterwards.
+        if (canReplayRaster(gc)) {
+            if (rasterImage == null) {
+                rasterize(gc.getFontSmoothingType());
+            }
+            if (rasterImage != null) {
+                gc.drawImage(rasterImage,
+                        clip.getX(), clip.getY(), clip.getWidth(), clip.getHeight(),
+                        0, 0, clip.getWidth(), clip.getHeight());
+                return;
+            }
+        }
+        decodeBuffers(gc);
+    }
+
+    private boolean canReplayRaster(WCGraphicsContext gc) {
+        if (!retained || rasterFailed || clip == null
+                || clip.getIntWidth() <= 0 || clip.getIntHeight() <= 0) {
+            return false;
+        }
+        // LCD text needs an opaque destination, which a tile image is not.
+        if (gc.getFontSmoothingType() == FONT_SMOOTHING_LCD) {
+            return false;
+        }
+        // Only an integer translation keeps the rasterized pixels exact.
+        double[] m = gc.getTransform().getMatrix();
+        return m[0] == 1 && m[1] == 0 && m[2] == 0 && m[3] == 1
+                && m[4] == Math.rint(m[4]) && m[5] == Math.rint(m[5]);
+    }
+
+    private void rasterize(int fontSmoothingType) {
+        if (rasterImageCount.incrementAndGet() > MAX_RASTER_IMAGES) {
+            rasterImageCount.decrementAndGet();
+            return;
+        }
+        WCGraphicsManager gm = WCGraphicsManager.getGraphicsManager();
+        WCImage image = gm.createRTImage(clip.getIntWidth(), clip.getIntHeight());
+        WCGraphicsContext rgc = gm.createBufferedContextRQ(image).gc;
+        image.ref();
+        if (!rgc.isValid()) {
+            rasterFailed = true;
+            image.deref();
+            rasterImageCount.decrementAndGet();
+            return;
+        }
+        rgc.setFontSmoothingType(fontSmoothingType);
+        rgc.translate(-clip.getX(), -clip.getY());
+        decodeBuffers(rgc);
+        rgc.flush();
+        rasterImage = image;
+    }
+
+    private void disposeRaster() {
+        if (rasterImage != null) {
+            rasterImage.deref();
+            rasterImage = null;
+            rasterImageCount.decrementAndGet();
+        }
+    }
+
+    /**
+     * Decodes this queue into a new image the size of its clip and returns
+     * the pixels of the image, premultiplied BGRA in native byte order, or
+     * {@code null} if the image could not be painted. The queue is disposed.
+     * Blocks until decoding has completed on the render thread, so the
+     * caller must not hold locks the render thread may wait for.
+     */
+    public ByteBuffer decodeToPixels() {
+        if (clip == null || clip.getIntWidth() <= 0 || clip.getIntHeight() <= 0) {
+            dispose();
+            return null;
+        }
+        WCGraphicsManager gm = WCGraphicsManager.getGraphicsManager();
+        WCImage image = gm.createRTImage(clip.getIntWidth(), clip.getIntHeight());
+        image.ref();
+        try {
+            boolean[] painted = new boolean[1];
+            runOnRenderThread(() -> {
+                WCGraphicsContext rgc = gm.createBufferedContextRQ(image).gc;
+                if (rgc.isValid()) {
+                    rgc.translate(-clip.getX(), -clip.getY());
+                    decodeBuffers(rgc);
+                    rgc.flush();
+                    painted[0] = true;
+                }
+            });
+            return painted[0] ? image.getPixelBuffer() : null;
+        } finally {
+            image.deref();
+            dispose();
+        }
+    }
+
+    private void decodeBuffers(WCGraphicsContext gc) {
+        for (BufferData bdata : buffers) {
+            try {
+                GraphicsDecoder.decode(
+                    WCGraphicsManager.getGraphicsManager(), gc, bdata);
+            } catch (RuntimeException e) {
+                e.printStackTrace(System.err);
+            }
+        }
+    }
+
+    @Override public synchronized void deref() {
+        super.deref();
+        if (retained && !hasRefs()) {
+            disposeRaster();
+            dispose();
+        }
+    }
+
     protected abstract void flush();
 
+    /**
+     * Runs {@code r} on the render thread and waits for it to complete.
+     */
+    protected abstract void runOnRenderThread(Runnable r);
+
     private void fwkFlush() {
         flush();
     }
 
-    private void fwkAddBuffer(ByteBuffer buffer) {
+    private void fwkAddBuffer(ByteBuffer buffer, int length) {
+        // Native buffers are pooled and reused once released by [twkRelease],
+        // so the same direct buffer may come back here with a different length.
+        buffer.clear().limit(length);
         addBuffer(buffer);
     }
 
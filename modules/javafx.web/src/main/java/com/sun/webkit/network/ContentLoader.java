@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.webkit.Invoker;
+import com.sun.webkit.LoadListenerClient;
+import com.sun.webkit.WebPage;
+import java.io.InputStream;
+import java.nio.ByteBuffer;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * A runnable that feeds content supplied by the application as a stream
+ * to WebCore, as if it was the body of a response. The stream is read on
+ * a loader thread and passed on in buffer sized pieces, so that decoding
+ * and parsing of large content is spread over many event thread turns
+ * instead of blocking the event thread at once.
+ */
+public final class ContentLoader extends URLLoaderBase implements Runnable {
+
+    private static final PlatformLogger logger =
+            PlatformLogger.getLogger(ContentLoader.class.getName());
+
+    /**
+     * The scheme of the URLs content streams are loaded from.
+     */
+    private static final String SCHEME = "jfxcontent:";
+
+    private static final int MAX_BUF_COUNT = 3;
+
+    private static final AtomicLong idCounter = new AtomicLong();
+    private static final Map<String, Content> contents =
+            new ConcurrentHashMap<>();
+
+    private record Content(InputStream stream,
+                           String contentType,
+                           String encoding) {}
+
+    private final WebPage webPage;
+    private final ByteBufferPool byteBufferPool;
+    private final boolean asynchronous;
+    private final String url;
+    private final Content content;
+    private final long data;
+    private volatile boolean canceled = false;
+
+
+    private ContentLoader(WebPage webPage,
+                          ByteBufferPool byteBufferPool,
+                          boolean asynchronous,
+                          String url,
+                          Content content,
+                          long data)
+    {
+        this.webPage = webPage;
+        this.byteBufferPool = byteBufferPool;
+        this.asynchronous = asynchronous;
+        this.url = url;
+        this.content = content;
+        this.data = data;
+    }
+
+    /**
+     * Registers a content stream and returns the URL to load it from.
+     * The stream can be loaded once; it is closed when the load ends.
+     */
+    public static String register(InputStream stream,
+                           String contentType,
+                           String encoding)
+    {
+        String url = SCHEME + idCounter.incrementAndGet();
+        contents.put(url, new Content(stream, contentType, encoding));
+        return url;
+    }
+
+    /**
+     * Checks whether {@code url} names a registered content stream.
+     */
+    static boolean isContentURL(String url) {
+        return url != null && url.startsWith(SCHEME)
+                && contents.containsKey(url);
+    }
+
+    /**
+     * Creates a loader for the content stream registered under
+     * {@code url}, or returns {@code null} if there is none.
+     */
+    static ContentLoader create(WebPage webPage,
+                                ByteBufferPool byteBufferPool,
+                                boolean asynchronous,
+                                String url,
+                                long data)
+    {
+        Content content = contents.remove(url);
+        if (content == null) {
+            return null;
+        }
+        return new ContentLoader(webPage, byteBufferPool, asynchronous,
+                url, content, data);
+    }
+
+
+    /**
+     * Cancels this loader.
+     */
+    @Override
+    public void fwkCancel() {
+        if (logger.isLoggable(Level.FINEST)) {
+            logger.finest(String.format("data: [0x%016X]", data));
+        }
+        canceled = true;
+    }
+
+    /**
+     * {@inheritDoc}
+     */
+    @Override
+    public void run() {
+        ByteBufferAllocator allocator =
+                byteBufferPool.newAllocator(MAX_BUF_COUNT);
+        ByteBuffer byteBuffer = null;
+        try (InputStream stream = content.stream()) {
+            markTiming(TIMING_RESPONSE_START);
+            didReceiveResponse();
+            byte[] buffer = null;
+            while (!canceled) {
+                byteBuffer = allocator.allocate();
+                int length = byteBuffer.remaining();
+                if (buffer == null) {
+                    buffer = new byte[length];
+                }
+                // Pass on full buffers only, each one is decoded and
+                // parsed in a turn of its own on the event thread
+                int count = stream.readNBytes(buffer, 0, length);
+                if (count > 0) {
+                    byteBuffer.put(buffer, 0, count);
+                    byteBuffer.flip();
+                    didReceiveData(byteBuffer, allocator);
+                    byteBuffer = null;
+                }
+                if (count < length) {
+                    break;
+                }
+            }
+            if (!canceled) {
+                didFinishLoading();
+            }
+        } catch (Throwable th) {
+            logger.finest("Load error", th);
+            didFail(LoadListenerClient.UNKNOWN_ERROR, th.getMessage());
+        } finally {
+            if (byteBuffer != null) {
+                allocator.release(byteBuffer);
+            }
+        }
+    }
+
+    private void didReceiveResponse() {
+        final long[] timing = getTiming();
+        callBack(() -> {
+            if (!canceled) {
+                twkDidReceiveResponse(
+                        200,
+                        content.contentType(),
+                        content.encoding(),
+                        -1,
+                        "",
+                        url,
+                        timing,
+                        data);
+            }
+        });
+    }
+
+    private void didReceiveData(final ByteBuffer byteBuffer,
+                                final ByteBufferAllocator allocator)
+    {
+        final long postTime = System.nanoTime();
+        callBack(() -> {
+            if (!canceled) {
+                didDeliverData(postTime, byteBuffer.remaining());
+                twkDidReceiveData(
+                        byteBuffer,
+                        byteBuffer.position(),
+                        byteBuffer.remaining(),
+                        data);
+            }
+            allocator.release(byteBuffer);
+        });
+    }
+
+    private void didFinishLoading() {
+        markTiming(TIMING_RESPONSE_END);
+        final long[] timing = getTiming();
+        callBack(() -> {
+            if (!canceled) {
+                addToLoadProfile(webPage, false);
+                twkDidFinishLoading(timing, data);
+            }
+        });
+    }
+
+    private void didFail(final int errorCode, final String message) {
+        callBack(() -> {
+            if (!canceled) {
+                addToLoadProfile(webPage, true);
+                twkDidFail(errorCode, url, message, data);
+            }
+        });
+    }
+
+    private void callBack(Runnable runnable) {
+        if (asynchronous) {
+            Invoker.getInvoker().invokeOnEventThread(runnable);
+        } else {
+            runnable.run();
+        }
+    }
+}
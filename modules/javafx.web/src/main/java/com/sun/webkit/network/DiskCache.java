@@ -0,0 +1,814 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.FilterInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.HttpURLConnection;
+import java.net.URL;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.StandardCopyOption;
+import java.security.AccessController;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.security.PrivilegedAction;
+import java.text.ParseException;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.zip.DeflaterOutputStream;
+import java.util.zip.InflaterInputStream;
+
+/**
+ * A persistent cache of HTTP GET responses used by {@link URLLoader}.
+ * The cache is off unless the {@code com.sun.webkit.diskCacheDir} system
+ * property names a directory to keep it in.
+ * <p>
+ * Each entry is a pair of files named after a hash of its URL: one with
+ * the response status and headers, which is rewritten when the entry is
+ * revalidated, and one with the body, deflated unless the server already
+ * sent it compressed. Entries are evicted least recently used first once
+ * the cache grows past {@code com.sun.webkit.diskCacheSize} megabytes.
+ */
+final class DiskCache {
+
+    private static final PlatformLogger logger =
+            PlatformLogger.getLogger(DiskCache.class.getName());
+
+    private static final int MAGIC = 0x4A574443;
+    private static final int VERSION = 1;
+    private static final String HEADERS_SUFFIX = ".h";
+    private static final String DATA_SUFFIX = ".d";
+    private static final String TEMP_SUFFIX = ".tmp";
+    private static final int DEFAULT_SIZE = 64; // MB
+    // Upper bound for the heuristic freshness of responses that only
+    // carry Last-Modified
+    private static final long MAX_HEURISTIC_LIFETIME = 7L * 24 * 3600 * 1000;
+
+    private static final DiskCache instance;
+    static {
+        @SuppressWarnings("removal")
+        DiskCache tmp = AccessController.doPrivileged((PrivilegedAction<DiskCache>) () -> {
+            String dir = System.getProperty("com.sun.webkit.diskCacheDir");
+            if (dir == null || dir.isEmpty()) {
+                return null;
+            }
+            int size = Integer.getInteger("com.sun.webkit.diskCacheSize", DEFAULT_SIZE);
+            File file = new File(dir);
+            if (size <= 0 || !(file.isDirectory() || file.mkdirs())) {
+                logger.warning("Disk cache disabled, cannot use {0}", dir);
+                return null;
+            }
+            return new DiskCache(file, size * 1024L * 1024L);
+        });
+        instance = tmp;
+    }
+
+    /**
+     * What a request allows the cache to do, as determined by its headers.
+     */
+    enum Policy {
+        /** Neither use nor update the cache */
+        BYPASS,
+        /** Use cached entries only after revalidating them */
+        REVALIDATE,
+        /** Use fresh entries as they are */
+        NORMAL
+    }
+
+    private final File dir;
+    private final long maxSize;
+    private final long maxEntrySize;
+    private final AtomicInteger tempCounter = new AtomicInteger();
+
+    // Key to size on disk, least recently used first
+    private final LinkedHashMap<String, Long> index =
+            new LinkedHashMap<>(64, 0.75f, true);
+    private long size;
+    private boolean indexLoaded;
+
+
+    private DiskCache(File dir, long maxSize) {
+        this.dir = dir;
+        this.maxSize = maxSize;
+        this.maxEntrySize = maxSize / 8;
+    }
+
+    /**
+     * Returns the cache, or {@code null} if it is disabled.
+     */
+    static DiskCache getInstance() {
+        return instance;
+    }
+
+    /**
+     * Determines how a request with the given headers may use the cache.
+     * The headers are in the "Name: value\n" form passed to the loaders.
+     */
+    static Policy requestPolicy(String headers) {
+        if (headers == null || headers.isEmpty()) {
+            return Policy.NORMAL;
+        }
+        Policy policy = Policy.NORMAL;
+        for (String h : headers.split("\n")) {
+            int i = h.indexOf(':');
+            if (i <= 0) {
+                continue;
+            }
+            String name = h.substring(0, i).trim().toLowerCase(Locale.ROOT);
+            String value = h.substring(i + 1).trim().toLowerCase(Locale.ROOT);
+            switch (name) {
+                case "authorization":
+                case "range":
+                // WebCore is revalidating its own copy, let the server answer
+                case "if-none-match":
+                case "if-modified-since":
+                    return Policy.BYPASS;
+                case "cache-control":
+                    if (value.contains("no-store")) {
+                        return Policy.BYPASS;
+                    }
+                    if (value.contains("no-cache") || value.contains("max-age=0")) {
+                        policy = Policy.REVALIDATE;
+                    }
+                    break;
+                case "pragma":
+                    if (value.contains("no-cache")) {
+                        policy = Policy.REVALIDATE;
+                    }
+                    break;
+            }
+        }
+        return policy;
+    }
+
+    /**
+     * Returns the entry stored for a URL, or {@code null} if there is none.
+     */
+    Entry lookup(String url) {
+        String key = key(url);
+        synchronized (this) {
+            loadIndex();
+            if (index.get(key) == null) {
+                return null;
+            }
+        }
+        File headersFile = new File(dir, key + HEADERS_SUFFIX);
+        try (DataInputStream in = new DataInputStream(new BufferedInputStream(
+                new FileInputStream(headersFile))))
+        {
+            Entry entry = Entry.read(key, in);
+            if (url.equals(entry.url)) {
+                return entry;
+            }
+        } catch (IOException ex) {
+            logger.finest("Cannot read cache entry", ex);
+            remove(key);
+        }
+        return null;
+    }
+
+    /**
+     * Returns a connection that replays the body of an entry with its
+     * stored headers, or {@code null} if the body is gone.
+     */
+    HttpURLConnection open(Entry entry, URL url) {
+        File dataFile = new File(dir, entry.key + DATA_SUFFIX);
+        if (!dataFile.isFile()) {
+            remove(entry.key);
+            return null;
+        }
+        return new CachedURLConnection(url, entry, dataFile);
+    }
+
+    /**
+     * Refreshes an entry with the headers of a 304 response to its
+     * revalidation and returns a connection replaying it, or {@code null}
+     * if the entry cannot be used anymore.
+     */
+    HttpURLConnection update(Entry entry, long requestTime,
+                             HttpURLConnection c)
+    {
+        List<String[]> updated = new ArrayList<>(entry.headers);
+        List<String[]> received = responseHeaders(c);
+        // Stored headers are replaced by the ones the 304 carries
+        for (String[] h : received) {
+            if (h[0] != null) {
+                updated.removeIf(s -> h[0].equalsIgnoreCase(s[0]));
+            }
+        }
+        for (String[] h : received) {
+            if (h[0] != null) {
+                updated.add(h);
+            }
+        }
+        Entry refreshed = new Entry(entry.key, entry.url, entry.status,
+                entry.message, updated, requestTime,
+                System.currentTimeMillis(), entry.compressed);
+        try {
+            File temp = tempFile(entry.key);
+            writeHeaders(refreshed, temp);
+            synchronized (this) {
+                if (index.get(entry.key) == null) {
+                    Files.deleteIfExists(temp.toPath());
+                    return null;
+                }
+                move(temp, new File(dir, entry.key + HEADERS_SUFFIX));
+            }
+        } catch (IOException ex) {
+            logger.finest("Cannot update cache entry", ex);
+        }
+        return open(refreshed, c.getURL());
+    }
+
+    /**
+     * Returns a writer storing the body of a response as it is read, or
+     * {@code null} if the response should not be cached.
+     */
+    Writer newWriter(String url, long requestTime, HttpURLConnection c)
+        throws IOException
+    {
+        if (c.getResponseCode() != HttpURLConnection.HTTP_OK) {
+            return null;
+        }
+        String cacheControl = c.getHeaderField("cache-control");
+        if (cacheControl != null
+                && cacheControl.toLowerCase(Locale.ROOT).contains("no-store"))
+        {
+            return null;
+        }
+        String vary = c.getHeaderField("vary");
+        if (vary != null) {
+            // Only the Accept-Encoding we send is fixed
+            for (String token : vary.split(",")) {
+                if (!token.trim().equalsIgnoreCase("accept-encoding")) {
+                    return null;
+                }
+            }
+        }
+        long contentLength = c.getContentLengthLong();
+        if (contentLength > maxEntrySize) {
+            return null;
+        }
+        String encoding = c.getContentEncoding();
+        boolean compress = (encoding == null || encoding.equalsIgnoreCase("identity"))
+                && isCompressible(c.getContentType());
+        List<String[]> headers = responseHeaders(c);
+        headers.removeIf(h -> h[0] != null
+                && (h[0].equalsIgnoreCase("set-cookie")
+                        || h[0].equalsIgnoreCase("set-cookie2")));
+        String key = key(url);
+        Entry entry = new Entry(key, url, c.getResponseCode(),
+                c.getResponseMessage(), headers, requestTime,
+                System.currentTimeMillis(), compress);
+        if (entry.freshnessLifetime() <= 0 && !entry.hasValidator()) {
+            // Could never be used without a full reload
+            return null;
+        }
+        return new Writer(entry, contentLength, tempFile(key));
+    }
+
+    private void remove(String key) {
+        synchronized (this) {
+            Long entrySize = index.remove(key);
+            if (entrySize != null) {
+                size -= entrySize;
+            }
+            new File(dir, key + HEADERS_SUFFIX).delete();
+            new File(dir, key + DATA_SUFFIX).delete();
+        }
+    }
+
+    private void commit(Entry entry, File dataTemp) throws IOException {
+        File headersTemp = tempFile(entry.key);
+        try {
+            writeHeaders(entry, headersTemp);
+            long entrySize = dataTemp.length() + headersTemp.length();
+            synchronized (this) {
+                loadIndex();
+                move(dataTemp, new File(dir, entry.key + DATA_SUFFIX));
+                move(headersTemp, new File(dir, entry.key + HEADERS_SUFFIX));
+                Long previous = index.put(entry.key, entrySize);
+                size += entrySize - (previous != null ? previous : 0);
+                evict();
+            }
+        } finally {
+            Files.deleteIfExists(headersTemp.toPath());
+        }
+    }
+
+    private void evict() {
+        Iterator<Map.Entry<String, Long>> it = index.entrySet().iterator();
+        while (size > maxSize && it.hasNext()) {
+            Map.Entry<String, Long> e = it.next();
+            it.remove();
+            size -= e.getValue();
+            new File(dir, e.getKey() + HEADERS_SUFFIX).delete();
+            new File(dir, e.getKey() + DATA_SUFFIX).delete();
+        }
+    }
+
+    /**
+     * Builds the index from the directory contents, oldest files first,
+     * and drops what previous sessions left half written.
+     */
+    private void loadIndex() {
+        if (indexLoaded) {
+            return;
+        }
+        indexLoaded = true;
+        File[] files = dir.listFiles();
+        if (files == null) {
+            return;
+        }
+        Map<String, Long> sizes = new HashMap<>();
+        Map<String, Long> times = new HashMap<>();
+        for (File f : files) {
+            String name = f.getName();
+            if (name.endsWith(TEMP_SUFFIX)) {
+                f.delete();
+            } else if (name.endsWith(HEADERS_SUFFIX) || name.endsWith(DATA_SUFFIX)) {
+                String key = name.substring(0, name.lastIndexOf('.'));
+                sizes.merge(key, f.length(), Long::sum);
+                if (name.endsWith(DATA_SUFFIX)) {
+                    times.put(key, f.lastModified());
+                }
+            }
+        }
+        List<String> keys = new ArrayList<>(times.keySet());
+        keys.sort((a, b) -> Long.compare(times.get(a), times.get(b)));
+        for (String key : keys) {
+            long entrySize = sizes.get(key);
+            index.put(key, entrySize);
+            size += entrySize;
+        }
+        for (String key : sizes.keySet()) {
+            if (!times.containsKey(key)) {
+                new File(dir, key + HEADERS_SUFFIX).delete();
+            }
+        }
+        evict();
+    }
+
+    private File tempFile(String key) {
+        return new File(dir, key + "." + tempCounter.incrementAndGet() + TEMP_SUFFIX);
+    }
+
+    private static void move(File from, File to) throws IOException {
+        Files.move(from.toPath(), to.toPath(),
+                StandardCopyOption.REPLACE_EXISTING,
+                StandardCopyOption.ATOMIC_MOVE);
+    }
+
+    private static void writeHeaders(Entry entry, File file) throws IOException {
+        try (DataOutputStream out = new DataOutputStream(new BufferedOutputStream(
+                new FileOutputStream(file))))
+        {
+            entry.write(out);
+        }
+    }
+
+    private static List<String[]> responseHeaders(HttpURLConnection c) {
+        List<String[]> headers = new ArrayList<>();
+        for (Map.Entry<String, List<String>> e : c.getHeaderFields().entrySet()) {
+            for (String value : e.getValue()) {
+                headers.add(new String[] {e.getKey(), value});
+            }
+        }
+        return headers;
+    }
+
+    private static boolean isCompressible(String contentType) {
+        if (contentType == null) {
+            return false;
+        }
+        String type = contentType.toLowerCase(Locale.ROOT);
+        return type.startsWith("text/")
+                || type.contains("javascript")
+                || type.contains("json")
+                || type.contains("xml");
+    }
+
+    private static String key(String url) {
+        try {
+            MessageDigest md = MessageDigest.getInstance("SHA-256");
+            byte[] digest = md.digest(url.getBytes(StandardCharsets.UTF_8));
+            StringBuilder sb = new StringBuilder(40);
+            // 20 bytes are plenty to tell URLs apart
+            for (int i = 0; i < 20; i++) {
+                sb.append(Character.forDigit((digest[i] >> 4) & 0xF, 16));
+                sb.append(Character.forDigit(digest[i] & 0xF, 16));
+            }
+            return sb.toString();
+        } catch (NoSuchAlgorithmException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    /**
+     * A stored response.
+     */
+    static final class Entry {
+        private final String key;
+        private final String url;
+        private final int status;
+        private final String message;
+        // Name and value pairs, the status line has a null name
+        private final List<String[]> headers;
+        private final long requestTime;
+        private final long responseTime;
+        private final boolean compressed;
+
+        private Entry(String key, String url, int status, String message,
+                      List<String[]> headers, long requestTime,
+                      long responseTime, boolean compressed)
+        {
+            this.key = key;
+            this.url = url;
+            this.status = status;
+            this.message = message;
+            this.headers = headers;
+            this.requestTime = requestTime;
+            this.responseTime = responseTime;
+            this.compressed = compressed;
+        }
+
+        /**
+         * Returns whether the entry can be used without revalidation.
+         */
+        boolean isFresh() {
+            return freshnessLifetime() > currentAge(System.currentTimeMillis());
+        }
+
+        boolean hasValidator() {
+            return header("etag") != null || header("last-modified") != null;
+        }
+
+        /**
+         * Adds the headers revalidating this entry to a request.
+         */
+        void addValidators(HttpURLConnection c) {
+            String etag = header("etag");
+            if (etag != null) {
+                c.setRequestProperty("If-None-Match", etag);
+            }
+            String lastModified = header("last-modified");
+            if (lastModified != null) {
+                c.setRequestProperty("If-Modified-Since", lastModified);
+            }
+        }
+
+        private long freshnessLifetime() {
+            String cacheControl = header("cache-control");
+            if (cacheControl != null) {
+                for (String directive : cacheControl.toLowerCase(Locale.ROOT).split(",")) {
+                    directive = directive.trim();
+                    if (directive.equals("no-cache") || directive.equals("must-revalidate")) {
+                        return 0;
+                    }
+                    if (directive.startsWith("max-age=")) {
+                        try {
+                            return Long.parseLong(directive.substring(8).trim()) * 1000;
+                        } catch (NumberFormatException ex) {
+                            return 0;
+                        }
+                    }
+                }
+            }
+            long date = date("date", responseTime);
+            String expires = header("expires");
+            if (expires != null) {
+                return date("expires", 0) - date;
+            }
+            long lastModified = date("last-modified", -1);
+            if (lastModified >= 0 && lastModified < date) {
+                return Math.min((date - lastModified) / 10, MAX_HEURISTIC_LIFETIME);
+            }
+            return 0;
+        }
+
+        // RFC 9111, section 4.2.3
+        private long currentAge(long now) {
+            long apparentAge = Math.max(0, responseTime - date("date", responseTime));
+            long ageValue = 0;
+            String age = header("age");
+            if (age != null) {
+                try {
+                    ageValue = Long.parseLong(age.trim()) * 1000;
+                } catch (NumberFormatException ignore) {}
+            }
+            long correctedInitialAge = Math.max(apparentAge,
+                    ageValue + (responseTime - requestTime));
+            return correctedInitialAge + (now - responseTime);
+        }
+
+        private long date(String name, long defaultValue) {
+            String value = header(name);
+            if (value == null) {
+                return defaultValue;
+            }
+            try {
+                return DateParser.parse(value);
+            } catch (ParseException ex) {
+                return defaultValue;
+            }
+        }
+
+        private String header(String name) {
+            String value = null;
+            for (String[] h : headers) {
+                if (name.equalsIgnoreCase(h[0])) {
+                    value = h[1];
+                }
+            }
+            return value;
+        }
+
+        private void write(DataOutputStream out) throws IOException {
+            out.writeInt(MAGIC);
+            out.writeInt(VERSION);
+            out.writeUTF(url);
+            out.writeInt(status);
+            out.writeUTF(message != null ? message : "");
+            out.writeLong(requestTime);
+            out.writeLong(responseTime);
+            out.writeBoolean(compressed);
+            out.writeInt(headers.size());
+            for (String[] h : headers) {
+                out.writeBoolean(h[0] != null);
+                if (h[0] != null) {
+                    out.writeUTF(h[0]);
+                }
+                out.writeUTF(h[1] != null ? h[1] : "");
+            }
+        }
+
+        private static Entry read(String key, DataInputStream in)
+            throws IOException
+        {
+            if (in.readInt() != MAGIC || in.readInt() != VERSION) {
+                throw new IOException("Unknown cache entry format");
+            }
+            String url = in.readUTF();
+            int status = in.readInt();
+            String message = in.readUTF();
+            long requestTime = in.readLong();
+            long responseTime = in.readLong();
+            boolean compressed = in.readBoolean();
+            int count = in.readInt();
+            List<String[]> headers = new ArrayList<>(count);
+            for (int i = 0; i < count; i++) {
+                String name = in.readBoolean() ? in.readUTF() : null;
+                headers.add(new String[] {name, in.readUTF()});
+            }
+            return new Entry(key, url, status, message, headers,
+                    requestTime, responseTime, compressed);
+        }
+    }
+
+    /**
+     * Copies a response body into the cache while it is being delivered.
+     * The entry is only stored if {@link #commit} is called after the
+     * whole body has been read.
+     */
+    final class Writer {
+        private final Entry entry;
+        private final long contentLength;
+        private final File temp;
+        private OutputStream out;
+        private long written;
+        private boolean failed;
+
+        private Writer(Entry entry, long contentLength, File temp)
+            throws IOException
+        {
+            this.entry = entry;
+            this.contentLength = contentLength;
+            this.temp = temp;
+            OutputStream os = new BufferedOutputStream(new FileOutputStream(temp));
+            this.out = entry.compressed ? new DeflaterOutputStream(os) : os;
+        }
+
+        /**
+         * Returns a stream that reads through {@code in} and keeps a copy
+         * of everything read.
+         */
+        InputStream wrap(InputStream in) {
+            return new FilterInputStream(in) {
+                @Override
+                public int read() throws IOException {
+                    int b = super.read();
+                    if (b >= 0) {
+                        write(new byte[] {(byte) b}, 0, 1);
+                    }
+                    return b;
+                }
+
+                @Override
+                public int read(byte[] b, int off, int len) throws IOException {
+                    int n = super.read(b, off, len);
+                    if (n > 0) {
+                        write(b, off, n);
+                    }
+                    return n;
+                }
+
+                @Override
+                public long skip(long n) throws IOException {
+                    // Skipped data would leave a hole in the entry
+                    failed = true;
+                    return super.skip(n);
+                }
+            };
+        }
+
+        private void write(byte[] b, int off, int len) {
+            if (failed) {
+                return;
+            }
+            written += len;
+            if (written > maxEntrySize) {
+                failed = true;
+                return;
+            }
+            try {
+                out.write(b, off, len);
+            } catch (IOException ex) {
+                logger.finest("Cannot write cache entry", ex);
+                failed = true;
+            }
+        }
+
+        /**
+         * Stores the entry, provided the body was read in full.
+         */
+        void commit() {
+            try {
+                closeOutput();
+                if (!failed && (contentLength < 0 || written == contentLength)) {
+                    DiskCache.this.commit(entry, temp);
+                    if (logger.isLoggable(Level.FINEST)) {
+                        logger.finest(String.format("Cached [%s], %d bytes",
+                                entry.url, written));
+                    }
+                }
+            } catch (IOException ex) {
+                logger.finest("Cannot store cache entry", ex);
+            } finally {
+                abort();
+            }
+        }
+
+        /**
+         * Discards whatever was written so far.
+         */
+        void abort() {
+            try {
+                closeOutput();
+                Files.deleteIfExists(temp.toPath());
+            } catch (IOException ignore) {}
+        }
+
+        private void closeOutput() throws IOException {
+            if (out != null) {
+                OutputStream os = out;
+                out = null;
+                os.close();
+            }
+        }
+    }
+
+    /**
+     * Replays a stored response as if it came from the network.
+     */
+    private static final class CachedURLConnection extends HttpURLConnection {
+        private final Entry entry;
+        private final File dataFile;
+        private final Map<String, List<String>> headerFields;
+        private InputStream inputStream;
+
+        private CachedURLConnection(URL url, Entry entry, File dataFile) {
+            super(url);
+            this.entry = entry;
+            this.dataFile = dataFile;
+            Map<String, List<String>> fields = new LinkedHashMap<>();
+            for (String[] h : entry.headers) {
+                fields.computeIfAbsent(h[0], k -> new ArrayList<>()).add(h[1]);
+            }
+            for (Map.Entry<String, List<String>> e : fields.entrySet()) {
+                e.setValue(Collections.unmodifiableList(e.getValue()));
+            }
+            this.headerFields = Collections.unmodifiableMap(fields);
+            this.responseCode = entry.status;
+            this.responseMessage = entry.message;
+        }
+
+        @Override
+        public void connect() {
+            connected = true;
+        }
+
+        @Override
+        public void disconnect() {
+            if (inputStream != null) {
+                try {
+                    inputStream.close();
+                } catch (IOException ignore) {}
+            }
+        }
+
+        @Override
+        public boolean usingProxy() {
+            return false;
+        }
+
+        @Override
+        public int getResponseCode() {
+            return entry.status;
+        }
+
+        @Override
+        public String getResponseMessage() {
+            return entry.message;
+        }
+
+        @Override
+        public String getHeaderField(String name) {
+            return name != null ? entry.header(name) : getHeaderField(0);
+        }
+
+        @Override
+        public String getHeaderFieldKey(int n) {
+            return n >= 0 && n < entry.headers.size()
+                    ? entry.headers.get(n)[0] : null;
+        }
+
+        @Override
+        public String getHeaderField(int n) {
+            return n >= 0 && n < entry.headers.size()
+                    ? entry.headers.get(n)[1] : null;
+        }
+
+        @Override
+        public Map<String, List<String>> getHeaderFields() {
+            return headerFields;
+        }
+
+        @Override
+        public InputStream getErrorStream() {
+            return null;
+        }
+
+        @Override
+        public synchronized InputStream getInputStream() throws IOException {
+            if (inputStream == null) {
+                InputStream in = new FileInputStream(dataFile);
+                inputStream = entry.compressed
+                        ? new InflaterInputStream(new BufferedInputStream(in, 8192))
+                        : new BufferedInputStream(in, 8192);
+            }
+            return inputStream;
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -55,6 +55,7 @@ import java.security.AccessControlException;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.time.Duration;
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.List;
 import java.util.Locale;
@@ -89,6 +90,13 @@ final class HTTP2Loader extends URLLoaderBase {
     private volatile boolean canceled = false;
 
     private final CompletableFuture<Void> response;
+
+    // Body data received on the HttpClient threads and not yet passed to
+    // WebCore. A single event thread callback delivers everything gathered
+    // until it runs, in buffer-sized JNI calls.
+    private final List<ByteBuffer> pendingData = new ArrayList<>();
+    // When the oldest pendingData was queued
+    private long pendingPostTime;
     // Use singleton instance of HttpClient to get the maximum benefits
     @SuppressWarnings("removal")
     private final static HttpClient HTTP_CLIENT =
@@ -392,6 +400,7 @@ final class HTTP2Loader extends URLLoaderBase {
                                .build();
 
         final BodyHandler<Void> bodyHandler = rsp -> {
+            markTiming(TIMING_RESPONSE_START);
             if(!handleRedirectionIfNeeded(rsp)) {
                 didReceiveResponse(rsp);
             }
@@ -400,6 +409,7 @@ final class HTTP2Loader extends URLLoaderBase {
 
         // Run the HttpClient in the page's access control context
         @SuppressWarnings("removal")
+        markTiming(TIMING_REQUEST_START);
         var tmpResponse = AccessController.doPrivileged((PrivilegedAction<CompletableFuture<Void>>) () -> {
             return HTTP_CLIENT.sendAsync(request, bodyHandler)
                               .thenAccept($ -> {})
@@ -498,6 +508,7 @@ final class HTTP2Loader extends URLLoaderBase {
     }
 
     private void didReceiveResponse(final HttpResponse.ResponseInfo rsp) {
+        final long[] timing = getTiming();
         callBackIfNotCanceled(() -> {
             twkDidReceiveResponse(
                     rsp.statusCode(),
@@ -506,6 +517,7 @@ final class HTTP2Loader extends URLLoaderBase {
                     getContentLength(rsp),
                     getHeadersAsString(rsp),
                     this.url,
+                    timing,
                     data);
         });
     }
@@ -520,22 +532,59 @@ final class HTTP2Loader extends URLLoaderBase {
         return dbb.clear();
     }
 
-    private ByteBuffer copyToDirectBuffer(final ByteBuffer bb) {
-        return getDirectBuffer(bb.limit()).put(bb).flip();
-    }
-
     // another variant to use from createZIPEncodedBodySubscriber
     private void didReceiveData(final byte[] bytes, int size) {
-        callBackIfNotCanceled(() -> {
-            notifyDidReceiveData(getDirectBuffer(size).put(bytes, 0, size).flip());
-        });
+        didReceiveData(List.of(ByteBuffer.wrap(bytes, 0, size)));
     }
 
     private void didReceiveData(final List<ByteBuffer> bytes) {
-        callBackIfNotCanceled(() -> bytes.stream()
-                                          .map(this::copyToDirectBuffer)
-                                          .forEach(this::notifyDidReceiveData)
-        );
+        final boolean schedule;
+        synchronized (pendingData) {
+            schedule = pendingData.isEmpty();
+            if (schedule) {
+                pendingPostTime = System.nanoTime();
+            }
+            pendingData.addAll(bytes);
+        }
+        // Calls posted later, didFinishLoading included, run after this one
+        // has drained everything received so far.
+        if (schedule) {
+            callBackIfNotCanceled(this::deliverPendingData);
+        }
+    }
+
+    private void deliverPendingData() {
+        final List<ByteBuffer> bytes;
+        final long postTime;
+        synchronized (pendingData) {
+            bytes = new ArrayList<>(pendingData);
+            pendingData.clear();
+            postTime = pendingPostTime;
+        }
+        int length = 0;
+        for (ByteBuffer bb : bytes) {
+            length += bb.remaining();
+        }
+        didDeliverData(postTime, length);
+        ByteBuffer dbb = getDirectBuffer(0);
+        for (ByteBuffer bb : bytes) {
+            while (bb.hasRemaining()) {
+                if (!dbb.hasRemaining()) {
+                    notifyDidReceiveData(dbb.flip());
+                    if (canceled) {
+                        return;
+                    }
+                    dbb.clear();
+                }
+                final int n = Math.min(bb.remaining(), dbb.remaining());
+                dbb.put(dbb.position(), bb, bb.position(), n);
+                dbb.position(dbb.position() + n);
+                bb.position(bb.position() + n);
+            }
+        }
+        if (dbb.position() > 0) {
+            notifyDidReceiveData(dbb.flip());
+        }
     }
 
     private void notifyDidReceiveData(ByteBuffer byteBuffer) {
@@ -555,15 +604,18 @@ final class HTTP2Loader extends URLLoaderBase {
     }
 
     private void didFinishLoading() {
-        callBackIfNotCanceled(this::notifyDidFinishLoading);
+        markTiming(TIMING_RESPONSE_END);
+        final long[] timing = getTiming();
+        callBackIfNotCanceled(() -> notifyDidFinishLoading(timing));
     }
 
-    private void notifyDidFinishLoading() {
+    private void notifyDidFinishLoading(long[] timing) {
         Invoker.getInvoker().checkEventThread();
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format("data: [0x%016X]", data));
         }
-        twkDidFinishLoading(data);
+        addToLoadProfile(webPage, false);
+        twkDidFinishLoading(timing, data);
     }
 
 
@@ -595,6 +647,7 @@ final class HTTP2Loader extends URLLoaderBase {
             } catch (Throwable ex) {
                 errorCode = LoadListenerClient.UNKNOWN_ERROR;
             }
+            addToLoadProfile(webPage, true);
             notifyDidFail(errorCode, url, th.getMessage());
         });
         return null;
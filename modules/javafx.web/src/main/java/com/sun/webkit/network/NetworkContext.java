@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,18 +27,26 @@ package com.sun.webkit.network;
 
 import static com.sun.webkit.network.URLs.newURL;
 
+import java.net.InetAddress;
 import java.net.MalformedURLException;
+import java.net.Proxy;
+import java.net.ProxySelector;
+import java.net.URI;
+import java.net.UnknownHostException;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.Arrays;
-import java.util.concurrent.LinkedBlockingQueue;
+import java.util.List;
+import java.util.concurrent.PriorityBlockingQueue;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.webkit.Invoker;
 import com.sun.webkit.WebPage;
 import java.security.Permission;
 
@@ -74,7 +82,14 @@ final class NetworkContext {
     private static final int BYTE_BUFFER_SIZE = 1024 * 40;
 
     /**
-     * The thread pool used to execute asynchronous loaders.
+     * Load priorities, these should match the native ResourceLoadPriority.
+     */
+    private static final int PRIORITY_VERY_LOW = 0;
+    private static final int PRIORITY_VERY_HIGH = 4;
+
+    /**
+     * The thread pool used to execute asynchronous loaders. Once all
+     * threads are busy, queued loads are started in priority order.
      */
     private static final ThreadPoolExecutor threadPool;
 
@@ -88,7 +103,7 @@ final class NetworkContext {
                 THREAD_POOL_SIZE,
                 THREAD_POOL_KEEP_ALIVE_TIME,
                 TimeUnit.MILLISECONDS,
-                new LinkedBlockingQueue<Runnable>(),
+                new PriorityBlockingQueue<Runnable>(),
                 new URLLoaderThreadFactory());
         threadPool.allowCoreThreadTimeOut(true);
 
@@ -126,6 +141,9 @@ final class NetworkContext {
      *         otherwise.
      */
     private static boolean canHandleURL(String url) {
+        if (ContentLoader.isContentURL(url)) {
+            return true;
+        }
         java.net.URL u = null;
         try {
             u = newURL(url);
@@ -143,6 +161,7 @@ final class NetworkContext {
                                      String method,
                                      String headers,
                                      FormDataElement[] formDataElements,
+                                     int priority,
                                      long data)
     {
         if (logger.isLoggable(Level.FINEST)) {
@@ -152,6 +171,7 @@ final class NetworkContext {
                     "url: [%s], " +
                     "method: [%s], " +
                     "formDataElements: %s, " +
+                    "priority: [%d], " +
                     "data: [0x%016X], " +
                     "headers:%n%s",
                     webPage,
@@ -160,11 +180,33 @@ final class NetworkContext {
                     method,
                     formDataElements != null
                             ? Arrays.asList(formDataElements) : "[null]",
+                    priority,
                     data,
                     Util.formatHeaders(headers)));
         }
 
-        if (useHTTP2Loader) {
+        if (ContentLoader.isContentURL(url)) {
+            final ContentLoader loader = ContentLoader.create(
+                webPage,
+                byteBufferPool,
+                asynchronous,
+                url,
+                data);
+            if (loader != null) {
+                if (!asynchronous) {
+                    loader.run();
+                    return null;
+                }
+                threadPool.execute(new PrioritizedTask(priority, loader));
+                return loader;
+            }
+        }
+
+        // The disk cache sits in URLLoader, so GET requests go there
+        // while it is enabled
+        boolean useDiskCache = DiskCache.getInstance() != null
+                && "GET".equals(method) && formDataElements == null;
+        if (useHTTP2Loader && !useDiskCache) {
             final URLLoaderBase loader = HTTP2Loader.create(
                 webPage,
                 byteBufferPool,
@@ -189,7 +231,7 @@ final class NetworkContext {
                 formDataElements,
                 data);
         if (asynchronous) {
-            threadPool.submit(loader);
+            threadPool.execute(new PrioritizedTask(priority, loader));
             if (logger.isLoggable(Level.FINEST)) {
                 logger.finest(
                         "active count: [{0}], " +
@@ -228,6 +270,79 @@ final class NetworkContext {
         return propValue >= 0 ? propValue : DEFAULT_HTTP_MAX_CONNECTIONS;
     }
 
+    /**
+     * Resolves the given host name on a loader thread, so that the
+     * resolver cache of {@link InetAddress} is warm by the time the host is
+     * connected to. WebCore limits the number of prefetches in flight; each
+     * one is reported back as done on the event thread.
+     */
+    private static void fwkPrefetchDNS(String hostname) {
+        threadPool.execute(new PrioritizedTask(PRIORITY_VERY_LOW, () -> {
+            try {
+                InetAddress.getAllByName(hostname);
+            } catch (UnknownHostException | SecurityException ex) {
+                logger.finest("Cannot prefetch " + hostname, ex);
+            } finally {
+                Invoker.getInvoker().postOnEventThread(NetworkContext::twkDidPrefetchDNS);
+            }
+        }));
+    }
+
+    /**
+     * Returns whether HTTP connections go through a proxy. Host names
+     * are not worth resolving locally in that case.
+     */
+    @SuppressWarnings("removal")
+    private static boolean fwkIsUsingProxy() {
+        return AccessController.doPrivileged((PrivilegedAction<Boolean>) () -> {
+            ProxySelector selector = ProxySelector.getDefault();
+            if (selector == null) {
+                return false;
+            }
+            try {
+                List<Proxy> proxies = selector.select(URI.create("http://www.example.com/"));
+                return proxies.stream().anyMatch(p -> p.type() != Proxy.Type.DIRECT);
+            } catch (IllegalArgumentException ex) {
+                return true;
+            }
+        });
+    }
+
+    private static native void twkDidPrefetchDNS();
+
+    /**
+     * A task of the loader thread pool. Tasks with a higher priority are
+     * taken from the queue first, tasks of equal priority in the order
+     * they were submitted.
+     */
+    private static final class PrioritizedTask
+            implements Runnable, Comparable<PrioritizedTask> {
+        private static final AtomicLong sequenceCounter = new AtomicLong();
+
+        private final int priority;
+        private final long sequence = sequenceCounter.getAndIncrement();
+        private final Runnable task;
+
+        private PrioritizedTask(int priority, Runnable task) {
+            this.priority = Math.max(PRIORITY_VERY_LOW,
+                    Math.min(priority, PRIORITY_VERY_HIGH));
+            this.task = task;
+        }
+
+        @Override
+        public void run() {
+            task.run();
+        }
+
+        @Override
+        public int compareTo(PrioritizedTask other) {
+            if (priority != other.priority) {
+                return Integer.compare(other.priority, priority);
+            }
+            return Long.compare(sequence, other.sequence);
+        }
+    }
+
     /**
      * Thread factory for URL loader threads.
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import com.sun.webkit.Invoker;
 import com.sun.webkit.WebPage;
 import java.io.IOException;
 import java.io.InputStream;
+import java.io.OutputStream;
 import static java.lang.String.format;
 import java.net.ConnectException;
 import java.net.InetSocketAddress;
@@ -43,6 +44,7 @@ import java.net.SocketException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.UnknownHostException;
+import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.List;
@@ -67,6 +69,9 @@ final class SocketStreamHandle {
             new SynchronousQueue<Runnable>(),
             new CustomThreadFactory());
 
+    private static final int READ_BUFFER_SIZE = 8192;
+    private static final int RECEIVE_BUFFER_SIZE = 64 * 1024;
+
     private enum State {ACTIVE, CLOSE_REQUESTED, DISPOSED}
 
     private final String host;
@@ -78,6 +83,16 @@ final class SocketStreamHandle {
     private volatile State state = State.ACTIVE;
     private volatile boolean connected;
 
+    // Received data is accumulated by the socket thread into receiveBuffer
+    // and handed to the native code in one call per event thread round
+    // trip. The two direct buffers are swapped under receiveLock.
+    private final Object receiveLock = new Object();
+    private ByteBuffer receiveBuffer;
+    private ByteBuffer deliverBuffer;
+
+    // Accessed on the event thread only
+    private byte[] sendBuffer;
+
     private SocketStreamHandle(String host, int port, boolean ssl,
                                WebPage webPage, long data)
     {
@@ -130,8 +145,12 @@ final class SocketStreamHandle {
             logger.finest("{0} connected", this);
             didOpen();
             InputStream is = socket.getInputStream();
+            byte[] buffer = new byte[READ_BUFFER_SIZE];
+            synchronized (receiveLock) {
+                receiveBuffer = ByteBuffer.allocateDirect(RECEIVE_BUFFER_SIZE);
+                deliverBuffer = ByteBuffer.allocateDirect(RECEIVE_BUFFER_SIZE);
+            }
             while (true) {
-                byte[] buffer = new byte[8192];
                 int n = is.read(buffer);
                 if(n > 0) {
                     if (logger.isLoggable(Level.FINEST)) {
@@ -175,6 +194,9 @@ final class SocketStreamHandle {
         } catch (SecurityException ex) {
             error = ex;
             errorDescription = "Security error";
+        } catch (InterruptedException ex) {
+            error = ex;
+            errorDescription = "Interrupted";
         } catch (Throwable th) {
             error = th;
         }
@@ -286,15 +308,23 @@ final class SocketStreamHandle {
         }
     }
 
-    private int fwkSend(byte[] buffer) {
+    private int fwkSend(ByteBuffer buffer) {
+        final int len = buffer.remaining();
         if (logger.isLoggable(Level.FINEST)) {
-            logger.finest(format("%s sending len: [%d], data:%s",
-                    this, buffer.length, dump(buffer, buffer.length)));
+            logger.finest(format("%s sending len: [%d]", this, len));
         }
         if (connected) {
             try {
-                socket.getOutputStream().write(buffer);
-                return buffer.length;
+                if (sendBuffer == null) {
+                    sendBuffer = new byte[READ_BUFFER_SIZE];
+                }
+                OutputStream os = socket.getOutputStream();
+                while (buffer.hasRemaining()) {
+                    int n = Math.min(buffer.remaining(), sendBuffer.length);
+                    buffer.get(sendBuffer, 0, n);
+                    os.write(sendBuffer, 0, n);
+                }
+                return len;
             } catch (IOException ex) {
                 logger.finest(format("%s exception", this), ex);
                 didFail(0, "I/O error");
@@ -311,6 +341,7 @@ final class SocketStreamHandle {
         synchronized (this) {
             logger.finest("{0}", this);
             state = State.CLOSE_REQUESTED;
+            wakeUpReceiver();
             try {
                 if (socket != null) {
                     socket.close();
@@ -322,6 +353,13 @@ final class SocketStreamHandle {
     private void fwkNotifyDisposed() {
         logger.finest("{0}", this);
         state = State.DISPOSED;
+        wakeUpReceiver();
+    }
+
+    private void wakeUpReceiver() {
+        synchronized (receiveLock) {
+            receiveLock.notifyAll();
+        }
     }
 
     private void didOpen() {
@@ -332,12 +370,46 @@ final class SocketStreamHandle {
         });
     }
 
-    private void didReceiveData(final byte[] buffer, final int len) {
-        Invoker.getInvoker().postOnEventThread(() -> {
-            if (state == State.ACTIVE) {
-                notifyDidReceiveData(buffer, len);
+    private void didReceiveData(byte[] buffer, int len)
+        throws InterruptedException
+    {
+        final boolean schedule;
+        synchronized (receiveLock) {
+            // Block the reader while the event thread is behind by
+            // a full buffer instead of queueing without bound
+            while (state == State.ACTIVE
+                    && receiveBuffer.remaining() < len)
+            {
+                receiveLock.wait();
             }
-        });
+            if (state != State.ACTIVE) {
+                return;
+            }
+            schedule = receiveBuffer.position() == 0;
+            receiveBuffer.put(buffer, 0, len);
+        }
+        // Anything read before the delivery below gets to run is sent
+        // along with it
+        if (schedule) {
+            Invoker.getInvoker().postOnEventThread(this::deliverReceivedData);
+        }
+    }
+
+    private void deliverReceivedData() {
+        final ByteBuffer bb;
+        synchronized (receiveLock) {
+            bb = receiveBuffer;
+            receiveBuffer = deliverBuffer;
+            deliverBuffer = bb;
+            receiveLock.notifyAll();
+        }
+        // The next delivery cannot run until this one returns, so bb
+        // is not touched by the reader until then
+        bb.flip();
+        if (state == State.ACTIVE && bb.hasRemaining()) {
+            notifyDidReceiveData(bb, bb.remaining());
+        }
+        bb.clear();
     }
 
     private void didFail(final int errorCode, final String errorDescription) {
@@ -361,10 +433,9 @@ final class SocketStreamHandle {
         twkDidOpen(data);
     }
 
-    private void notifyDidReceiveData(byte[] buffer, int len) {
+    private void notifyDidReceiveData(ByteBuffer buffer, int len) {
         if (logger.isLoggable(Level.FINEST)) {
-            logger.finest(format("%s, len: [%d], data:%s",
-                    this, len, dump(buffer, len)));
+            logger.finest(format("%s, len: [%d]", this, len));
         }
         twkDidReceiveData(buffer, len, data);
     }
@@ -384,7 +455,7 @@ final class SocketStreamHandle {
     }
 
     private static native void twkDidOpen(long data);
-    private static native void twkDidReceiveData(byte[] buffer, int len,
+    private static native void twkDidReceiveData(ByteBuffer buffer, int len,
                                                  long data);
     private static native void twkDidFail(int errorCode,
                                           String errorDescription, long data);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,6 +69,8 @@ final class URLLoader extends URLLoaderBase implements Runnable {
     private static final PlatformLogger logger =
             PlatformLogger.getLogger(URLLoader.class.getName());
     private static final int MAX_BUF_COUNT = 3;
+    // Longest time received data is held back to fill a buffer.
+    private static final long MAX_DELIVERY_DELAY = 4_000_000L; // ns
     private static final String GET = "GET";
     private static final String HEAD = "HEAD";
     private static final String DELETE = "DELETE";
@@ -83,6 +85,12 @@ final class URLLoader extends URLLoaderBase implements Runnable {
     private FormDataElement[] formDataElements;
     private final long data;
     private volatile boolean canceled = false;
+    private final DiskCache diskCache;
+    // Set when the response may be stored in diskCache
+    private boolean cacheable;
+    // The entry a conditional request was sent for, and when
+    private DiskCache.Entry revalidating;
+    private long requestTime;
 
 
     /**
@@ -105,6 +113,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
         this.headers = headers;
         this.formDataElements = formDataElements;
         this.data = data;
+        this.diskCache = DiskCache.getInstance();
     }
 
 
@@ -141,6 +150,12 @@ final class URLLoader extends URLLoaderBase implements Runnable {
         try {
             boolean streaming = true;
             boolean connectionResetRetry = true;
+            DiskCache.Policy cachePolicy = diskCache != null
+                    && method.equals(GET)
+                    && formDataElements == null
+                    && (url.startsWith("http:") || url.startsWith("https:"))
+                    ? DiskCache.requestPolicy(headers)
+                    : DiskCache.Policy.BYPASS;
             while (true) {
                 // RT-14438
                 String actualUrl = url;
@@ -156,12 +171,38 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                 // RT-22458
                 workaround7177996(urlObject);
 
-                URLConnection c = urlObject.openConnection();
-                prepareConnection(c);
+                cacheable = cachePolicy != DiskCache.Policy.BYPASS;
+                revalidating = null;
+                requestTime = System.currentTimeMillis();
+                URLConnection c = null;
+                if (cacheable) {
+                    DiskCache.Entry entry = diskCache.lookup(url);
+                    if (entry != null) {
+                        if (cachePolicy == DiskCache.Policy.NORMAL
+                                && entry.isFresh())
+                        {
+                            c = diskCache.open(entry, urlObject);
+                            cacheable = false;
+                        } else if (entry.hasValidator()) {
+                            revalidating = entry;
+                        }
+                    }
+                }
+                if (c == null) {
+                    c = urlObject.openConnection();
+                    prepareConnection(c);
+                    if (revalidating != null && c instanceof HttpURLConnection) {
+                        revalidating.addValidators((HttpURLConnection) c);
+                    }
+                }
 
                 try {
                     sendRequest(c, streaming);
                     receiveResponse(c);
+                } catch (CacheMissException ex) {
+                    // The entry went away while it was being revalidated
+                    cachePolicy = DiskCache.Policy.BYPASS;
+                    continue;
                 } catch (HttpRetryException ex) {
                     // RT-19914
                     if (streaming) {
@@ -341,6 +382,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
             int maxTryCount = isGetOrHead ? 3 : 1;
             c.setConnectTimeout(c.getConnectTimeout() / maxTryCount);
             int tryCount = 0;
+            markTiming(TIMING_CONNECT_START);
             while (!canceled) {
                 try {
                     c.connect();
@@ -354,6 +396,8 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                     throw new MalformedURLException(url);
                 }
             }
+            markTiming(TIMING_CONNECT_END);
+            markTiming(TIMING_REQUEST_START);
 
             if (sendFormData) {
                 out = c.getOutputStream();
@@ -405,6 +449,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
             HttpURLConnection http = (HttpURLConnection) c;
 
             int code = http.getResponseCode();
+            markTiming(TIMING_RESPONSE_START);
             if (code == -1) {
                 throw new InvalidResponseException();
             }
@@ -413,6 +458,24 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                 return;
             }
 
+            if (code == 304 && revalidating != null) {
+                // Our own conditional request, WebCore gets the stored
+                // response instead
+                HttpURLConnection cached =
+                        diskCache.update(revalidating, requestTime, http);
+                revalidating = null;
+                if (cached == null) {
+                    throw new CacheMissException();
+                }
+                cacheable = false;
+                try {
+                    receiveResponse(cached);
+                } finally {
+                    close(cached);
+                }
+                return;
+            }
+
             // See RT-17435
             switch (code) {
                 case 301: // Moved Permanently
@@ -469,6 +532,9 @@ final class URLLoader extends URLLoaderBase implements Runnable {
             }
         }
 
+        if (!(c instanceof HttpURLConnection)) {
+            markTiming(TIMING_RESPONSE_START);
+        }
         didReceiveResponse(c);
 
         if (method.equals(HEAD)) {
@@ -492,7 +558,19 @@ final class URLLoader extends URLLoaderBase implements Runnable {
             }
         }
 
+        DiskCache.Writer cacheWriter = null;
+        if (inputStream != null && cacheable && errorStream == null
+                && c instanceof HttpURLConnection)
+        {
+            cacheWriter = diskCache.newWriter(url, requestTime,
+                    (HttpURLConnection) c);
+            if (cacheWriter != null) {
+                inputStream = cacheWriter.wrap(inputStream);
+            }
+        }
+
         String encoding = c.getContentEncoding();
+        InputStream rawStream = inputStream;
         if (inputStream != null) {
             try {
                 if ("gzip".equalsIgnoreCase(encoding)) {
@@ -518,6 +596,11 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                 // most URLConnections, by using the same size, we avoid quite
                 // a few System.arrayCopy() calls
                 byte[] buffer = new byte[8192];
+                // Data is passed on in full buffers, except when the
+                // connection has nothing more at hand or the oldest byte
+                // held reaches MAX_DELIVERY_DELAY, so that the event thread
+                // is not interrupted for every read.
+                long pendingSince = 0;
                 while (!canceled) {
                     int count;
                     try {
@@ -546,12 +629,29 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                         didReceiveData(byteBuffer, allocator);
                         byteBuffer = null;
 
+                        pendingSince = 0;
+
                         int outstanding = count - remaining;
                         if (outstanding > 0) {
                             byteBuffer = allocator.allocate();
                             byteBuffer.put(buffer, remaining, outstanding);
                         }
                     }
+
+                    if (byteBuffer != null && byteBuffer.position() > 0) {
+                        long now = System.nanoTime();
+                        if (pendingSince == 0) {
+                            pendingSince = now;
+                        }
+                        if (rawStream.available() == 0
+                                || now - pendingSince >= MAX_DELIVERY_DELAY)
+                        {
+                            byteBuffer.flip();
+                            didReceiveData(byteBuffer, allocator);
+                            byteBuffer = null;
+                            pendingSince = 0;
+                        }
+                    }
                 }
             }
             if (!canceled) {
@@ -561,11 +661,17 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                     byteBuffer = null;
                 }
                 didFinishLoading();
+                if (cacheWriter != null) {
+                    cacheWriter.commit();
+                }
             }
         } finally {
             if (byteBuffer != null) {
                 allocator.release(byteBuffer);
             }
+            if (cacheWriter != null) {
+                cacheWriter.abort();
+            }
         }
     }
 
@@ -586,6 +692,15 @@ final class URLLoader extends URLLoaderBase implements Runnable {
         } catch (IOException ignore) {}
     }
 
+    /**
+     * Signals that a revalidated disk cache entry could not be read.
+     */
+    private static final class CacheMissException extends IOException {
+        private CacheMissException() {
+            super("Disk cache entry missing");
+        }
+    }
+
     /**
      * Signals an invalid response from the server.
      */
@@ -682,6 +797,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
         final long contentLength = extractContentLength(c);
         final String responseHeaders = extractHeaders(c);
         final String adjustedUrl = adjustUrlForWebKit(url);
+        final long[] timing = getTiming();
         callBack(() -> {
             if (!canceled) {
                 notifyDidReceiveResponse(
@@ -690,7 +806,8 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                         contentEncoding,
                         contentLength,
                         responseHeaders,
-                        adjustedUrl);
+                        adjustedUrl,
+                        timing);
             }
         });
     }
@@ -700,7 +817,8 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                                           String contentEncoding,
                                           long contentLength,
                                           String headers,
-                                          String url)
+                                          String url,
+                                          long[] timing)
     {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
@@ -726,14 +844,17 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                 contentLength,
                 headers,
                 url,
+                timing,
                 data);
     }
 
     private void didReceiveData(final ByteBuffer byteBuffer,
                                 final ByteBufferAllocator allocator)
     {
+        final long postTime = System.nanoTime();
         callBack(() -> {
             if (!canceled) {
+                didDeliverData(postTime, byteBuffer.remaining());
                 notifyDidReceiveData(
                         byteBuffer,
                         byteBuffer.position(),
@@ -762,24 +883,28 @@ final class URLLoader extends URLLoaderBase implements Runnable {
     }
 
     private void didFinishLoading() {
+        markTiming(TIMING_RESPONSE_END);
+        final long[] timing = getTiming();
         callBack(() -> {
             if (!canceled) {
-                notifyDidFinishLoading();
+                addToLoadProfile(webPage, false);
+                notifyDidFinishLoading(timing);
             }
         });
     }
 
-    private void notifyDidFinishLoading() {
+    private void notifyDidFinishLoading(long[] timing) {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format("data: [0x%016X]", data));
         }
-        twkDidFinishLoading(data);
+        twkDidFinishLoading(timing, data);
     }
 
     private void didFail(final int errorCode, final String message) {
         final String adjustedUrl = adjustUrlForWebKit(url);
         callBack(() -> {
             if (!canceled) {
+                addToLoadProfile(webPage, true);
                 notifyDidFail(errorCode, adjustedUrl, message);
             }
         });
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,12 +25,76 @@
 
 package com.sun.webkit.network;
 
+import com.sun.webkit.WebPage;
 import java.lang.annotation.Native;
 import java.nio.ByteBuffer;
 
 abstract class URLLoaderBase {
     @Native public static final int ALLOW_UNASSIGNED = java.net.IDN.ALLOW_UNASSIGNED;
 
+    // Indices into the load timing arrays passed to the native code.
+    // Entries are nanoseconds since the loader was created, -1 if unknown.
+    @Native static final int TIMING_CONNECT_START = 0;
+    @Native static final int TIMING_CONNECT_END = 1;
+    @Native static final int TIMING_REQUEST_START = 2;
+    @Native static final int TIMING_RESPONSE_START = 3;
+    @Native static final int TIMING_RESPONSE_END = 4;
+    @Native static final int TIMING_COUNT = 5;
+
+    private final long creationTime = System.nanoTime();
+    private final long[] timing = {-1, -1, -1, -1, -1};
+
+    // Accessed on the event thread only
+    private long bytesDelivered;
+    private long deliveryTime;
+
+    /**
+     * Records that a phase of the load is reached now.
+     */
+    protected final synchronized void markTiming(int index) {
+        timing[index] = System.nanoTime() - creationTime;
+    }
+
+    /**
+     * Returns the phases recorded so far.
+     */
+    protected final synchronized long[] getTiming() {
+        return timing.clone();
+    }
+
+    /**
+     * Accounts for data, posted to the event thread at {@code postTime},
+     * being handed to WebCore. Called on the event thread.
+     */
+    protected final void didDeliverData(long postTime, int length) {
+        bytesDelivered += length;
+        deliveryTime += System.nanoTime() - postTime;
+    }
+
+    /**
+     * Adds this load to the profile of its page once it is over.
+     * Called on the event thread.
+     */
+    protected final void addToLoadProfile(WebPage webPage, boolean failed) {
+        if (webPage == null) {
+            return;
+        }
+        long[] t = getTiming();
+        long total = System.nanoTime() - creationTime;
+        webPage.getLoadProfile().add(
+                failed,
+                span(t[TIMING_CONNECT_START], t[TIMING_CONNECT_END]),
+                span(t[TIMING_REQUEST_START], t[TIMING_RESPONSE_START]),
+                span(t[TIMING_RESPONSE_START], t[TIMING_RESPONSE_END]),
+                deliveryTime,
+                total,
+                bytesDelivered);
+    }
+
+    private static long span(long start, long end) {
+        return start >= 0 && end >= start ? end - start : -1;
+    }
+
     /**
      * Cancels the loader.
      */
@@ -54,6 +118,7 @@ abstract class URLLoaderBase {
                                                      long contentLength,
                                                      String headers,
                                                      String url,
+                                                     long[] timing,
                                                      long data);
 
     protected static native void twkDidReceiveData(ByteBuffer byteBuffer,
@@ -61,7 +126,8 @@ abstract class URLLoaderBase {
                                                  int remaining,
                                                  long data);
 
-    protected static native void twkDidFinishLoading(long data);
+    protected static native void twkDidFinishLoading(long[] timing,
+                                                   long data);
 
     protected static native void twkDidFail(int errorCode,
                                           String url,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,6 +99,13 @@ public final class WCGraphicsPerfLogger extends WCGraphicsContext {
         logger.suspendCount("FILLRECT_FFFFI");
     }
 
+    @Override
+    public void fillRects(float[] rects, int count, Color color) {
+        logger.resumeCount("FILLRECT_LIST");
+        gc.fillRects(rects, count, color);
+        logger.suspendCount("FILLRECT_LIST");
+    }
+
     @Override public void fillRoundedRect(float x, float y, float w, float h,
             float topLeftW, float topLeftH, float topRightW, float topRightH,
             float bottomLeftW, float bottomLeftH, float bottomRightW, float bottomRightH,
@@ -238,6 +245,22 @@ public final class WCGraphicsPerfLogger extends WCGraphicsContext {
         logger.suspendCount("DRAWIMAGE");
     }
 
+    @Override
+    public void drawImages(WCImage img, float[] rects, int count) {
+        logger.resumeCount("DRAWIMAGE_LIST");
+        gc.drawImages(img, rects, count);
+        logger.suspendCount("DRAWIMAGE_LIST");
+    }
+
+    @Override
+    public void drawFilteredImage(WCImage img,
+                          float dstx, float dsty, float dstw, float dsth,
+                          int[] types, float[] params) {
+        logger.resumeCount("DRAWFILTEREDIMAGE");
+        gc.drawFilteredImage(img, dstx, dsty, dstw, dsth, types, params);
+        logger.suspendCount("DRAWFILTEREDIMAGE");
+    }
+
     @Override
     public void drawIcon(WCIcon icon, int x, int y) {
         logger.resumeCount("DRAWICON");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1025,9 +1025,13 @@ final public class WebEngine {
             try {
                 userDataDir = DirectoryLock.canonicalize(userDataDir);
                 File localStorageDir = new File(userDataDir, "localstorage");
+                File indexedDatabaseDir = new File(userDataDir, "indexeddb");
+                File bytecodeCacheDir = new File(userDataDir, "bytecodecache");
                 File[] dirs = new File[] {
                     userDataDir,
                     localStorageDir,
+                    indexedDatabaseDir,
+                    bytecodeCacheDir,
                 };
                 for (File dir : dirs) {
                     createDirectories(dir);
@@ -1042,6 +1046,8 @@ final public class WebEngine {
 
                 page.setLocalStorageDatabasePath(localStorageDir.getPath());
                 page.setLocalStorageEnabled(true);
+                page.setIndexedDatabasePath(indexedDatabaseDir.getPath());
+                page.setBytecodeCachePath(bytecodeCacheDir.getPath());
 
                 logger.fine("User data directory [{0}] has "
                         + "been applied successfully", displayString);
@@ -44,6 +44,10 @@
 #include <wtf/TZoneMallocInlines.h>
 #include <wtf/WorkQueue.h>
 
+#if OS(WINDOWS)
+#include <windows.h>
+#endif
+
 #if ENABLE(LIBPAS_JIT_HEAP)
 #include <bmalloc/jit_heap.h>
 #include <bmalloc/jit_heap_config.h>
@@ -365,6 +369,74 @@ struct JITReservation {
     size_t size { 0 };
 };
 
+#if OS(WINDOWS) && CPU(X86_64)
+
+// Without unwind data the Windows exception dispatcher cannot walk a stack
+// that contains JIT frames, which breaks exception handling and stack
+// walks in the host, notably the JVM. JIT frames always start with
+// push rbp; mov rbp, rsp, so a single function entry covering the pool
+// that restores rsp from rbp and pops rbp unwinds any of them.
+
+// The unwind structures are documented but not declared by the SDK headers.
+struct JITUnwindCode {
+    uint8_t codeOffset;
+    uint8_t unwindOp : 4;
+    uint8_t opInfo : 4;
+};
+
+struct JITUnwindInfo {
+    uint8_t version : 3;
+    uint8_t flags : 5;
+    uint8_t sizeOfProlog;
+    uint8_t countOfCodes;
+    uint8_t frameRegister : 4;
+    uint8_t frameOffset : 4;
+    JITUnwindCode unwindCode[2];
+};
+
+struct JITUnwindData {
+    RUNTIME_FUNCTION runtimeFunction;
+    JITUnwindInfo unwindInfo;
+};
+
+static PRUNTIME_FUNCTION jitRuntimeFunctionCallback(DWORD64, PVOID context)
+{
+    return &static_cast<JITUnwindData*>(context)->runtimeFunction;
+}
+
+static void registerJITUnwindData(void* unwindBase, size_t unwindSize, size_t reservationSize)
+{
+    static_assert(sizeof(JITUnwindData) <= 4 * KB);
+    RELEASE_ASSERT(unwindSize >= sizeof(JITUnwindData));
+
+    constexpr uint8_t pushRBPOffset = 1;
+    constexpr uint8_t setFramePointerOffset = 4;
+    constexpr uint8_t unwindOpPushNonVolatile = 0;
+    constexpr uint8_t unwindOpSetFramePointer = 3;
+    constexpr uint8_t rbp = 5;
+
+    auto* data = new (NotNull, unwindBase) JITUnwindData { };
+    data->unwindInfo.version = 1;
+    data->unwindInfo.sizeOfProlog = setFramePointerOffset;
+    data->unwindInfo.countOfCodes = 2;
+    data->unwindInfo.frameRegister = rbp;
+    // Unwind codes are listed in the reverse order of the prolog.
+    data->unwindInfo.unwindCode[0] = { setFramePointerOffset, unwindOpSetFramePointer, 0 };
+    data->unwindInfo.unwindCode[1] = { pushRBPOffset, unwindOpPushNonVolatile, rbp };
+
+    // Addresses are relative to the start of the reservation.
+    data->runtimeFunction.BeginAddress = static_cast<DWORD>(unwindSize);
+    data->runtimeFunction.EndAddress = static_cast<DWORD>(reservationSize);
+    data->runtimeFunction.UnwindData = offsetof(JITUnwindData, unwindInfo);
+
+    // The low bits of the identifier tell the system this is a callback table.
+    DWORD64 tableIdentifier = reinterpret_cast<DWORD64>(unwindBase) | 0x3;
+    if (!RtlInstallFunctionTableCallback(tableIdentifier, reinterpret_cast<DWORD64>(unwindBase), reservationSize, jitRuntimeFunctionCallback, data, nullptr))
+        dataLogLnIf(Options::verboseExecutablePoolAllocation(), "Failed to register unwind data for the executable pool");
+}
+
+#endif // OS(WINDOWS) && CPU(X86_64)
+
 static ALWAYS_INLINE JITReservation initializeJITPageReservation()
 {
     JITReservation reservation;
@@ -431,6 +503,15 @@ static ALWAYS_INLINE JITReservation initializeJITPageReservation()
         }
 #endif
 
+#if OS(WINDOWS) && CPU(X86_64)
+        // First page of our JIT allocation holds the unwind data.
+        ASSERT(reservation.size >= executablePageSize() * 2);
+        reservation.pageReservation.commit(reservation.base, executablePageSize());
+        registerJITUnwindData(reservation.base, executablePageSize(), reservation.size);
+        reservation.base = (void*)((uintptr_t)(reservation.base) + executablePageSize());
+        reservation.size -= executablePageSize();
+#endif
+
         void* reservationEnd = reinterpret_cast<uint8_t*>(reservation.base) + reservation.size;
         g_jscConfig.startExecutableMemory = reservation.base;
         g_jscConfig.endExecutableMemory = reservationEnd;
@@ -36,7 +36,7 @@ WTF_MAKE_TZONE_ALLOCATED_IMPL(CodeCache);
 
 void CodeCacheMap::pruneSlowCase()
 {
-    m_minCapacity = std::max(m_size - m_sizeAtLastPrune, static_cast<int64_t>(0));
+    m_minCapacity = std::max({ m_size - m_sizeAtLastPrune, m_reservedCapacity, static_cast<int64_t>(0) });
     m_sizeAtLastPrune = m_size;
     m_timeAtLastPrune = ApproximateTime::now();
 
@@ -151,6 +151,16 @@ public:
 
     int64_t age() { return m_age; }
 
+    // Source length, in characters, the cache keeps compiled regardless of
+    // the recent hit rate, so that code shared by several pages survives
+    // the adaptive shrinking below.
+    void setReservedCapacity(int64_t reservedCapacity)
+    {
+        m_reservedCapacity = std::max<int64_t>(reservedCapacity, 0);
+        m_minCapacity = std::max(m_minCapacity, m_reservedCapacity);
+        m_capacity = std::max(m_capacity, m_minCapacity);
+    }
+
 private:
     template<typename UnlinkedCodeBlockType>
     UnlinkedCodeBlockType* fetchFromDiskImpl(VM& vm, const SourceCodeKey& key)
@@ -217,6 +227,7 @@ private:
     int64_t m_minCapacity;
     int64_t m_capacity;
     int64_t m_age;
+    int64_t m_reservedCapacity { 0 };
 };
 
 // Caches top-level code such as <script>, window.eval(), new Function, and JSEvaluateScript().
@@ -231,6 +242,7 @@ public:
     void updateCache(const UnlinkedFunctionExecutable*, const SourceCode&, CodeSpecializationKind, const UnlinkedFunctionCodeBlock*);
 
     void clear() { m_sourceCode.clear(); }
+    void setReservedCapacity(int64_t reservedCapacity) { m_sourceCode.setReservedCapacity(reservedCapacity); }
     JS_EXPORT_PRIVATE void write();
 
 private:
@@ -80,6 +80,31 @@ Structure* IntlDateTimeFormat::createStructure(VM& vm, JSGlobalObject* globalObj
     return Structure::create(vm, globalObject, prototype, TypeInfo(ObjectType, StructureFlags), info());
 }
 
+// Formatting a date with the default locale and options is common enough
+// (Date.prototype.toLocaleString() in loops) that constructing the ICU
+// formatter each time dominates, so keep one per kind in the global object.
+IntlDateTimeFormat* IntlDateTimeFormat::defaultFormat(JSGlobalObject* globalObject, RequiredComponent required, Defaults defaults)
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    String timeZone = vm.dateCache.defaultTimeZone();
+    if (timeZone != globalObject->m_defaultDateTimeFormatsTimeZone) {
+        for (auto& format : globalObject->m_defaultDateTimeFormats)
+            format.clear();
+        globalObject->m_defaultDateTimeFormatsTimeZone = WTFMove(timeZone);
+    }
+
+    auto& cachedFormat = globalObject->m_defaultDateTimeFormats[static_cast<unsigned>(defaults)];
+    if (!cachedFormat) {
+        auto* dateTimeFormat = IntlDateTimeFormat::create(vm, globalObject->dateTimeFormatStructure());
+        dateTimeFormat->initializeDateTimeFormat(globalObject, jsUndefined(), jsUndefined(), required, defaults);
+        RETURN_IF_EXCEPTION(scope, nullptr);
+        cachedFormat.set(vm, globalObject, dateTimeFormat);
+    }
+    return cachedFormat.get();
+}
+
 IntlDateTimeFormat::IntlDateTimeFormat(VM& vm, Structure* structure)
     : Base(vm, structure)
 {
@@ -2444,6 +2444,8 @@ void JSGlobalObject::visitChildrenImpl(JSCell* cell, Visitor& visitor)
 
     thisObject->m_defaultCollator.visit(visitor);
     thisObject->m_defaultNumberFormat.visit(visitor);
+    for (auto& format : thisObject->m_defaultDateTimeFormats)
+        visitor.append(format);
     thisObject->m_collatorStructure.visit(visitor);
     thisObject->m_displayNamesStructure.visit(visitor);
     thisObject->m_durationFormatStructure.visit(visitor);
@@ -71,6 +71,7 @@ class GeneratorPrototype;
 class GetterSetter;
 class ImportMap;
 class IntlCollator;
+class IntlDateTimeFormat;
 class IntlNumberFormat;
 class IteratorPrototype;
 class JSArrayBuffer;
@@ -224,6 +225,11 @@ public:
 
     LazyProperty<JSGlobalObject, IntlCollator> m_defaultCollator;
     LazyProperty<JSGlobalObject, IntlNumberFormat> m_defaultNumberFormat;
+    // Formats of Date.prototype.toLocale*String() called without locales and
+    // options, indexed by IntlDateTimeFormat::Defaults. They capture the
+    // default time zone they were created in.
+    std::array<WriteBarrier<IntlDateTimeFormat>, 3> m_defaultDateTimeFormats;
+    String m_defaultDateTimeFormatsTimeZone;
     LazyProperty<JSGlobalObject, Structure> m_collatorStructure;
     LazyProperty<JSGlobalObject, Structure> m_displayNamesStructure;
     LazyProperty<JSGlobalObject, Structure> m_durationFormatStructure;
@@ -302,7 +302,21 @@ TryMallocReturnValue tryFastRealloc(void* p, size_t n)
     return realloc(p, n);
 }
 
+#if OS(WINDOWS)
+void releaseFastMallocFreeMemory()
+{
+    // The CRT allocates from the process heap. Unlike HeapCompact alone,
+    // HeapOptimizeResources also decommits the free blocks the
+    // low-fragmentation heap keeps around, which is what lets RSS drop
+    // after a memory pressure release.
+    HANDLE heap = GetProcessHeap();
+    HEAP_OPTIMIZE_RESOURCES_INFORMATION information { HEAP_OPTIMIZE_RESOURCES_CURRENT_VERSION, 0 };
+    if (!HeapSetInformation(heap, HeapOptimizeResources, &information, sizeof(information)))
+        HeapCompact(heap, 0);
+}
+#else
 void releaseFastMallocFreeMemory() { }
+#endif
 void releaseFastMallocFreeMemoryForThisThread() { }
 
 FastMallocStatistics fastMallocStatistics()
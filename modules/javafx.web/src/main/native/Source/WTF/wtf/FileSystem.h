@@ -280,6 +280,10 @@ private:
 #if OS(WINDOWS)
     Win32Handle m_fileMapping;
 #endif
+#if PLATFORM(JAVA)
+    // The MappedByteBuffer backing m_fileData, unmapped once collected
+    JGObject m_mappedBuffer;
+#endif
 };
 
 inline std::optional<MappedFileData> MappedFileData::create(const String& filePath, MappedFileMode mode)
@@ -328,7 +332,13 @@ inline MappedFileData::MappedFileData(MappedFileData&& other)
 #if OS(WINDOWS)
     , m_fileMapping(WTFMove(other.m_fileMapping))
 #endif
+#if PLATFORM(JAVA)
+    , m_mappedBuffer(other.m_mappedBuffer)
+#endif
 {
+#if PLATFORM(JAVA)
+    other.m_mappedBuffer.clear();
+#endif
 }
 
 inline MappedFileData& MappedFileData::operator=(MappedFileData&& other)
@@ -337,6 +347,10 @@ inline MappedFileData& MappedFileData::operator=(MappedFileData&& other)
     m_fileSize = std::exchange(other.m_fileSize, 0);
 #if OS(WINDOWS)
     m_fileMapping = WTFMove(other.m_fileMapping);
+#endif
+#if PLATFORM(JAVA)
+    m_mappedBuffer = other.m_mappedBuffer;
+    other.m_mappedBuffer.clear();
 #endif
     return *this;
 }
@@ -77,6 +77,9 @@ WTF_EXPORT_PRIVATE bool isMainThreadOrGCThread();
 void initializeMainThreadPlatform();
 #if PLATFORM(JAVA)
 void scheduleDispatchFunctionsOnMainThread();
+#if USE(GENERIC_EVENT_LOOP)
+void scheduleDispatchFunctionsOnMainThread(MonotonicTime);
+#endif
 #endif
 
 // To be used with WTF_REQUIRES_CAPABILITY(mainThread). Symbol is undefined.
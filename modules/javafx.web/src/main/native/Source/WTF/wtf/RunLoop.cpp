@@ -221,7 +221,7 @@ void RunLoop::threadWillExit()
     }
 }
 
-#if PLATFORM(JAVA)
+#if PLATFORM(JAVA) && !USE(GENERIC_EVENT_LOOP)
 void RunLoop::dispatchFunctionsFromMainThread()
 {
     performWork();
@@ -28,6 +28,7 @@
 #include <wtf/RunLoop.h>
 
 #include <wtf/DataLog.h>
+#include <wtf/MainThread.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/ProcessID.h>
 
@@ -265,7 +266,27 @@ void RunLoop::wakeUpWithLock()
 
     if (m_wakeUpCallback)
         m_wakeUpCallback();
+
+#if PLATFORM(JAVA)
+    // Nobody sleeps in run() on the main loop of the Java port, so the
+    // event thread has to be asked to come by when the next timer is due.
+    if (this == &RunLoop::main() && !m_schedules.isEmpty())
+        scheduleDispatchFunctionsOnMainThread(m_schedules.first()->scheduledTimePoint());
+#endif
+}
+
+#if PLATFORM(JAVA)
+void RunLoop::dispatchFunctionsFromMainThread()
+{
+    // Fires the due timers and runs the queued functions in one pass.
+    runImpl(RunMode::Iterate);
+
+    // Repeating timers were rescheduled without a wake up, see runImpl().
+    Locker locker { m_loopLock };
+    if (!m_schedules.isEmpty())
+        scheduleDispatchFunctionsOnMainThread(m_schedules.first()->scheduledTimePoint());
 }
+#endif
 
 void RunLoop::wakeUp()
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -273,6 +273,49 @@ int readFromFile(PlatformFileHandle handle, void* data, int length)
     return result;
 }
 
+bool MappedFileData::mapFileHandle(PlatformFileHandle handle, FileOpenMode openMode, MappedFileMode)
+{
+    // Files are only opened for reading, which a private and a shared
+    // mapping do not tell apart
+    if (openMode != FileOpenMode::Read || !isHandleValid(handle)) {
+        return false;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkMapFile",
+            "(Ljava/io/RandomAccessFile;)Ljava/nio/ByteBuffer;");
+    ASSERT(mid);
+
+    JLObject buffer = env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle);
+    if (WTF::CheckAndClearException(env) || !buffer) {
+        return false;
+    }
+
+    jlong size = env->GetDirectBufferCapacity(buffer);
+    if (!size) {
+        return true;
+    }
+    void* data = env->GetDirectBufferAddress(buffer);
+    if (!data || size < 0) {
+        return false;
+    }
+
+    m_mappedBuffer = buffer;
+    m_fileData = data;
+    m_fileSize = static_cast<unsigned>(size);
+    return true;
+}
+
+MappedFileData::~MappedFileData()
+{
+    // Dropping the buffer reference is all there is to it, the JDK
+    // unmaps the file when the buffer is collected.
+}
+
 String pathFileName(const String& path)
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -378,11 +421,6 @@ std::optional<int32_t> getFileDeviceId(const String&)
     return {};
 }
 
-bool MappedFileData::mapFileHandle(PlatformFileHandle, FileOpenMode, MappedFileMode)
-{
-    fprintf(stderr, "MappedFileData::mapFileHandle(PlatformFileHandle handle, MappedFileMode) NOT IMPLEMENTED\n");
-    return false;
-}
 
 bool unmapViewOfFile(void* , size_t)
 {
@@ -390,17 +428,24 @@ bool unmapViewOfFile(void* , size_t)
     return false;
 }
 
-MappedFileData::~MappedFileData()
-{
-    if (!m_fileData)
-        return;
-    unmapViewOfFile(m_fileData, m_fileSize);
-}
 
-bool deleteFile(const String&)
+bool deleteFile(const String& path)
 {
-    fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
-    return false;
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkDeleteFile",
+            "(Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
 }
 
 bool deleteEmptyDirectory(String const &)
@@ -523,7 +568,29 @@ bool fileIDsAreEqual(std::optional<PlatformFileID> a, std::optional<PlatformFile
 
 int overwriteEntireFile(const String& path, std::span<uint8_t> span)
 {
-    return 0;
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkOverwriteEntireFile",
+            "(Ljava/lang/String;Ljava/nio/ByteBuffer;)I");
+    ASSERT(mid);
+
+    JLObject data(env->NewDirectByteBuffer(span.data(), span.size()));
+    if (!data) {
+        WTF::CheckAndClearException(env);
+        return -1;
+    }
+
+    jint result = env->CallStaticIntMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env),
+            (jobject)data);
+    if (WTF::CheckAndClearException(env))
+        return -1;
+
+    return result;
 }
 
 } // namespace FileSystemImpl
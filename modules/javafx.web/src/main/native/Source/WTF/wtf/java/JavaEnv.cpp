@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,6 +44,48 @@ bool CheckAndClearException(JNIEnv* env)
 }
 
 
+namespace {
+
+// Attaching and detaching around every call is expensive, so a thread that
+// is not attached yet gets attached on first use and stays attached until
+// it exits. It is attached as a daemon so that it cannot hold up VM exit.
+class PermanentJavaEnvAttachment {
+public:
+    ~PermanentJavaEnvAttachment()
+    {
+        if (m_env)
+            jvm->DetachCurrentThread();
+    }
+
+    JNIEnv* env()
+    {
+        if (m_env)
+            return m_env;
+        if (g_ShuttingDown)
+            return nullptr;
+        // Threads attached by someone else, such as the event thread, are
+        // left alone; their env is looked up each time as it may go away.
+        JNIEnv* env = nullptr;
+        if (jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_2) == JNI_EDETACHED) {
+            if (jvm->AttachCurrentThreadAsDaemon(reinterpret_cast<void**>(&env), nullptr) != JNI_OK)
+                return nullptr;
+            m_env = env;
+        }
+        return env;
+    }
+
+private:
+    JNIEnv* m_env { nullptr };
+};
+
+} // namespace
+
+JNIEnv* GetOrAttachJavaEnv()
+{
+    static thread_local PermanentJavaEnvAttachment attachment;
+    return attachment.env();
+}
+
 jclass PL_GetClass(JNIEnv* env)
 {
     static JGClass cls(
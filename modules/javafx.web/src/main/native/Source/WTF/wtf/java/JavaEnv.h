@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,12 @@ ALWAYS_INLINE JNIEnv* JNICALL GetJavaEnv()
     return (JNIEnv*)env;
 }
 
+// Returns the env of the current thread, attaching the thread to the JVM
+// for the rest of its life if needed. Meant for native threads that call
+// into Java all the time, such as worker threads. Returns null once the
+// JVM is shutting down.
+JNIEnv* GetOrAttachJavaEnv();
+
 bool CheckAndClearException(JNIEnv* env);
 
 JLObject PL_GetLogger(JNIEnv* env, const char* name);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,16 @@
 #include <wtf/MainThread.h>
 #include <wtf/RunLoop.h>
 
+#if USE(GENERIC_EVENT_LOOP)
+#include <wtf/Condition.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Threading.h>
+#endif
+
+#include <atomic>
+
 #if OS(UNIX)
 #include <pthread.h>
 #endif
@@ -44,15 +54,90 @@ static pthread_t s_mainThread;
 static ThreadIdentifier s_mainThread { 0 };
 #endif
 
+// Set while a dispatch is posted to the event thread and has not started
+// running yet; further requests until then are covered by that dispatch.
+static std::atomic<bool> s_dispatchPending { false };
+
 void scheduleDispatchFunctionsOnMainThread()
 {
-    AttachThreadAsNonDaemonToJavaEnv autoAttach;
-    JNIEnv* env = autoAttach.env();
+    if (s_dispatchPending.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    JNIEnv* env = GetOrAttachJavaEnv();
     if (env) {
         env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
-        WTF::CheckAndClearException(env);
+        if (!WTF::CheckAndClearException(env))
+            return;
+    }
+    // Nothing was posted, let the next request try again.
+    s_dispatchPending.store(false, std::memory_order_release);
+}
+
+#if USE(GENERIC_EVENT_LOOP)
+namespace {
+
+// The event thread never runs the main RunLoop itself, it only drains it
+// when a dispatch arrives. This thread waits for the earliest main loop
+// timer to come due and then posts such a dispatch.
+class MainThreadTimerWaker {
+    WTF_MAKE_NONCOPYABLE(MainThreadTimerWaker);
+public:
+    static MainThreadTimerWaker& singleton()
+    {
+        static NeverDestroyed<MainThreadTimerWaker> waker;
+        return waker;
     }
+
+    MainThreadTimerWaker() = default;
+
+    void scheduleAt(MonotonicTime fireTime)
+    {
+        Locker locker { m_lock };
+        // An earlier wake up will re-arm for this one after it drains.
+        if (fireTime >= m_fireTime)
+            return;
+        m_fireTime = fireTime;
+        if (!m_thread) {
+            m_thread = Thread::create("WebKit: Main RunLoop timers", [this] {
+                run();
+            });
+        }
+        m_condition.notifyOne();
+    }
+
+private:
+    void run()
+    {
+        Locker locker { m_lock };
+        while (!g_ShuttingDown) {
+            MonotonicTime fireTime = m_fireTime;
+            if (MonotonicTime::now() < fireTime) {
+                m_condition.waitUntil(m_lock, fireTime);
+                continue;
+            }
+            m_fireTime = MonotonicTime::infinity();
+            DropLockForScope unlocker { locker };
+            scheduleDispatchFunctionsOnMainThread();
+        }
+    }
+
+    Lock m_lock;
+    Condition m_condition;
+    MonotonicTime m_fireTime WTF_GUARDED_BY_LOCK(m_lock) { MonotonicTime::infinity() };
+    RefPtr<Thread> m_thread WTF_GUARDED_BY_LOCK(m_lock);
+};
+
+} // namespace
+
+void scheduleDispatchFunctionsOnMainThread(MonotonicTime fireTime)
+{
+    if (fireTime <= MonotonicTime::now()) {
+        scheduleDispatchFunctionsOnMainThread();
+        return;
+    }
+    MainThreadTimerWaker::singleton().scheduleAt(fireTime);
 }
+#endif
 
 void initializeMainThreadPlatform()
 {
@@ -117,6 +202,9 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_MainThread_twkScheduleDispatchFunctions
   (JNIEnv*, jobject)
 {
+    // Cleared before running so that functions dispatched from here on
+    // post a new dispatch instead of relying on this one.
+    s_dispatchPending.store(false, std::memory_order_release);
     RunLoop::main().dispatchFunctionsFromMainThread();
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,10 +26,20 @@
 #include "config.h"
 
 #include <wtf/Vector.h>
+#include <wtf/text/ASCIIFastPath.h>
+#include <wtf/text/AtomStringImpl.h>
 #include <wtf/text/WTFString.h>
 
 namespace WTF {
 
+// Strings up to this length are first looked up in the atom table, so that
+// repeated values crossing the JNI boundary (header names, MIME types,
+// attribute values) share the existing AtomStringImpl instead of allocating.
+static constexpr unsigned maxAtomLookupLength = 32;
+
+// 8-bit strings up to this length are converted on the stack.
+static constexpr size_t inlineConversionCapacity = 256;
+
 // String conversions
 String::String(JNIEnv* env, const JLString &s)
 {
@@ -42,7 +52,13 @@ String::String(JNIEnv* env, const JLString &s)
         } else {
             const jchar* str = env->GetStringCritical(s, NULL);
             if (str) {
-                m_impl = StringImpl::create((const UChar*)str, len);
+                const UChar* characters = reinterpret_cast<const UChar*>(str);
+                RefPtr<StringImpl> atom;
+                if (len <= maxAtomLookupLength)
+                    atom = AtomStringImpl::lookUp(characters, len);
+                // Latin-1 content is stored as 8-bit, as WebCore would for
+                // the same text coming from the parser.
+                m_impl = atom ? atom.releaseNonNull() : StringImpl::create8BitIfPossible(characters, len);
                 env->ReleaseStringCritical(s, str);
             } else {
                 m_impl = StringImpl::create(reinterpret_cast<const UChar*>(L"OME"), 3);
@@ -58,10 +74,19 @@ JLString String::toJavaString(JNIEnv *env) const
     } else {
         const unsigned len = length();
         if (is8Bit()) {
+            const LChar* characters = characters8();
+            // ASCII without NULs is valid modified UTF-8, which lets the VM
+            // build a compact string without widening to UTF-16 first.
+            if (charactersAreAllASCII(characters, len) && !memchr(characters, 0, len)) {
+                Vector<char, inlineConversionCapacity> chars(len + 1);
+                memcpy(chars.data(), characters, len);
+                chars[len] = '\0';
+                return env->NewStringUTF(chars.data());
+            }
             // Convert latin1 chars to unicode.
-            Vector<jchar> jchars(len);
+            Vector<jchar, inlineConversionCapacity> jchars(len);
             for (unsigned i = 0; i < len; i++) {
-                jchars[i] = characterAt(i);
+                jchars[i] = characters[i];
             }
             return env->NewString(jchars.data(), len);
         } else {
@@ -1,5 +1,13 @@
 include(platform/TextureMapper.cmake)
 
+if (USE_JAVA_IMAGE_DECODERS)
+    include(platform/ImageDecoders.cmake)
+
+    list(APPEND WebCore_SOURCES
+        platform/image-decoders/java/ImageBackingStoreJava.cpp
+    )
+endif ()
+
 set(WebCore_OUTPUT_NAME WebCore)
 
 # JDK-9 +
@@ -92,6 +100,8 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     bindings/java/JavaNodeFilterCondition.h
     bridge/jni/jsc/BridgeUtils.h
     dom/DOMStringList.h
+    editing/java/TextExtractorJava.h
+    editing/java/TextSearchIndexJava.h
     platform/graphics/java/ImageBufferJavaBackend.h
     platform/graphics/java/ImageJava.h
     platform/graphics/java/PlatformContextJava.h
@@ -100,10 +110,12 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     platform/graphics/java/RenderingQueue.h
     platform/graphics/texmap/BitmapTextureJava.h
     platform/graphics/texmap/TextureMapperJava.h
+    platform/java/BytecodeCacheJava.h
     platform/java/DataObjectJava.h
     platform/java/PageSupplementJava.h
     platform/java/PlatformJavaClasses.h
     platform/java/PluginWidgetJava.h
+    platform/java/RenderingProfileJava.h
     platform/mock/GeolocationClientMock.h
     platform/network/java/AuthenticationChallenge.h
     platform/network/java/CertificateInfo.h
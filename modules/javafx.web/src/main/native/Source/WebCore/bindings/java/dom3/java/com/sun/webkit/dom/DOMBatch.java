@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package com.sun.webkit.dom;
+
+import java.lang.annotation.Native;
+import java.lang.ref.Reference;
+import java.util.Arrays;
+import org.w3c.dom.DOMException;
+import org.w3c.dom.Node;
+
+/**
+ * Bulk access to the DOM for code that would otherwise make one native
+ * call, and often create one peer object, per node or attribute. Each
+ * method here crosses into WebCore once and exchanges plain arrays, so
+ * nodes that are only visited are never turned into {@code Node} peers.
+ * Must be used on the FX application thread, like the rest of the DOM
+ * bindings.
+ */
+public final class DOMBatch {
+
+    private DOMBatch() {
+    }
+
+    /**
+     * Captures the subtree rooted at {@code root}, root included, in
+     * document order.
+     *
+     * @param root the root of the subtree
+     * @return the snapshot
+     */
+    public static TreeSnapshot snapshot(Node root) {
+        return snapshotImpl(peerOf(root));
+    }
+
+    /**
+     * Reads attributes of every element matching {@code selectors} under
+     * {@code root}. The result holds one row of {@code names.length}
+     * values per matching element, in document order; absent attributes
+     * are {@code null}.
+     *
+     * @param root the node to search from
+     * @param selectors a CSS selector list, as for {@code querySelectorAll}
+     * @param names the attributes to read
+     * @return the attribute values, row by row
+     * @throws DOMException if {@code selectors} is invalid
+     */
+    public static String[] queryAttributes(Node root, String selectors, String... names)
+            throws DOMException {
+        return queryAttributesImpl(peerOf(root), selectors, names.clone());
+    }
+
+    /**
+     * Counts the elements matching {@code selectors} under {@code root}.
+     *
+     * @param root the node to search from
+     * @param selectors a CSS selector list, as for {@code querySelectorAll}
+     * @return the number of matching elements
+     * @throws DOMException if {@code selectors} is invalid
+     */
+    public static int count(Node root, String selectors) throws DOMException {
+        return countImpl(peerOf(root), selectors);
+    }
+
+    private static long peerOf(Node node) {
+        if (!(node instanceof NodeImpl)) {
+            throw new IllegalArgumentException("Not a WebKit DOM node: " + node);
+        }
+        return ((NodeImpl) node).getPeer();
+    }
+
+    /**
+     * A flattened subtree. Nodes are numbered in document order starting
+     * with the root at 0, and every node refers to its parent by number.
+     */
+    public static final class TreeSnapshot {
+        private final int[] parents;
+        private final short[] types;
+        private final String[] names;
+        private final String[] values;
+        // attributes of node i are pairs [attributeOffsets[i], attributeOffsets[i + 1])
+        private final int[] attributeOffsets;
+        private final String[] attributes;
+
+        // Called from native
+        private TreeSnapshot(int[] parents, short[] types, String[] names,
+                             String[] values, int[] attributeOffsets,
+                             String[] attributes) {
+            this.parents = parents;
+            this.types = types;
+            this.names = names;
+            this.values = values;
+            this.attributeOffsets = attributeOffsets;
+            this.attributes = attributes;
+        }
+
+        /** Returns the number of nodes. */
+        public int size() {
+            return parents.length;
+        }
+
+        /** Returns the number of the parent of node {@code i}, or -1 for the root. */
+        public int getParent(int i) {
+            return parents[i];
+        }
+
+        /** Returns the {@link Node#getNodeType node type} of node {@code i}. */
+        public short getNodeType(int i) {
+            return types[i];
+        }
+
+        /** Returns the {@link Node#getNodeName node name} of node {@code i}. */
+        public String getNodeName(int i) {
+            return names[i];
+        }
+
+        /** Returns the {@link Node#getNodeValue node value} of node {@code i}. */
+        public String getNodeValue(int i) {
+            return values[i];
+        }
+
+        /** Returns the number of attributes of node {@code i}. */
+        public int getAttributeCount(int i) {
+            return (attributeOffsets[i + 1] - attributeOffsets[i]) / 2;
+        }
+
+        /** Returns the name of attribute {@code j} of node {@code i}. */
+        public String getAttributeName(int i, int j) {
+            return attributes[attributeIndex(i, j)];
+        }
+
+        /** Returns the value of attribute {@code j} of node {@code i}. */
+        public String getAttributeValue(int i, int j) {
+            return attributes[attributeIndex(i, j) + 1];
+        }
+
+        private int attributeIndex(int i, int j) {
+            if (j < 0 || j >= getAttributeCount(i)) {
+                throw new IndexOutOfBoundsException("attribute " + j);
+            }
+            return attributeOffsets[i] + 2 * j;
+        }
+    }
+
+    /**
+     * A list of DOM changes applied together by {@link #apply}. Each
+     * change targets either a node or, when a selector is given, every
+     * element matching it under that node.
+     */
+    public static final class Mutations {
+        @Native static final int SET_ATTRIBUTE = 0;
+        @Native static final int REMOVE_ATTRIBUTE = 1;
+        @Native static final int SET_TEXT_CONTENT = 2;
+
+        private Node[] targets = new Node[16];
+        private String[] selectors = new String[16];
+        private int[] operations = new int[16];
+        private String[] arguments = new String[32];
+        private int size;
+
+        public Mutations() {
+        }
+
+        /** Sets attribute {@code name} to {@code value}. */
+        public Mutations setAttribute(Node target, String selector, String name, String value) {
+            return add(target, selector, SET_ATTRIBUTE, name, value);
+        }
+
+        /** Removes attribute {@code name}. */
+        public Mutations removeAttribute(Node target, String selector, String name) {
+            return add(target, selector, REMOVE_ATTRIBUTE, name, null);
+        }
+
+        /** Replaces the children with a text node holding {@code text}. */
+        public Mutations setTextContent(Node target, String selector, String text) {
+            return add(target, selector, SET_TEXT_CONTENT, text, null);
+        }
+
+        private Mutations add(Node target, String selector, int operation,
+                              String first, String second) {
+            peerOf(target);
+            if (size == operations.length) {
+                int capacity = 2 * size;
+                targets = Arrays.copyOf(targets, capacity);
+                selectors = Arrays.copyOf(selectors, capacity);
+                operations = Arrays.copyOf(operations, capacity);
+                arguments = Arrays.copyOf(arguments, 2 * capacity);
+            }
+            targets[size] = target;
+            selectors[size] = selector;
+            operations[size] = operation;
+            arguments[2 * size] = first;
+            arguments[2 * size + 1] = second;
+            size++;
+            return this;
+        }
+
+        /**
+         * Applies the changes in order. If one fails, the ones before it
+         * stay applied and the rest are skipped.
+         *
+         * @throws DOMException if a change fails, e.g. because of an
+         *         invalid selector or attribute name
+         */
+        public void apply() throws DOMException {
+            long[] peers = new long[size];
+            for (int i = 0; i < size; i++) {
+                peers[i] = peerOf(targets[i]);
+            }
+            try {
+                applyImpl(peers, selectors, operations, arguments, size);
+            } finally {
+                // The target peers must stay alive until the call returns
+                Reference.reachabilityFence(targets);
+            }
+        }
+    }
+
+    private static native TreeSnapshot snapshotImpl(long peer);
+    private static native String[] queryAttributesImpl(long peer, String selectors, String[] names);
+    private static native int countImpl(long peer, String selectors);
+    private static native void applyImpl(long[] peers, String[] selectors,
+                                         int[] operations, String[] arguments,
+                                         int count);
+}
@@ -31,6 +31,10 @@
 #include "CachedScriptFetcher.h"
 #include <JavaScriptCore/SourceProvider.h>
 
+#if PLATFORM(JAVA)
+#include "BytecodeCacheJava.h"
+#endif
+
 namespace WebCore {
 
 class CachedScriptSourceProvider : public JSC::SourceProvider, public CachedResourceClient {
@@ -46,6 +50,17 @@ public:
     unsigned hash() const override;
     StringView source() const override;
 
+#if PLATFORM(JAVA)
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const override
+    {
+        if (!m_didLoadCachedBytecode) {
+            m_cachedBytecode = BytecodeCacheJava::load(*this);
+            m_didLoadCachedBytecode = true;
+        }
+        return m_cachedBytecode;
+    }
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), JSC::SourceTaintedOrigin::Untainted, TextPosition(), sourceType)
@@ -55,6 +70,10 @@ private:
     }
 
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(JAVA)
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+    mutable bool m_didLoadCachedBytecode { false };
+#endif
 };
 
 inline unsigned CachedScriptSourceProvider::hash() const
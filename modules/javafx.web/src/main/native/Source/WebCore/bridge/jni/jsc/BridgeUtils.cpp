@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,13 +46,17 @@
 #include "runtime_root.h"
 #include <wtf/java/JavaRef.h>
 #include <wtf/text/WTFString.h>
+#include <JavaScriptCore/ArgList.h>
+#include <JavaScriptCore/DateInstance.h>
 #include <JavaScriptCore/JSArray.h>
 #include <JavaScriptCore/JSLock.h>
 #include <JavaScriptCore/APICast.h>
 #include <JavaScriptCore/OpaqueJSString.h>
+#include <JavaScriptCore/PropertyNameArray.h>
 #include <JavaScriptCore/JSBase.h>
 #include <JavaScriptCore/JSStringRef.h>
 
+#include "com_sun_webkit_ScriptSnapshot.h"
 #include "com_sun_webkit_dom_JSObject.h"
 
 #if 1
@@ -106,6 +110,11 @@ static jclass getStringClass (JNIEnv *env)
     FIND_CACHE_CLASS(env, "java/lang/String");
 }
 
+static jclass getScriptSnapshotClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "com/sun/webkit/ScriptSnapshot");
+}
+
 static jclass getNullPointerExceptionClass (JNIEnv *env)
 {
     FIND_CACHE_CLASS(env, "java/lang/NullPointerException");
@@ -266,6 +275,190 @@ jobject executeScript(
     return WebCore::JSValue_to_Java_Object(value, env, ctx, rootObject);
 }
 
+namespace {
+
+// Writes a JS value graph in the tagged format read by
+// com.sun.webkit.ScriptSnapshot. Objects are numbered in the order they
+// are first written so that later occurrences become references.
+class ScriptSnapshotWriter {
+public:
+    explicit ScriptSnapshotWriter(JSC::JSGlobalObject* globalObject)
+        : m_globalObject(globalObject)
+    {
+    }
+
+    const Vector<uint8_t>& data() const { return m_data; }
+
+    void write(JSC::JSValue value)
+    {
+        JSC::VM& vm = m_globalObject->vm();
+        auto scope = DECLARE_THROW_SCOPE(vm);
+
+        if (value.isInt32()) {
+            appendTag(com_sun_webkit_ScriptSnapshot_TAG_INT);
+            append<int32_t>(value.asInt32());
+        } else if (value.isNumber()) {
+            appendTag(com_sun_webkit_ScriptSnapshot_TAG_DOUBLE);
+            append<double>(value.asNumber());
+        } else if (value.isBoolean())
+            appendTag(value.asBoolean() ? com_sun_webkit_ScriptSnapshot_TAG_TRUE : com_sun_webkit_ScriptSnapshot_TAG_FALSE);
+        else if (value.isString() || value.isBigInt()) {
+            String string = value.toWTFString(m_globalObject);
+            RETURN_IF_EXCEPTION(scope, void());
+            appendTag(com_sun_webkit_ScriptSnapshot_TAG_STRING);
+            appendString(string);
+        } else if (value.isObject() && !value.isCallable())
+            writeObject(JSC::asObject(value));
+        else
+            appendTag(com_sun_webkit_ScriptSnapshot_TAG_NULL);
+    }
+
+private:
+    static bool isOmitted(JSC::JSValue value)
+    {
+        return value.isSymbol() || value.isCallable();
+    }
+
+    void writeObject(JSC::JSObject* object)
+    {
+        JSC::VM& vm = m_globalObject->vm();
+        auto scope = DECLARE_THROW_SCOPE(vm);
+
+        if (auto* date = JSC::jsDynamicCast<JSC::DateInstance*>(object)) {
+            appendTag(com_sun_webkit_ScriptSnapshot_TAG_DATE);
+            append<double>(date->internalNumber());
+            return;
+        }
+
+        auto it = m_objects.find(object);
+        if (it != m_objects.end()) {
+            appendTag(com_sun_webkit_ScriptSnapshot_TAG_REFERENCE);
+            append<int32_t>(it->value);
+            return;
+        }
+
+        if (UNLIKELY(!vm.isSafeToRecurseSoft())) {
+            JSC::throwStackOverflowError(m_globalObject, scope);
+            return;
+        }
+
+        m_objects.add(object, m_objects.size());
+        // Getters may drop the last reference to an object that was
+        // already written; keep it alive so that its address cannot be
+        // reused by a new object and mistaken for a reference.
+        m_protected.append(object);
+
+        if (JSC::isJSArray(object)) {
+            unsigned length = JSC::asArray(object)->length();
+            appendTag(com_sun_webkit_ScriptSnapshot_TAG_ARRAY);
+            append<int32_t>(length);
+            for (unsigned i = 0; i < length; i++) {
+                JSC::JSValue element = object->get(m_globalObject, i);
+                RETURN_IF_EXCEPTION(scope, void());
+                if (isOmitted(element))
+                    appendTag(com_sun_webkit_ScriptSnapshot_TAG_NULL);
+                else
+                    write(element);
+                RETURN_IF_EXCEPTION(scope, void());
+            }
+            return;
+        }
+
+        JSC::PropertyNameArray names(vm, JSC::PropertyNameMode::Strings, JSC::PrivateSymbolMode::Exclude);
+        object->methodTable()->getOwnPropertyNames(object, m_globalObject, names, JSC::DontEnumPropertiesMode::Exclude);
+        RETURN_IF_EXCEPTION(scope, void());
+
+        appendTag(com_sun_webkit_ScriptSnapshot_TAG_OBJECT);
+        size_t sizeOffset = m_data.size();
+        append<int32_t>(0);
+        int32_t size = 0;
+        for (auto& name : names) {
+            JSC::JSValue propertyValue = object->get(m_globalObject, name);
+            RETURN_IF_EXCEPTION(scope, void());
+            if (isOmitted(propertyValue))
+                continue;
+            appendString(name.string());
+            write(propertyValue);
+            RETURN_IF_EXCEPTION(scope, void());
+            size++;
+        }
+        memcpy(m_data.data() + sizeOffset, &size, sizeof(size));
+    }
+
+    void appendTag(int tag)
+    {
+        m_data.append(static_cast<uint8_t>(tag));
+    }
+
+    template<typename T>
+    void append(T value)
+    {
+        m_data.append(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    void appendString(const String& string)
+    {
+        append<int32_t>(string.length());
+        if (string.is8Bit()) {
+            for (LChar c : string.span8())
+                append<UChar>(c);
+        } else
+            m_data.append(reinterpret_cast<const uint8_t*>(string.span16().data()), string.length() * sizeof(UChar));
+    }
+
+    JSC::JSGlobalObject* m_globalObject;
+    Vector<uint8_t> m_data;
+    HashMap<JSC::JSObject*, int32_t> m_objects;
+    JSC::MarkedArgumentBuffer m_protected;
+};
+
+} // namespace
+
+jobject executeScriptSnapshot(
+    JNIEnv* env,
+    JSObjectRef object,
+    JSContextRef ctx,
+    JSC::Bindings::RootObject *rootObject,
+    jstring str)
+{
+    if (str == nullptr) {
+        throwNullPointerException(env);
+        return nullptr;
+    }
+    JSStringRef script = asJSStringRef(env, str);
+    JSValueRef exception = 0;
+    JSValueRef value = JSEvaluateScript(ctx, script, object, nullptr, 1, &exception);
+    JSStringRelease(script);
+    if (exception) {
+        throwJavaException(env, ctx, exception, rootObject);
+        return nullptr;
+    }
+
+    JSC::JSGlobalObject* globalObject = toJS(ctx);
+    JSC::JSLockHolder lock(globalObject);
+    auto scope = DECLARE_CATCH_SCOPE(globalObject->vm());
+
+    ScriptSnapshotWriter writer(globalObject);
+    writer.write(toJS(globalObject, value));
+    if (JSC::Exception* thrown = scope.exception()) {
+        scope.clearException();
+        throwJavaException(env, ctx, toRef(globalObject, thrown->value()), rootObject);
+        return nullptr;
+    }
+
+    const Vector<uint8_t>& data = writer.data();
+    JLObject buffer(env->NewDirectByteBuffer(const_cast<uint8_t*>(data.data()), data.size()));
+    if (!buffer) {
+        WTF::CheckAndClearException(env);
+        return nullptr;
+    }
+
+    static jmethodID decodeID = env->GetStaticMethodID(getScriptSnapshotClass(env),
+        "fwkDecode", "(Ljava/nio/ByteBuffer;)Ljava/lang/Object;");
+    ASSERT(decodeID);
+    return env->CallStaticObjectMethod(getScriptSnapshotClass(env), decodeID, (jobject)buffer);
+}
+
 }
 
 
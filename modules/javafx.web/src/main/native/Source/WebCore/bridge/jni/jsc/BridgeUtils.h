@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,4 +44,9 @@ jobject executeScript(JNIEnv* env,
                       JSContextRef ctx,
                       JSC::Bindings::RootObject* rootPeer,
                       jstring script);
+jobject executeScriptSnapshot(JNIEnv* env,
+                              JSObjectRef object,
+                              JSContextRef ctx,
+                              JSC::Bindings::RootObject* rootPeer,
+                              jstring script);
 }  // namespace WebCore
@@ -34,6 +34,8 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBuffer.h>
+#include <JavaScriptCore/JSArrayBufferViewInlines.h>
 #include <JavaScriptCore/JSLock.h>
 
 #include "JavaArrayJSC.h"
@@ -74,6 +76,167 @@ jobject convertUndefinedToJObject()
     return jgoUndefined;
 }
 
+template<typename From, typename To>
+static void convertElements(const void* data, size_t length, To* out)
+{
+    const From* in = static_cast<const From*>(data);
+    for (size_t i = 0; i < length; i++)
+        out[i] = (To)in[i];
+}
+
+template<typename To>
+static bool convertElements(TypedArrayType type, const void* data, size_t length, To* out)
+{
+    switch (type) {
+    case TypeInt8:
+        convertElements<int8_t>(data, length, out);
+        return true;
+    case TypeUint8:
+    case TypeUint8Clamped:
+        convertElements<uint8_t>(data, length, out);
+        return true;
+    case TypeInt16:
+        convertElements<int16_t>(data, length, out);
+        return true;
+    case TypeUint16:
+        convertElements<uint16_t>(data, length, out);
+        return true;
+    case TypeInt32:
+        convertElements<int32_t>(data, length, out);
+        return true;
+    case TypeUint32:
+        convertElements<uint32_t>(data, length, out);
+        return true;
+    case TypeFloat32:
+        convertElements<float>(data, length, out);
+        return true;
+    case TypeFloat64:
+        convertElements<double>(data, length, out);
+        return true;
+    case TypeBigInt64:
+        convertElements<int64_t>(data, length, out);
+        return true;
+    case TypeBigUint64:
+        convertElements<uint64_t>(data, length, out);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Fills a new Java primitive array from typed array contents. When the
+// element representations match the contents are copied as is, otherwise
+// they are converted the way single numbers are, into a temporary buffer
+// that is then copied with one region call.
+template<typename T, typename ArrayType>
+static jobject createPrimitiveArray(JNIEnv* env, TypedArrayType type, const void* data, size_t length, bool sameRepresentation,
+    ArrayType (JNIEnv::*newArray)(jsize), void (JNIEnv::*setRegion)(ArrayType, jsize, jsize, const T*))
+{
+    ArrayType array = (env->*newArray)(static_cast<jsize>(length));
+    if (!array || !length)
+        return array;
+
+    if (sameRepresentation) {
+        (env->*setRegion)(array, 0, static_cast<jsize>(length), static_cast<const T*>(data));
+        return array;
+    }
+
+    Vector<T> elements(length);
+    if (!convertElements(type, data, length, elements.data())) {
+        env->DeleteLocalRef(array);
+        return nullptr;
+    }
+    (env->*setRegion)(array, 0, static_cast<jsize>(length), elements.data());
+    return array;
+}
+
+static jobject createDirectByteBuffer(JNIEnv* env, const void* data, size_t byteLength)
+{
+    static JGClass byteBufferClass(env->FindClass("java/nio/ByteBuffer"));
+    static JGClass byteOrderClass(env->FindClass("java/nio/ByteOrder"));
+    static jmethodID allocateDirectID = env->GetStaticMethodID(byteBufferClass, "allocateDirect", "(I)Ljava/nio/ByteBuffer;");
+    static jmethodID nativeOrderID = env->GetStaticMethodID(byteOrderClass, "nativeOrder", "()Ljava/nio/ByteOrder;");
+    static jmethodID orderID = env->GetMethodID(byteBufferClass, "order", "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;");
+
+    jobject buffer = env->CallStaticObjectMethod(byteBufferClass, allocateDirectID, static_cast<jint>(byteLength));
+    if (WTF::CheckAndClearException(env) || !buffer)
+        return nullptr;
+    if (byteLength)
+        memcpy(env->GetDirectBufferAddress(buffer), data, byteLength);
+
+    // Typed array contents are in native byte order, so let Java read
+    // multi-byte elements from the buffer without swapping.
+    JLObject nativeOrder(env->CallStaticObjectMethod(byteOrderClass, nativeOrderID));
+    JLObject ordered(env->CallObjectMethod(buffer, orderID, (jobject)nativeOrder));
+    WTF::CheckAndClearException(env);
+    return buffer;
+}
+
+// Converts an ArrayBuffer, a typed array or a DataView passed where Java
+// expects a primitive array or a ByteBuffer with one bulk copy instead of
+// building the Java object element by element. Returns null if the
+// conversion does not apply.
+static jobject convertArrayBufferToJObject(JSObject* object, const char* javaClassName)
+{
+    TypedArrayType type;
+    const void* data;
+    size_t length;
+    size_t byteLength;
+    if (JSArrayBufferView* view = jsDynamicCast<JSArrayBufferView*>(object)) {
+        type = typedArrayType(view->type());
+        if (view->isOutOfBounds()) {
+            data = nullptr;
+            length = byteLength = 0;
+        } else {
+            data = view->vector();
+            length = view->length();
+            byteLength = view->byteLength();
+        }
+    } else if (JSArrayBuffer* arrayBuffer = jsDynamicCast<JSArrayBuffer*>(object)) {
+        type = TypeUint8;
+        data = arrayBuffer->impl()->data();
+        byteLength = length = data ? arrayBuffer->impl()->byteLength() : 0;
+    } else
+        return nullptr;
+
+    if (byteLength > static_cast<size_t>(std::numeric_limits<jint>::max()))
+        return nullptr;
+
+    JNIEnv* env = getJNIEnv();
+    if (!strcmp(javaClassName, "java.nio.ByteBuffer") || !strcmp(javaClassName, "java.nio.Buffer"))
+        return createDirectByteBuffer(env, data, byteLength);
+
+    if (javaClassName[0] != '[' || !javaClassName[1] || javaClassName[2])
+        return nullptr;
+
+    // A DataView has no element type, so it only maps to byte[].
+    if (type == TypeDataView && javaClassName[1] != 'B')
+        return nullptr;
+
+    switch (javaClassName[1]) {
+    case 'Z':
+        return createPrimitiveArray<jboolean>(env, type, data, length, false, &JNIEnv::NewBooleanArray, &JNIEnv::SetBooleanArrayRegion);
+    case 'B':
+        if (type == TypeDataView)
+            return createPrimitiveArray<jbyte>(env, type, data, byteLength, true, &JNIEnv::NewByteArray, &JNIEnv::SetByteArrayRegion);
+        return createPrimitiveArray<jbyte>(env, type, data, length, elementSize(type) == 1, &JNIEnv::NewByteArray, &JNIEnv::SetByteArrayRegion);
+    case 'C':
+        return createPrimitiveArray<jchar>(env, type, data, length, type == TypeUint16, &JNIEnv::NewCharArray, &JNIEnv::SetCharArrayRegion);
+    case 'S':
+        return createPrimitiveArray<jshort>(env, type, data, length, type == TypeInt16 || type == TypeUint16, &JNIEnv::NewShortArray, &JNIEnv::SetShortArrayRegion);
+    case 'I':
+        return createPrimitiveArray<jint>(env, type, data, length, type == TypeInt32 || type == TypeUint32, &JNIEnv::NewIntArray, &JNIEnv::SetIntArrayRegion);
+    case 'J':
+        return createPrimitiveArray<jlong>(env, type, data, length, type == TypeBigInt64 || type == TypeBigUint64, &JNIEnv::NewLongArray, &JNIEnv::SetLongArrayRegion);
+    case 'F':
+        return createPrimitiveArray<jfloat>(env, type, data, length, type == TypeFloat32, &JNIEnv::NewFloatArray, &JNIEnv::SetFloatArrayRegion);
+    case 'D':
+        return createPrimitiveArray<jdouble>(env, type, data, length, type == TypeFloat64, &JNIEnv::NewDoubleArray, &JNIEnv::SetDoubleArrayRegion);
+    default:
+        return nullptr;
+    }
+}
+
 jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject, JSValue value, JavaType javaType, const char* javaClassName)
 {
     JSLockHolder lock(globalObject);
@@ -115,6 +278,8 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                         return result;
                     }
                     result.l = array->javaArray();
+                } else if (javaClassName && (result.l = convertArrayBufferToJObject(object, javaClassName))) {
+                    // Copied in bulk into a Java primitive array or ByteBuffer.
                 } else if ((!result.l && (!strcmp(javaClassName, "java.lang.Object")))
                            || (!strcmp(javaClassName, "netscape.javascript.JSObject"))) {
                     // Wrap objects in JSObject instances.
@@ -253,50 +418,49 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
 
 jobject jvalueToJObject(jvalue value, JavaType jtype) {
     JNIEnv* env = getJNIEnv();
-    jmethodID meth;
     switch (jtype) {
     case JavaTypeObject:
     case JavaTypeArray:
         return value.l;
     case JavaTypeBoolean: {
       static JGClass clsZ(env->FindClass("java/lang/Boolean"));
-      meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
+      static jmethodID meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
       return env->CallStaticObjectMethod(clsZ, meth, value.z);
     }
     case JavaTypeChar: {
       static JGClass clsC(env->FindClass("java/lang/Character"));
-      meth = env->GetStaticMethodID(clsC, "valueOf",
-                                    "(C)Ljava/lang/Character;");
+      static jmethodID meth = env->GetStaticMethodID(clsC, "valueOf",
+                                                     "(C)Ljava/lang/Character;");
       return env->CallStaticObjectMethod(clsC, meth, value.c);
     }
     case JavaTypeByte: {
       static JGClass clsB(env->FindClass("java/lang/Byte"));
-      meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
+      static jmethodID meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
       return env->CallStaticObjectMethod(clsB, meth, value.b);
     }
     case JavaTypeShort: {
       static JGClass clsS(env->FindClass("java/lang/Short"));
-      meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
+      static jmethodID meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
       return env->CallStaticObjectMethod(clsS, meth, value.s);
     }
     case JavaTypeInt: {
       static JGClass clsI(env->FindClass("java/lang/Integer"));
-      meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
+      static jmethodID meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
       return env->CallStaticObjectMethod(clsI, meth, value.i);
     }
     case JavaTypeLong: {
       static JGClass clsJ(env->FindClass("java/lang/Long"));
-      meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
+      static jmethodID meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
       return env->CallStaticObjectMethod(clsJ, meth, value.j);
     }
     case JavaTypeFloat: {
       static JGClass clsF(env->FindClass("java/lang/Float"));
-      meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
+      static jmethodID meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
       return env->CallStaticObjectMethod(clsF, meth, value.f);
     }
     case JavaTypeDouble: {
       static JGClass clsD(env->FindClass("java/lang/Double"));
-      meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
+      static jmethodID meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
       return env->CallStaticObjectMethod(clsD, meth, value.d);
     }
     default:
@@ -304,7 +468,93 @@ jobject jvalueToJObject(jvalue value, JavaType jtype) {
     }
 }
 
-jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
+jobject numberToJObject(double number, JavaType jtype)
+{
+    jvalue value;
+    switch (jtype) {
+    case JavaTypeBoolean:
+        value.z = (jboolean)number;
+        break;
+    case JavaTypeByte:
+        value.b = (jbyte)number;
+        break;
+    case JavaTypeShort:
+        value.s = (jshort)number;
+        break;
+    case JavaTypeInt:
+        value.i = (jint)number;
+        break;
+    case JavaTypeLong:
+        value.j = (jlong)number;
+        break;
+    case JavaTypeFloat:
+        value.f = (jfloat)number;
+        break;
+    case JavaTypeDouble:
+        value.d = (jdouble)number;
+        break;
+    default:
+        ASSERT_NOT_REACHED();
+        return nullptr;
+    }
+    return jvalueToJObject(value, jtype);
+}
+
+// Unboxes the result of a reflective call. The boxed type is known from
+// the return type, so the accessor IDs are resolved once per box class.
+static void unboxResult(JNIEnv* env, jobject r, JavaType returnType, jvalue& result)
+{
+    switch (returnType) {
+    case JavaTypeBoolean: {
+        static JGClass cls(env->FindClass("java/lang/Boolean"));
+        static jmethodID mid = env->GetMethodID(cls, "booleanValue", "()Z");
+        result.z = env->CallBooleanMethod(r, mid);
+        break;
+    }
+    case JavaTypeByte: {
+        static JGClass cls(env->FindClass("java/lang/Byte"));
+        static jmethodID mid = env->GetMethodID(cls, "byteValue", "()B");
+        result.b = env->CallByteMethod(r, mid);
+        break;
+    }
+    case JavaTypeShort: {
+        static JGClass cls(env->FindClass("java/lang/Short"));
+        static jmethodID mid = env->GetMethodID(cls, "shortValue", "()S");
+        result.s = env->CallShortMethod(r, mid);
+        break;
+    }
+    case JavaTypeInt: {
+        static JGClass cls(env->FindClass("java/lang/Integer"));
+        static jmethodID mid = env->GetMethodID(cls, "intValue", "()I");
+        result.i = env->CallIntMethod(r, mid);
+        break;
+    }
+    case JavaTypeLong: {
+        static JGClass cls(env->FindClass("java/lang/Long"));
+        static jmethodID mid = env->GetMethodID(cls, "longValue", "()J");
+        result.j = env->CallLongMethod(r, mid);
+        break;
+    }
+    case JavaTypeFloat: {
+        static JGClass cls(env->FindClass("java/lang/Float"));
+        static jmethodID mid = env->GetMethodID(cls, "floatValue", "()F");
+        result.f = env->CallFloatMethod(r, mid);
+        break;
+    }
+    case JavaTypeDouble: {
+        static JGClass cls(env->FindClass("java/lang/Double"));
+        static jmethodID mid = env->GetMethodID(cls, "doubleValue", "()D");
+        result.d = env->CallDoubleMethod(r, mid);
+        break;
+    }
+    default:
+        ASSERT_NOT_REACHED();
+        break;
+    }
+    env->DeleteLocalRef(r);
+}
+
+jthrowable dispatchJNICall(int count, RootObject* rootObject, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(obj, true);
@@ -315,18 +565,33 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
-    for (int i = 0;  i < count; i++)
-      env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    return dispatchJNICall(count, rootObject, obj, rmethod, returnType, args, result, accessControlContext);
+}
+
+jthrowable dispatchJNICall(int count, RootObject*, jobject obj, jobject reflectedMethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext) {
+
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::dispatchJNICall", (jobject)jlinstance);
+        return NULL;
+    }
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/security/AccessControlContext;)Ljava/lang/Object;");
+
+    JLObjectArray argsArray(env->NewObjectArray(count, objectCls, NULL));
+    for (int i = 0;  i < count; i++)
+      env->SetObjectArrayElement(argsArray, i, args[i]);
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            reflectedMethod, obj, argsArray,
                                             accessControlContext);
 
     jthrowable ex = env->ExceptionOccurred();
@@ -334,8 +599,9 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
 
     switch (returnType) {
     case JavaTypeVoid:
-        {
-        }
+    case JavaTypeInvalid:
+        if (r)
+            env->DeleteLocalRef(r);
         break;
     case JavaTypeArray:
     case JavaTypeObject:
@@ -346,35 +612,16 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
         break;
 
     case JavaTypeBoolean:
-        result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
-        break;
-
     case JavaTypeByte:
-        result.b = callJNIMethod<jbyte>(r, "byteValue", "()B");
-        break;
-
     case JavaTypeShort:
-        result.s = callJNIMethod<jshort>(r, "shortValue", "()S");
-        break;
-
     case JavaTypeInt:
-        result.i = callJNIMethod<jint>(r, "intValue", "()I");
-        break;
-
     case JavaTypeLong:
-        result.j = callJNIMethod<jlong>(r, "longValue", "()J");
-        break;
-
     case JavaTypeFloat:
-        result.f = callJNIMethod<jfloat>(r, "floatValue", "()F");
-        break;
-
     case JavaTypeDouble:
-        result.d = callJNIMethod<jdouble>(r, "doubleValue", "()D");
-        break;
-
-    case JavaTypeInvalid:
-        /* Nothing to do */
+        if (r)
+            unboxResult(env, r, returnType, result);
+        else
+            memset(&result, 0, sizeof(jvalue));
         break;
     }
     return ex;
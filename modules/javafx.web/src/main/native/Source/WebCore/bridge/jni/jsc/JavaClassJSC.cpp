@@ -170,6 +170,12 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
     size_t i;
     if (nameLength >= 3 && name[nameLength-1] == ')'
         && (i = name.find('(', 1)) != WTF::notFound) {
+        // Resolving an explicit overload means parsing and matching the
+        // parameter list; remember the outcome since scripts tend to use
+        // the same name at the same call site over and over.
+        auto cached = m_resolvedMethods.find(name);
+        if (cached != m_resolvedMethods.end())
+            return cached->value;
         Vector<String> pnames;
         size_t pstart = i + 1;
         if (pstart < nameLength-1) {
@@ -258,6 +264,10 @@ Method* JavaClass::methodNamed(PropertyName propertyName, Instance*) const
                 }
             }
         }
+        Method* method = methodList ? methodList->at(0) : nullptr;
+        delete methodList;
+        m_resolvedMethods.add(name, method);
+        return method;
     } else {
         methodList = m_methods.get(name.impl());
     }
@@ -53,6 +53,7 @@ private:
     const char* m_name;
     mutable FieldMap m_fields;
     mutable MethodListMap m_methods;
+    mutable HashMap<String, Method*> m_resolvedMethods;
 };
 
 } // namespace Bindings
@@ -306,13 +306,20 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         return jsUndefined();
     }
 
-    Vector<jobject> jArgs(count);
+    Vector<jobject, 8> jArgs(count);
 
+    bool numericArguments = jMethod->hasOnlyNumericParameters();
     for (int i = 0; i < count; i++) {
-        CString javaClassName = jMethod->parameterAt(i).utf8();
-        JavaType jtype = javaTypeFromClassName(javaClassName.data());
+        JSValue argument = callFrame->argument(i);
+        JavaType jtype = jMethod->parameterTypeAt(i);
+        // Numbers passed to primitive parameters are boxed directly, which
+        // is what convertValueToJValue would end up doing for them.
+        if (numericArguments && argument.isNumber()) {
+            jArgs[i] = numberToJObject(argument.asNumber(), jtype);
+            continue;
+        }
         jvalue jarg = convertValueToJValue(globalObject, m_rootObject.get(),
-            callFrame->argument(i), jtype, javaClassName.data());
+            argument, jtype, jMethod->parameterClassNameAt(i));
         jArgs[i] = jvalueToJObject(jarg, jtype);
 #if !PLATFORM(JAVA)
         LOG(LiveConnect, "JavaInstance::invokeMethod arg[%d] = %s", i, callFrame->argument(i).toString(globalObject)->value(globalObject).ascii().data());
@@ -342,13 +349,21 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
-
-        jthrowable ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
-                                        obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
+        jthrowable ex = dispatchJNICall(count, rootObject, obj,
+                                        jMethod->reflectedMethod(),
+                                        jMethod->returnType(),
                                         jArgs.data(), result,
                                         accessControlContext());
+
+        // The boxes created for primitive arguments are local references
+        // that would otherwise pile up when a script calls into Java in a
+        // loop.
+        JNIEnv* env = getJNIEnv();
+        for (int i = 0; i < count; i++) {
+            JavaType jtype = jMethod->parameterTypeAt(i);
+            if (jtype != JavaTypeObject && jtype != JavaTypeArray && jArgs[i])
+                env->DeleteLocalRef(jArgs[i]);
+        }
         if (ex != NULL) {
             JSValue exceptionDescription
               = (JavaInstance::create(ex, rootObject, accessControlContext())
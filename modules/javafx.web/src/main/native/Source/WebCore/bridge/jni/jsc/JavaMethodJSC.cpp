@@ -66,12 +66,26 @@ JavaMethod::JavaMethod(JNIEnv* env, jobject aMethod)
             if (!parameterName)
                 parameterName = env->NewStringUTF("<Unknown>");
             m_parameters.append(JavaString(env, parameterName).impl());
+            m_parameterClassNames.append(m_parameters.last().utf8());
+            m_parameterTypes.append(javaTypeFromClassName(m_parameterClassNames.last().data()));
             env->DeleteLocalRef(aParameter);
             env->DeleteLocalRef(parameterName);
         }
         env->DeleteLocalRef(jparameters);
     }
 
+    m_hasOnlyNumericParameters = true;
+    for (JavaType type : m_parameterTypes) {
+        if (type == JavaTypeObject || type == JavaTypeArray || type == JavaTypeChar
+            || type == JavaTypeInvalid) {
+            m_hasOnlyNumericParameters = false;
+            break;
+        }
+    }
+
+    m_reflectedMethod = JLObject(aMethod, true);
+    m_methodID = env->FromReflectedMethod(aMethod);
+
     // Created lazily.
     m_signature = 0;
 
@@ -111,14 +125,14 @@ const char* JavaMethod::signature() const
         StringBuilder signatureBuilder;
         signatureBuilder.append('(');
         for (unsigned int i = 0; i < m_parameters.size(); i++) {
-            CString javaClassName = parameterAt(i).utf8();
-            JavaType type = javaTypeFromClassName(javaClassName.data());
+            const char* javaClassName = parameterClassNameAt(i);
+            JavaType type = parameterTypeAt(i);
             if (type == JavaTypeArray)
-                appendClassName(signatureBuilder, javaClassName.data());
+                appendClassName(signatureBuilder, javaClassName);
             else {
                 signatureBuilder.append(signatureFromJavaType(type));
                 if (type == JavaTypeObject) {
-                    appendClassName(signatureBuilder, javaClassName.data());
+                    appendClassName(signatureBuilder, javaClassName);
                     signatureBuilder.append(';');
                 }
             }
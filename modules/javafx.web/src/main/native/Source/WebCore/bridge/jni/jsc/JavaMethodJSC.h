@@ -47,20 +47,37 @@ public:
     const String name() const { return m_name.impl(); }
     RuntimeType returnTypeClassName() const { return m_returnTypeClassName.utf8(); }
     const String parameterAt(int i) const { return m_parameters[i]; }
+    const char* parameterClassNameAt(int i) const { return m_parameterClassNames[i].data(); }
+    JavaType parameterTypeAt(int i) const { return m_parameterTypes[i]; }
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
 
+    // The java.lang.reflect.Method this was created from and its method ID,
+    // kept so that invocations need neither a by-name method lookup nor a
+    // ToReflectedMethod round trip.
+    jobject reflectedMethod() const { return m_reflectedMethod; }
+    jmethodID methodID() const { return m_methodID; }
+
+    // True if every parameter is a primitive other than char, so that
+    // numeric JS arguments can be boxed without the generic conversion.
+    bool hasOnlyNumericParameters() const { return m_hasOnlyNumericParameters; }
+
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
 
 private:
     Vector<WTF::String> m_parameters;
+    Vector<CString> m_parameterClassNames;
+    Vector<JavaType> m_parameterTypes;
+    JGObject m_reflectedMethod;
+    jmethodID m_methodID;
     JavaString m_name;
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
     JavaType m_returnType;
     bool m_isStatic;
+    bool m_hasOnlyNumericParameters;
 };
 
 } // namespace Bindings
@@ -316,6 +316,7 @@
 #include <wtf/text/TextStream.h>
 
 #if PLATFORM(JAVA)
+#include "RenderingProfileJava.h"
 #include <wtf/unicode/java/UnicodeJava.h>
 #endif
 
@@ -2509,6 +2510,14 @@ void Document::resolveStyle(ResolveStyleType type)
     }
 
     TraceScope tracingScope(StyleRecalcStart, StyleRecalcEnd);
+#if PLATFORM(JAVA)
+    // Style resolution stays on the main thread: RenderStyle, CSSValue and the
+    // rule data are not thread-safe, so subtrees cannot be cascaded on workers.
+    // The profile's style sharing and matched-declarations hit rates are the
+    // metrics to look at for large, repetitive pages.
+    auto* renderingProfile = RenderingProfileJava::from(*this);
+    RenderingProfileJava::Scope renderingProfileScope(renderingProfile, RenderingProfileJava::Phase::Style);
+#endif
 
     RenderView::RepaintRegionAccumulator repaintRegionAccumulator(renderView());
 
@@ -2557,6 +2566,10 @@ void Document::resolveStyle(ResolveStyleType type)
         while (resolver.hasUnresolvedQueryContainers()) {
             if (styleUpdate) {
                 SetForScope resolvingContainerQueriesScope(m_isResolvingContainerQueries, true);
+#if PLATFORM(JAVA)
+                if (renderingProfile)
+                    renderingProfile->didRestyleElements(styleUpdate->size());
+#endif
 
                 updateRenderTree(WTFMove(styleUpdate));
 
@@ -2568,6 +2581,10 @@ void Document::resolveStyle(ResolveStyleType type)
         }
 
         m_lastStyleUpdateSizeForTesting = styleUpdate ? styleUpdate->size() : 0;
+#if PLATFORM(JAVA)
+        if (renderingProfile)
+            renderingProfile->didRestyleElements(m_lastStyleUpdateSizeForTesting);
+#endif
 
         setHasValidStyle();
         clearChildNeedsStyleRecalc();
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "TextExtractorJava.h"
+
+#include "Document.h"
+#include "ElementInlines.h"
+#include "HTMLNames.h"
+#include "RenderElement.h"
+#include "RenderStyleInlines.h"
+#include "RenderText.h"
+#include "Text.h"
+#include <wtf/text/StringBuilder.h>
+
+namespace WebCore {
+
+using namespace HTMLNames;
+
+// static
+ASCIILiteral TextExtractorJava::supplementName()
+{
+    return "TextExtractorJava"_s;
+}
+
+// static
+TextExtractorJava& TextExtractorJava::from(Document& document)
+{
+    auto* extractor = static_cast<TextExtractorJava*>(document.requireSupplement(supplementName()));
+    if (!extractor) {
+        auto newExtractor = makeUnique<TextExtractorJava>();
+        extractor = newExtractor.get();
+        document.provideSupplement(supplementName(), WTFMove(newExtractor));
+    }
+    return *extractor;
+}
+
+void TextExtractorJava::begin(Document& document, bool skipInvisible)
+{
+    // Renderers tell what is displayed as soon as style is resolved, so
+    // skipping invisible content costs a style update but no layout.
+    if (skipInvisible)
+        document.updateStyleIfNeeded();
+
+    m_root = &document;
+    m_current = document.documentElement();
+    m_skipInvisible = skipInvisible && document.hasLivingRenderTree();
+    m_atStart = true;
+    m_pendingSpace = false;
+    m_pendingNewline = false;
+    m_pending.clear();
+    m_pendingOffset = 0;
+}
+
+static bool isLineBreaking(const Node& node)
+{
+    auto* element = dynamicDowncast<Element>(node);
+    if (!element)
+        return false;
+    if (element->hasTagName(brTag))
+        return true;
+    if (auto* renderer = element->renderer())
+        return !renderer->isInline();
+    return element->hasTagName(pTag) || element->hasTagName(divTag) || element->hasTagName(liTag)
+        || element->hasTagName(trTag) || element->hasTagName(h1Tag) || element->hasTagName(h2Tag)
+        || element->hasTagName(h3Tag) || element->hasTagName(h4Tag) || element->hasTagName(h5Tag)
+        || element->hasTagName(h6Tag) || element->hasTagName(preTag) || element->hasTagName(tableTag)
+        || element->hasTagName(blockquoteTag) || element->hasTagName(sectionTag) || element->hasTagName(articleTag);
+}
+
+bool TextExtractorJava::shouldSkipSubtree(const Node& node) const
+{
+    auto* element = dynamicDowncast<Element>(node);
+    if (!element)
+        return false;
+    if (element->hasTagName(scriptTag) || element->hasTagName(styleTag) || element->hasTagName(noscriptTag)
+        || element->hasTagName(templateTag))
+        return true;
+    return m_skipInvisible && !element->renderer() && !element->hasDisplayContents();
+}
+
+void TextExtractorJava::appendText(const Node& node)
+{
+    auto& text = downcast<Text>(node);
+    if (m_skipInvisible) {
+        auto* renderer = text.renderer();
+        if (!renderer || renderer->style().visibility() != Visibility::Visible)
+            return;
+    }
+
+    StringBuilder builder;
+    for (UChar c : StringView(text.data()).codeUnits()) {
+        if (isASCIIWhitespace(c)) {
+            m_pendingSpace = true;
+            continue;
+        }
+        if (!m_atStart) {
+            if (m_pendingNewline)
+                builder.append('\n');
+            else if (m_pendingSpace)
+                builder.append(' ');
+        }
+        m_atStart = false;
+        m_pendingSpace = false;
+        m_pendingNewline = false;
+        builder.append(c);
+    }
+    if (builder.isEmpty())
+        return;
+
+    m_pending.append(builder.toString().utf8().bytes());
+}
+
+void TextExtractorJava::advance(bool skipChildren)
+{
+    if (!skipChildren) {
+        if (auto* child = m_current->firstChild()) {
+            m_current = child;
+            return;
+        }
+    }
+    for (RefPtr node = m_current; node && node != m_root; node = node->parentNode()) {
+        if (isLineBreaking(*node))
+            m_pendingNewline = true;
+        if (auto* sibling = node->nextSibling()) {
+            m_current = sibling;
+            return;
+        }
+    }
+    m_current = nullptr;
+}
+
+size_t TextExtractorJava::read(std::span<uint8_t> buffer)
+{
+    size_t written = 0;
+    while (written < buffer.size()) {
+        if (m_pendingOffset < m_pending.size()) {
+            size_t end = std::min(m_pending.size(), m_pendingOffset + buffer.size() - written);
+            // Stop before a continuation byte, the sequence goes into the
+            // next piece as a whole.
+            while (end < m_pending.size() && end > m_pendingOffset && (m_pending[end] & 0xC0) == 0x80)
+                --end;
+            if (end == m_pendingOffset)
+                break;
+            memcpy(buffer.data() + written, m_pending.data() + m_pendingOffset, end - m_pendingOffset);
+            written += end - m_pendingOffset;
+            m_pendingOffset = end;
+            continue;
+        }
+        m_pending.shrink(0);
+        m_pendingOffset = 0;
+
+        // A node removed since the last piece ends the walk, its
+        // successors are not where they used to be.
+        if (!m_current || !m_current->isConnected())
+            break;
+
+        if (isLineBreaking(*m_current))
+            m_pendingNewline = true;
+        bool skipChildren = shouldSkipSubtree(*m_current);
+        if (!skipChildren && is<Text>(*m_current))
+            appendText(*m_current);
+        advance(skipChildren);
+    }
+    return written;
+}
+
+} // namespace WebCore
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "Supplementable.h"
+#include <span>
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+class Document;
+class Node;
+
+// Walks the text of a document in DOM order and hands it out as UTF-8
+// in pieces, for indexing. Unlike innerText it needs no layout: markup
+// whitespace is collapsed, block elements and line breaks become new
+// lines and script and style contents are left out. Invisible content
+// can be skipped after a style update, going by the renderers.
+class TextExtractorJava final : public Supplement<Document> {
+    WTF_MAKE_NONCOPYABLE(TextExtractorJava);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    TextExtractorJava() = default;
+
+    WEBCORE_EXPORT static TextExtractorJava& from(Document&);
+
+    // Starts over from the beginning of the document.
+    WEBCORE_EXPORT void begin(Document&, bool skipInvisible);
+
+    // Writes the next piece of text into buffer, never splitting a
+    // character, and returns the number of bytes written. Returns 0 once
+    // the text is exhausted or the walk lost its place in the document.
+    WEBCORE_EXPORT size_t read(std::span<uint8_t> buffer);
+
+private:
+    static ASCIILiteral supplementName();
+
+    bool shouldSkipSubtree(const Node&) const;
+    void appendText(const Node&);
+    void advance(bool skipChildren);
+
+    RefPtr<Node> m_root;
+    RefPtr<Node> m_current;
+    bool m_skipInvisible { false };
+    bool m_atStart { true };
+    bool m_pendingSpace { false };
+    bool m_pendingNewline { false };
+    Vector<uint8_t> m_pending;
+    size_t m_pendingOffset { 0 };
+};
+
+} // namespace WebCore
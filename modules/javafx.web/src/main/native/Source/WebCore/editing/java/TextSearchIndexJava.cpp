@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "TextSearchIndexJava.h"
+
+#include "Document.h"
+#include "Text.h"
+#include "TextIterator.h"
+#include <unicode/uchar.h>
+#include <wtf/text/StringBuilder.h>
+
+namespace WebCore {
+
+// Distance between the points the text can be resolved from, so that
+// turning a match into a range walks at most this much of the document.
+static constexpr unsigned checkpointInterval = 4096;
+
+// static
+ASCIILiteral TextSearchIndexJava::supplementName()
+{
+    return "TextSearchIndexJava"_s;
+}
+
+// static
+TextSearchIndexJava& TextSearchIndexJava::from(Document& document)
+{
+    auto* index = static_cast<TextSearchIndexJava*>(document.requireSupplement(supplementName()));
+    if (!index) {
+        auto newIndex = makeUnique<TextSearchIndexJava>();
+        index = newIndex.get();
+        document.provideSupplement(supplementName(), WTFMove(newIndex));
+    }
+    return *index;
+}
+
+void TextSearchIndexJava::updateIfNeeded(Document& document)
+{
+    document.updateLayoutIgnorePendingStylesheets();
+    if (m_isValid && m_domTreeVersion == document.domTreeVersion())
+        return;
+
+    m_text = { };
+    m_foldedText = { };
+    m_checkpoints.clear();
+
+    auto documentRange = makeRangeSelectingNodeContents(document);
+    StringBuilder builder;
+    unsigned nextCheckpoint = 0;
+    for (TextIterator it(documentRange, findIteratorOptions()); !it.atEnd(); it.advance()) {
+        if (builder.length() >= nextCheckpoint && is<Text>(it.node())) {
+            m_checkpoints.append({ builder.length(), it.range().start });
+            nextCheckpoint = builder.length() + checkpointInterval;
+        }
+        it.appendTextToStringBuilder(builder);
+    }
+    m_text = builder.toString();
+    m_domTreeVersion = document.domTreeVersion();
+    m_isValid = true;
+}
+
+const String& TextSearchIndexJava::foldedText()
+{
+    // Simple case folding maps one code unit to one, so that the offsets
+    // of matches in the folded text are offsets into the text as well.
+    if (m_foldedText.isNull() && !m_text.isEmpty()) {
+        if (m_text.is8Bit() && m_text.containsOnlyASCII()) {
+            m_foldedText = m_text.convertToASCIILowercase();
+        } else {
+            Vector<UChar> folded(m_text.length());
+            for (unsigned i = 0; i < m_text.length(); ++i) {
+                UChar c = m_text[i];
+                folded[i] = U16_IS_SURROGATE(c) ? c : static_cast<UChar>(u_foldCase(c, U_FOLD_CASE_DEFAULT));
+            }
+            m_foldedText = String::adopt(WTFMove(folded));
+        }
+    }
+    return m_foldedText;
+}
+
+unsigned TextSearchIndexJava::findAll(Document& document, const String& target, bool caseSensitive, unsigned maxMatches, Vector<Match>& matches)
+{
+    matches.clear();
+    if (target.isEmpty())
+        return 0;
+
+    updateIfNeeded(document);
+
+    String needle = target;
+    StringView haystack = m_text;
+    if (!caseSensitive) {
+        haystack = foldedText();
+        StringBuilder foldedNeedle;
+        for (unsigned i = 0; i < target.length(); ++i) {
+            UChar c = target[i];
+            foldedNeedle.append(U16_IS_SURROGATE(c) ? c : static_cast<UChar>(u_foldCase(c, U_FOLD_CASE_DEFAULT)));
+        }
+        needle = foldedNeedle.toString();
+    }
+
+    unsigned count = 0;
+    for (size_t position = haystack.find(needle); position != notFound; position = haystack.find(needle, position + needle.length())) {
+        if (matches.size() < maxMatches)
+            matches.append({ static_cast<unsigned>(position), needle.length() });
+        ++count;
+    }
+    return count;
+}
+
+std::optional<SimpleRange> TextSearchIndexJava::rangeOfMatch(Document& document, const Match& match)
+{
+    updateIfNeeded(document);
+    if (match.offset + match.length > m_text.length())
+        return std::nullopt;
+
+    auto documentRange = makeRangeSelectingNodeContents(document);
+    StringView expected = StringView(m_text).substring(match.offset, match.length);
+
+    // Resolve from the closest checkpoint. Text the iterator emits around
+    // its start may differ from what it emits mid document, so fall back
+    // to the whole document when the result does not read as the match.
+    size_t index = std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), match.offset, [](unsigned offset, auto& checkpoint) {
+        return offset < checkpoint.offset;
+    }) - m_checkpoints.begin();
+    if (index) {
+        auto& checkpoint = m_checkpoints[index - 1];
+        if (checkpoint.start.container->isConnected() && &checkpoint.start.container->document() == &document) {
+            SimpleRange scope { checkpoint.start, documentRange.end };
+            auto range = resolveCharacterRange(scope, { match.offset - checkpoint.offset, match.length }, findIteratorOptions());
+            if (StringView(plainText(range, findIteratorOptions())) == expected)
+                return range;
+        }
+    }
+    auto range = resolveCharacterRange(documentRange, { match.offset, match.length }, findIteratorOptions());
+    if (StringView(plainText(range, findIteratorOptions())) != expected)
+        return std::nullopt;
+    return range;
+}
+
+} // namespace WebCore
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "SimpleRange.h"
+#include "Supplementable.h"
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+class Document;
+
+// The plain text of a document, as seen by find in page, kept so that
+// repeated searches over a large document do not walk the render tree
+// again. It is rebuilt after the DOM changed. Matches are offsets into
+// the text and are turned into ranges only when asked for.
+class TextSearchIndexJava final : public Supplement<Document> {
+    WTF_MAKE_NONCOPYABLE(TextSearchIndexJava);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    struct Match {
+        unsigned offset;
+        unsigned length;
+    };
+
+    TextSearchIndexJava() = default;
+
+    WEBCORE_EXPORT static TextSearchIndexJava& from(Document&);
+
+    // Returns the number of matches of target in the document, and the
+    // first maxMatches of them.
+    WEBCORE_EXPORT unsigned findAll(Document&, const String& target, bool caseSensitive, unsigned maxMatches, Vector<Match>&);
+
+    // Returns the range of a match returned by findAll, if the document
+    // did not change since.
+    WEBCORE_EXPORT std::optional<SimpleRange> rangeOfMatch(Document&, const Match&);
+
+private:
+    struct Checkpoint {
+        unsigned offset;
+        BoundaryPoint start;
+    };
+
+    static ASCIILiteral supplementName();
+
+    void updateIfNeeded(Document&);
+    const String& foldedText();
+
+    uint64_t m_domTreeVersion { 0 };
+    bool m_isValid { false };
+    String m_text;
+    String m_foldedText;
+    Vector<Checkpoint> m_checkpoints;
+};
+
+} // namespace WebCore
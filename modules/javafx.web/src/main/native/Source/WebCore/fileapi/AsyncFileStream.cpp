@@ -82,6 +82,9 @@ static void callOnFileThread(Function<void ()>&& function)
     static std::once_flag createFileThreadOnce;
     std::call_once(createFileThreadOnce, [] {
         Thread::create("WebCore: AsyncFileStream", [] {
+#if PLATFORM(JAVA)
+            WTF::GetOrAttachJavaEnv();
+#endif
             for (;;) {
                 AutodrainedPool pool;
 
@@ -92,9 +95,6 @@ static void callOnFileThread(Function<void ()>&& function)
 
                 // This can bever be null because we never queue a function that is null.
                 ASSERT(*function);
-#if PLATFORM(JAVA)
-                WTF::AttachThreadAsNonDaemonToJavaEnv autoAttach;
-#endif
                 (*function)();
             }
         });
@@ -29,6 +29,8 @@
 #include "ApplicationCacheHost.h"
 #include "BackForwardController.h"
 #include "CachedPage.h"
+#include "CachedResource.h"
+#include "CachedResourceLoader.h"
 #include "DeviceMotionController.h"
 #include "DeviceOrientationController.h"
 #include "DiagnosticLoggingClient.h"
@@ -352,6 +354,44 @@ void BackForwardCache::setMaxSize(unsigned maxSize)
     prune(PruningReason::None);
 }
 
+void BackForwardCache::setMaxCost(size_t maxCost)
+{
+    m_maxCost = maxCost;
+    prune(PruningReason::None);
+}
+
+size_t BackForwardCache::totalCost() const
+{
+    size_t cost = 0;
+    for (auto& item : m_items)
+        cost += item->m_cachedPage->memoryCost();
+    return cost;
+}
+
+void BackForwardCache::resetStatistics()
+{
+    m_hitCount = 0;
+    m_missCount = 0;
+    m_evictionCount = 0;
+}
+
+// The subresources of a cached page stay alive as long as the page does,
+// their sizes are a cheap estimate of what caching the page costs.
+static size_t estimatedMemoryCost(Page& page)
+{
+    size_t cost = 0;
+    for (RefPtr frame = &page.mainFrame(); frame; frame = frame->tree().traverseNext()) {
+        RefPtr localFrame = dynamicDowncast<LocalFrame>(frame.get());
+        if (!localFrame || !localFrame->document())
+            continue;
+        for (auto& resource : localFrame->document()->cachedResourceLoader().allCachedResources().values()) {
+            if (resource)
+                cost += resource->size();
+        }
+    }
+    return cost;
+}
+
 unsigned BackForwardCache::frameCount() const
 {
     unsigned frameCount = m_items.size();
@@ -504,9 +544,11 @@ bool BackForwardCache::addIfCacheable(HistoryItem& item, Page* page)
     if (!page)
         return false;
 
+    size_t memoryCost = m_maxCost ? estimatedMemoryCost(*page) : 0;
     auto cachedPage = trySuspendPage(*page, ForceSuspension::No);
     if (!cachedPage)
         return false;
+    cachedPage->setMemoryCost(memoryCost);
 
     {
         // Make sure we don't fire any JS events in this scope.
@@ -577,6 +619,7 @@ CachedPage* BackForwardCache::get(HistoryItem& item, Page* page)
     if (!cachedPage) {
         if (item.m_pruningReason != PruningReason::None)
             logBackForwardCacheFailureDiagnosticMessage(page, pruningReasonToDiagnosticLoggingKey(item.m_pruningReason));
+        ++m_missCount;
         return nullptr;
     }
 
@@ -584,8 +627,10 @@ CachedPage* BackForwardCache::get(HistoryItem& item, Page* page)
         LOG(BackForwardCache, "Not restoring page for %s from back/forward cache because cache entry has expired", item.url().string().ascii().data());
         logBackForwardCacheFailureDiagnosticMessage(page, DiagnosticLoggingKeys::expiredKey());
         remove(item);
+        ++m_missCount;
         return nullptr;
     }
+    ++m_hitCount;
     return cachedPage.get();
 }
 
@@ -604,10 +649,11 @@ void BackForwardCache::remove(HistoryItem& item)
 
 void BackForwardCache::prune(PruningReason pruningReason)
 {
-    while (pageCount() > maxSize()) {
+    while (pageCount() > maxSize() || (m_maxCost && totalCost() > m_maxCost)) {
         RefPtr oldestItem = m_items.takeFirst();
         oldestItem->setCachedPage(nullptr);
         oldestItem->m_pruningReason = pruningReason;
+        ++m_evictionCount;
         RELEASE_LOG(BackForwardCache, "BackForwardCache::prune removing item: %s, size: %u / %u", oldestItem->identifier().toString().utf8().data(), pageCount(), maxSize());
     }
 }
@@ -52,6 +52,19 @@ public:
     WEBCORE_EXPORT void setMaxSize(unsigned); // number of pages to cache.
     unsigned maxSize() const { return m_maxSize; }
 
+    // Upper bound for the sum of the memory costs of the cached pages,
+    // zero means that only the page count is limited.
+    WEBCORE_EXPORT void setMaxCost(size_t);
+    size_t maxCost() const { return m_maxCost; }
+    WEBCORE_EXPORT size_t totalCost() const;
+
+    // Back/forward navigations served from the cache, navigations that
+    // found no usable cached page, and pages pruned from the cache.
+    unsigned hitCount() const { return m_hitCount; }
+    unsigned missCount() const { return m_missCount; }
+    unsigned evictionCount() const { return m_evictionCount; }
+    WEBCORE_EXPORT void resetStatistics();
+
     WEBCORE_EXPORT std::unique_ptr<CachedPage> suspendPage(Page&);
     WEBCORE_EXPORT bool addIfCacheable(HistoryItem&, Page*); // Prunes if maxSize() is exceeded.
     WEBCORE_EXPORT void remove(HistoryItem&);
@@ -84,6 +97,10 @@ private:
 
     ListHashSet<RefPtr<HistoryItem>> m_items;
     unsigned m_maxSize {0};
+    size_t m_maxCost {0};
+    unsigned m_hitCount {0};
+    unsigned m_missCount {0};
+    unsigned m_evictionCount {0};
 
 #if ASSERT_ENABLED
     bool m_isInRemoveAllItemsForPage { false };
@@ -62,10 +62,15 @@ public:
 
     void markForContentsSizeChanged() { m_needsUpdateContentsSize = true; }
 
+    // Estimated number of bytes kept alive by this page.
+    size_t memoryCost() const { return m_memoryCost; }
+    void setMemoryCost(size_t memoryCost) { m_memoryCost = memoryCost; }
+
 private:
     WeakRef<Page> m_page;
     MonotonicTime m_expirationTime;
     std::unique_ptr<CachedFrame> m_cachedMainFrame;
+    size_t m_memoryCost { 0 };
 #if ENABLE(VIDEO)
     bool m_needsCaptionPreferencesChanged { false };
 #endif
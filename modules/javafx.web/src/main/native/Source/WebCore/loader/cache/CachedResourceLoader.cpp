@@ -1124,6 +1124,17 @@ ResourceErrorOr<CachedResourceHandle<CachedResource>> CachedResourceLoader::requ
 
     auto mayAddToMemoryCache = computeMayAddToMemoryCache(request, resource.get()) ? MayAddToMemoryCache::Yes : MayAddToMemoryCache::No;
     RevalidationPolicy policy = determineRevalidationPolicy(type, request, resource.get(), forPreload, imageLoading);
+#if PLATFORM(JAVA)
+    if (mayAddToMemoryCache == MayAddToMemoryCache::Yes) {
+        auto& counters = memoryCache.counters();
+        if (policy == Use)
+            ++counters.hits;
+        else if (policy == Revalidate)
+            ++counters.revalidations;
+        else
+            ++counters.misses;
+    }
+#endif
     switch (policy) {
     case Reload:
         if (mayAddToMemoryCache == MayAddToMemoryCache::Yes)
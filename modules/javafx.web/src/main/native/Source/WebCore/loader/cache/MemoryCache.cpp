@@ -407,6 +407,9 @@ void MemoryCache::pruneDeadResourcesToSize(unsigned targetSize)
 
             if (!resource->hasClients() && !resource->isPreloaded() && !resource->isCacheValidator()) {
                 remove(*resource);
+#if PLATFORM(JAVA)
+                ++m_counters.evictions;
+#endif
                 if (targetSize && m_deadSize <= targetSize)
                     return;
             }
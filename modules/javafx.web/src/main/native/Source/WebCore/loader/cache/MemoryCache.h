@@ -168,6 +168,18 @@ public:
     WEBCORE_EXPORT void pruneDeadResourcesToSize(unsigned targetSize);
     WEBCORE_EXPORT void pruneLiveResourcesToSize(unsigned targetSize, bool shouldDestroyDecodedDataForAllLiveResources = false);
 
+#if PLATFORM(JAVA)
+    // Outcomes of the requests looked up in the cache, and the dead resources
+    // evicted to stay within the capacity, since startup.
+    struct Counters {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+        uint64_t revalidations { 0 };
+        uint64_t evictions { 0 };
+    };
+    Counters& counters() { return m_counters; }
+#endif
+
 private:
     using CachedResourceMap = HashMap<std::pair<URL, String /* partitionName */>, WeakPtr<CachedResource>>;
     using LRUList = WeakListHashSet<CachedResource>;
@@ -214,6 +226,9 @@ private:
     SessionCachedResourceMap m_sessionResources;
 
     Timer m_pruneTimer;
+#if PLATFORM(JAVA)
+    Counters m_counters;
+#endif
 };
 
 } // namespace WebCore
@@ -50,6 +50,10 @@
 #include <wtf/SystemTracing.h>
 #include <wtf/text/TextStream.h>
 
+#if PLATFORM(JAVA)
+#include "RenderingProfileJava.h"
+#endif
+
 namespace WebCore {
 
 UpdateScrollInfoAfterLayoutTransaction::UpdateScrollInfoAfterLayoutTransaction() = default;
@@ -183,6 +187,9 @@ void LocalFrameViewLayoutContext::performLayout()
 
     LayoutScope layoutScope(*this);
     TraceScope tracingScope(PerformLayoutStart, PerformLayoutEnd);
+#if PLATFORM(JAVA)
+    RenderingProfileJava::Scope renderingProfileScope(RenderingProfileJava::from(view().frame().page()), RenderingProfileJava::Phase::Layout);
+#endif
     ScriptDisallowedScope::InMainThread scriptDisallowedScope;
     InspectorInstrumentation::willLayout(view().frame());
     SingleThreadWeakPtr<RenderElement> layoutRoot;
@@ -211,6 +211,10 @@
 #include "AccessibilityRootAtspi.h"
 #endif
 
+#if PLATFORM(JAVA)
+#include "RenderingProfileJava.h"
+#endif
+
 namespace WebCore {
 
 static HashSet<WeakRef<Page>>& allPages()
@@ -1819,6 +1823,9 @@ void Page::updateRendering()
     }
 
     m_lastRenderingUpdateTimestamp = MonotonicTime::now();
+#if PLATFORM(JAVA)
+    RenderingProfileJava::Scope renderingProfileScope(RenderingProfileJava::from(this), RenderingProfileJava::Phase::RenderingUpdate);
+#endif
 
     forEachWindowEventLoop([&](WindowEventLoop& eventLoop) {
         eventLoop.didStartRenderingUpdate(*this);
@@ -52,6 +52,12 @@ public:
     WEBCORE_EXPORT static bool& shouldSetupPowerObserver();
     WEBCORE_EXPORT static void restartSharedTimer();
 
+#if PLATFORM(JAVA)
+    // Rounds fire times up to a multiple of the interval so that timers of
+    // background pages share wake ups. Zero turns the alignment off.
+    WEBCORE_EXPORT static void setAlignmentInterval(Seconds);
+#endif
+
 private:
     MainThreadSharedTimer();
 
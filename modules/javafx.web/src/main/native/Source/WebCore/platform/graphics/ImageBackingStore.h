@@ -31,6 +31,10 @@
 #include "NativeImage.h"
 #include "SharedBuffer.h"
 
+#if PLATFORM(JAVA)
+#include "ImageTypes.h"
+#endif
+
 namespace WebCore {
 
 #if USE(CAIRO)
@@ -54,6 +58,17 @@ public:
 
     PlatformImagePtr image() const;
 
+#if PLATFORM(JAVA)
+    // Each subsampling level halves both dimensions, rounding up.
+    static IntSize subsampledSize(const IntSize& size, SubsamplingLevel subsamplingLevel)
+    {
+        unsigned shift = static_cast<unsigned>(subsamplingLevel);
+        return IntSize((size.width() + (1 << shift) - 1) >> shift, (size.height() + (1 << shift) - 1) >> shift);
+    }
+
+    PlatformImagePtr image(SubsamplingLevel) const;
+#endif
+
     bool setSize(const IntSize& size)
     {
         if (size.isEmpty())
@@ -25,7 +25,7 @@
 
 #include "config.h"
 #include "ImageDecoder.h"
-#if !PLATFORM(JAVA) && (!USE(CG) || USE(AVIF))
+#if (!PLATFORM(JAVA) || USE(JAVA_IMAGE_DECODERS)) && (!USE(CG) || USE(AVIF))
 #include "ScalableImageDecoder.h"
 #endif
 #include <wtf/NeverDestroyed.h>
@@ -120,6 +120,12 @@ RefPtr<ImageDecoder> ImageDecoder::create(FragmentedSharedBuffer& data, const St
 #elif USE(DIRECT2D)
     return ImageDecoderDirect2D::create(data, alphaOption, gammaAndColorProfileOption);
 #elif PLATFORM(JAVA)
+#if USE(JAVA_IMAGE_DECODERS)
+    // Formats the in-process decoders recognize are decoded without going through
+    // ImageIO; anything else still falls back to WCImageDecoder.
+    if (auto imageDecoder = ScalableImageDecoder::create(data, alphaOption, gammaAndColorProfileOption))
+        return imageDecoder;
+#endif
     return ImageDecoderJava::create(data, alphaOption, gammaAndColorProfileOption);
 #else
     return ScalableImageDecoder::create(data, alphaOption, gammaAndColorProfileOption);
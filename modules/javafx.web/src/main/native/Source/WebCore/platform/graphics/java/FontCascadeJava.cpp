@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,62 +40,28 @@ namespace WebCore {
 void FontCascade::drawGlyphs(GraphicsContext& context, const Font& font, const GlyphBufferGlyph* glyphs,
     const GlyphBufferAdvance* advances, unsigned numGlyphs, const FloatPoint& point, FontSmoothingMode)
 {
-    // we need to call freeSpace() before refIntArr() and refFloatArr(), see RT-19695.
-    RenderingQueue& rq = context.platformContext()->rq().freeSpace(24);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    //prepare Glyphs array
-    JLocalRef<jintArray> jGlyphs(env->NewIntArray(numGlyphs));
-    ASSERT(jGlyphs);
-    {
-        jint *bufArray = (jint*)env->GetPrimitiveArrayCritical(jGlyphs, NULL);
-        ASSERT(bufArray);
-        memcpy(bufArray, glyphs, sizeof(jint)*numGlyphs);
-        env->ReleasePrimitiveArrayCritical(jGlyphs, bufArray, 0);
+    if (!numGlyphs) {
+        return;
     }
-    static jmethodID refIntArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refIntArr",
-        "([I)I");
-    ASSERT(refIntArr_mID);
-    jint sid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refIntArr_mID,
-        (jintArray)jGlyphs);
-    WTF::CheckAndClearException(env);
-
 
-    // Prepare Offsets/Advances array
-    JLocalRef<jfloatArray> jAdvance(env->NewFloatArray(numGlyphs));
-    WTF::CheckAndClearException(env);
-    ASSERT(jAdvance);
-    {
-        jfloat *bufArray = env->GetFloatArrayElements(jAdvance, NULL);
-        ASSERT(bufArray);
-        for (unsigned i = 0; i < numGlyphs; ++i) {
-            auto pAdvance = advances[i];
-            bufArray[i] = jfloat(pAdvance.width());
-        }
-        env->ReleaseFloatArrayElements(jAdvance, bufArray, 0);
-    }
-    static jmethodID refFloatArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refFloatArr",
-        "([F)I");
-    ASSERT(refFloatArr_mID);
-    jint aid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refFloatArr_mID,
-        (jfloatArray)jAdvance);
-    WTF::CheckAndClearException(env);
+    // The run is carried inline in the queue, which saves allocating java
+    // arrays and two JNI calls per run:
+    //   DRAWGLYPHS font count x y {glyph}*count {advance}*count
+    // Lookup and rasterization of the glyphs go through the glyph cache of
+    // the Prism font strike, and the quads of consecutive runs are batched.
+    RenderingQueue& rq = context.platformContext()->rq().freeSpace(20 + 8 * numGlyphs);
 
-    rq  << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWSTRING_FAST
+    rq  << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWGLYPHS
         << font.platformData().nativeFontData()
-        << sid
-        << aid
+        << (jint)numGlyphs
         << (jfloat)point.x()
         << (jfloat)point.y();
+    for (unsigned i = 0; i < numGlyphs; ++i) {
+        rq << (jint)glyphs[i];
+    }
+    for (unsigned i = 0; i < numGlyphs; ++i) {
+        rq << (jfloat)advances[i].width();
+    }
 }
 
 bool FontCascade::canReturnFallbackFontsForComplexText()
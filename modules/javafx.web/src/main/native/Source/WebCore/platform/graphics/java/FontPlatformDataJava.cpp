@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,9 @@
 #include "NotImplemented.h"
 
 #include <wtf/Assertions.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/TinyLRUCache.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/WTFString.h>
 
@@ -56,6 +59,41 @@ RefPtr<RQRef> getJavaFont(const String& family, float size, bool italic, bool bo
 
     return RQRef::create(wcFont);
 }
+
+struct JavaFontKey {
+    String family;
+    float size;
+    bool italic;
+    bool bold;
+
+    bool operator==(const JavaFontKey&) const = default;
+};
+
+struct JavaFontCachePolicy : TinyLRUCachePolicy<JavaFontKey, RefPtr<RQRef>> {
+    static RefPtr<RQRef> createValueForKey(const JavaFontKey& key)
+    {
+        return getJavaFont(key.family, key.size, key.italic, key.bold);
+    }
+
+    static JavaFontKey createKeyForStorage(const JavaFontKey& key)
+    {
+        return { key.family.isolatedCopy(), key.size, key.italic, key.bold };
+    }
+};
+
+// Font descriptions that differ in ways the java font does not see, and
+// font-family lists naming fonts that are not installed, query the same
+// java fonts over and over. Recent lookups, including failed ones, are
+// answered here. Handing out the same RQRef also lets platformIsEqual()
+// compare most fonts without calling into java.
+RefPtr<RQRef> getCachedJavaFont(const String& family, float size, bool italic, bool bold)
+{
+    static Lock lock;
+    static NeverDestroyed<TinyLRUCache<JavaFontKey, RefPtr<RQRef>, 64, JavaFontCachePolicy>> cache;
+
+    Locker locker { lock };
+    return cache->get({ family, size, italic, bold });
+}
 }
 
 FontPlatformData::FontPlatformData(RefPtr<RQRef> font, float size)
@@ -67,7 +105,7 @@ FontPlatformData::FontPlatformData(RefPtr<RQRef> font, float size)
 std::unique_ptr<FontPlatformData> FontPlatformData::create(
         const FontDescription& fontDescription, const AtomString& family)
 {
-    RefPtr<RQRef> wcFont = getJavaFont(
+    RefPtr<RQRef> wcFont = getCachedJavaFont(
             family,
             fontDescription.computedSize(),
             isItalic(fontDescription.italic()),
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -93,6 +93,13 @@ static void setGradient(Gradient &gradient,
     p0 = gradientSpaceTransformation.mapPoint(p0);
     p1 = gradientSpaceTransformation.mapPoint(p1);
 
+    // The gradient replaces the java paint, a following color must be re-sent.
+    if (id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT) {
+        context->invalidateFillPaint();
+    } else {
+        context->invalidateStrokePaint();
+    }
+
     context->rq().freeSpace(4 * 11 + 20 * nStops)
     << id
     << (jfloat)p0.x()
@@ -161,8 +168,7 @@ void GraphicsContextJava::savePlatformState()
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(4)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->saveState();
 }
 
 void GraphicsContextJava::restore(GraphicsContextState::Purpose) {
@@ -175,8 +181,7 @@ void GraphicsContextJava::restorePlatformState()
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(4)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->restoreState();
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -230,12 +235,7 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
     if (paintingDisabled())
         return;
 
-    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(36)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
-    << rect.x() << rect.y()
-    << rect.width() << rect.height()
-    << r << g << b << a;
+    platformContext()->fillRect(rect, &color);
 }
 
 void GraphicsContextJava::fillRect(const FloatRect& rect)
@@ -261,10 +261,7 @@ void GraphicsContextJava::fillRect(const FloatRect& rect)
                 com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT);
         }
 
-        platformContext()->rq().freeSpace(20)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFF
-        << rect.x() << rect.y()
-        << rect.width() << rect.height();
+        platformContext()->fillRect(rect);
     }
 }
 void GraphicsContextJava::fillRect(const FloatRect&, Gradient&, const AffineTransform&)
@@ -491,9 +488,7 @@ void GraphicsContextJava::translate(float x, float y)
         return;
 
     m_state.transform.translate(x, y);
-    platformContext()->rq().freeSpace(12)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE
-    << x << y;
+    platformContext()->translate(x, y);
 }
 
 void GraphicsContextJava::setPlatformFillColor(const Color& color)
@@ -501,10 +496,7 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
     if (paintingDisabled())
         return;
 
-    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
-    << r << g << b << a;
+    platformContext()->setFillColor(color);
 }
 
 void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
@@ -526,9 +518,7 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
-    << (jint)style;
+    platformContext()->setStrokeStyle(style);
 }
 
 void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
@@ -536,10 +526,7 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
     if (paintingDisabled())
         return;
 
-    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
-    << r << g << b << a;
+    platformContext()->setStrokeColor(color);
 }
 
 void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
@@ -547,9 +534,7 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
-    << strokeThickness;
+    platformContext()->setStrokeThickness(strokeThickness);
 }
 
 void GraphicsContextJava::setPlatformImageInterpolationQuality(InterpolationQuality)
@@ -617,9 +602,7 @@ void GraphicsContextJava::beginTransparencyLayer(float opacity)
     if (paintingDisabled())
       return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
-    << opacity;
+    platformContext()->beginTransparencyLayer(opacity);
 }
 
 void GraphicsContextJava::endTransparencyLayer()
@@ -627,8 +610,7 @@ void GraphicsContextJava::endTransparencyLayer()
     if (paintingDisabled())
       return;
 
-    platformContext()->rq().freeSpace(4)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    platformContext()->endTransparencyLayer();
 
     GraphicsContext::endTransparencyLayer();
 }
@@ -752,7 +734,7 @@ void GraphicsContextJava::strokePath(const Path& path)
 
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_STROKE_PATH
-    << copyPath(path.platformPath())
+    << path.platformPath()
     << (jint)fillRule();
 }
 
@@ -769,7 +751,7 @@ static void setClipPath(
     state.clipBounds.intersect(state.transform.mapRect(path.fastBoundingRect()));
     gc.platformContext()->rq().freeSpace(16)
     << jint(com_sun_webkit_graphics_GraphicsDecoder_CLIP_PATH)
-    << copyPath(path.platformPath())
+    << path.platformPath()
     << jint(wrule == WindRule::EvenOdd
        ? com_sun_webkit_graphics_WCPath_RULE_EVENODD
        : com_sun_webkit_graphics_WCPath_RULE_NONZERO)
@@ -803,6 +785,16 @@ void GraphicsContextJava::drawPlatformImage(const PlatformImagePtr& image, const
     if (!image || !image->getImage())
         return;
 
+    // The common case (e.g. canvas drawImage) needs no state change, which
+    // lets consecutive draws of the same image be merged into one command.
+    if (options.orientation() == ImageOrientation::Orientation::None
+        && options.compositeOperator() == compositeOperation()
+        && options.blendMode() == blendMode()) {
+        platformContext()->drawImage(image->getImage(), destRect, srcRect);
+        return;
+    }
+
+    auto compositeMode = this->compositeMode();
     savePlatformState();
     setCompositeOperation(options.compositeOperator(), options.blendMode());
 
@@ -821,14 +813,10 @@ void GraphicsContextJava::drawPlatformImage(const PlatformImagePtr& image, const
         }
     }
 
-    platformContext()->rq().freeSpace(72)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE
-        << image->getImage()
-        << adjustedDestRect.x() << adjustedDestRect.y()
-        << adjustedDestRect.width() << adjustedDestRect.height()
-        << adjustedSrcRect.x() << adjustedSrcRect.y()
-        << adjustedSrcRect.width() << adjustedSrcRect.height();
+    platformContext()->drawImage(image->getImage(), adjustedDestRect, adjustedSrcRect);
     restorePlatformState();
+    // Keep the tracked composite mode in line with the restored java state.
+    setCompositeMode(compositeMode);
 }
 
 void GraphicsContextJava::drawPlatformPattern(const PlatformImagePtr& image, const FloatRect& destRect, const FloatRect& tileRect, const AffineTransform& patternTransform, const FloatPoint& phase, const FloatSize&,ImagePaintingOptions)
@@ -895,7 +883,7 @@ void GraphicsContextJava::fillPath(const Path& path)
 
         platformContext()->rq().freeSpace(12)
         << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILL_PATH
-        << copyPath(path.platformPath())
+        << path.platformPath()
         << (jint)fillRule();
     }
 }
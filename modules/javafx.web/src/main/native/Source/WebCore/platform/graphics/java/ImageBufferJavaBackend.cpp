@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,8 @@
 #include "MIMETypeRegistry.h"
 #include "PlatformContextJava.h"
 #include "GraphicsContextJava.h"
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
+
 namespace WebCore {
 
 std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
@@ -141,11 +143,17 @@ Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::
 
 void* ImageBufferJavaBackend::getData()
 {
+    auto& rq = context().platformContext()->rq();
+    if (m_pixels && rq.bufferGeneration() == m_syncGeneration && rq.position() == m_syncPosition)
+        return m_pixels;
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     //RenderQueue need to be processed before pixel buffer extraction.
     //For that purpose it has to be in actual state.
-    context().platformContext()->rq().flushBuffer();
+    rq.flushBuffer();
+    m_pixels = nullptr;
+    m_uploadRect = { };
 
     static jmethodID midGetBGRABytes = env->GetMethodID(
         PG_GetImageClass(env),
@@ -159,21 +167,44 @@ void* ImageBufferJavaBackend::getData()
     }
     JLObject byteBuffer(pixelBuf);
 
-    return env->GetDirectBufferAddress(byteBuffer);
+    m_pixels = env->GetDirectBufferAddress(byteBuffer);
+    markPixelsInSync();
+    return m_pixels;
 }
 
-void ImageBufferJavaBackend::update() const
+void ImageBufferJavaBackend::markPixelsInSync()
 {
-    JNIEnv* env = WTF::GetJavaEnv();
+    auto& rq = context().platformContext()->rq();
+    m_syncGeneration = rq.bufferGeneration();
+    m_syncPosition = rq.position();
+}
 
-    static jmethodID midUpdateByteBuffer = env->GetMethodID(
-        PG_GetImageClass(env),
-        "drawPixelBuffer",
-        "()V");
-    ASSERT(midUpdateByteBuffer);
+void ImageBufferJavaBackend::uploadPixels(const IntRect& rect)
+{
+    if (rect.isEmpty())
+        return;
 
-    env->CallObjectMethod(getWCImage(), midUpdateByteBuffer);
-    WTF::CheckAndClearException(env);
+    // The texture is refreshed from the mapped buffer by a queued command so
+    // that the upload stays ordered with the drawing around it. getData() has
+    // just verified that nothing follows the previous upload command, so a
+    // run of puts ends up as a single upload of their bounding box.
+    auto& rq = context().platformContext()->rq();
+    if (!m_uploadRect.isEmpty()) {
+        m_uploadRect.unite(rect);
+        rq.putIntAt(m_uploadPosition, m_uploadRect.x());
+        rq.putIntAt(m_uploadPosition + 4, m_uploadRect.y());
+        rq.putIntAt(m_uploadPosition + 8, m_uploadRect.width());
+        rq.putIntAt(m_uploadPosition + 12, m_uploadRect.height());
+    } else {
+        m_uploadRect = rect;
+        rq.freeSpace(24)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_UPDATE_PIXEL_BUFFER
+        << m_image->getImage()
+        << (jint)rect.x() << (jint)rect.y()
+        << (jint)rect.width() << (jint)rect.height();
+        m_uploadPosition = rq.position() - 16;
+    }
+    markPixelsInSync();
 }
 
 GraphicsContext& ImageBufferJavaBackend::context()
@@ -215,8 +246,19 @@ void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, void* data,
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat, void* destination)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, destination);
-    update();
 
+    // Same clipping as ImageBufferBackend::putPixelBuffer(), to find the
+    // pixels it just wrote.
+    IntRect sourceRectClipped = intersection({ IntPoint::zero(), sourcePixelBuffer.size() }, srcRect);
+    IntRect destinationRect = sourceRectClipped;
+    destinationRect.moveBy(destPoint);
+    if (srcRect.x() < 0)
+        destinationRect.setX(destinationRect.x() - srcRect.x());
+    if (srcRect.y() < 0)
+        destinationRect.setY(destinationRect.y() - srcRect.y());
+    destinationRect.intersect({ IntPoint::zero(), size() });
+
+    uploadPixels(destinationRect);
 }
 
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat)
@@ -225,8 +267,6 @@ void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer
     if (!data)
         return;
     putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, data);
-    update();
-
 }
 
 size_t ImageBufferJavaBackend::calculateMemoryCost(const Parameters& parameters)
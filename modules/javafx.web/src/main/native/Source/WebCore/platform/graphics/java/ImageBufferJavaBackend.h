@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,7 +47,6 @@ public:
     JLObject getWCImage() const;
     Vector<uint8_t> toDataJava(const String& mimeType, std::optional<double>) override;
     void* getData();
-    void update() const;
 
     GraphicsContext& context() override;
     void flushContext() override;
@@ -72,9 +71,23 @@ protected:
 
     unsigned bytesPerRow() const override;
 
+    void uploadPixels(const IntRect&);
+    void markPixelsInSync();
+
     PlatformImagePtr m_image;
     std::unique_ptr<GraphicsContext> m_context;
     IntSize m_backendSize;
+
+    // Mapped pixel buffer of the image, valid while nothing has been
+    // recorded into the rendering queue since it was fetched.
+    void* m_pixels { nullptr };
+    unsigned m_syncGeneration { 0 };
+    int m_syncPosition { -1 };
+
+    // Area covered by the last UPDATE_PIXEL_BUFFER command and its offset in
+    // the queue, so that consecutive puts can widen it in place.
+    IntRect m_uploadRect;
+    int m_uploadPosition { -1 };
 };
 
 } // namespace WebCore
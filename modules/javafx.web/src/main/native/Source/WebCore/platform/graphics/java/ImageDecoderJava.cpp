@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,9 +27,9 @@
 
 #include "ImageDecoderJava.h"
 
+#include "ImageBackingStore.h"
 #include "NotImplemented.h"
 #include "SharedBuffer.h"
-#include "SharedBuffer.h"
 #include "PlatformJavaClasses.h"
 #include "Logging.h"
 
@@ -107,17 +107,18 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;I)V");
     ASSERT(midAddImageData);
 
+    jint totalSize = static_cast<jint>(data.size());
     while (m_receivedDataSize < data.size()) {
         const auto& someData = data.getSomeData(m_receivedDataSize);
         unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
-            // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+        // The segment is handed over in place, the decoder copies it
+        // before returning.
+        JLObject jBuffer(env->NewDirectByteBuffer(const_cast<uint8_t*>(someData.data()), length));
+        if (jBuffer && !WTF::CheckAndClearException(env)) {
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)jBuffer, totalSize);
             WTF::CheckAndClearException(env);
         }
         m_receivedDataSize += length;
@@ -125,7 +126,7 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
 
     if (allDataReceived) {
         m_isAllDataReceived = true;
-        env->CallVoidMethod(m_nativeDecoder, midAddImageData, 0);
+        env->CallVoidMethod(m_nativeDecoder, midAddImageData, nullptr, totalSize);
         WTF::CheckAndClearException(env);
     }
 }
@@ -176,7 +177,7 @@ size_t ImageDecoderJava::frameCount() const
         : count;
 }
 
-PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
+PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel subsamplingLevel, const DecodingOptions&)
 {
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
@@ -186,13 +187,14 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
     static jmethodID midGetFrame = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "getFrame",
-        "(I)Lcom/sun/webkit/graphics/WCImageFrame;");
+        "(II)Lcom/sun/webkit/graphics/WCImageFrame;");
     ASSERT(midGetFrame);
 
     JLObject frame(env->CallObjectMethod(
         m_nativeDecoder,
         midGetFrame,
-        idx));
+        idx,
+        static_cast<jint>(subsamplingLevel)));
     WTF::CheckAndClearException(env);
 
     if(!frame)
@@ -248,7 +250,7 @@ IntSize ImageDecoderJava::size() const
     return m_size;
 }
 
-IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
+IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel subsamplingLevel) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
@@ -264,19 +266,36 @@ IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
                         midGetFrameSize,
                         idx));
     if (!jsize) {
-        return m_size;
+        return ImageBackingStore::subsampledSize(m_size, subsamplingLevel);
     }
 
     jint* size = (jint*)env->GetPrimitiveArrayCritical((jintArray)jsize, 0);
     IntSize frameSize(size[0], size[1]);
     env->ReleasePrimitiveArrayCritical(jsize, size, 0);
 
-    return frameSize;
+    // WCImageDecoder decodes subsampled frames to exactly this size.
+    return ImageBackingStore::subsampledSize(frameSize, subsamplingLevel);
+}
+
+void ImageDecoderJava::clearFrameBufferCache(size_t)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env || !m_nativeDecoder) {
+        return;
+    }
+
+    static jmethodID midDestroyDecodedData = env->GetMethodID(
+        PG_GetGraphicsImageDecoderClass(env),
+        "destroyDecodedData",
+        "()V");
+    ASSERT(midDestroyDecodedData);
+
+    env->CallVoidMethod(m_nativeDecoder, midDestroyDecodedData);
+    WTF::CheckAndClearException(env);
 }
 
 bool ImageDecoderJava::frameAllowSubsamplingAtIndex(size_t) const
 {
-    notImplemented();
     return true;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@
 #include "ImageBuffer.h"
 #include "FloatRect.h"
 #include "GraphicsContext.h"
+#include "ImageJava.h"
 #include "TransformationMatrix.h"
 #include "PlatformJavaClasses.h"
 #include "com_sun_webkit_graphics_GraphicsDecoder.h"
@@ -40,6 +41,8 @@
 #include "PlatformContextJava.h"
 #include "Logging.h"
 
+#include <wtf/MainThread.h>
+
 class ImageBuffer;
 
 namespace WebCore {
@@ -59,13 +62,7 @@ void Image::drawImage(GraphicsContext& gc, const FloatRect &dstRect, const Float
     CompositeOperator oldCompositeOperator = gc.compositeOperation();
     gc.setCompositeOperation(compositeOperator);
 
-    gc.platformContext()->rq().freeSpace(72)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE
-    << nativeImage->platformImage()->getImage()
-    << dstRect.x() << dstRect.y()
-    << dstRect.width() << dstRect.height()
-    << srcRect.x() << srcRect.y()
-    << srcRect.width() << srcRect.height();
+    gc.platformContext()->drawImage(nativeImage->platformImage()->getImage(), dstRect, srcRect);
 
     gc.setCompositeOperation(oldCompositeOperator);
 
@@ -81,6 +78,45 @@ Ref<Image> ImageAdapter::loadPlatformResource(const char *name)
 void ImageAdapter::invalidate()
 {
 }
+
+void ImageJava::createImageFromPixels() const
+{
+    ASSERT(isMainThread());
+    auto pixels = WTFMove(m_pixels);
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env) {
+        return;
+    }
+
+    static jmethodID s_createFrame_mID = env->GetMethodID(
+            PG_GetGraphicsManagerClass(env), "createFrame",
+            "(IILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/WCImageFrame;");
+    ASSERT(s_createFrame_mID);
+
+    // WCGraphicsManager.createFrame copies the pixels, so the buffer can go
+    // away as soon as the call returns.
+    JLObject data(env->NewDirectByteBuffer(
+            const_cast<uint8_t*>(pixels->data()),
+            pixels->size()));
+    if (!data) {
+        WTF::CheckAndClearException(env);
+        return;
+    }
+
+    JLObject frame(env->CallObjectMethod(
+        PL_GetGraphicsManager(env),
+        s_createFrame_mID,
+        m_width,
+        m_height,
+        (jobject)data));
+    if (WTF::CheckAndClearException(env) || !frame) {
+        return;
+    }
+
+    m_rqoImage = RQRef::create(frame);
+}
+
 #if !USE(IMAGEIO)
 NativeImagePtr ImageFrame::asNewNativeImage() const
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,11 +25,12 @@
 
 #pragma once
 
-#include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
+#include <wtf/ThreadSafeRefCounted.h>
 
 #include "PlatformJavaClasses.h"
 #include "RenderingQueue.h"
+#include "SharedBuffer.h"
 
 namespace WebCore {
 
@@ -37,16 +38,29 @@ class RenderingQueue;
 
 // Used as PlatformImagePtr
 
-class ImageJava : public RefCounted<ImageJava> {
+class ImageJava : public ThreadSafeRefCounted<ImageJava> {
 public:
     static RefPtr<ImageJava> create(RefPtr<RQRef> rqoImage, RefPtr<RenderingQueue> rq, int w, int h)
     {
         return adoptRef(new ImageJava(rqoImage, rq, w, h));
     }
 
+    // Wraps premultiplied ARGB pixels produced by the in-process image decoders.
+    // Those may run on a decoding thread, so the Java image is only created when
+    // the frame is first used on the main thread.
+    static RefPtr<ImageJava> create(Ref<FragmentedSharedBuffer::DataSegment>&& pixels, int w, int h)
+    {
+        return adoptRef(new ImageJava(WTFMove(pixels), w, h));
+    }
+
     FloatSize size() const { return FloatSize(m_width, m_height); }
 
-    RefPtr<RQRef> getImage() const { return m_rqoImage; }
+    RefPtr<RQRef> getImage() const
+    {
+        if (m_pixels)
+            createImageFromPixels();
+        return m_rqoImage;
+    }
 
     RefPtr<RenderingQueue> getRenderingQueue() const { return m_rq; }
 
@@ -57,9 +71,16 @@ private:
         : m_width(w), m_height(h), m_rq(rq), m_rqoImage(rqoImage)
     {}
 
+    ImageJava(Ref<FragmentedSharedBuffer::DataSegment>&& pixels, int w, int h)
+        : m_width(w), m_height(h), m_pixels(WTFMove(pixels))
+    {}
+
+    void createImageFromPixels() const;
+
     int m_width, m_height;
     RefPtr<RenderingQueue> m_rq;
-    RefPtr<RQRef> m_rqoImage;
+    mutable RefPtr<RQRef> m_rqoImage;
+    mutable RefPtr<FragmentedSharedBuffer::DataSegment> m_pixels;
 };
 
 } // namespace WebCore
\ No newline at end of file
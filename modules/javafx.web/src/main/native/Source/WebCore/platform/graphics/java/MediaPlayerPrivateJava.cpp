@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -263,6 +263,7 @@ MediaPlayerPrivate::MediaPlayerPrivate(MediaPlayer *player)
     , m_networkState(MediaPlayer::NetworkState::Empty)
     , m_readyState(MediaPlayer::ReadyState::HaveNothing)
     , m_isVisible(false)
+    , m_newFramePending(false)
     , m_hasVideo(false)
     , m_hasAudio(false)
     , m_paused(true)
@@ -413,6 +414,10 @@ void MediaPlayerPrivate::setPageIsVisible(bool visible,String&& sceneIdentifier)
     if (m_isVisible != visible) {
         PLOG_TRACE2("MediaPlayerPrivate setPageIsVisible: %d => %d\n", m_isVisible ? 1 : 0, visible ? 1 : 0);
         m_isVisible = visible;
+        if (m_isVisible && m_newFramePending) {
+            // frames that arrived while hidden were not repainted
+            m_player->repaint();
+        }
     }
 }
 
@@ -581,6 +586,7 @@ void MediaPlayerPrivate::setSize(const IntSize& size)
 void MediaPlayerPrivate::paint(GraphicsContext& gc, const FloatRect& r)
 {
 //    PLOG_TRACE4(">>MediaPlayerPrivate paint (%d, %d), [%d x %d]\n", r.x(), r.y(), r.width(), r.height());
+    m_newFramePending = false;
     if (gc.paintingDisabled()) {
         PLOG_TRACE0("<<MediaPlayerPrivate paint (!gc or paintingDisabled)\n");
         return;
@@ -770,7 +776,15 @@ void MediaPlayerPrivate::notifySizeChanged(int width, int height)
 void MediaPlayerPrivate::notifyNewFrame()
 {
     PLOG_TRACE0(">>MediaPlayerPrivate notifyNewFrame\n");
-    m_player->repaint();
+    if (m_newFramePending) {
+        // the previous frame is still waiting to be painted; the paint will
+        // pick up the latest frame
+        return;
+    }
+    m_newFramePending = true;
+    if (m_isVisible) {
+        m_player->repaint();
+    }
     //PLOG_TRACE0("<<MediaPlayerPrivate notifyNewFrame\n");
 }
 
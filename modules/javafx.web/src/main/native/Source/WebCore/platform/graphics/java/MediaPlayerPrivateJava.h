@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -159,6 +159,9 @@ namespace WebCore {
         volatile MediaPlayer::ReadyState m_readyState;
 
         bool m_isVisible;
+        // A repaint was requested for a new frame and the frame has not been
+        // painted yet; further frames need no repaint of their own.
+        bool m_newFramePending;
         bool m_hasVideo;
         bool m_hasAudio;
         FloatSize m_naturalSize;
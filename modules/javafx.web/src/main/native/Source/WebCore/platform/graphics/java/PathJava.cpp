@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,7 +39,7 @@
 #include <wtf/text/WTFString.h>
 #include <wtf/java/JavaRef.h>
 
-#include "com_sun_webkit_graphics_WCPathIterator.h"
+#include "com_sun_webkit_graphics_WCPath.h"
 
 namespace WebCore {
 
@@ -64,19 +64,6 @@ Ref<PathJava> PathJava::create(const PathSegment& segment)
     return pathJava;
 }
 
-RefPtr<RQRef> createEmptyPath()
-{
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-        "createWCPath", "()Lcom/sun/webkit/graphics/WCPath;");
-    ASSERT(mid);
-
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid));
-    ASSERT(ref);
-    WTF::CheckAndClearException(env);
-    return RQRef::create(ref);
-}
-
 static GraphicsContext& scratchContext()
 {
     static auto img = ImageBuffer::create(FloatSize(1.f, 1.f), RenderingPurpose::Unspecified, 1, DestinationColorSpace::SRGB(), PixelFormat::BGRA8);
@@ -84,115 +71,101 @@ static GraphicsContext& scratchContext()
     return context;
 }
 
-RefPtr<RQRef> copyPath(RefPtr<RQRef> p)
-{
-    if (!p) {
-        return createEmptyPath();
-    }
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-        "createWCPath",
-        "(Lcom/sun/webkit/graphics/WCPath;)Lcom/sun/webkit/graphics/WCPath;");
-    ASSERT(mid);
-
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid, (jobject)*p));
-    ASSERT(ref);
-    WTF::CheckAndClearException(env);
-
-    return RQRef::create(ref);
-}
-
-Ref<PathJava> PathJava::create(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&& elementsStream)
+PathJava::PathJava()
+    : m_elementsStream(PathStream::create())
 {
-    return adoptRef(*new PathJava(WTFMove(platformPath), WTFMove(elementsStream)));
 }
 
-PathJava::PathJava()
-    : m_platformPath(createEmptyPath())
-    , m_elementsStream(PathStream::create())
+static RefPtr<PathStream> copyStream(const RefPtr<PathStream>& stream)
 {
+    if (!stream)
+        return nullptr;
+    RefPtr<PathImpl> copy = stream->copy();
+    return downcast<PathStream>(WTFMove(copy));
 }
 
-PathJava::PathJava(RefPtr<RQRef>&& platformPath, RefPtr<PathStream>&& elementsStream)
-    : m_platformPath(WTFMove(platformPath))
-    , m_elementsStream(WTFMove(elementsStream))
+PathJava::PathJava(const PathJava& other)
+    : PathImpl()
+    , m_commands(other.m_commands)
+    , m_coords(other.m_coords)
+    , m_elementsStream(copyStream(other.m_elementsStream))
+    , m_platformPath(other.m_platformPath)
 {
-    ASSERT(m_platformPath);
 }
 
 Ref<PathImpl> PathJava::copy() const
 {
-    RefPtr<RQRef> platformPathCopy(copyPath(platformPath()));
-
-    auto elementsStream = m_elementsStream ? RefPtr<PathImpl> { m_elementsStream->copy() } : nullptr;
-
-    return PathJava::create(WTFMove(platformPathCopy), downcast<PathStream>(WTFMove(elementsStream)));
+    // The java path is never modified once built, so the copy can share it.
+    return adoptRef(*new PathJava(*this));
 }
 
-PlatformPathPtr PathJava::platformPath() const
+void PathJava::record(jint command, std::initializer_list<double> coords)
 {
-    return m_platformPath.get();
+    m_commands.append(command);
+    m_coords.append(std::span { coords.begin(), coords.size() });
+    m_platformPath = nullptr;
 }
 
-
-void PathJava::add(PathMoveTo moveto)
+PlatformPathPtr PathJava::platformPath() const
 {
-    ASSERT(m_platformPath);
+    if (m_platformPath) {
+        return m_platformPath;
+    }
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
+    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
+        "createWCPath", "([I[D)Lcom/sun/webkit/graphics/WCPath;");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y());
+    JLocalRef<jintArray> commands(env->NewIntArray(m_commands.size()));
+    JLocalRef<jdoubleArray> coords(env->NewDoubleArray(m_coords.size()));
+    if (WTF::CheckAndClearException(env) || !commands || !coords) {
+        return nullptr;
+    }
+    env->SetIntArrayRegion(commands, 0, m_commands.size(), m_commands.data());
+    env->SetDoubleArrayRegion(coords, 0, m_coords.size(), m_coords.data());
+
+    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid,
+        (jintArray)commands, (jdoubleArray)coords));
+    ASSERT(ref);
     WTF::CheckAndClearException(env);
+
+    m_platformPath = RQRef::create(ref);
+    return m_platformPath;
 }
 
-void PathJava::add(PathLineTo lineTo)
+void PathJava::add(PathMoveTo moveto)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
+    if (m_elementsStream)
+        m_elementsStream->add(moveto);
+    record(com_sun_webkit_graphics_WCPath_SEG_MOVETO, { moveto.point.x(), moveto.point.y() });
+}
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y());
-    WTF::CheckAndClearException(env);
+void PathJava::add(PathLineTo lineTo)
+{
+    if (m_elementsStream)
+        m_elementsStream->add(lineTo);
+    record(com_sun_webkit_graphics_WCPath_SEG_LINETO, { lineTo.point.x(), lineTo.point.y() });
 }
 
 void PathJava::add(PathQuadCurveTo quadTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream)
+        m_elementsStream->add(quadTo);
+    record(com_sun_webkit_graphics_WCPath_SEG_QUADTO, {
+        quadTo.controlPoint.x(), quadTo.controlPoint.y(),
+        quadTo.endPoint.x(), quadTo.endPoint.y() });
 }
 
 void PathJava::add(PathBezierCurveTo bezierTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)bezierTo.controlPoint1.x(), (jdouble)bezierTo.controlPoint1.y(),
-                        (jdouble)bezierTo.controlPoint2.x(), (jdouble)bezierTo.controlPoint2.y(),
-                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream)
+        m_elementsStream->add(bezierTo);
+    record(com_sun_webkit_graphics_WCPath_SEG_CUBICTO, {
+        bezierTo.controlPoint1.x(), bezierTo.controlPoint1.y(),
+        bezierTo.controlPoint2.x(), bezierTo.controlPoint2.y(),
+        bezierTo.endPoint.x(), bezierTo.endPoint.y() });
 }
 
 static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
@@ -202,45 +175,29 @@ static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const Flo
 
 void PathJava::add(PathArcTo arcTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)arcTo.controlPoint1.x(), (jdouble)arcTo.controlPoint1.y(),
-                        (jdouble)arcTo.controlPoint2.x(), (jdouble)arcTo.controlPoint2.y(), (jdouble)arcTo.radius);
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream)
+        m_elementsStream->add(arcTo);
+    record(com_sun_webkit_graphics_WCPath_SEG_ARCTO, {
+        arcTo.controlPoint1.x(), arcTo.controlPoint1.y(),
+        arcTo.controlPoint2.x(), arcTo.controlPoint2.y(), arcTo.radius });
 }
 
 void PathJava::add(PathArc arc)
 {
-    ASSERT(m_platformPath);
-    bool clockwise = false;
-    const RotationDirection direction = arc.direction;
-    if (direction == RotationDirection::Counterclockwise) {
-        clockwise = true;
-    } else if (direction == RotationDirection::Clockwise) {
-        clockwise = false;
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
+    // WCPath.addArc() takes the canvas "anticlockwise" flag.
+    bool anticlockwise = arc.direction == RotationDirection::Counterclockwise;
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
-        (jdouble)arc.radius, (jdouble)arc.startAngle, (jdouble)arc.endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream)
+        m_elementsStream->add(arc);
+    record(com_sun_webkit_graphics_WCPath_SEG_ARC, {
+        arc.center.x(), arc.center.y(), arc.radius,
+        arc.startAngle, arc.endAngle, anticlockwise ? 1. : 0. });
 }
+
 void PathJava::add(PathClosedArc closedArc)
 {
-    notImplemented();
+    add(closedArc.arc);
+    add(PathCloseSubpath { });
 }
 
 void PathJava::add(PathEllipse ellipse)
@@ -250,32 +207,19 @@ void PathJava::add(PathEllipse ellipse)
 
 void PathJava::add(PathEllipseInRect ellipseInRect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)ellipseInRect.rect.x(), (jdouble)ellipseInRect.rect.y(),
-                        (jdouble)ellipseInRect.rect.width(), (jdouble)ellipseInRect.rect.height());
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream)
+        m_elementsStream->add(ellipseInRect);
+    record(com_sun_webkit_graphics_WCPath_SEG_ELLIPSE, {
+        ellipseInRect.rect.x(), ellipseInRect.rect.y(),
+        ellipseInRect.rect.width(), ellipseInRect.rect.height() });
 }
 
 void PathJava::add(PathRect rect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
-                              (jdouble)rect.rect.width(), (jdouble)rect.rect.height());
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream)
+        m_elementsStream->add(rect);
+    record(com_sun_webkit_graphics_WCPath_SEG_RECT, {
+        rect.rect.x(), rect.rect.y(), rect.rect.width(), rect.rect.height() });
 }
 
 void PathJava::add(PathRoundedRect roundedRect)
@@ -283,18 +227,11 @@ void PathJava::add(PathRoundedRect roundedRect)
     addBeziersForRoundedRect(roundedRect.roundedRect);
 }
 
-void PathJava::add(PathCloseSubpath)
+void PathJava::add(PathCloseSubpath closeSubpath)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream)
+        m_elementsStream->add(closeSubpath);
+    record(com_sun_webkit_graphics_WCPath_SEG_CLOSE, { });
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
@@ -304,75 +241,39 @@ void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
 
 void PathJava::applySegments(const PathSegmentApplier& applier) const
 {
-    applyElements([&](const PathElement& pathElement) {
-        switch (pathElement.type) {
-        case PathElement::Type::MoveToPoint:
-            applier({ PathMoveTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddLineToPoint:
-            applier({ PathLineTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddQuadCurveToPoint:
-            applier({ PathQuadCurveTo { pathElement.points[0], pathElement.points[1] } });
-            break;
-
-        case PathElement::Type::AddCurveToPoint:
-            applier({ PathBezierCurveTo { pathElement.points[0], pathElement.points[1], pathElement.points[2] } });
-            break;
-
-        case PathElement::Type::CloseSubpath:
-            applier({ PathCloseSubpath { } });
-            break;
-        }
-    });
+    if (m_elementsStream)
+        m_elementsStream->applySegments(applier);
 }
 
 bool PathJava::applyElements(const PathElementApplier& applier) const
 {
-    // need to implement this method after looking into cairo implementation
-    return true;
+    return m_elementsStream && m_elementsStream->applyElements(applier);
 }
 
 bool PathJava::isEmpty() const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "isEmpty", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    if (const PathImpl* elements = m_elementsStream.get())
+        return elements->isEmpty();
+    return m_commands.isEmpty();
 }
 
 FloatPoint PathJava::currentPoint() const
 {
-    //utatodo: return current point of subpath.
+    if (const PathImpl* elements = m_elementsStream.get())
+        return elements->currentPoint();
+
     float quietNaN = std::numeric_limits<float>::quiet_NaN();
     return FloatPoint(quietNaN, quietNaN);
 }
 
 bool PathJava::transform(const AffineTransform& transform)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
+    if (m_elementsStream && !m_elementsStream->transform(transform))
+        m_elementsStream = nullptr;
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "transform", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)transform.a(), (jdouble)transform.b(),
-                        (jdouble)transform.c(), (jdouble)transform.d(),
-                        (jdouble)transform.e(), (jdouble)transform.f());
-    WTF::CheckAndClearException(env);
+    record(com_sun_webkit_graphics_WCPath_SEG_TRANSFORM, {
+        transform.a(), transform.b(), transform.c(),
+        transform.d(), transform.e(), transform.f() });
     return true;
 }
 
@@ -381,7 +282,9 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
     if (isEmpty() || !std::isfinite(point.x()) || !std::isfinite(point.y()))
         return false;
 
-    ASSERT(m_platformPath);
+    auto path = platformPath();
+    if (!path)
+        return false;
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -389,7 +292,7 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
         "(IDD)Z");
     ASSERT(mid);
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
+    jboolean res = env->CallBooleanMethod(*path, mid, (jint)rule,
         (jdouble)point.x(), (jdouble)point.y());
     WTF::CheckAndClearException(env);
 
@@ -398,9 +301,12 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
 
 bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
     ASSERT(strokeStyleApplier);
 
+    auto path = platformPath();
+    if (!path)
+        return false;
+
     GraphicsContext& gc = scratchContext();
     gc.save();
 
@@ -430,7 +336,7 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
     env->SetDoubleArrayRegion(dashArray, 0, size, dashes.data());
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jdouble)p.x(),
+    jboolean res = env->CallBooleanMethod(*path, mid, (jdouble)p.x(),
         (jdouble)p.y(), (jdouble) thickness, (jdouble) miterLimit,
         (jint) cap, (jint) join, (jdouble) dashOffset, (jdoubleArray) dashArray);
 
@@ -441,17 +347,37 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
 FloatRect PathJava::fastBoundingRect() const
 {
-    return boundingRect();
+    if (m_elementsStream)
+        return m_elementsStream->fastBoundingRect();
+    return javaBoundingRect();
 }
 
 FloatRect PathJava::boundingRect() const
 {
-    return strokeBoundingRect(nullptr);
+    if (m_elementsStream)
+        return m_elementsStream->boundingRect();
+    return javaBoundingRect();
 }
 
 FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
+    FloatRect bounds = boundingRect();
+    if (strokeStyleApplier && !bounds.isEmpty()) {
+        GraphicsContext& gc = scratchContext();
+        gc.save();
+        strokeStyleApplier(gc);
+        float thickness = gc.strokeThickness();
+        gc.restore();
+        bounds.inflate(thickness / 2);
+    }
+    return bounds;
+}
+
+FloatRect PathJava::javaBoundingRect() const
+{
+    auto path = platformPath();
+    if (!path)
+        return FloatRect();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -459,38 +385,27 @@ FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& s
             "()Lcom/sun/webkit/graphics/WCRectangle;");
     ASSERT(mid);
 
-    JLObject rect(env->CallObjectMethod(*m_platformPath, mid));
+    JLObject rect(env->CallObjectMethod(*path, mid));
     WTF::CheckAndClearException(env);
-    if (rect) {
-        static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
-        ASSERT(rectxFID);
-        static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
-        ASSERT(rectyFID);
-        static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
-        ASSERT(rectwFID);
-        static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
-        ASSERT(recthFID);
-
-        FloatRect bounds(
-            float(env->GetFloatField(rect, rectxFID)),
-            float(env->GetFloatField(rect, rectyFID)),
-            float(env->GetFloatField(rect, rectwFID)),
-            float(env->GetFloatField(rect, recthFID)));
-        WTF::CheckAndClearException(env);
-
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
-        }
-        return bounds;
-    } else {
+    if (!rect)
         return FloatRect();
-    }
+
+    static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
+    ASSERT(rectxFID);
+    static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
+    ASSERT(rectyFID);
+    static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
+    ASSERT(rectwFID);
+    static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
+    ASSERT(recthFID);
+
+    FloatRect bounds(
+        float(env->GetFloatField(rect, rectxFID)),
+        float(env->GetFloatField(rect, rectyFID)),
+        float(env->GetFloatField(rect, rectwFID)),
+        float(env->GetFloatField(rect, recthFID)));
+    WTF::CheckAndClearException(env);
+    return bounds;
 }
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,21 +30,26 @@
 #include "PlatformPath.h"
 #include "RQRef.h"
 #include "WindRule.h"
+#include <jni.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
 class GraphicsContext;
 class PathStream;
 
+// The geometry is recorded natively: as a PathStream for bounds and
+// segment iteration, and as a packed list of WCPath calls. The java WCPath
+// is built from the packed list in a single call when platformPath() is
+// first asked for, and is not modified afterwards, so the queue can refer
+// to it without copying it.
 class PathJava final : public PathImpl {
 public:
     static Ref<PathJava> create();
     static Ref<PathJava> create(const PathSegment&);
     static Ref<PathJava> create(const PathStream&);
-    static Ref<PathJava> create(RefPtr<RQRef>&&, RefPtr<PathStream>&& = nullptr);
 
     PathJava();
-    PathJava(RefPtr<RQRef>&&, RefPtr<PathStream>&&);
 
     PlatformPathPtr platformPath() const;
 
@@ -60,6 +65,8 @@ public:
     FloatRect strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const;
 
 private:
+    PathJava(const PathJava&);
+
     Ref<PathImpl> copy() const final;
     void add(PathMoveTo) final;
     void add(PathLineTo) final;
@@ -83,8 +90,14 @@ private:
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
 
-    RefPtr<RQRef> m_platformPath;
+    void record(jint command, std::initializer_list<double> coords);
+    FloatRect javaBoundingRect() const;
+
+    Vector<jint> m_commands;
+    Vector<double> m_coords;
+    // Null once a transform that PathStream cannot apply has been recorded.
     RefPtr<PathStream> m_elementsStream;
+    mutable RefPtr<RQRef> m_platformPath;
 };
 
 } // namespace WebCore
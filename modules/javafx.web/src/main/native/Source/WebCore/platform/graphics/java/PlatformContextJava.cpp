@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "PlatformContextJava.h"
+
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
+
+namespace WebCore {
+
+PlatformContextJava::PaintState& PlatformContextJava::paintState()
+{
+    // Nothing is known about the java state once the buffer it was recorded
+    // into is flushed; forget the tracked state of the whole stack.
+    if (m_paintStateGeneration != m_rq->bufferGeneration()) {
+        m_paintStateGeneration = m_rq->bufferGeneration();
+        m_paintState = PaintState();
+        for (auto& saved : m_savedStates) {
+            saved.paintState = PaintState();
+        }
+    }
+    return m_paintState;
+}
+
+bool PlatformContextJava::isLastCommand(const RecordedCommand& command) const
+{
+    return command.end > 0
+        && command.generation == m_rq->bufferGeneration()
+        && command.end == m_rq->position();
+}
+
+PlatformContextJava::RecordedCommand PlatformContextJava::recordCommand(int start) const
+{
+    return { m_rq->bufferGeneration(), start, m_rq->position() };
+}
+
+void PlatformContextJava::rewindTo(int position)
+{
+    m_rq->rewind(position);
+
+    // New commands will be recorded over the discarded ones.
+    auto forgetDiscarded = [position] (RecordedCommand& command) {
+        if (command.end > position) {
+            command = RecordedCommand();
+        }
+    };
+    forgetDiscarded(m_lastTranslate);
+    forgetDiscarded(m_lastRectFill);
+    forgetDiscarded(m_lastImageDraw);
+    for (auto& saved : m_savedStates) {
+        forgetDiscarded(saved.save);
+    }
+}
+
+void PlatformContextJava::saveState()
+{
+    m_rq->freeSpace(4);
+    int start = m_rq->position();
+    *m_rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+
+    m_savedStates.append({ paintState(), recordCommand(start), false });
+}
+
+void PlatformContextJava::restoreState()
+{
+    while (!m_savedStates.isEmpty() && m_savedStates.last().isLayer) {
+        m_savedStates.removeLast();
+    }
+
+    // A save immediately followed by a restore is a no-op: drop both.
+    if (!m_savedStates.isEmpty() && isLastCommand(m_savedStates.last().save)) {
+        m_paintState = m_savedStates.takeLast().paintState;
+        rewindTo(m_rq->position() - 4);
+        return;
+    }
+
+    m_rq->freeSpace(4)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+
+    paintState();
+    m_paintState = m_savedStates.isEmpty() ? PaintState() : m_savedStates.takeLast().paintState;
+}
+
+void PlatformContextJava::beginTransparencyLayer(float opacity)
+{
+    m_rq->freeSpace(8)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
+    << opacity;
+
+    m_savedStates.append({ paintState(), RecordedCommand(), true });
+}
+
+void PlatformContextJava::endTransparencyLayer()
+{
+    m_rq->freeSpace(4)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+
+    paintState();
+    if (!m_savedStates.isEmpty() && m_savedStates.last().isLayer) {
+        m_paintState = m_savedStates.takeLast().paintState;
+    } else {
+        m_paintState = PaintState();
+    }
+}
+
+void PlatformContextJava::translate(float x, float y)
+{
+    // Consecutive translations are folded into one, and removed if they cancel out.
+    if (isLastCommand(m_lastTranslate)) {
+        m_lastTranslateOffset.expand(x, y);
+        if (m_lastTranslateOffset.isZero()) {
+            rewindTo(m_lastTranslate.start);
+        } else {
+            m_rq->putFloatAt(m_lastTranslate.start + 4, m_lastTranslateOffset.width());
+            m_rq->putFloatAt(m_lastTranslate.start + 8, m_lastTranslateOffset.height());
+        }
+        return;
+    }
+
+    m_rq->freeSpace(12);
+    int start = m_rq->position();
+    *m_rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE
+    << x << y;
+
+    m_lastTranslate = recordCommand(start);
+    m_lastTranslateOffset = FloatSize(x, y);
+}
+
+void PlatformContextJava::setFillColor(const Color& color)
+{
+    if (paintState().fillColor == color) {
+        return;
+    }
+
+    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    m_rq->freeSpace(20)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
+    << r << g << b << a;
+
+    paintState().fillColor = color;
+}
+
+void PlatformContextJava::setStrokeColor(const Color& color)
+{
+    if (paintState().strokeColor == color) {
+        return;
+    }
+
+    auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    m_rq->freeSpace(20)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
+    << r << g << b << a;
+
+    paintState().strokeColor = color;
+}
+
+void PlatformContextJava::setStrokeStyle(StrokeStyle style)
+{
+    if (paintState().strokeStyle == style) {
+        return;
+    }
+
+    m_rq->freeSpace(8)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
+    << (jint)style;
+
+    paintState().strokeStyle = style;
+}
+
+void PlatformContextJava::setStrokeThickness(float thickness)
+{
+    if (paintState().strokeThickness == thickness) {
+        return;
+    }
+
+    m_rq->freeSpace(8)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
+    << thickness;
+
+    paintState().strokeThickness = thickness;
+}
+
+void PlatformContextJava::invalidateFillPaint()
+{
+    paintState().fillColor = std::nullopt;
+}
+
+void PlatformContextJava::invalidateStrokePaint()
+{
+    paintState().strokeColor = std::nullopt;
+}
+
+void PlatformContextJava::fillRect(const FloatRect& rect, const Color* color)
+{
+    auto putColor = [this] (const Color& color) {
+        auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+        *m_rq << r << g << b << a;
+    };
+    auto putRect = [this] (const FloatRect& rect) {
+        *m_rq << rect.x() << rect.y() << rect.width() << rect.height();
+    };
+
+    // Adjacent fills with the same paint are merged into a FILLRECT_LIST command:
+    //   FILLRECT_LIST_FFFF  count {x, y, w, h}*count
+    //   FILLRECT_LIST_FFFFI count r, g, b, a {x, y, w, h}*count
+    bool samePaint = color
+        ? m_lastRectFillColor == *color
+        : !m_lastRectFillColor;
+    if (samePaint && isLastCommand(m_lastRectFill)) {
+        if (m_lastRectFillCount == 1 && m_rq->hasFreeSpace(20)) {
+            // Re-record the single fill as a list of two.
+            m_rq->rewind(m_lastRectFill.start);
+            *m_rq << (jint)(color
+                ? com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_LIST_FFFFI
+                : com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_LIST_FFFF)
+            << (jint)2;
+            if (color) {
+                putColor(*color);
+            }
+            putRect(m_lastRectFillRect);
+            putRect(rect);
+            m_lastRectFill.end = m_rq->position();
+            m_lastRectFillCount = 2;
+            return;
+        }
+        if (m_lastRectFillCount > 1 && m_rq->hasFreeSpace(16)) {
+            m_rq->putIntAt(m_lastRectFill.start + 4, ++m_lastRectFillCount);
+            putRect(rect);
+            m_lastRectFill.end = m_rq->position();
+            return;
+        }
+    }
+
+    m_rq->freeSpace(color ? 36 : 20);
+    int start = m_rq->position();
+    if (color) {
+        *m_rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI;
+        putRect(rect);
+        putColor(*color);
+        m_lastRectFillColor = *color;
+    } else {
+        *m_rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFF;
+        putRect(rect);
+        m_lastRectFillColor = std::nullopt;
+    }
+    m_lastRectFill = recordCommand(start);
+    m_lastRectFillCount = 1;
+    m_lastRectFillRect = rect;
+}
+
+void PlatformContextJava::drawImage(RefPtr<RQRef> image, const FloatRect& destRect, const FloatRect& srcRect)
+{
+    auto putRects = [this] (const FloatRect& destRect, const FloatRect& srcRect) {
+        *m_rq << destRect.x() << destRect.y() << destRect.width() << destRect.height()
+        << srcRect.x() << srcRect.y() << srcRect.width() << srcRect.height();
+    };
+
+    // Adjacent draws of the same image are merged into a DRAWIMAGE_LIST command:
+    //   DRAWIMAGE_LIST image count {dst x, y, w, h, src x, y, w, h}*count
+    if (image.get() == m_lastImageDrawImage && isLastCommand(m_lastImageDraw)) {
+        if (m_lastImageDrawCount == 1 && m_rq->hasFreeSpace(36)) {
+            // Re-record the single draw as a list of two, keeping the image
+            // reference already put into the buffer.
+            m_rq->rewind(m_lastImageDraw.start + 8);
+            m_rq->putIntAt(m_lastImageDraw.start, com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE_LIST);
+            *m_rq << (jint)2;
+            putRects(m_lastImageDrawDestRect, m_lastImageDrawSrcRect);
+            putRects(destRect, srcRect);
+            m_lastImageDraw.end = m_rq->position();
+            m_lastImageDrawCount = 2;
+            return;
+        }
+        if (m_lastImageDrawCount > 1 && m_rq->hasFreeSpace(32)) {
+            m_rq->putIntAt(m_lastImageDraw.start + 8, ++m_lastImageDrawCount);
+            putRects(destRect, srcRect);
+            m_lastImageDraw.end = m_rq->position();
+            return;
+        }
+    }
+
+    m_rq->freeSpace(40);
+    int start = m_rq->position();
+    *m_rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE << image;
+    putRects(destRect, srcRect);
+
+    m_lastImageDraw = recordCommand(start);
+    m_lastImageDrawCount = 1;
+    m_lastImageDrawImage = image.get();
+    m_lastImageDrawDestRect = destRect;
+    m_lastImageDrawSrcRect = srcRect;
+}
+
+} // namespace WebCore
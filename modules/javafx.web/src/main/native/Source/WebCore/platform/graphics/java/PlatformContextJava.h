@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,17 +25,19 @@
 
 #pragma once
 
+#include "Color.h"
+#include "FloatRect.h"
+#include "FloatSize.h"
 #include "GraphicsContext.h"
 #include "Path.h"
 #include "RenderingQueue.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 #include <jni.h>
+#include <optional>
 #include <wtf/Noncopyable.h>
 
 namespace WebCore {
 
-    RefPtr<RQRef> copyPath(RefPtr<RQRef> p);
-
     class PlatformContextJava {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
@@ -64,25 +66,6 @@ namespace WebCore {
             m_jRenderTheme = jTheme;
         }
 
-        void beginPath() {
-            m_path.clear();
-        }
-
-        void addPath(PlatformPathPtr pPath) {
-            JNIEnv* env = WTF::GetJavaEnv();
-
-            static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                "addPath", "(Lcom/sun/webkit/graphics/WCPath;)V");
-            ASSERT(mid);
-
-            env->CallVoidMethod((jobject)*m_path.platformPath(), mid, (jobject)*pPath);
-            WTF::CheckAndClearException(env);
-        }
-
-        PlatformPathPtr platformPath() {
-            return m_path.platformPath();
-        }
-
         const DashArray& dashArray() const {
             return m_dashArray;
         }
@@ -119,10 +102,64 @@ namespace WebCore {
         void setMiterLimit(float miterLimit) {
             m_miterLimit = miterLimit;
         }
+
+        /*
+         * Command peephole. The methods below record the state commands into
+         * the queue while tracking the state of the java graphics context, so
+         * that redundant commands are dropped, cancelling ones are removed,
+         * and adjacent rectangle fills with the same paint, as well as
+         * adjacent draws of the same image, are merged.
+         *
+         * The tracked state is only trusted within the current queue buffer:
+         * each buffer is decoded as a whole by java, but nothing is assumed
+         * about a graphics context that decodes a later buffer.
+         */
+        void saveState();
+        void restoreState();
+        void beginTransparencyLayer(float opacity);
+        void endTransparencyLayer();
+        void translate(float x, float y);
+        void setFillColor(const Color&);
+        void setStrokeColor(const Color&);
+        void setStrokeStyle(StrokeStyle);
+        void setStrokeThickness(float);
+        void fillRect(const FloatRect&, const Color* = nullptr);
+        void drawImage(RefPtr<RQRef> image, const FloatRect& destRect, const FloatRect& srcRect);
+
+        // The java paint was changed by a command that is not tracked (a gradient).
+        void invalidateFillPaint();
+        void invalidateStrokePaint();
+
     private:
+        struct PaintState {
+            std::optional<Color> fillColor;
+            std::optional<Color> strokeColor;
+            std::optional<StrokeStyle> strokeStyle;
+            std::optional<float> strokeThickness;
+        };
+
+        // A command recorded at [start, end) of the buffer [generation].
+        struct RecordedCommand {
+            unsigned generation { 0 };
+            int start { -1 };
+            int end { -1 };
+        };
+
+        // An entry of the java state stack: pushed by SAVESTATE or by
+        // BEGINTRANSPARENCYLAYER, RESTORESTATE also pops unclosed layers.
+        struct SavedState {
+            PaintState paintState;
+            RecordedCommand save;
+            bool isLayer { false };
+        };
+
+        PaintState& paintState();
+        bool isLastCommand(const RecordedCommand&) const;
+        RecordedCommand recordCommand(int start) const;
+        void rewindTo(int position);
+
         RefPtr<RenderingQueue> m_rq;
         RefPtr<RQRef> m_jRenderTheme;
-        Path m_path;
         // Buffer the last set stroke styles on the native side to make them
         // acessible outside the java graphics context
         DashArray m_dashArray;
@@ -130,5 +167,21 @@ namespace WebCore {
         LineCap m_lineCap { };
         LineJoin m_lineJoin { };
         float m_miterLimit { };
+
+        PaintState m_paintState;
+        Vector<SavedState> m_savedStates;
+        unsigned m_paintStateGeneration { 0 };
+
+        RecordedCommand m_lastTranslate;
+        FloatSize m_lastTranslateOffset;
+        RecordedCommand m_lastRectFill;
+        int m_lastRectFillCount { 0 };
+        std::optional<Color> m_lastRectFillColor;
+        FloatRect m_lastRectFillRect;
+        RecordedCommand m_lastImageDraw;
+        int m_lastImageDrawCount { 0 };
+        RQRef* m_lastImageDrawImage { nullptr }; // kept alive by the queue buffer
+        FloatRect m_lastImageDrawDestRect;
+        FloatRect m_lastImageDrawSrcRect;
     };
 }
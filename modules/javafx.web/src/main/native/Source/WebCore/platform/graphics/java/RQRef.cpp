@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,35 +27,66 @@
 
 #include "RQRef.h"
 
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Vector.h>
+
 namespace WebCore {
 
+// Number of pending releases that triggers a batch.
+static constexpr size_t maxPendingRefs = 256;
+
+static Vector<jint>& pendingRefs()
+{
+    // Only used on the event thread.
+    static NeverDestroyed<Vector<jint>> ids;
+    return ids.get();
+}
+
 RQRef::~RQRef()
 {
     if (-1 != m_refID) {
-        JNIEnv* env = WTF::GetJavaEnv();
+        Vector<jint>& ids = pendingRefs();
+        ids.append(m_refID);
+        if (ids.size() >= maxPendingRefs) {
+            releasePendingRefs();
+        }
+    }
+}
+
+void RQRef::releasePendingRefs()
+{
+    Vector<jint>& ids = pendingRefs();
+    if (ids.isEmpty()) {
+        return;
+    }
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env) {
+        // the JVM is gone, there is nothing to release
+        ids.clear();
+        return;
+    }
 
-        if (env) {
-            //do it if JVM is here.
-            static jmethodID mid = env->GetMethodID(PG_GetRefClass(env), "deref", "()V");
-            ASSERT(mid);
-            env->CallVoidMethod(m_ref, mid);
+    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env), "fwkDerefAll", "([I)V");
+    ASSERT(mid);
 
-            WTF::CheckAndClearException(env);
-        }
+    JLocalRef<jintArray> jids(env->NewIntArray(ids.size()));
+    if (!jids) {
+        WTF::CheckAndClearException(env);
+        return;
     }
+    env->SetIntArrayRegion(jids, 0, ids.size(), ids.data());
+    ids.clear();
+    env->CallVoidMethod(PL_GetGraphicsManager(env), mid, (jintArray)jids);
+    WTF::CheckAndClearException(env);
 }
 
 RQRef::operator jint() {
     if (-1 == m_refID) {
         JNIEnv* env = WTF::GetJavaEnv();
 
-        static jmethodID midGetId = env->GetMethodID(PG_GetRefClass(env), "getID", "()I");
-        ASSERT(midGetId);
-        m_refID = env->CallIntMethod(m_ref, midGetId);
-
-        static jmethodID midRef = env->GetMethodID(PG_GetRefClass(env), "ref", "()V");
-        ASSERT(midRef);
-        env->CallVoidMethod(m_ref, midRef);
+        static jmethodID mid = env->GetMethodID(PG_GetRefClass(env), "fwkRef", "()I");
+        ASSERT(mid);
+        m_refID = env->CallIntMethod(m_ref, mid);
 
         WTF::CheckAndClearException(env);
     }
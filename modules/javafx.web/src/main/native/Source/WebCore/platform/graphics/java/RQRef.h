@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,11 @@ public:
     }
     ~RQRef();
 
+    // Java references of destroyed RQRefs are released in batches: when a
+    // rendering queue hands a buffer over or gets buffers back, or once
+    // enough are pending.
+    static void releasePendingRefs();
+
 private:
     RQRef(const JLObject &obj)
         : m_ref(obj)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -65,7 +65,7 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = m_bufferPool->acquire(size);
     }
     return *this;
 }
@@ -106,18 +106,23 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;I)V");
     ASSERT(midFwkAddBuffer);
 
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
     a2bb.set(m_buffer->bufferAddress(), m_buffer);
+    m_buffer->setPool(m_bufferPool.ptr());
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)(m_buffer->directByteBuffer(env)),
+        (jint)m_buffer->size());
     WTF::CheckAndClearException(env);
 
     m_buffer = nullptr;
+    ++m_bufferGeneration;
+
+    RQRef::releasePendingRefs();
 
     return *this;
 }
@@ -139,7 +144,12 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            // The buffer goes back to its queue pool (or is freed if the pool
+            // is full or gone). Its resources are dereferenced here in both cases.
+            if (RefPtr<ByteBuffer> buffer = a2bb.take(key)) {
+                buffer->release();
+            }
         }
     }
+    RQRef::releasePendingRefs();
 }
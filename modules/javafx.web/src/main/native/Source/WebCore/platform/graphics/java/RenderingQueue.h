@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@
 namespace WebCore {
 
 class RQRef;
+class ByteBufferPool;
 
 class ByteBuffer : public RefCounted<ByteBuffer> {
     RQ_LOG_INSTANCE_COUNT(ByteBuffer)
@@ -44,15 +45,37 @@ public:
         return adoptRef(new ByteBuffer(capacity));
     }
 
-    JLObject createDirectByteBuffer(JNIEnv* env) {
+    /*
+     * The direct NIO buffer covers the whole native storage and is created
+     * once per ByteBuffer, so a recycled buffer is handed to java without
+     * another NewDirectByteBuffer call. The java side limits it to [size()].
+     */
+    JLObject directByteBuffer(JNIEnv* env) {
         ASSERT(!isEmpty());
-        JLObject ret(env->NewDirectByteBuffer(m_buffer, m_position));
-        m_nio_holder = ret;
-        return ret;
+        if (!m_nio_holder) {
+            m_nio_holder = JLObject(env->NewDirectByteBuffer(m_buffer, m_capacity));
+        }
+        return m_nio_holder;
     }
 
     char* bufferAddress() { return m_buffer; }
 
+    int capacity() const { return m_capacity; }
+
+    int size() const { return m_position; }
+
+    // Attaches the buffer to the pool it should return to once java releases it.
+    void setPool(RefPtr<ByteBufferPool> pool) { m_pool = WTFMove(pool); }
+
+    // Called from [WCRenderQueue.twkRelease] when java has decoded the buffer.
+    void release();
+
+    // Drops the resources used by the recorded commands and rewinds the buffer.
+    void reset() {
+        m_refList.clear();
+        m_position = 0;
+    }
+
     void putRef(RefPtr<RQRef> ref) {
         ASSERT(m_position + sizeof(jint) <= m_capacity);
         RefPtr<RQRef> repeatable_use_holder(ref);
@@ -72,6 +95,24 @@ public:
         m_position += sizeof(jfloat);
     }
 
+    // Overwrites a value of an already recorded command.
+    void putIntAt(int position, jint i) {
+        ASSERT(position + sizeof(jint) <= static_cast<size_t>(m_position));
+        memcpy((m_buffer + position), &i, sizeof(jint));
+    }
+
+    void putFloatAt(int position, jfloat f) {
+        ASSERT(position + sizeof(jfloat) <= static_cast<size_t>(m_position));
+        memcpy((m_buffer + position), &f, sizeof(jfloat));
+    }
+
+    // Discards the commands recorded after [position]. The discarded commands
+    // must not hold references put by [putRef].
+    void rewind(int position) {
+        ASSERT(position >= 0 && position <= m_position);
+        m_position = position;
+    }
+
     bool hasFreeSpace(int size) { return m_position + size <= m_capacity; }
 
     bool isEmpty() { return m_position == 0; }
@@ -92,8 +133,66 @@ private:
     int m_position;
     JGObject m_nio_holder;
     Vector< RefPtr<RQRef> > m_refList;
+    RefPtr<ByteBufferPool> m_pool; // set while the buffer is owned by java
+};
+
+/*
+ * A bounded set of ByteBuffers released by java that is reused by a
+ * RenderingQueue instead of allocating a new buffer each time the current
+ * one fills up. Only buffers of the nominal queue capacity are pooled;
+ * oversized buffers requested for a single large command are freed as before.
+ *
+ * The pool outlives its RenderingQueue while buffers are still queued on the
+ * java side; [detach] makes such late releases free the buffers instead.
+ */
+class ByteBufferPool : public RefCounted<ByteBufferPool> {
+public:
+    static Ref<ByteBufferPool> create(int capacity, size_t maxSize) {
+        return adoptRef(*new ByteBufferPool(capacity, maxSize));
+    }
+
+    RefPtr<ByteBuffer> acquire(int size) {
+        if (size <= m_capacity && !m_buffers.isEmpty()) {
+            return m_buffers.takeLast();
+        }
+        return ByteBuffer::create(std::max(m_capacity, size));
+    }
+
+    void recycle(RefPtr<ByteBuffer>&& buffer) {
+        buffer->reset();
+        if (!m_detached
+            && buffer->capacity() == m_capacity
+            && m_buffers.size() < m_maxSize) {
+            m_buffers.append(WTFMove(buffer));
+        }
+    }
+
+    void detach() {
+        m_detached = true;
+        m_buffers.clear();
+    }
+
+private:
+    ByteBufferPool(int capacity, size_t maxSize)
+        : m_capacity(capacity)
+        , m_maxSize(maxSize)
+    {}
+
+    int m_capacity;
+    size_t m_maxSize;
+    bool m_detached { false };
+    Vector<RefPtr<ByteBuffer>> m_buffers;
 };
 
+inline void ByteBuffer::release() {
+    RefPtr<ByteBufferPool> pool = WTFMove(m_pool);
+    if (pool) {
+        pool->recycle(RefPtr<ByteBuffer>(this));
+    } else {
+        reset();
+    }
+}
+
 /*
  * A lifecycle of an instance of RenderingQueue (RQ) used to draw to ImageBufferJava
  * may continue after the RQ is flushed to java (e.g. when it's used for html5 canvas).
@@ -134,6 +233,25 @@ public:
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    /*
+     * Access to the current buffer for the command peephole in
+     * PlatformContextJava. A recorded position is only meaningful while
+     * [bufferGeneration] is unchanged, i.e. until the buffer is flushed.
+     */
+    unsigned bufferGeneration() const { return m_bufferGeneration; }
+
+    int position() const { return m_buffer ? m_buffer->size() : 0; }
+
+    bool hasFreeSpace(int size) const {
+        return m_buffer && m_buffer->hasFreeSpace(size);
+    }
+
+    void putIntAt(int position, jint i) { m_buffer->putIntAt(position, i); }
+
+    void putFloatAt(int position, jfloat f) { m_buffer->putFloatAt(position, f); }
+
+    void rewind(int position) { m_buffer->rewind(position); }
+
     bool isEmpty() {
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
@@ -149,6 +267,7 @@ public:
     }
 
     ~RenderingQueue() {
+        m_bufferPool->detach();
         disposeGraphics();
     }
 
@@ -157,7 +276,8 @@ private:
         m_rqoRenderingQueue(RQRef::create(jRQ)),
         m_capacity(capacity),
         m_autoFlush(autoFlush),
-        m_buffer(nullptr)
+        m_buffer(nullptr),
+        m_bufferPool(ByteBufferPool::create(capacity, MAX_BUFFER_COUNT))
     {}
 
     void flush();
@@ -170,6 +290,7 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
-
+    unsigned m_bufferGeneration { 0 }; // incremented on each flushed buffer
+    Ref<ByteBufferPool> m_bufferPool; // buffers released by java for reuse
 };
 } // namespace WebCore
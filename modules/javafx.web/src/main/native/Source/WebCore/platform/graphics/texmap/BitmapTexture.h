@@ -60,7 +60,7 @@ public:
 
     virtual IntSize size() const = 0;
     virtual void updateContents(NativeImage*, const IntRect&, const IntPoint& offset)=0;
-    void updateContents(GraphicsLayer*, const IntRect& target, const IntPoint& offset, float scale = 1);
+    virtual void updateContents(GraphicsLayer*, const IntRect& target, const IntPoint& offset, float scale = 1);
     virtual void updateContents(const void*, const IntRect& target, const IntPoint& offset, int bytesPerLine) = 0;
     virtual bool isValid() const = 0;
     inline Flags flags() const { return m_flags; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,17 +26,45 @@
 #include "config.h"
 
 #include "BitmapTextureJava.h"
+#include "ByteArrayPixelBuffer.h"
+#include "FilterOperations.h"
+#include "GraphicsContext.h"
 #include "GraphicsLayer.h"
+#include "LengthFunctions.h"
 #include "NotImplemented.h"
 #include "PlatformContextJava.h"
 #include "TextureMapperJava.h"
 
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
+
 namespace WebCore {
 
 
-void BitmapTextureJava::updateContents(const void*, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine)
+void BitmapTextureJava::updateContents(const void* data, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine)
 {
-    notImplemented();
+    if (!m_image || target.isEmpty())
+        return;
+
+    PixelBufferFormat format { AlphaPremultiplication::Premultiplied, PixelFormat::BGRA8, DestinationColorSpace::SRGB() };
+    auto pixelBuffer = ByteArrayPixelBuffer::tryCreate(format, target.size());
+    if (!pixelBuffer)
+        return;
+
+    // Pack the requested sub-rectangle of the caller's rows into a tightly
+    // packed buffer; putPixelBuffer() then writes it straight into the
+    // texture's backing store without an intermediate image.
+    const size_t rowBytes = static_cast<size_t>(target.width()) * 4;
+    const uint8_t* src = static_cast<const uint8_t*>(data)
+        + static_cast<size_t>(sourceOffset.y()) * bytesPerLine
+        + static_cast<size_t>(sourceOffset.x()) * 4;
+    uint8_t* dst = pixelBuffer->bytes();
+    for (int y = 0; y < target.height(); ++y) {
+        memcpy(dst, src, rowBytes);
+        src += bytesPerLine;
+        dst += rowBytes;
+    }
+
+    m_image->putPixelBuffer(*pixelBuffer, IntRect(IntPoint(), target.size()), target.location());
 }
 
 void BitmapTextureJava::didReset()
@@ -48,13 +76,130 @@ void BitmapTextureJava::didReset()
 
 void BitmapTextureJava::updateContents(NativeImage* image, const IntRect& targetRect, const IntPoint& offset)
 {
-    //m_image->context().drawImage(*image, targetRect, IntRect(offset, targetRect.size()));
+    if (!m_image || !image)
+        return;
+
+    m_image->context().drawNativeImage(*image, targetRect, FloatRect(offset, targetRect.size()), { CompositeOperator::Copy });
+}
+
+void BitmapTextureJava::updateContents(GraphicsLayer* sourceLayer, const IntRect& targetRect, const IntPoint& offset, float scale)
+{
+    if (!m_image)
+        return;
+
+    // Paint the layer directly into the texture's render target instead of
+    // going through a temporary ImageBuffer and a NativeImage copy. The
+    // texture keeps its contents until the layer is invalidated again, so
+    // compositing a cached layer does not require repainting it.
+    GraphicsContext& context = m_image->context();
+    GraphicsContextStateSaver stateSaver(context);
+    context.clip(targetRect);
+    context.clearRect(targetRect);
+    context.setImageInterpolationQuality(InterpolationQuality::Default);
+    context.setTextDrawingMode(TextDrawingMode::Fill);
+
+    IntRect sourceRect(targetRect);
+    sourceRect.setLocation(offset);
+    sourceRect.scale(1 / scale);
+    context.translate(targetRect.x(), targetRect.y());
+    context.applyDeviceScaleFactor(scale);
+    context.translate(-sourceRect.x(), -sourceRect.y());
+
+    sourceLayer->paintGraphicsLayerContents(context, sourceRect);
 }
 
-RefPtr<BitmapTexture> BitmapTextureJava::applyFilters(TextureMapper&, const FilterOperations&, bool)
+// Encodes the filter operations that the Java side can run through Decora
+// effects. Returns false if any of them has to go through the software
+// filter path instead.
+static bool encodeFilterOperations(const FilterOperations& filters, const IntSize& size, Vector<jint>& types, Vector<float>& params)
 {
-    notImplemented();
-    return this;
+    bool hasOpacity = false;
+    for (auto& operation : filters.operations()) {
+        switch (operation->type()) {
+        case FilterOperation::Type::Blur: {
+            auto& blur = downcast<BlurFilterOperation>(*operation);
+            types.append(com_sun_webkit_graphics_GraphicsDecoder_FILTER_BLUR);
+            params.append(floatValueForLength(blur.stdDeviation(), std::max(size.width(), size.height())));
+            break;
+        }
+        case FilterOperation::Type::DropShadow: {
+            // Decora draws the content over its shadow with its own alpha,
+            // which no longer matches CSS once opacity was applied earlier.
+            if (hasOpacity)
+                return false;
+            auto& shadow = downcast<DropShadowFilterOperation>(*operation);
+            auto [r, g, b, a] = shadow.color().toColorTypeLossy<SRGBA<float>>().resolved();
+            types.append(com_sun_webkit_graphics_GraphicsDecoder_FILTER_DROP_SHADOW);
+            params.appendList({ static_cast<float>(shadow.x()), static_cast<float>(shadow.y()),
+                static_cast<float>(shadow.stdDeviation()), r, g, b, a });
+            break;
+        }
+        case FilterOperation::Type::Opacity: {
+            auto& opacity = downcast<BasicComponentTransferFilterOperation>(*operation);
+            types.append(com_sun_webkit_graphics_GraphicsDecoder_FILTER_OPACITY);
+            params.append(clampTo<float>(opacity.amount(), 0, 1));
+            hasOpacity = true;
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+RefPtr<BitmapTexture> BitmapTextureJava::applyFilters(TextureMapper&, const FilterOperations& filters, bool)
+{
+    if (!m_image || filters.isEmpty())
+        return this;
+
+    Vector<jint> types;
+    Vector<float> params;
+    if (!encodeFilterOperations(filters, contentSize(), types, params)) {
+        notImplemented();
+        return this;
+    }
+
+    // The filtered result is kept with the source texture so that a layer
+    // animating under a filter reuses the same render target every frame.
+    if (!m_filteredTexture || m_filteredTexture->contentSize() != contentSize() || m_filteredTexture->flags() != flags()) {
+        m_filteredTexture = adoptRef(new BitmapTextureJava);
+        m_filteredTexture->reset(contentSize(), flags());
+        if (!m_filteredTexture->isValid()) {
+            m_filteredTexture = nullptr;
+            return this;
+        }
+    }
+
+    auto sourceImage = m_image->copyNativeImage();
+    if (!sourceImage)
+        return this;
+    const PlatformImagePtr& platformImage = sourceImage->platformImage();
+
+    GraphicsContext& context = m_filteredTexture->m_image->context();
+    context.clearRect(FloatRect(FloatPoint(), contentSize()));
+
+    RenderingQueue& rq = context.platformContext()->rq();
+    if (auto sourceRQ = platformImage->getRenderingQueue(); sourceRQ && !sourceRQ->isEmpty()) {
+        sourceRQ->flushBuffer();
+        rq.freeSpace(8)
+            << (jint)com_sun_webkit_graphics_GraphicsDecoder_DECODERQ
+            << sourceRQ->getRQRenderingQueue();
+    }
+
+    rq.freeSpace(static_cast<int>(4 * (8 + types.size() + params.size())))
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE_FILTERED
+        << platformImage->getImage()
+        << 0.0f << 0.0f
+        << (float)contentSize().width() << (float)contentSize().height()
+        << (jint)types.size();
+    for (jint type : types)
+        rq << type;
+    rq << (jint)params.size();
+    for (float param : params)
+        rq << param;
+
+    return m_filteredTexture;
 }
 
 } // namespace WebCore
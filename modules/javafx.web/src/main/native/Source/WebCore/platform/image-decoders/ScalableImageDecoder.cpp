@@ -216,13 +216,18 @@ bool ScalableImageDecoder::frameHasAlphaAtIndex(size_t index) const
     return frame.hasAlpha();
 }
 
-unsigned ScalableImageDecoder::frameBytesAtIndex(size_t index, SubsamplingLevel) const
+unsigned ScalableImageDecoder::frameBytesAtIndex(size_t index, SubsamplingLevel subsamplingLevel) const
 {
     Locker locker { m_lock };
     if (m_frameBufferCache.size() <= index)
         return 0;
+#if PLATFORM(JAVA)
+    return ImageBackingStore::subsampledSize(m_size, subsamplingLevel).area() * sizeof(uint32_t);
+#else
+    UNUSED_PARAM(subsamplingLevel);
     // FIXME: Use the dimension of the requested frame.
     return m_size.area() * sizeof(uint32_t);
+#endif
 }
 
 Seconds ScalableImageDecoder::frameDurationAtIndex(size_t index) const
@@ -245,7 +250,7 @@ Seconds ScalableImageDecoder::frameDurationAtIndex(size_t index) const
     return duration;
 }
 
-PlatformImagePtr ScalableImageDecoder::createFrameImageAtIndex(size_t index, SubsamplingLevel, const DecodingOptions&)
+PlatformImagePtr ScalableImageDecoder::createFrameImageAtIndex(size_t index, SubsamplingLevel subsamplingLevel, const DecodingOptions&)
 {
     Locker locker { m_lock };
     // Zero-height images can cause problems for some ports. If we have an empty image dimension, just bail.
@@ -258,7 +263,12 @@ PlatformImagePtr ScalableImageDecoder::createFrameImageAtIndex(size_t index, Sub
 
     // Return the buffer contents as a native image. For some ports, the data
     // is already in a native container, and this just increments its refcount.
+#if PLATFORM(JAVA)
+    return buffer->backingStore()->image(subsamplingLevel);
+#else
+    UNUSED_PARAM(subsamplingLevel);
     return buffer->backingStore()->image();
+#endif
 }
 
 }
@@ -104,9 +104,14 @@ public:
     // sizes. This does NOT differ from size() for GIF, since decoding GIFs
     // composites any smaller frames against previous frames to create full-
     // size frames.
-    IntSize frameSizeAtIndex(size_t, SubsamplingLevel) const override
+    IntSize frameSizeAtIndex(size_t, SubsamplingLevel subsamplingLevel) const override
     {
+#if PLATFORM(JAVA)
+        return ImageBackingStore::subsampledSize(size(), subsamplingLevel);
+#else
+        UNUSED_PARAM(subsamplingLevel);
         return size();
+#endif
     }
 
     // Returns whether the size is legal (i.e. not going to result in
@@ -149,7 +154,11 @@ public:
 
     ImageDecoder::FrameMetadata frameMetadataAtIndex(size_t) const override { return { m_orientation, m_densityCorrectedSize }; }
 
+#if PLATFORM(JAVA)
+    bool frameAllowSubsamplingAtIndex(size_t) const override { return true; }
+#else
     bool frameAllowSubsamplingAtIndex(size_t) const override { return false; }
+#endif
 
     enum { ICCColorProfileHeaderLength = 128 };
 
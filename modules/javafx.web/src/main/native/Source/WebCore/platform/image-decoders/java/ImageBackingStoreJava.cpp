@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "ImageBackingStore.h"
+
+#include "ImageJava.h"
+
+namespace WebCore {
+
+PlatformImagePtr ImageBackingStore::image() const
+{
+    return ImageJava::create(Ref { *m_pixels }, m_size.width(), m_size.height());
+}
+
+PlatformImagePtr ImageBackingStore::image(SubsamplingLevel subsamplingLevel) const
+{
+    if (subsamplingLevel == SubsamplingLevel::Default)
+        return image();
+
+    // Box-filter the premultiplied pixels down: every destination pixel is the
+    // average of the block of source pixels it covers.
+    unsigned shift = static_cast<unsigned>(subsamplingLevel);
+    IntSize size = subsampledSize(m_size, subsamplingLevel);
+    Vector<uint8_t> buffer(size.area() * sizeof(uint32_t));
+    uint32_t* dest = reinterpret_cast<uint32_t*>(buffer.data());
+
+    for (int y = 0; y < size.height(); ++y) {
+        int srcTop = y << shift;
+        int srcBottom = std::min(srcTop + (1 << shift), m_size.height());
+        for (int x = 0; x < size.width(); ++x) {
+            int srcLeft = x << shift;
+            int srcRight = std::min(srcLeft + (1 << shift), m_size.width());
+            unsigned a = 0, r = 0, g = 0, b = 0;
+            for (int sy = srcTop; sy < srcBottom; ++sy) {
+                const uint32_t* src = m_pixelsPtr + sy * m_size.width();
+                for (int sx = srcLeft; sx < srcRight; ++sx) {
+                    uint32_t pixel = src[sx];
+                    a += pixel >> 24;
+                    r += (pixel >> 16) & 0xFF;
+                    g += (pixel >> 8) & 0xFF;
+                    b += pixel & 0xFF;
+                }
+            }
+            unsigned count = (srcBottom - srcTop) * (srcRight - srcLeft);
+            *dest++ = ((a / count) << 24) | ((r / count) << 16) | ((g / count) << 8) | (b / count);
+        }
+    }
+
+    return ImageJava::create(FragmentedSharedBuffer::DataSegment::create(WTFMove(buffer)), size.width(), size.height());
+}
+
+} // namespace WebCore
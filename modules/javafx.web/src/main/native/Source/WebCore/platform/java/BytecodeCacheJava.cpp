@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "BytecodeCacheJava.h"
+
+#include "CommonVM.h"
+#include <JavaScriptCore/Completion.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/SourceCode.h>
+#include <JavaScriptCore/SourceProvider.h>
+#include <wtf/FileSystem.h>
+#include <wtf/HashSet.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/SHA1.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+namespace WebCore {
+
+// Below this size parsing is cheaper than mapping a file.
+static constexpr unsigned minimumCachedSourceLength = 16 * KB;
+
+static String& cacheDirectory()
+{
+    static NeverDestroyed<String> directory;
+    return directory;
+}
+
+static HashSet<String>& pendingCacheEntries()
+{
+    static NeverDestroyed<HashSet<String>> entries;
+    return entries;
+}
+
+void BytecodeCacheJava::setDirectory(const String& directory)
+{
+    ASSERT(isMainThread());
+    if (cacheDirectory().isEmpty())
+        cacheDirectory() = directory;
+}
+
+static String cacheEntryPath(const JSC::SourceProvider& provider)
+{
+    SHA1 sha1;
+    sha1.addBytes(provider.sourceURL().utf8());
+    sha1.addBytes(CString(provider.sourceType() == JSC::SourceProviderSourceType::Module ? "\nmodule\n" : "\nprogram\n"));
+    StringView source = provider.source();
+    if (source.is8Bit())
+        sha1.addBytes(source.span8());
+    else
+        sha1.addBytes(std::as_bytes(source.span16()));
+    return FileSystem::pathByAppendingComponent(cacheDirectory(), makeString(sha1.computeHexDigest().data(), ".jsbc"_s));
+}
+
+static void storeBytecode(Ref<JSC::SourceProvider>&& provider, const String& path)
+{
+    auto isModule = provider->sourceType() == JSC::SourceProviderSourceType::Module;
+    JSC::SourceCode source(WTFMove(provider));
+
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> bytecode = isModule
+        ? JSC::generateModuleBytecode(vm, source, FileSystem::invalidPlatformFileHandle, error)
+        : JSC::generateProgramBytecode(vm, source, FileSystem::invalidPlatformFileHandle, error);
+    if (!bytecode || error.isValid())
+        return;
+
+    FileSystem::makeAllDirectories(cacheDirectory());
+    FileSystem::overwriteEntireFile(path, std::span { const_cast<uint8_t*>(bytecode->data()), bytecode->size() });
+}
+
+RefPtr<JSC::CachedBytecode> BytecodeCacheJava::load(const JSC::SourceProvider& provider)
+{
+    ASSERT(isMainThread());
+    if (cacheDirectory().isEmpty() || provider.source().length() < minimumCachedSourceLength)
+        return nullptr;
+
+    auto sourceType = provider.sourceType();
+    if (sourceType != JSC::SourceProviderSourceType::Program && sourceType != JSC::SourceProviderSourceType::Module)
+        return nullptr;
+
+    String path = cacheEntryPath(provider);
+    if (FileSystem::fileExists(path)) {
+        bool success;
+        FileSystem::MappedFileData mappedFile(path, FileSystem::MappedFileMode::Private, success);
+        if (success && mappedFile.size())
+            return JSC::CachedBytecode::create(WTFMove(mappedFile));
+        return nullptr;
+    }
+
+    // Generating the bytecode parses the script once more, keep that off
+    // the load that is running right now.
+    if (pendingCacheEntries().add(path).isNewEntry) {
+        callOnMainThread([provider = Ref { const_cast<JSC::SourceProvider&>(provider) }, path = WTFMove(path)] () mutable {
+            storeBytecode(WTFMove(provider), path);
+            pendingCacheEntries().remove(path);
+        });
+    }
+    return nullptr;
+}
+
+} // namespace WebCore
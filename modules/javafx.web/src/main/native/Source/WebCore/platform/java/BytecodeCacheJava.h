@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,44 +23,29 @@
  * questions.
  */
 
-#include "config.h"
-#include "RunLoop.h"
+#pragma once
 
-namespace WTF {
+#include <JavaScriptCore/CachedBytecode.h>
+#include <wtf/Forward.h>
 
-// JDK-8146878
-//XXX: implement these stubs?
-
-RunLoop::RunLoop() {}
-RunLoop::~RunLoop() {}
-
-void RunLoop::TimerBase::fired() {}
-
-void RunLoop::run() {}
-void RunLoop::stop() {}
-void RunLoop::wakeUp() {}
-
-RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
-    : m_runLoop(runLoop)
-{
+namespace JSC {
+class SourceProvider;
 }
 
-RunLoop::TimerBase::~TimerBase()
-{
-    stop();
-}
+namespace WebCore {
 
-void RunLoop::TimerBase::start(double fireInterval, bool repeat)
-{
-}
-
-void RunLoop::TimerBase::stop()
-{
-}
+// On-disk cache of the bytecode generated for page scripts. Entries are
+// keyed by script URL and content, and JSC rejects entries written by a
+// different build, so a stale entry only costs a regular compile.
+class BytecodeCacheJava {
+public:
+    // The cache is disabled until a directory is set. Only the first call
+    // takes effect.
+    WEBCORE_EXPORT static void setDirectory(const String&);
 
-bool RunLoop::TimerBase::isActive() const
-{
-  return true;
-}
+    // Maps the cached bytecode of the script in, or schedules the bytecode
+    // to be generated and stored once the current task is done.
+    static RefPtr<JSC::CachedBytecode> load(const JSC::SourceProvider&);
+};
 
-} // namespace WTF
+} // namespace WebCore
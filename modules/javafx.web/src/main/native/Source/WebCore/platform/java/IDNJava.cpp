@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,26 +25,46 @@
 
 #include "config.h"
 #include "IDNJava.h"
-#include <wtf/java/JavaEnv.h>
-#include "com_sun_webkit_network_URLLoaderBase.h"
+
+#include <unicode/uidna.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/URLParser.h>
+#include <wtf/text/StringHash.h>
 
 namespace IDNJavaInternal {
 
-static JGClass idnClass;
-static jmethodID toASCIIMID;
+// Pages tend to link to a handful of hosts many times over, so a small
+// cache covers nearly all conversions. It is simply dropped when full.
+static constexpr unsigned maxCachedHostnames = 256;
+
+static Lock cacheLock;
+
+static HashMap<String, String>& hostnameCache() WTF_REQUIRES_LOCK(cacheLock)
+{
+    static NeverDestroyed<HashMap<String, String>> cache;
+    return cache;
+}
 
-static void initRefs(JNIEnv* env)
+static String convert(const String& hostname)
 {
-    if (!idnClass) {
-        idnClass = JLClass(env->FindClass("java/net/IDN"));
-        ASSERT(idnClass);
+    if (hostname.length() > WTF::URLParser::hostnameBufferLength) {
+        return String();
+    }
 
-        toASCIIMID = env->GetStaticMethodID(
-                idnClass,
-                "toASCII",
-                "(Ljava/lang/String;I)Ljava/lang/String;");
-        ASSERT(toASCIIMID);
+    UChar buffer[WTF::URLParser::hostnameBufferLength];
+    UErrorCode error = U_ZERO_ERROR;
+    UIDNAInfo processingDetails = UIDNA_INFO_INITIALIZER;
+    int32_t length = uidna_nameToASCII(&WTF::URLParser::internationalDomainNameTranscoder(),
+            hostname.upconvertedCharacters(), hostname.length(),
+            buffer, WTF::URLParser::hostnameBufferLength, &processingDetails, &error);
+    if (U_FAILURE(error)
+            || (processingDetails.errors & ~WTF::URLParser::allowedNameToASCIIErrors)
+            || !length) {
+        return String();
     }
+    return String(buffer, length);
 }
 }
 
@@ -55,16 +75,28 @@ namespace IDNJava {
 String toASCII(const String& hostname)
 {
     using namespace IDNJavaInternal;
-    JNIEnv* env = WTF::GetJavaEnv();
-    initRefs(env);
+    if (hostname.containsOnlyASCII()) {
+        return hostname;
+    }
 
-    JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
-            idnClass,
-            toASCIIMID,
-            (jstring)hostname.toJavaString(env),
-            com_sun_webkit_network_URLLoaderBase_ALLOW_UNASSIGNED));
-    WTF::CheckAndClearException(env);
-    return String(env, result);
+    {
+        Locker locker { cacheLock };
+        auto it = hostnameCache().find(hostname);
+        if (it != hostnameCache().end()) {
+            return it->value.isolatedCopy();
+        }
+    }
+
+    String result = convert(hostname);
+    if (!result.isNull()) {
+        Locker locker { cacheLock };
+        auto& cache = hostnameCache();
+        if (cache.size() >= maxCachedHostnames) {
+            cache.clear();
+        }
+        cache.set(hostname.isolatedCopy(), result.isolatedCopy());
+    }
+    return result;
 }
 
 } // namespace IDNJava
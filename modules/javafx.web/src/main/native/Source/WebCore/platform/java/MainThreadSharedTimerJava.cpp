@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,38 +30,71 @@
 
 #include <wtf/Assertions.h>
 #include <wtf/MainThread.h>
+#include <wtf/WallTime.h>
+
+#include <cmath>
+#include <limits>
 
 namespace WebCore {
 
-// The fire time is relative to the classic POSIX epoch of January 1, 1970,
-// as the result of currentTime() is.
-#define MINIMAL_INTERVAL 1e-9 //1ns
-void MainThreadSharedTimer::setFireInterval(Seconds timeout)
+// WebCore reschedules the shared timer every time its earliest timer
+// changes, which with setTimeout(0) loops and animations happens many
+// thousands of times per second. The deadline WebCore wants is kept here
+// and Java only hears about it when it has to fire sooner than the
+// deadline it already holds. A late or stale wake up is sorted out in
+// twkFireTimerEvent.
+static WallTime s_fireTime = WallTime::infinity();
+static WallTime s_javaFireTime = WallTime::infinity();
+static Seconds s_alignmentInterval;
+
+// Java timers have millisecond resolution.
+static jlong toJavaTime(WallTime time)
+{
+    if (time == WallTime::infinity())
+        return std::numeric_limits<jlong>::max();
+    return static_cast<jlong>(std::ceil(time.secondsSinceEpoch().milliseconds()));
+}
+
+static void setJavaFireTime(WallTime fireTime)
 {
-    auto fireTime = timeout.value();
-    if (fireTime < MINIMAL_INTERVAL) {
-        fireTime = MINIMAL_INTERVAL;
-    }
     WC_GETJAVAENV_CHKRET(env);
 
     static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
-                                                  "fwkSetFireTime", "(D)V");
+                                                  "fwkSetFireTime", "(J)V");
     ASSERT(mid);
 
-    env->CallStaticVoidMethod(getTimerClass(env), mid, fireTime);
-    WTF::CheckAndClearException(env);
+    env->CallStaticVoidMethod(getTimerClass(env), mid, toJavaTime(fireTime));
+    if (!WTF::CheckAndClearException(env))
+        s_javaFireTime = fireTime;
 }
 
-void MainThreadSharedTimer::stop()
+static WallTime alignedFireTime(WallTime fireTime)
 {
-    WC_GETJAVAENV_CHKRET(env);
+    if (!s_alignmentInterval)
+        return fireTime;
+    double interval = s_alignmentInterval.value();
+    return WallTime::fromRawSeconds(std::ceil(fireTime.secondsSinceEpoch().value() / interval) * interval);
+}
 
-    static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
-                                                  "fwkStopTimer", "()V");
-    ASSERT(mid);
+void MainThreadSharedTimer::setFireInterval(Seconds timeout)
+{
+    ASSERT(isMainThread());
+    s_fireTime = alignedFireTime(WallTime::now() + std::max(timeout, 0_s));
+    if (toJavaTime(s_fireTime) < toJavaTime(s_javaFireTime))
+        setJavaFireTime(s_fireTime);
+}
+
+void MainThreadSharedTimer::stop()
+{
+    // The Java timer is left armed, its wake up is dropped when it comes.
+    ASSERT(isMainThread());
+    s_fireTime = WallTime::infinity();
+}
 
-    env->CallStaticVoidMethod(getTimerClass(env), mid);
-    WTF::CheckAndClearException(env);
+void MainThreadSharedTimer::setAlignmentInterval(Seconds interval)
+{
+    ASSERT(isMainThread());
+    s_alignmentInterval = interval;
 }
 
 // JDK-8146958
@@ -76,7 +109,20 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_Timer_twkFireTimerEvent
     (JNIEnv*, jclass)
 {
-    WebCore::MainThreadSharedTimer::singleton().fired();
+    using namespace WebCore;
+
+    s_javaFireTime = WallTime::infinity();
+    if (s_fireTime == WallTime::infinity())
+        return;
+
+    // Java fired for a deadline that has since moved later.
+    if (toJavaTime(s_fireTime) > toJavaTime(WallTime::now())) {
+        setJavaFireTime(s_fireTime);
+        return;
+    }
+
+    s_fireTime = WallTime::infinity();
+    MainThreadSharedTimer::singleton().fired();
 }
 
 }
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "RenderingProfileJava.h"
+
+#include "Document.h"
+#include "Page.h"
+#include <wtf/text/StringBuilder.h>
+
+namespace WebCore {
+
+// About a minute of rendering updates at 60 fps with a handful of phases
+// each, older events are dropped.
+static constexpr size_t maxTraceEvents = 32 * 1024;
+
+unsigned RenderingProfileJava::s_enabledPageCount = 0;
+
+RenderingProfileJava::RenderingProfileJava(bool keepTrace)
+    : m_keepTrace(keepTrace)
+    , m_traceStart(MonotonicTime::now())
+{
+    ++s_enabledPageCount;
+}
+
+RenderingProfileJava::~RenderingProfileJava()
+{
+    --s_enabledPageCount;
+}
+
+// static
+ASCIILiteral RenderingProfileJava::supplementName()
+{
+    return "RenderingProfileJava"_s;
+}
+
+// static
+void RenderingProfileJava::setEnabled(Page& page, bool enabled, bool keepTrace)
+{
+    page.removeSupplement(supplementName());
+    if (enabled)
+        page.provideSupplement(supplementName(), makeUnique<RenderingProfileJava>(keepTrace));
+}
+
+// static
+RenderingProfileJava* RenderingProfileJava::from(Page* page)
+{
+    if (LIKELY(!s_enabledPageCount) || !page)
+        return nullptr;
+    return static_cast<RenderingProfileJava*>(page->requireSupplement(supplementName()));
+}
+
+// static
+RenderingProfileJava* RenderingProfileJava::from(const Document& document)
+{
+    if (LIKELY(!s_enabledPageCount))
+        return nullptr;
+    return from(document.page());
+}
+
+MonotonicTime RenderingProfileJava::begin(Phase phase)
+{
+    if (phase == Phase::RenderingUpdate && !m_renderingUpdateDepth++)
+        m_layoutsInCurrentRenderingUpdate = 0;
+    return MonotonicTime::now();
+}
+
+void RenderingProfileJava::end(Phase phase, MonotonicTime start)
+{
+    auto duration = MonotonicTime::now() - start;
+    auto& totals = m_totals[static_cast<unsigned>(phase)];
+    ++totals.count;
+    totals.time += duration;
+    totals.longest = std::max(totals.longest, duration);
+
+    if (phase == Phase::Layout && m_renderingUpdateDepth)
+        ++m_layoutsInCurrentRenderingUpdate;
+    if (phase == Phase::RenderingUpdate && !--m_renderingUpdateDepth) {
+        m_layoutsInRenderingUpdates += m_layoutsInCurrentRenderingUpdate;
+        m_maxLayoutsPerRenderingUpdate = std::max(m_maxLayoutsPerRenderingUpdate, m_layoutsInCurrentRenderingUpdate);
+    }
+
+    if (m_keepTrace) {
+        if (m_trace.size() == maxTraceEvents)
+            m_trace.removeFirst();
+        m_trace.append({ phase, start, duration });
+    }
+}
+
+void RenderingProfileJava::reset()
+{
+    m_totals = { };
+    m_restyledElements = 0;
+    m_matchedDeclarationsHits = 0;
+    m_matchedDeclarationsMisses = 0;
+    m_styleSharingHits = 0;
+    m_styleSharingMisses = 0;
+    m_layoutsInRenderingUpdates = 0;
+    m_maxLayoutsPerRenderingUpdate = 0;
+    m_trace.clear();
+}
+
+static ASCIILiteral phaseName(RenderingProfileJava::Phase phase)
+{
+    switch (phase) {
+    case RenderingProfileJava::Phase::Style:
+        return "Style"_s;
+    case RenderingProfileJava::Phase::Layout:
+        return "Layout"_s;
+    case RenderingProfileJava::Phase::Paint:
+        return "Paint"_s;
+    case RenderingProfileJava::Phase::Composite:
+        return "Composite"_s;
+    case RenderingProfileJava::Phase::RenderingUpdate:
+        return "RenderingUpdate"_s;
+    }
+    ASSERT_NOT_REACHED();
+    return ""_s;
+}
+
+String RenderingProfileJava::traceJSON() const
+{
+    // Complete ("X") events of one thread, timestamps in microseconds
+    StringBuilder builder;
+    builder.append("{\"traceEvents\":["_s);
+    bool first = true;
+    for (auto& event : m_trace) {
+        if (!first)
+            builder.append(',');
+        first = false;
+        builder.append("{\"name\":\""_s, phaseName(event.phase),
+            "\",\"cat\":\"rendering\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"_s,
+            static_cast<uint64_t>((event.start - m_traceStart).microseconds()),
+            ",\"dur\":"_s, static_cast<uint64_t>(event.duration.microseconds()), '}');
+    }
+    builder.append("],\"displayTimeUnit\":\"ms\"}"_s);
+    return builder.toString();
+}
+
+} // namespace WebCore
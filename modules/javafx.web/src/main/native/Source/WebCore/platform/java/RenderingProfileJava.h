@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "Supplementable.h"
+#include <array>
+#include <wtf/Deque.h>
+#include <wtf/Forward.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/WeakPtr.h>
+
+namespace WebCore {
+
+class Document;
+class Page;
+
+// Counts the rendering work done for a page while profiling is enabled
+// for it, and optionally keeps a trace of the individual phases. Phase
+// times are inclusive, a layout forced by a style recalc counts towards
+// both. Profiling may be turned off by script running inside a phase,
+// so scopes hold the profile weakly. Main thread only.
+class RenderingProfileJava final : public Supplement<Page>, public CanMakeWeakPtr<RenderingProfileJava> {
+    WTF_MAKE_NONCOPYABLE(RenderingProfileJava);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    enum class Phase : uint8_t {
+        Style,
+        Layout,
+        Paint,
+        Composite,
+        RenderingUpdate,
+    };
+    static constexpr unsigned phaseCount = 5;
+
+    struct PhaseTotals {
+        uint64_t count { 0 };
+        Seconds time;
+        Seconds longest;
+    };
+
+    class Scope {
+        WTF_MAKE_NONCOPYABLE(Scope);
+    public:
+        Scope(RenderingProfileJava* profile, Phase phase)
+            : m_profile(profile)
+            , m_phase(phase)
+        {
+            if (profile)
+                m_start = profile->begin(m_phase);
+        }
+
+        ~Scope()
+        {
+            if (m_profile)
+                m_profile->end(m_phase, m_start);
+        }
+
+    private:
+        WeakPtr<RenderingProfileJava> m_profile;
+        Phase m_phase;
+        MonotonicTime m_start;
+    };
+
+    explicit RenderingProfileJava(bool keepTrace);
+    ~RenderingProfileJava();
+
+    WEBCORE_EXPORT static void setEnabled(Page&, bool enabled, bool keepTrace);
+
+    // Returns nullptr unless profiling is enabled for the page, cheaply
+    // while it is not enabled for any page.
+    WEBCORE_EXPORT static RenderingProfileJava* from(Page*);
+    static RenderingProfileJava* from(const Document&);
+
+    void didRestyleElements(unsigned count) { m_restyledElements += count; }
+    void didLookUpMatchedDeclarations(bool hit) { ++(hit ? m_matchedDeclarationsHits : m_matchedDeclarationsMisses); }
+    void didLookUpSharedStyle(bool hit) { ++(hit ? m_styleSharingHits : m_styleSharingMisses); }
+
+    const PhaseTotals& totals(Phase phase) const { return m_totals[static_cast<unsigned>(phase)]; }
+    uint64_t restyledElements() const { return m_restyledElements; }
+    uint64_t matchedDeclarationsHits() const { return m_matchedDeclarationsHits; }
+    uint64_t matchedDeclarationsMisses() const { return m_matchedDeclarationsMisses; }
+    uint64_t styleSharingHits() const { return m_styleSharingHits; }
+    uint64_t styleSharingMisses() const { return m_styleSharingMisses; }
+    uint64_t layoutsInRenderingUpdates() const { return m_layoutsInRenderingUpdates; }
+    unsigned maxLayoutsPerRenderingUpdate() const { return m_maxLayoutsPerRenderingUpdate; }
+
+    WEBCORE_EXPORT void reset();
+
+    // The kept trace in the Trace Event Format, as read by Perfetto and
+    // chrome://tracing.
+    WEBCORE_EXPORT String traceJSON() const;
+
+private:
+    struct TraceEvent {
+        Phase phase;
+        MonotonicTime start;
+        Seconds duration;
+    };
+
+    static ASCIILiteral supplementName();
+
+    MonotonicTime begin(Phase);
+    void end(Phase, MonotonicTime start);
+
+    static unsigned s_enabledPageCount;
+
+    std::array<PhaseTotals, phaseCount> m_totals;
+    uint64_t m_restyledElements { 0 };
+    uint64_t m_matchedDeclarationsHits { 0 };
+    uint64_t m_matchedDeclarationsMisses { 0 };
+    uint64_t m_styleSharingHits { 0 };
+    uint64_t m_styleSharingMisses { 0 };
+    uint64_t m_layoutsInRenderingUpdates { 0 };
+    unsigned m_maxLayoutsPerRenderingUpdate { 0 };
+    unsigned m_layoutsInCurrentRenderingUpdate { 0 };
+    unsigned m_renderingUpdateDepth { 0 };
+
+    bool m_keepTrace;
+    MonotonicTime m_traceStart;
+    Deque<TraceEvent> m_trace;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,16 +26,25 @@
 #include "config.h"
 
 #include "SharedBuffer.h"
-#include "NotImplemented.h"
 #include "com_sun_webkit_SharedBuffer.h"
+#include <wtf/FileSystem.h>
 
 namespace WebCore {
 
-// JDK-8146959
-RefPtr<SharedBuffer> SharedBuffer::createFromReadingFile(const String&)
+RefPtr<SharedBuffer> SharedBuffer::createFromReadingFile(const String& filePath)
 {
-  notImplemented();
-  return {};
+    if (filePath.isEmpty())
+        return nullptr;
+
+    // The file is mapped rather than read, so its pages are only brought
+    // in as the buffer is used and are never copied onto the heap.
+    bool success = false;
+    FileSystem::MappedFileData mappedFileData(filePath, FileSystem::MappedFileMode::Private, success);
+    if (!success)
+        return nullptr;
+    if (!mappedFileData)
+        return SharedBuffer::create();
+    return SharedBuffer::create(WTFMove(mappedFileData));
 }
 
 extern "C" {
@@ -29,22 +29,70 @@
 #if PLATFORM(JAVA)
 
 #include "NotImplemented.h"
+#include "PlatformJavaClasses.h"
+#include <wtf/java/JavaEnv.h>
+
+#include "com_sun_webkit_network_NetworkContext.h"
 
 namespace WebCore {
 
+namespace DNSResolveQueueJavaInternal {
+
+static JGClass networkContextClass;
+static jmethodID prefetchDNSMethod;
+static jmethodID isUsingProxyMethod;
+
+static void initRefs(JNIEnv* env)
+{
+    if (!networkContextClass) {
+        networkContextClass = JLClass(env->FindClass(
+                "com/sun/webkit/network/NetworkContext"));
+        ASSERT(networkContextClass);
+
+        prefetchDNSMethod = env->GetStaticMethodID(
+                networkContextClass,
+                "fwkPrefetchDNS",
+                "(Ljava/lang/String;)V");
+        ASSERT(prefetchDNSMethod);
+
+        isUsingProxyMethod = env->GetStaticMethodID(
+                networkContextClass,
+                "fwkIsUsingProxy",
+                "()Z");
+        ASSERT(isUsingProxyMethod);
+    }
+}
+}
+
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    jboolean isUsingProxy = env->CallStaticBooleanMethod(networkContextClass, isUsingProxyMethod);
+    // Don't prefetch if the answer is unknown.
+    m_isUsingProxy = WTF::CheckAndClearException(env) || jbool_to_bool(isUsingProxy);
 }
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+void DNSResolveQueueJava::platformResolve(const String& hostname)
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    // The request is counted in flight until twkDidPrefetchDNS.
+    env->CallStaticVoidMethod(networkContextClass, prefetchDNSMethod,
+            (jstring)hostname.toJavaString(env));
+    if (WTF::CheckAndClearException(env)) {
+        decrementRequestCount();
+    }
 }
 
-void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
+void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& completionHandler)
 {
     notImplemented();
+    completionHandler(makeUnexpected(DNSError::CannotResolve));
 }
 
 void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
@@ -52,6 +100,16 @@ void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
     notImplemented();
 }
 
+} // namespace WebCore
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_NetworkContext_twkDidPrefetchDNS
+  (JNIEnv*, jclass)
+{
+    WebCore::DNSResolveQueue::singleton().decrementRequestCount();
+}
+
 }
 
 #endif
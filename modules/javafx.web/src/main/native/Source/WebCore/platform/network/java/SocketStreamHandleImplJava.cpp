@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -89,20 +89,21 @@ std::optional<size_t> SocketStreamHandleImpl::platformSendInternal(const uint8_t
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
-    JLByteArray byteArray = env->NewByteArray(len);
-    env->SetByteArrayRegion(
-            (jbyteArray) byteArray,
-            (jsize) 0,
-            (jsize) len,
-            (const jbyte*) data);
+    // fwkSend writes the data out before returning, so it can read
+    // straight from WebCore's buffer.
+    JLObject buffer(env->NewDirectByteBuffer(const_cast<uint8_t*>(data), len));
+    if (!buffer) {
+        WTF::CheckAndClearException(env);
+        return { };
+    }
 
     static jmethodID mid = env->GetMethodID(
             GetSocketStreamHandleClass(env),
             "fwkSend",
-            "([B)I");
+            "(Ljava/nio/ByteBuffer;)I");
     ASSERT(mid);
 
-    jint res = env->CallIntMethod(m_ref, mid, (jbyteArray) byteArray);
+    jint res = env->CallIntMethod(m_ref, mid, (jobject) buffer);
     if (WTF::CheckAndClearException(env)) {
         return { };
     }
@@ -170,15 +171,17 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidOpen
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidReceiveData
-  (JNIEnv* env, jclass, jbyteArray buffer, jint len, jlong data)
+  (JNIEnv* env, jclass, jobject buffer, jint len, jlong data)
 {
     using namespace WebCore;
     SocketStreamHandleImpl* handle =
             static_cast<SocketStreamHandleImpl*>(jlong_to_ptr(data));
     ASSERT(handle);
-    jbyte* p = env->GetByteArrayElements(buffer, NULL);
-    handle->didReceiveData((const uint8_t*) p, len);
-    env->ReleaseByteArrayElements(buffer, p, JNI_ABORT);
+    const uint8_t* p = static_cast<const uint8_t*>(env->GetDirectBufferAddress(buffer));
+    ASSERT(p);
+    if (!p)
+        return;
+    handle->didReceiveData(p, len);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidFail
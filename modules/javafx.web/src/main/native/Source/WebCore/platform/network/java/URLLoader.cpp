@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 #endif
 
 #include "FrameNetworkingContext.h"
+#include "HTTPHeaderNames.h"
 #include "HTTPParsers.h"
 #include "MIMETypeRegistry.h"
 #include "NetworkingContext.h"
@@ -42,6 +43,7 @@
 #include "ResourceRequest.h"
 #include "ResourceResponse.h"
 #include "SharedBuffer.h"
+#include "Timer.h"
 #include "URLLoader.h"
 #include "NetworkLoadMetrics.h"
 #include "com_sun_webkit_LoadListenerClient.h"
@@ -78,7 +80,7 @@ static void initRefs(JNIEnv* env)
                 "fwkLoad",
                 "(Lcom/sun/webkit/WebPage;Z"
                 "Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;"
-                "[Lcom/sun/webkit/network/FormDataElement;J)"
+                "[Lcom/sun/webkit/network/FormDataElement;IJ)"
                 "Lcom/sun/webkit/network/URLLoaderBase;");
         ASSERT(loadMethod);
     }
@@ -127,6 +129,14 @@ std::unique_ptr<URLLoader> URLLoader::loadAsynchronously(NetworkingContext* cont
 {
     std::unique_ptr<URLLoader> result = std::unique_ptr<URLLoader>(new URLLoader());
     result->m_target = std::unique_ptr<AsynchronousTarget>(new AsynchronousTarget(handle));
+    if (auto data = readLocalFile(request)) {
+        result->m_target->fetchStart = MonotonicTime::now();
+        result->m_localFileURL = request.url();
+        result->m_localFileData = WTFMove(data);
+        result->m_localFileTimer = makeUnique<Timer>(*result, &URLLoader::localFileTimerFired);
+        result->m_localFileTimer->startOneShot(0_s);
+        return result;
+    }
     result->m_ref = load(
             true,
             context,
@@ -138,6 +148,8 @@ std::unique_ptr<URLLoader> URLLoader::loadAsynchronously(NetworkingContext* cont
 void URLLoader::cancel()
 {
     using namespace URLLoaderJavaInternal;
+    m_localFileTimer = nullptr;
+    m_localFileData = nullptr;
     if (m_ref) {
         JNIEnv* env = WTF::GetJavaEnv();
         initRefs(env);
@@ -156,9 +168,64 @@ void URLLoader::loadSynchronously(NetworkingContext* context,
                                   Vector<uint8_t>& data)
 {
     SynchronousTarget target(request, error, response, data);
+    if (auto fileData = readLocalFile(request)) {
+        target.fetchStart = MonotonicTime::now();
+        deliverLocalFile(request.url(), *fileData, &target, nullptr);
+        return;
+    }
     load(false, context, request, &target);
 }
 
+RefPtr<SharedBuffer> URLLoader::readLocalFile(const ResourceRequest& request)
+{
+    // Remote file URLs and anything with a body are left to the Java
+    // loader, as is anything that cannot be mapped, directories included.
+    const URL& url = request.url();
+    if (!url.protocolIsFile() || !url.host().isEmpty()
+            || request.httpMethod() != "GET"_s || request.httpBody()) {
+        return nullptr;
+    }
+    String path = url.fileSystemPath();
+#if OS(WINDOWS)
+    // "/C:/dir/file" names "C:/dir/file"
+    if (path.length() > 2 && path[0] == '/' && path[2] == ':')
+        path = path.substring(1);
+#endif
+    return SharedBuffer::createFromReadingFile(path);
+}
+
+void URLLoader::deliverLocalFile(const URL& url, const SharedBuffer& data, Target* target, const WeakPtr<URLLoader>& loader)
+{
+    // The same response the Java loader builds for local files
+    ResourceResponse response(url, MIMETypeRegistry::mimeTypeForPath(url.path().toString()), data.size(), String());
+    NetworkLoadMetrics metrics;
+    metrics.fetchStart = target->fetchStart;
+    metrics.requestStart = metrics.responseStart = MonotonicTime::now();
+    response.setDeprecatedNetworkLoadMetrics(Box<NetworkLoadMetrics>::create(metrics));
+    bool asynchronous = !!loader;
+    target->didReceiveResponse(response);
+    // Any callback may cancel an asynchronous load, which destroys the
+    // loader and its target
+    if (asynchronous && !loader)
+        return;
+    if (data.size()) {
+        target->didReceiveData(&data, data.size());
+        if (asynchronous && !loader)
+            return;
+    }
+    metrics.responseEnd = MonotonicTime::now();
+    metrics.responseBodyBytesReceived = metrics.responseBodyDecodedSize = data.size();
+    metrics.markComplete();
+    target->didFinishLoading(metrics);
+}
+
+void URLLoader::localFileTimerFired()
+{
+    RefPtr<SharedBuffer> data = WTFMove(m_localFileData);
+    ASSERT(data);
+    deliverLocalFile(m_localFileURL, *data, m_target.get(), WeakPtr { *this });
+}
+
 JLObject URLLoader::load(bool asynchronous,
                          NetworkingContext* context,
                          const ResourceRequest& request,
@@ -193,6 +260,7 @@ JLObject URLLoader::load(bool asynchronous,
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
+    target->fetchStart = MonotonicTime::now();
     JLObject loader = env->CallStaticObjectMethod(
             networkContextClass,
             loadMethod,
@@ -202,6 +270,7 @@ JLObject URLLoader::load(bool asynchronous,
             (jstring) request.httpMethod().toJavaString(env),
             (jstring) headerString.toJavaString(env),
             (jobjectArray) toJava(request.httpBody().get()),
+            static_cast<jint>(request.priority()),
             ptr_to_jlong(target));
     WTF::CheckAndClearException(env);
 
@@ -307,11 +376,11 @@ void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer* data, int
     }
 }
 
-void URLLoader::AsynchronousTarget::didFinishLoading()
+void URLLoader::AsynchronousTarget::didFinishLoading(const NetworkLoadMetrics& metrics)
 {
     ResourceHandleClient* client = m_handle->client();
     if (client) {
-        client->didFinishLoading(m_handle, {});
+        client->didFinishLoading(m_handle, metrics);
     }
 }
 
@@ -368,7 +437,7 @@ void URLLoader::SynchronousTarget::didReceiveData(const SharedBuffer* data, int
     m_data.append(data->data(), (size_t)length);
 }
 
-void URLLoader::SynchronousTarget::didFinishLoading()
+void URLLoader::SynchronousTarget::didFinishLoading(const NetworkLoadMetrics&)
 {
 }
 
@@ -419,30 +488,66 @@ static WebCore::ResourceResponse setupResponse(JNIEnv* env,
                 static_cast<long long>(contentLength));
     }
 
+    // The headers come as "name:value\n" lines, walked in place so that
+    // only the names and values themselves are allocated.
     String headersString(env, headers);
-    int splitPos = headersString.find("\n"_s);
-    while (splitPos != -1) {
-        String s = headersString.left(splitPos);
-        int j = s.find(":"_s);
-        if (j != -1) {
-            String key = s.left(j);
-            String val = s.substring(j + 1);
-            response.setHTTPHeaderField(key, val);
+    StringView remaining = headersString;
+    for (size_t splitPos = remaining.find('\n'); splitPos != notFound; splitPos = remaining.find('\n')) {
+        StringView line = remaining.left(splitPos);
+        size_t j = line.find(':');
+        if (j != notFound) {
+            StringView name = line.left(j);
+            String value = line.substring(j + 1).toString();
+            HTTPHeaderName headerName;
+            if (findHTTPHeaderName(name, headerName)) {
+                response.setHTTPHeaderField(headerName, value);
+            } else {
+                response.setHTTPHeaderField(name.toString(), value);
+            }
         }
-        headersString = headersString.substring(splitPos + 1);
-        splitPos = headersString.find("\n"_s);
+        remaining = remaining.substring(splitPos + 1);
     }
 
     URL kurl = URL(URL(), String(env, url));
     response.setURL(kurl);
 
     // Setup mime type for local resources
-    if (/*kurl.hasPath()*/kurl.pathEnd() != kurl.pathStart() && kurl.protocol() == String("file"_s)) {
+    if (/*kurl.hasPath()*/kurl.pathEnd() != kurl.pathStart() && kurl.protocolIs("file"_s)) {
         response.setMimeType(MIMETypeRegistry::mimeTypeForPath(kurl.path().toString()));
     }
     return response;
 }
 
+static WebCore::NetworkLoadMetrics loadMetrics(JNIEnv* env, jlongArray timing,
+                                               const WebCore::URLLoader::Target& target)
+{
+    using namespace WebCore;
+    NetworkLoadMetrics metrics;
+    metrics.fetchStart = target.fetchStart;
+    if (!timing || !target.fetchStart) {
+        return metrics;
+    }
+
+    jlong values[com_sun_webkit_network_URLLoaderBase_TIMING_COUNT];
+    env->GetLongArrayRegion(timing, 0, com_sun_webkit_network_URLLoaderBase_TIMING_COUNT, values);
+    if (WTF::CheckAndClearException(env)) {
+        return metrics;
+    }
+    auto time = [&] (int index) {
+        return values[index] >= 0
+            ? target.fetchStart + Seconds::fromNanoseconds(values[index])
+            : MonotonicTime();
+    };
+    // The Java loaders cannot tell name resolution from connecting, so
+    // both go under connectStart and connectEnd.
+    metrics.connectStart = time(com_sun_webkit_network_URLLoaderBase_TIMING_CONNECT_START);
+    metrics.connectEnd = time(com_sun_webkit_network_URLLoaderBase_TIMING_CONNECT_END);
+    metrics.requestStart = time(com_sun_webkit_network_URLLoaderBase_TIMING_REQUEST_START);
+    metrics.responseStart = time(com_sun_webkit_network_URLLoaderBase_TIMING_RESPONSE_START);
+    metrics.responseEnd = time(com_sun_webkit_network_URLLoaderBase_TIMING_RESPONSE_END);
+    return metrics;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidSendData
   (JNIEnv*, jclass, jlong totalBytesSent, jlong totalBytesToBeSent, jlong data)
 {
@@ -478,7 +583,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkWillSendRequ
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveResponse
   (JNIEnv* env, jclass, jint status, jstring contentType,
    jstring contentEncoding, jlong contentLength, jstring headers,
-   jstring url, jlong data)
+   jstring url, jlongArray timing, jlong data)
 {
     using namespace WebCore;
     URLLoader::Target* target =
@@ -493,6 +598,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveRe
             contentLength,
             headers,
             url);
+    // Navigation timing is taken from the response, before the load ends
+    response.setDeprecatedNetworkLoadMetrics(
+            Box<NetworkLoadMetrics>::create(loadMetrics(env, timing, *target)));
 
     target->didReceiveResponse(response);
 }
@@ -507,19 +615,23 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
     ASSERT(target);
     const uint8_t* address =
             static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<FragmentedSharedBuffer> tmp_buf = FragmentedSharedBuffer::create(address,remaining);
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    // The Java loaders reuse their direct buffers once this call returns,
+    // while WebCore may keep the data by reference, so it is copied once
+    // into a contiguous buffer of its own.
+    Ref<SharedBuffer> buffer = SharedBuffer::create(address + position, remaining);
+    target->didReceiveData(buffer.ptr(), remaining);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
-  (JNIEnv*, jclass, jlong data)
+  (JNIEnv* env, jclass, jlongArray timing, jlong data)
 {
     using namespace WebCore;
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
-    target->didFinishLoading();
+    NetworkLoadMetrics metrics = loadMetrics(env, timing, *target);
+    metrics.markComplete();
+    target->didFinishLoading(metrics);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFail
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,19 +26,25 @@
 #pragma once
 
 #include <wtf/java/JavaRef.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/URL.h>
 #include <wtf/Vector.h>
+#include <wtf/WeakPtr.h>
 #include <wtf/text/WTFString.h>
 
 namespace WebCore {
 
 class FormData;
+class NetworkLoadMetrics;
 class NetworkingContext;
 class ResourceError;
 class ResourceHandle;
 class ResourceRequest;
 class ResourceResponse;
+class SharedBuffer;
+class Timer;
 
-class URLLoader {
+class URLLoader : public CanMakeWeakPtr<URLLoader> {
 public:
     static std::unique_ptr<URLLoader> loadAsynchronously(NetworkingContext* context,
                                                     ResourceHandle* handle,
@@ -58,9 +64,13 @@ public:
         virtual bool willSendRequest(const ResourceResponse& response) = 0;
         virtual void didReceiveResponse(const ResourceResponse& response) = 0;
         virtual void didReceiveData(const SharedBuffer* data, int length) = 0;
-        virtual void didFinishLoading() = 0;
+        virtual void didFinishLoading(const NetworkLoadMetrics& metrics) = 0;
         virtual void didFail(const ResourceError& error) = 0;
         virtual ~Target();
+
+        // When the load was started, the timing reported by the Java
+        // loaders is relative to it
+        MonotonicTime fetchStart;
     };
 
 private:
@@ -71,6 +81,9 @@ private:
                          const ResourceRequest& request,
                          Target* target);
     static JLObjectArray toJava(const FormData* formData);
+    static RefPtr<SharedBuffer> readLocalFile(const ResourceRequest& request);
+    static void deliverLocalFile(const URL& url, const SharedBuffer& data, Target* target, const WeakPtr<URLLoader>& loader);
+    void localFileTimerFired();
 
     class AsynchronousTarget : public Target {
     public:
@@ -80,7 +93,7 @@ private:
         bool willSendRequest(const ResourceResponse& response) final;
         void didReceiveResponse(const ResourceResponse& response) final;
         void didReceiveData(const SharedBuffer* data, int length) final;
-        void didFinishLoading() final;
+        void didFinishLoading(const NetworkLoadMetrics& metrics) final;
         void didFail(const ResourceError& error) final;
     private:
         ResourceHandle* m_handle;
@@ -97,7 +110,7 @@ private:
         bool willSendRequest(const ResourceResponse& response) final;
         void didReceiveResponse(const ResourceResponse& response) final;
         void didReceiveData(const SharedBuffer* data, int length) final;
-        void didFinishLoading() final;
+        void didFinishLoading(const NetworkLoadMetrics& metrics) final;
         void didFail(const ResourceError& error) final;
     private:
         const ResourceRequest& m_request;
@@ -108,6 +121,12 @@ private:
 
     JGObject m_ref;
     std::unique_ptr<AsynchronousTarget> m_target;
+
+    // Local files are mapped and handed over from a timer instead of
+    // going through the Java loaders
+    URL m_localFileURL;
+    RefPtr<SharedBuffer> m_localFileData;
+    std::unique_ptr<Timer> m_localFileTimer;
 };
 
 } // namespace WebCore
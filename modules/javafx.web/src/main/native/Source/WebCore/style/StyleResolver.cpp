@@ -86,6 +86,10 @@
 #include <wtf/Vector.h>
 #include <wtf/text/AtomStringHash.h>
 
+#if PLATFORM(JAVA)
+#include "RenderingProfileJava.h"
+#endif
+
 namespace WebCore {
 namespace Style {
 
@@ -610,6 +614,10 @@ void Resolver::applyMatchedProperties(State& state, const MatchResult& matchResu
     auto* cacheEntry = m_matchedDeclarationsCache.find(cacheHash, matchResult, parentStyle.inheritedCustomProperties());
 
     auto hasUsableEntry = cacheEntry && MatchedDeclarationsCache::isCacheable(element, style, parentStyle);
+#if PLATFORM(JAVA)
+    if (auto* renderingProfile = RenderingProfileJava::from(document()))
+        renderingProfile->didLookUpMatchedDeclarations(hasUsableEntry);
+#endif
     if (hasUsableEntry) {
         // We can build up the style by copying non-inherited properties from an earlier style object built using the same exact
         // style declarations. We then only need to apply the inherited properties, if any, as their values can depend on the
@@ -59,6 +59,10 @@
 #include "WebAnimationTypes.h"
 #include "WebAnimationUtilities.h"
 
+#if PLATFORM(JAVA)
+#include "RenderingProfileJava.h"
+#endif
+
 namespace WebCore {
 
 namespace Style {
@@ -153,8 +157,13 @@ ResolvedStyle TreeResolver::styleForStyleable(const Styleable& styleable, Resolu
         return { WTFMove(style) };
     }
 
-    if (auto style = scope().sharingResolver.resolve(styleable, *m_update))
-        return { WTFMove(style) };
+    auto sharedStyle = scope().sharingResolver.resolve(styleable, *m_update);
+#if PLATFORM(JAVA)
+    if (auto* renderingProfile = RenderingProfileJava::from(m_document))
+        renderingProfile->didLookUpSharedStyle(!!sharedStyle);
+#endif
+    if (sharedStyle)
+        return { WTFMove(sharedStyle) };
 
     auto elementStyle = scope().resolver->styleForElement(element, resolutionContext);
 
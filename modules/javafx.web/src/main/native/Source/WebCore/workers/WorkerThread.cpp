@@ -130,15 +130,17 @@ Ref<Thread> WorkerThread::createThread()
     }
 
     return Thread::create(threadName(), [this] {
+#if PLATFORM(JAVA)
+        // Loaders, timers and file access call into Java from the worker
+        // thread for as long as it runs, keep it attached throughout.
+        WTF::GetOrAttachJavaEnv();
+#endif
         workerOrWorkletThread();
     }, ThreadType::JavaScript);
 }
 
 RefPtr<WorkerOrWorkletGlobalScope> WorkerThread::createGlobalScope()
 {
-#if PLATFORM(JAVA)
-    WTF::AttachThreadAsDaemonToJavaEnv autoAttach;
-#endif
     return createWorkerGlobalScope(m_startupData->params, WTFMove(m_startupData->origin), WTFMove(m_startupData->topOrigin));
 }
 
@@ -28,6 +28,7 @@ list(APPEND WebKitLegacy_SOURCES
     java/DOM/JavaCharacterData.cpp
     java/DOM/JavaComment.cpp
     java/DOM/JavaCounter.cpp
+    java/DOM/JavaDOMBatch.cpp
     java/DOM/JavaDOMImplementation.cpp
     java/DOM/JavaDOMStringList.cpp
     java/DOM/JavaDOMWindow.cpp
@@ -130,7 +131,9 @@ list(APPEND WebKitLegacy_SOURCES
     java/WebCoreSupport/PlatformStrategiesJava.cpp
     java/WebCoreSupport/ChromeClientJava.cpp
     java/WebCoreSupport/BackForwardList.cpp
+    java/WebCoreSupport/MemoryUsageJava.cpp
     java/WebCoreSupport/PageCacheJava.cpp
+    java/WebCoreSupport/RetainedPaintCache.cpp
 
     java/storage/WebDatabaseProviderJava.cpp
 )
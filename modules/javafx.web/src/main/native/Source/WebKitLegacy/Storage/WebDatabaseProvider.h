@@ -41,6 +41,13 @@ public:
 
     void deleteAllDatabases();
 
+#if PLATFORM(JAVA)
+    // IndexedDB databases of the default session are kept under this
+    // directory. It has to be set before the first database is opened,
+    // later calls are ignored.
+    static void setIndexedDatabaseDirectoryPath(const String&);
+#endif
+
 private:
     explicit WebDatabaseProvider();
 
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#undef IMPL
+
+#include <WebCore/ContainerNode.h>
+#include <WebCore/DOMException.h>
+#include <WebCore/Element.h>
+#include <WebCore/ElementInlines.h>
+#include <WebCore/JSExecState.h>
+#include <WebCore/Node.h>
+#include <WebCore/NodeList.h>
+#include <WebCore/NodeTraversal.h>
+
+#include <wtf/HashMap.h>
+#include <wtf/Vector.h>
+
+#include "com_sun_webkit_dom_DOMBatch_Mutations.h"
+#include <WebCore/JavaDOMUtils.h>
+#include <wtf/java/JavaEnv.h>
+
+using namespace WebCore;
+
+namespace {
+
+void setStringElement(JNIEnv* env, jobjectArray array, jsize index, const String& string)
+{
+    if (string.isNull())
+        return;
+    JLString value(string.toJavaString(env));
+    env->SetObjectArrayElement(array, index, value);
+}
+
+jobjectArray newStringArray(JNIEnv* env, jsize length)
+{
+    static JGClass stringClass(env->FindClass("java/lang/String"));
+    return env->NewObjectArray(length, stringClass, nullptr);
+}
+
+RefPtr<NodeList> querySelectorAll(JNIEnv* env, jlong peer, jstring selectors)
+{
+    auto* container = dynamicDowncast<ContainerNode>(jlong_to_Nodeptr(peer));
+    if (!container) {
+        raiseNotSupportedErrorException(env);
+        return nullptr;
+    }
+    return raiseOnDOMError(env, container->querySelectorAll(String(env, selectors)));
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jobject JNICALL Java_com_sun_webkit_dom_DOMBatch_snapshotImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    Node* root = jlong_to_Nodeptr(peer);
+
+    Vector<Node*> nodes;
+    for (Node* node = root; node; node = NodeTraversal::next(*node, root))
+        nodes.append(node);
+
+    jsize count = nodes.size();
+    HashMap<Node*, jint> indices;
+    Vector<jint> parents(count);
+    Vector<jshort> types(count);
+    Vector<jint> attributeOffsets(count + 1);
+    jsize attributeCount = 0;
+    for (jsize i = 0; i < count; i++) {
+        Node* node = nodes[i];
+        indices.add(node, i);
+        parents[i] = i ? indices.get(node->parentNode()) : -1;
+        types[i] = static_cast<jshort>(node->nodeType());
+        attributeOffsets[i] = attributeCount;
+        if (auto* element = dynamicDowncast<Element>(*node); element && element->hasAttributes())
+            attributeCount += 2 * element->attributeCount();
+    }
+    attributeOffsets[count] = attributeCount;
+
+    JLocalRef<jintArray> jparents(env->NewIntArray(count));
+    JLocalRef<jshortArray> jtypes(env->NewShortArray(count));
+    JLObjectArray jnames(newStringArray(env, count));
+    JLObjectArray jvalues(newStringArray(env, count));
+    JLocalRef<jintArray> jattributeOffsets(env->NewIntArray(count + 1));
+    JLObjectArray jattributes(newStringArray(env, attributeCount));
+    if (!jparents || !jtypes || !jnames || !jvalues || !jattributeOffsets || !jattributes) {
+        WTF::CheckAndClearException(env);
+        return nullptr;
+    }
+    env->SetIntArrayRegion(jparents, 0, count, parents.data());
+    env->SetShortArrayRegion(jtypes, 0, count, types.data());
+    env->SetIntArrayRegion(jattributeOffsets, 0, count + 1, attributeOffsets.data());
+
+    for (jsize i = 0; i < count; i++) {
+        Node* node = nodes[i];
+        setStringElement(env, jnames, i, node->nodeName());
+        setStringElement(env, jvalues, i, node->nodeValue());
+        auto* element = dynamicDowncast<Element>(*node);
+        if (!element || !element->hasAttributes())
+            continue;
+        jsize index = attributeOffsets[i];
+        for (const Attribute& attribute : element->attributesIterator()) {
+            setStringElement(env, jattributes, index++, attribute.name().toString());
+            setStringElement(env, jattributes, index++, attribute.value());
+        }
+    }
+
+    static JGClass snapshotClass(env->FindClass("com/sun/webkit/dom/DOMBatch$TreeSnapshot"));
+    static jmethodID snapshotConstructor = env->GetMethodID(snapshotClass, "<init>",
+        "([I[S[Ljava/lang/String;[Ljava/lang/String;[I[Ljava/lang/String;)V");
+    ASSERT(snapshotConstructor);
+    jobject snapshot = env->NewObject(snapshotClass, snapshotConstructor,
+        (jintArray)jparents, (jshortArray)jtypes, (jobjectArray)jnames,
+        (jobjectArray)jvalues, (jintArray)jattributeOffsets, (jobjectArray)jattributes);
+    WTF::CheckAndClearException(env);
+    return snapshot;
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_DOMBatch_queryAttributesImpl(JNIEnv* env, jclass, jlong peer
+    , jstring selectors, jobjectArray names)
+{
+    WebCore::JSMainThreadNullState state;
+    RefPtr<NodeList> elements = querySelectorAll(env, peer, selectors);
+    if (!elements)
+        return nullptr;
+
+    jsize nameCount = env->GetArrayLength(names);
+    Vector<AtomString> attributeNames;
+    for (jsize j = 0; j < nameCount; j++) {
+        JLString name(static_cast<jstring>(env->GetObjectArrayElement(names, j)));
+        attributeNames.append(AtomString { String(env, name) });
+    }
+
+    unsigned length = elements->length();
+    JLObjectArray result(newStringArray(env, length * nameCount));
+    if (!result) {
+        WTF::CheckAndClearException(env);
+        return nullptr;
+    }
+    for (unsigned i = 0; i < length; i++) {
+        auto* element = dynamicDowncast<Element>(elements->item(i));
+        if (!element)
+            continue;
+        for (jsize j = 0; j < nameCount; j++)
+            setStringElement(env, result, i * nameCount + j, element->getAttribute(attributeNames[j]));
+    }
+    return result.releaseLocal();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_dom_DOMBatch_countImpl(JNIEnv* env, jclass, jlong peer
+    , jstring selectors)
+{
+    WebCore::JSMainThreadNullState state;
+    RefPtr<NodeList> elements = querySelectorAll(env, peer, selectors);
+    return elements ? elements->length() : 0;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_DOMBatch_applyImpl(JNIEnv* env, jclass, jlongArray peers
+    , jobjectArray selectors, jintArray operations, jobjectArray arguments, jint count)
+{
+    WebCore::JSMainThreadNullState state;
+
+    Vector<jlong> targets(count);
+    Vector<jint> ops(count);
+    env->GetLongArrayRegion(peers, 0, count, targets.data());
+    env->GetIntArrayRegion(operations, 0, count, ops.data());
+
+    for (jint i = 0; i < count; i++) {
+        JLString selector(static_cast<jstring>(env->GetObjectArrayElement(selectors, i)));
+        JLString first(static_cast<jstring>(env->GetObjectArrayElement(arguments, 2 * i)));
+        JLString second(static_cast<jstring>(env->GetObjectArrayElement(arguments, 2 * i + 1)));
+
+        Vector<Ref<Node>> nodes;
+        if (selector) {
+            RefPtr<NodeList> elements = querySelectorAll(env, targets[i], selector);
+            if (!elements)
+                return;
+            for (unsigned k = 0; k < elements->length(); k++)
+                nodes.append(*elements->item(k));
+        } else
+            nodes.append(*jlong_to_Nodeptr(targets[i]));
+
+        switch (ops[i]) {
+        case com_sun_webkit_dom_DOMBatch_Mutations_SET_ATTRIBUTE:
+        case com_sun_webkit_dom_DOMBatch_Mutations_REMOVE_ATTRIBUTE: {
+            AtomString name { String(env, first) };
+            for (auto& node : nodes) {
+                auto* element = dynamicDowncast<Element>(node.get());
+                if (!element) {
+                    raiseNotSupportedErrorException(env);
+                    return;
+                }
+                if (ops[i] == com_sun_webkit_dom_DOMBatch_Mutations_REMOVE_ATTRIBUTE)
+                    element->removeAttribute(name);
+                else {
+                    raiseOnDOMError(env, element->setAttribute(name, AtomString { String(env, second) }));
+                    if (env->ExceptionCheck())
+                        return;
+                }
+            }
+            break;
+        }
+        case com_sun_webkit_dom_DOMBatch_Mutations_SET_TEXT_CONTENT: {
+            String text(env, first);
+            for (auto& node : nodes)
+                node->setTextContent(String { text });
+            break;
+        }
+        default:
+            ASSERT_NOT_REACHED();
+            break;
+        }
+    }
+}
+
+}
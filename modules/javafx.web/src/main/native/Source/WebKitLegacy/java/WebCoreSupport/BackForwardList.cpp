@@ -574,6 +574,46 @@ void BackForwardList::removeItem(HistoryItem& item)
     notifyBackForwardListChanged(m_hostObject);
 }
 
+static void clearDocumentStateRecursively(HistoryItem& item)
+{
+    if (!item.documentState().isEmpty())
+        item.setDocumentState({ });
+    for (const auto& child : item.children())
+        clearDocumentStateRecursively(child.get());
+}
+
+void BackForwardList::trimDistantItems(unsigned maxDistance)
+{
+    if (m_current == NoCurrentItemIndex)
+        return;
+
+    for (unsigned i = 0; i < m_entries.size(); ++i) {
+        unsigned distance = i < m_current ? m_current - i : i - m_current;
+        if (distance <= maxDistance)
+            continue;
+        auto& item = m_entries[i].get();
+        if (item.isInBackForwardCache())
+            BackForwardCache::singleton().remove(item);
+        clearDocumentStateRecursively(item);
+    }
+}
+
+static unsigned itemCountRecursively(const HistoryItem& item)
+{
+    unsigned count = 1;
+    for (const auto& child : item.children())
+        count += itemCountRecursively(child.get());
+    return count;
+}
+
+unsigned BackForwardList::itemCount() const
+{
+    unsigned count = 0;
+    for (const auto& item : m_entries)
+        count += itemCountRecursively(item.get());
+    return count;
+}
+
 bool BackForwardList::containsItem(const HistoryItem& entry) const
 {
     return m_entryHash.contains(const_cast<HistoryItem*>(&entry));
@@ -68,6 +68,13 @@ public:
     void removeItem(WebCore::HistoryItem&);
     HistoryItemVector& entries();
 
+    // Drops the cached page and the saved form state of every item more
+    // than maxDistance entries away from the current one. The items stay
+    // in the list and reload from the network when visited.
+    void trimDistantItems(unsigned maxDistance);
+    // Number of history items held, counting subframe items.
+    unsigned itemCount() const;
+
     JLObject hostObject() const { return m_hostObject; }
     void setHostObject(const JLObject& hostObject) { m_hostObject = hostObject; }
 
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include <JavaScriptCore/HeapProfiler.h>
+#include <JavaScriptCore/HeapSnapshotBuilder.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/BackForwardCache.h>
+#include <WebCore/BackForwardController.h>
+#include <WebCore/CommonVM.h>
+#include <WebCore/Document.h>
+#include <WebCore/FontCache.h>
+#include <WebCore/GCController.h>
+#include <WebCore/MemoryCache.h>
+#include <WebCore/Page.h>
+#include <wtf/FastMalloc.h>
+#include <wtf/MemoryFootprint.h>
+#include <wtf/MemoryPressureHandler.h>
+
+#include "BackForwardList.h"
+#include "com_sun_webkit_MemoryUsage.h"
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetProcessFootprint
+  (JNIEnv *, jclass)
+{
+    return WTF::memoryFootprint();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetJavaScriptHeapSize
+  (JNIEnv *, jclass)
+{
+    JSC::VM& vm = WebCore::commonVM();
+    JSC::JSLockHolder lock(vm);
+    return vm.heap.size();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetJavaScriptHeapCapacity
+  (JNIEnv *, jclass)
+{
+    JSC::VM& vm = WebCore::commonVM();
+    JSC::JSLockHolder lock(vm);
+    return vm.heap.capacity();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetJavaScriptExtraMemorySize
+  (JNIEnv *, jclass)
+{
+    JSC::VM& vm = WebCore::commonVM();
+    JSC::JSLockHolder lock(vm);
+    return vm.heap.extraMemorySize();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetMemoryCacheSize
+  (JNIEnv *, jclass)
+{
+    return WebCore::MemoryCache::singleton().size();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetDecodedImageSize
+  (JNIEnv *, jclass)
+{
+    return WebCore::MemoryCache::singleton().getStatistics().images.decodedSize;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_MemoryUsage_twkGetDocumentCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::Document::allDocumentsMap().size();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_MemoryUsage_twkGetFontCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::FontCache::forCurrentThread().fontCount();
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_MemoryUsage_twkTakeJavaScriptHeapSnapshot
+  (JNIEnv* env, jclass)
+{
+    JSC::VM& vm = WebCore::commonVM();
+    JSC::JSLockHolder lock(vm);
+    JSC::HeapSnapshotBuilder snapshotBuilder(vm.ensureHeapProfiler());
+    snapshotBuilder.buildSnapshot();
+    String json = snapshotBuilder.json();
+    // The profiler keeps every snapshot to diff the next one against, which
+    // only the inspector needs.
+    vm.ensureHeapProfiler().clearSnapshots();
+    return json.toJavaString(env).releaseLocal();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetMemoryCacheHitCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::MemoryCache::singleton().counters().hits;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetMemoryCacheMissCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::MemoryCache::singleton().counters().misses;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetMemoryCacheRevalidationCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::MemoryCache::singleton().counters().revalidations;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_MemoryUsage_twkGetMemoryCacheEvictionCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::MemoryCache::singleton().counters().evictions;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_MemoryUsage_twkGetHistoryItemCount
+  (JNIEnv *, jclass)
+{
+    unsigned count = 0;
+    WebCore::Page::forEachPage([&](WebCore::Page& page) {
+        count += static_cast<BackForwardList&>(page.backForward().client()).itemCount();
+    });
+    return count;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_MemoryUsage_twkGetBackForwardCachePageCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().pageCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryUsage_twkScavenge
+  (JNIEnv *, jclass, jboolean aggressive)
+{
+    if (aggressive) {
+        MemoryPressureHandler::singleton().releaseMemory(Critical::Yes, Synchronous::Yes);
+        return;
+    }
+    WebCore::GCController::singleton().garbageCollectNow();
+    WTF::releaseFastMallocFreeMemory();
+}
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,4 +44,53 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_PageCache_twkSetCapacity
     WebCore::BackForwardCache::singleton().setMaxSize(capacity);
 }
 
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_PageCache_twkGetMemoryCapacity
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().maxCost();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_PageCache_twkSetMemoryCapacity
+  (JNIEnv *, jclass, jlong capacity)
+{
+    ASSERT(capacity >= 0);
+    WebCore::BackForwardCache::singleton().setMaxCost(static_cast<size_t>(capacity));
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_PageCache_twkGetMemoryCost
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().totalCost();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetPageCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().pageCount();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetHitCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().hitCount();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetMissCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().missCount();
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetEvictionCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().evictionCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_PageCache_twkResetStatistics
+  (JNIEnv *, jclass)
+{
+    WebCore::BackForwardCache::singleton().resetStatistics();
+}
+
 }
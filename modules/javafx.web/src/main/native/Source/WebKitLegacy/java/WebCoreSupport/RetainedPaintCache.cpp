@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "RetainedPaintCache.h"
+
+#include <WebCore/GraphicsContext.h>
+#include <WebCore/PlatformContextJava.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/Vector.h>
+
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
+
+namespace WebCore {
+
+// Bounds the memory held by the recorded tiles; this is a few times
+// the number of tiles covering a large view. The tiles farthest from
+// the viewport are evicted first.
+static constexpr unsigned maxRetainedTileCount = 512;
+
+static int tileIndex(int coordinate)
+{
+    return coordinate >= 0
+        ? coordinate / RetainedPaintCache::tileSize
+        : -((-coordinate - 1) / RetainedPaintCache::tileSize) - 1;
+}
+
+static IntRect tileRect(const IntPoint& index)
+{
+    return IntRect(
+        index.x() * RetainedPaintCache::tileSize,
+        index.y() * RetainedPaintCache::tileSize,
+        RetainedPaintCache::tileSize,
+        RetainedPaintCache::tileSize);
+}
+
+template<typename Functor>
+static void forEachTile(const IntRect& rect, const Functor& functor)
+{
+    if (rect.isEmpty()) {
+        return;
+    }
+    int firstColumn = tileIndex(rect.x());
+    int lastColumn = tileIndex(rect.maxX() - 1);
+    int firstRow = tileIndex(rect.y());
+    int lastRow = tileIndex(rect.maxY() - 1);
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            functor(IntPoint(column, row));
+        }
+    }
+}
+
+RetainedPaintCache::RetainedPaintCache(const JLObject& jWebPage, RefPtr<RQRef> jRenderTheme, PaintFunction&& paintContents)
+    : m_jWebPage(jWebPage)
+    , m_jRenderTheme(WTFMove(jRenderTheme))
+    , m_paintContents(WTFMove(paintContents))
+{
+}
+
+RefPtr<RQRef> RetainedPaintCache::recordTile(const IntRect& rect)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+        PG_GetWebPageClass(env),
+        "fwkCreateRetainedRenderQueue",
+        "(IIII)Lcom/sun/webkit/graphics/WCRenderQueue;");
+    ASSERT(mid);
+
+    JLObject jRQ(env->CallObjectMethod(
+        (jobject)m_jWebPage,
+        mid,
+        rect.x(),
+        rect.y(),
+        rect.width(),
+        rect.height()));
+    if (WTF::CheckAndClearException(env) || !jRQ) {
+        return nullptr;
+    }
+
+    RefPtr<RQRef> tile = RQRef::create(jRQ);
+    // Registers the java reference now: it is held until the tile is
+    // invalidated and the last page queue replaying it is released.
+    jint refID = *tile;
+    UNUSED_VARIABLE(refID);
+
+    // Will be deleted by GraphicsContext destructor
+    PlatformContextJava* ppgc = new PlatformContextJava(jRQ, m_jRenderTheme);
+    GraphicsContextJava gc(ppgc);
+    gc.clip(rect);
+    m_paintContents(gc, rect);
+    gc.platformContext()->rq().flushBuffer();
+
+    return tile;
+}
+
+uint64_t RetainedPaintCache::distanceToVisibleRect(const IntPoint& index) const
+{
+    IntPoint tileCenter = tileRect(index).center();
+    IntPoint visibleCenter = m_visibleRect.center();
+    int64_t dx = tileCenter.x() - visibleCenter.x();
+    int64_t dy = tileCenter.y() - visibleCenter.y();
+    return dx * dx + dy * dy;
+}
+
+void RetainedPaintCache::evictTiles()
+{
+    if (m_tiles.size() <= maxRetainedTileCount) {
+        return;
+    }
+
+    Vector<std::pair<uint64_t, IntPoint>> tiles;
+    tiles.reserveInitialCapacity(m_tiles.size());
+    for (auto& index : m_tiles.keys()) {
+        tiles.append({ distanceToVisibleRect(index), index });
+    }
+    std::sort(tiles.begin(), tiles.end(), [] (const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+    for (size_t i = 0; m_tiles.size() > maxRetainedTileCount; ++i) {
+        m_tiles.remove(tiles[i].second);
+    }
+}
+
+void RetainedPaintCache::paint(GraphicsContext& gc, const IntRect& rect)
+{
+    evictTiles();
+
+    forEachTile(rect, [&] (const IntPoint& index) {
+        IntRect bounds = tileRect(index);
+        auto result = m_tiles.ensure(index, [&] {
+            return recordTile(bounds);
+        });
+        RefPtr<RQRef> tile = result.iterator->value;
+        if (!tile) {
+            m_tiles.remove(result.iterator);
+            return;
+        }
+
+        bounds.intersect(rect);
+        gc.save();
+        gc.clip(bounds);
+        gc.platformContext()->rq().freeSpace(8)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_REPLAYRQ
+        << tile;
+        gc.restore();
+    });
+}
+
+bool RetainedPaintCache::prerender(const IntRect& area, unsigned maxTileCount)
+{
+    Vector<std::pair<uint64_t, IntPoint>> missingTiles;
+    forEachTile(area, [&] (const IntPoint& index) {
+        if (!m_tiles.contains(index)) {
+            missingTiles.append({ distanceToVisibleRect(index), index });
+        }
+    });
+    std::sort(missingTiles.begin(), missingTiles.end(), [] (const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    size_t count = std::min<size_t>(maxTileCount, missingTiles.size());
+    for (size_t i = 0; i < count; ++i) {
+        const IntPoint& index = missingTiles[i].second;
+        if (RefPtr<RQRef> tile = recordTile(tileRect(index))) {
+            m_tiles.add(index, WTFMove(tile));
+        }
+    }
+    evictTiles();
+    return count < missingTiles.size();
+}
+
+void RetainedPaintCache::invalidate(const IntRect& rect)
+{
+    if (m_tiles.isEmpty()) {
+        return;
+    }
+    forEachTile(rect, [&] (const IntPoint& index) {
+        m_tiles.remove(index);
+    });
+}
+
+void RetainedPaintCache::invalidateOutside(const IntRect& rect)
+{
+    m_tiles.removeIf([&] (auto& entry) {
+        return !tileRect(entry.key).intersects(rect);
+    });
+}
+
+void RetainedPaintCache::invalidateAll()
+{
+    m_tiles.clear();
+}
+
+} // namespace WebCore
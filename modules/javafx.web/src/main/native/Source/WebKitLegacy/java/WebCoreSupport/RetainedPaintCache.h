@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/IntPointHash.h>
+#include <WebCore/IntRect.h>
+#include <WebCore/RQRef.h>
+#include <wtf/Function.h>
+#include <wtf/HashMap.h>
+
+namespace WebCore {
+
+class GraphicsContext;
+
+/*
+ * Retained painting of the page content.
+ *
+ * The document is split into fixed size tiles in content coordinates, each one
+ * recorded once into its own java WCRenderQueue that is kept after being
+ * decoded. Painting a rectangle replays the valid tiles by reference
+ * (REPLAYRQ), so only the tiles touched by an invalidation since the last
+ * paint are painted by WebCore again. As the tiles do not depend on the scroll
+ * position, the strip exposed by a scroll is replayed from tiles recorded
+ * ahead of time around the viewport (see prerender()).
+ *
+ * A tile queue is released once the tile is invalidated or evicted and all the
+ * page queues that replay it have been decoded.
+ */
+class RetainedPaintCache {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    static constexpr int tileSize = 256;
+
+    using PaintFunction = WTF::Function<void(GraphicsContext&, const IntRect&)>;
+
+    // [paintContents] paints the given rectangle of the document in content coordinates.
+    RetainedPaintCache(const JLObject& jWebPage, RefPtr<RQRef> jRenderTheme, PaintFunction&& paintContents);
+
+    // Writes the content of [rect], in content coordinates, into [gc].
+    void paint(GraphicsContext& gc, const IntRect& rect);
+
+    // Records at most [maxTileCount] missing tiles of [area], nearest to the
+    // visible rect first. Returns true if some tiles of [area] are still missing.
+    bool prerender(const IntRect& area, unsigned maxTileCount);
+
+    // The tiles farthest from [visibleRect] are evicted first.
+    void setVisibleRect(const IntRect& visibleRect) { m_visibleRect = visibleRect; }
+
+    void invalidate(const IntRect&);
+    void invalidateOutside(const IntRect&);
+    void invalidateAll();
+
+private:
+    RefPtr<RQRef> recordTile(const IntRect& tileRect);
+    uint64_t distanceToVisibleRect(const IntPoint& index) const;
+    void evictTiles();
+
+    JGObject m_jWebPage;
+    RefPtr<RQRef> m_jRenderTheme;
+    PaintFunction m_paintContents;
+    HashMap<IntPoint, RefPtr<RQRef>> m_tiles;
+    IntRect m_visibleRect;
+};
+
+} // namespace WebCore
@@ -34,6 +34,10 @@ using namespace WebCore;
 
 static bool s_shouldTrackVisitedLinks;
 
+// Upper bound on the number of remembered links. The store is shared by
+// every WebView, so without a bound it would grow for the process lifetime.
+static constexpr unsigned maxVisitedLinkCount = 100000;
+
 static HashSet<VisitedLinkStoreJava*>& visitedLinkStores()
 {
     static NeverDestroyed<HashSet<VisitedLinkStoreJava*>> visitedLinkStores;
@@ -46,6 +50,13 @@ Ref<VisitedLinkStoreJava> VisitedLinkStoreJava::create()
     return adoptRef(*new VisitedLinkStoreJava);
 }
 
+VisitedLinkStoreJava& VisitedLinkStoreJava::shared()
+{
+    static NeverDestroyed<Ref<VisitedLinkStoreJava>> sharedStore(create());
+
+    return sharedStore.get();
+}
+
 VisitedLinkStoreJava::VisitedLinkStoreJava()
     : m_visitedLinksPopulated(false)
 {
@@ -104,9 +115,14 @@ void VisitedLinkStoreJava::populateVisitedLinksIfNeeded(Page&)
 void VisitedLinkStoreJava::addVisitedLinkHash(SharedStringHash linkHash)
 {
     ASSERT(s_shouldTrackVisitedLinks);
-    m_visitedLinkHashes.add(linkHash);
+    // Revisiting a known link only refreshes its age; its style is unchanged.
+    if (!m_visitedLinkHashes.appendOrMoveToLast(linkHash).isNewEntry)
+        return;
 
     invalidateStylesForLink(linkHash);
+
+    if (m_visitedLinkHashes.size() > maxVisitedLinkCount)
+        invalidateStylesForLink(m_visitedLinkHashes.takeFirst());
 }
 
 void VisitedLinkStoreJava::removeVisitedLinkHashes()
@@ -27,10 +27,12 @@
 
 #include <WebCore/SharedStringHash.h>
 #include <WebCore/VisitedLinkStore.h>
+#include <wtf/ListHashSet.h>
 
 class VisitedLinkStoreJava final : public WebCore::VisitedLinkStore {
 public:
     static Ref<VisitedLinkStoreJava> create();
+    static VisitedLinkStoreJava& shared();
     virtual ~VisitedLinkStoreJava();
 
     static void setShouldTrackVisitedLinks(bool);
@@ -48,7 +50,9 @@ private:
     void addVisitedLinkHash(WebCore::SharedStringHash);
     void removeVisitedLinkHashes();
 
-    HashSet<WebCore::SharedStringHash, WebCore::SharedStringHashHash> m_visitedLinkHashes;
+    // Kept in least recently visited order so that the oldest links are
+    // dropped first once the store is full.
+    ListHashSet<WebCore::SharedStringHash, WebCore::SharedStringHashHash> m_visitedLinkHashes;
     bool m_visitedLinksPopulated;
 };
 
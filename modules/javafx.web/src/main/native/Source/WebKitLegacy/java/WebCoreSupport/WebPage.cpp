@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,11 +53,15 @@
 #include <JavaScriptCore/JSContextRefPrivate.h>
 #include <JavaScriptCore/JSStringRef.h>
 #include <JavaScriptCore/Options.h>
+#include <JavaScriptCore/SamplingProfiler.h>
+#include <WebCore/BackForwardCache.h>
 #include <WebCore/BackForwardController.h>
+#include <WebCore/BytecodeCacheJava.h>
 #include <WebCore/BridgeUtils.h>
 #include <WebCore/CharacterData.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/ColorTypes.h>
+#include <WebCore/CommonVM.h>
 #include <WebCore/CompositionHighlight.h>
 #include <WebCore/ContextMenu.h>
 #include <WebCore/ContextMenuController.h>
@@ -65,6 +69,7 @@
 #include <WebCore/DeprecatedGlobalSettings.h>
 #include <WebCore/Document.h>
 #include <WebCore/DocumentInlines.h>
+#include <WebCore/DocumentLoader.h>
 #include <WebCore/DragController.h>
 #include <WebCore/DragData.h>
 #include <WebCore/Editor.h>
@@ -84,7 +89,11 @@
 #include <WebCore/InspectorController.h>
 #include <WebCore/KeyboardEvent.h>
 #include <WebCore/LogInitialization.h>
+#include <WebCore/MainThreadSharedTimer.h>
+#include <WebCore/MemoryCache.h>
+#include <WebCore/MemoryRelease.h>
 #include <WebCore/NodeTraversal.h>
+#include <WebCore/NodeList.h>
 #include <WebCore/Page.h>
 #include <WebCore/PageConfiguration.h>
 #include <WebCore/PageSupplementJava.h>
@@ -94,21 +103,31 @@
 #include <WebCore/PlatformMouseEvent.h>
 #include <WebCore/PlatformTouchEvent.h>
 #include <WebCore/PlatformWheelEvent.h>
+#include <WebCore/Region.h>
 #include <WebCore/RenderTreeAsText.h>
+#include <WebCore/RenderingProfileJava.h>
 #include <WebCore/RenderView.h>
 #include <WebCore/ResourceRequest.h>
 #include <WebCore/ScriptController.h>
 #include <WebCore/SecurityPolicy.h>
 #include <WebCore/Settings.h>
 #include <WebCore/StorageNamespaceProvider.h>
+#include <WebCore/TextExtractorJava.h>
 #include <WebCore/TextIterator.h>
+#include <WebCore/TextSearchIndexJava.h>
 #include <WebCore/TextureMapperJava.h>
 #include <WebCore/TextureMapperLayer.h>
+#include <WebCore/Timer.h>
 #include <WebCore/WorkerThread.h>
 #include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/JSONValues.h>
+#include <wtf/MemoryPressureHandler.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/RAMSize.h>
 #include <wtf/Ref.h>
 #include <wtf/RunLoop.h>
 #include <wtf/java/JavaRef.h>
+#include <wtf/text/StringBuilder.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/text/StringToIntegerConversion.h>
 
@@ -136,6 +155,7 @@ namespace WebCore {
 
 WebPage::WebPage(std::unique_ptr<Page> page)
     : m_page(WTFMove(page))
+    , m_retainedPrerenderTimer(*this, &WebPage::retainedPrerenderTimerFired)
 {
 #if ENABLE(NOTIFICATIONS) || ENABLE(LEGACY_NOTIFICATIONS)
     if(!NotificationController::from(m_page.get())) {
@@ -186,6 +206,10 @@ void WebPage::setSize(const IntSize& size)
     frameView->resize(size);
     frameView->layoutContext().scheduleLayout();
 
+    if (m_retainedPaintCache) {
+        m_retainedPaintCache->invalidateAll();
+    }
+
     if (m_rootLayer) {
         m_rootLayer->setSize(size);
         m_rootLayer->setNeedsDisplay();
@@ -221,22 +245,71 @@ static void drawDebugBorder(GraphicsContext& context,
     context.fillRect(FloatRect(x + w - width, y, width, h), color);
 }
 
-void WebPage::prePaint() {
+bool WebPage::prePaint(bool allowDefer) {
     if (m_rootLayer) {
         if (m_syncLayers) {
             m_syncLayers = false;
             syncLayers();
         }
-        return;
+        return true;
     }
 
     Frame* mainFrame = (Frame*)&m_page->mainFrame();
         auto* localFrame = dynamicDowncast<LocalFrame>(mainFrame);
     LocalFrameView* frameView = localFrame->view();
     if (frameView) {
+        if (allowDefer && shouldDeferLayout(*localFrame, *frameView)) {
+            return false;
+        }
         // Updating layout & styles precedes normal painting.
         frameView->updateLayoutAndStyleIfNeededRecursive();
+        m_lastLayoutTime = MonotonicTime::now();
+    }
+    return true;
+}
+
+void WebPage::setProgressiveRendering(Seconds minLayoutInterval, size_t firstPaintThreshold)
+{
+    m_minLayoutInterval = minLayoutInterval;
+    m_firstPaintThreshold = firstPaintThreshold;
+}
+
+static size_t mainResourceBytesReceived(DocumentLoader& loader)
+{
+    // Content loaded from a string is all there at once, and
+    // mainResourceData() would copy it.
+    if (loader.substituteData().isValid()) {
+        return loader.substituteData().content()->size();
+    }
+    auto data = loader.mainResourceData();
+    return data ? data->size() : 0;
+}
+
+bool WebPage::shouldDeferLayout(LocalFrame& frame, LocalFrameView& frameView)
+{
+    RefPtr document = frame.document();
+    if (!document || !document->parsing()) {
+        return false;
+    }
+    // Repaints that need no layout, e.g. of an animated image, go through.
+    if (!frameView.needsLayout() && !document->needsStyleRecalc()) {
+        return false;
     }
+
+    if (m_firstPaintThreshold && !frameView.isVisuallyNonEmpty()) {
+        DocumentLoader* loader = frame.loader().documentLoader();
+        if (!loader || mainResourceBytesReceived(*loader) < m_firstPaintThreshold) {
+            // Building the render tree is enough for the visually non-empty
+            // heuristic to end the suppression early.
+            document->updateStyleIfNeeded();
+            if (!frameView.isVisuallyNonEmpty()) {
+                return true;
+            }
+        }
+    }
+
+    return m_minLayoutInterval
+        && MonotonicTime::now() - m_lastLayoutTime < m_minLayoutInterval;
 }
 
 RefPtr<RQRef> WebPage::jRenderTheme()
@@ -248,9 +321,97 @@ RefPtr<RQRef> WebPage::jRenderTheme()
     return m_jRenderTheme;
 }
 
+void WebPage::setRetainedPaintEnabled(bool enabled)
+{
+    if (!enabled) {
+        m_retainedPrerenderTimer.stop();
+        m_retainedPaintCache = nullptr;
+    } else if (!m_retainedPaintCache) {
+        m_retainedPaintCache = makeUnique<RetainedPaintCache>(jobjectFromPage(m_page.get()), jRenderTheme(),
+            [this] (GraphicsContext& context, const IntRect& rect) {
+                auto* localFrame = dynamicDowncast<LocalFrame>(m_page->mainFrame());
+                if (LocalFrameView* frameView = localFrame ? localFrame->view() : nullptr) {
+                    frameView->paintContents(context, rect);
+                }
+            });
+    }
+}
+
+void WebPage::setLayoutOnly(bool layoutOnly)
+{
+    if (m_layoutOnly == layoutOnly) {
+        return;
+    }
+    m_layoutOnly = layoutOnly;
+    if (layoutOnly) {
+        setRetainedPaintEnabled(false);
+    } else if (m_rootLayer) {
+        // The layers were not flushed while nothing was composited.
+        m_rootLayer->setNeedsDisplay();
+        m_syncLayers = true;
+    }
+}
+
+// Mirrors ScrollView::paint(): the document part of [dirtyRect] is replayed
+// from the retained tiles, the scrollbars and the scroll corner, which are not
+// part of the tiles, are painted on top of them.
+void WebPage::paintRetained(GraphicsContext& gc, LocalFrameView& frameView, const IntRect& dirtyRect)
+{
+    IntRect visibleContentRect = frameView.visibleContentRect();
+    IntRect contentArea(frameView.locationOfContents(), visibleContentRect.size());
+    IntRect documentDirtyRect = intersection(dirtyRect, contentArea);
+    if (!documentDirtyRect.isEmpty()) {
+        GraphicsContextStateSaver stateSaver(gc);
+        IntSize offset = frameView.locationOfContents() - frameView.scrollPosition();
+        gc.translate(offset.width(), offset.height());
+        documentDirtyRect.move(-offset);
+        gc.clip(visibleContentRect);
+
+        m_retainedPaintCache->setVisibleRect(visibleContentRect);
+        m_retainedPaintCache->paint(gc, documentDirtyRect);
+    }
+
+    Region scrollbarRegion(dirtyRect);
+    scrollbarRegion.subtract(contentArea);
+    for (auto& rect : scrollbarRegion.rects()) {
+        frameView.paint(gc, rect);
+    }
+}
+
+void WebPage::retainedPrerenderTimerFired()
+{
+    // Tiles recorded per timer shot, so that input events are not held back.
+    static constexpr unsigned prerenderTileCount = 4;
+
+    if (!m_retainedPaintCache || m_rootLayer) {
+        return;
+    }
+
+    auto* localFrame = dynamicDowncast<LocalFrame>(m_page->mainFrame());
+    LocalFrameView* frameView = localFrame ? localFrame->view() : nullptr;
+    if (!frameView || frameView->paintsEntireContents()) {
+        return;
+    }
+    frameView->updateLayoutAndStyleIfNeededRecursive();
+
+    JSGlobalContextRef globalContext = toGlobalRef(localFrame->script().globalObject(mainThreadNormalWorld()));
+    JSC::JSLockHolder sw(toJS(globalContext));
+
+    // One ring of tiles around the viewport covers the next scroll steps.
+    IntRect visibleContentRect = frameView->visibleContentRect();
+    IntRect area = visibleContentRect;
+    area.inflate(RetainedPaintCache::tileSize);
+    area.intersect(IntRect(IntPoint(), frameView->contentsSize()));
+
+    m_retainedPaintCache->setVisibleRect(visibleContentRect);
+    if (m_retainedPaintCache->prerender(area, prerenderTileCount)) {
+        m_retainedPrerenderTimer.startOneShot(0_s);
+    }
+}
+
 void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 {
-    if (m_rootLayer) {
+    if (m_rootLayer || m_layoutOnly) {
         return;
     }
 
@@ -264,6 +425,8 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
         return;
     }
 
+    RenderingProfileJava::Scope renderingProfileScope(RenderingProfileJava::from(m_page.get()), RenderingProfileJava::Phase::Paint);
+
     // Will be deleted by GraphicsContext destructor
     PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
     GraphicsContextJava gc(ppgc);
@@ -272,7 +435,11 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
     JSGlobalContextRef globalContext = toGlobalRef(localFrame->script().globalObject(mainThreadNormalWorld()));
     JSC::JSLockHolder sw(toJS(globalContext)); // TODO-java: was JSC::APIEntryShim sw( toJS(globalContext) );
 
-    frameView->paint(gc, IntRect(x, y, w, h));
+    if (m_retainedPaintCache && !frameView->paintsEntireContents()) {
+        paintRetained(gc, *frameView, IntRect(x, y, w, h));
+    } else {
+        frameView->paint(gc, IntRect(x, y, w, h));
+    }
     if (m_page->settings().showDebugBorders()) {
         drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 0, 255, 128 });
     }
@@ -282,8 +449,8 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 
 void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
 {
-    if (!m_page->inspectorController().highlightedNode()
-            && !m_rootLayer
+    if (m_layoutOnly || (!m_page->inspectorController().highlightedNode()
+            && !m_rootLayer)
     ) {
         return;
     }
@@ -322,6 +489,12 @@ void WebPage::scroll(const IntSize& scrollDelta,
         return;
     }
 
+    // The recorded tiles are in content coordinates and stay valid; the
+    // ones exposed by the next scroll steps are recorded while idle.
+    if (m_retainedPaintCache && !m_retainedPrerenderTimer.isActive()) {
+        m_retainedPrerenderTimer.startOneShot(100_ms);
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
@@ -344,9 +517,30 @@ void WebPage::scroll(const IntSize& scrollDelta,
 
 void WebPage::repaint(const IntRect& rect)
 {
+    if (m_layoutOnly) {
+        return;
+    }
     if (m_rootLayer) {
         m_rootLayer->setNeedsDisplayInRect(rect);
     }
+    if (m_retainedPaintCache) {
+        auto* localFrame = dynamicDowncast<LocalFrame>(m_page->mainFrame());
+        LocalFrameView* frameView = localFrame ? localFrame->view() : nullptr;
+        if (frameView) {
+            // Scrollbar repaints leave the document tiles alone.
+            IntRect contentArea(frameView->locationOfContents(), frameView->visibleContentRect().size());
+            IntRect documentRect = intersection(rect, contentArea);
+            if (!documentRect.isEmpty()) {
+                // WebCore drops the invalidations outside of the visible rect,
+                // so the tiles kept around it may be out of date now.
+                m_retainedPaintCache->invalidateOutside(frameView->visibleContentRect());
+                documentRect.move(frameView->scrollPosition() - frameView->locationOfContents());
+                m_retainedPaintCache->invalidate(documentRect);
+            }
+        } else {
+            m_retainedPaintCache->invalidateAll();
+        }
+    }
     requestJavaRepaint(rect);
 }
 
@@ -398,7 +592,7 @@ void WebPage::scheduleRenderingUpdate()
 
 void WebPage::markForSync()
 {
-    if (!m_rootLayer) {
+    if (!m_rootLayer || m_layoutOnly) {
         m_page->isolatedUpdateRendering();
         return;
     }
@@ -418,6 +612,7 @@ void WebPage::syncLayers()
     if (!localFrame->contentRenderer() || !frameView)
         return;
 
+    RenderingProfileJava::Scope renderingProfileScope(RenderingProfileJava::from(m_page.get()), RenderingProfileJava::Phase::Composite);
     frameView->updateLayoutAndStyleIfNeededRecursive();
     // Updating layout might have taken us out of compositing mode
     if (m_rootLayer) {
@@ -439,6 +634,7 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
     ASSERT(m_rootLayer);
     ASSERT(m_textureMapper);
 
+    RenderingProfileJava::Scope renderingProfileScope(RenderingProfileJava::from(m_page.get()), RenderingProfileJava::Phase::Composite);
     TextureMapperLayer& rootTextureMapperLayer = downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer();
 
     static_cast<TextureMapperJava&>(*m_textureMapper).setGraphicsContext(&context);
@@ -859,17 +1055,113 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
 bool s_useCSS3D;
+unsigned s_memoryCacheCapacity;
+unsigned s_gcMarkerThreads;
+unsigned s_gcMinHeapSize;
+double s_gcHeapGrowthFactor;
+bool s_gcGenerational { true };
+unsigned s_codeCacheReservedSize;
+
+// Matches the DOM timer alignment WebCore applies to hidden pages.
+constexpr Seconds hiddenProcessTimerAlignmentInterval = 1_s;
+
+// History items further than this from the current one lose their cached
+// page and saved form state under non-critical memory pressure.
+constexpr unsigned trimmedHistoryDistance = 3;
+
+void trimBackForwardLists(Critical critical)
+{
+    unsigned maxDistance = critical == Critical::Yes ? 0 : trimmedHistoryDistance;
+    Page::forEachPage([&](Page& page) {
+        static_cast<BackForwardList&>(page.backForward().client()).trimDistantItems(maxDistance);
+    });
+}
+
+// Without an explicit memoryCacheSize the memory cache is sized after the
+// machine, and grows by a quarter for each further live page up to twice
+// that size since pages rarely share all of their resources.
+void updateMemoryCacheCapacity()
+{
+    unsigned capacity = s_memoryCacheCapacity;
+    if (!capacity) {
+        size_t memorySize = ramSize() / MB;
+        if (memorySize >= 4096)
+            capacity = 64 * MB;
+        else if (memorySize >= 2048)
+            capacity = 48 * MB;
+        else if (memorySize >= 1024)
+            capacity = 32 * MB;
+        else if (memorySize >= 512)
+            capacity = 16 * MB;
+        else
+            capacity = 8 * MB;
+        unsigned pageCount = 0;
+        Page::forEachPage([&](Page&) {
+            ++pageCount;
+        });
+        capacity += capacity / 4 * std::min(pageCount > 1 ? pageCount - 1 : 0, 4u);
+    }
+
+    static unsigned s_appliedCapacity;
+    if (capacity == s_appliedCapacity)
+        return;
+    s_appliedCapacity = capacity;
+    // Decoded images count against the live part of the capacity, MemoryCache
+    // then drops the decoded data of the least recently drawn images first.
+    WebCore::MemoryCache::singleton().setCapacities(capacity / 8, capacity / 4, capacity);
+}
+
+// Once no page is visible the process counts as inactive: memory is
+// released more eagerly and the shared timer wakes up less often.
+void updateProcessActivity()
+{
+    bool hasVisiblePage = false;
+    Page::forEachPage([&](Page& page) {
+        hasVisiblePage |= page.isVisible();
+    });
+    MemoryPressureHandler::singleton().setProcessState(hasVisiblePage ? WebsamProcessState::Active : WebsamProcessState::Inactive);
+    MainThreadSharedTimer::setAlignmentInterval(hasVisiblePage ? 0_s : hiddenProcessTimerAlignmentInterval);
+}
+
+// The objects of a closed page only become garbage for the next collection
+// and the pages bmalloc frees then are returned to the system lazily. Run
+// both a little after the last of a batch of pages is closed, so closing
+// several views actually shrinks the process.
+void scheduleScavengeAfterPageClose()
+{
+    static NeverDestroyed<Timer> scavengeTimer([] {
+        GCController::singleton().garbageCollectNow();
+        WTF::releaseFastMallocFreeMemory();
+    });
+    scavengeTimer->startOneShot(1_s);
+}
 
 }  // namespace
 
 extern "C" {
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetHeapOptions
+    (JNIEnv*, jclass, jint markerThreads, jint minHeapSize, jdouble heapGrowthFactor, jboolean generational) {
+    s_gcMarkerThreads = markerThreads > 0 ? static_cast<unsigned>(markerThreads) : 0;
+    s_gcMinHeapSize = minHeapSize > 0 ? static_cast<unsigned>(minHeapSize) : 0;
+    s_gcHeapGrowthFactor = heapGrowthFactor > 1 ? heapGrowthFactor : 0;
+    s_gcGenerational = jbool_to_bool(generational);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetCodeCacheSize
+    (JNIEnv*, jclass, jint reservedSize) {
+    s_codeCacheReservedSize = reservedSize > 0 ? static_cast<unsigned>(reservedSize) : 0;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT, jboolean useCSS3D, jint memoryCacheCapacity) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
     s_useCSS3D = useCSS3D;
+    s_memoryCacheCapacity = memoryCacheCapacity > 0 ? static_cast<unsigned>(memoryCacheCapacity) : 0;
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
@@ -898,6 +1190,63 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+#if ENABLE(FTL_JIT)
+        JSC::Options::useFTLJIT() = s_useJIT && s_useDFGJIT && s_useFTLJIT;
+#endif
+        // The JVM runs its own GC threads next to ours, let the embedder
+        // size the JSC heap and its marker threads.
+        if (s_gcMarkerThreads)
+            JSC::Options::numberOfGCMarkers() = s_gcMarkerThreads;
+        if (s_gcMinHeapSize)
+            JSC::Options::largeHeapSize() = JSC::Options::smallHeapSize() = s_gcMinHeapSize;
+        if (s_gcHeapGrowthFactor) {
+            JSC::Options::smallHeapGrowthFactor() = s_gcHeapGrowthFactor;
+            JSC::Options::mediumHeapGrowthFactor() = s_gcHeapGrowthFactor;
+            JSC::Options::largeHeapGrowthFactor() = s_gcHeapGrowthFactor;
+        }
+        JSC::Options::useGenerationalGC() = s_gcGenerational;
+#if ENABLE(WEBASSEMBLY)
+        // Fast memory bounds checks wasm accesses with a SIGSEGV/SIGBUS
+        // handler, which would sit in front of the handlers of the JVM.
+        JSC::Options::useWebAssemblyFastMemory() = false;
+#endif
+    });
+
+    static std::once_flag initializeCodeCache;
+    std::call_once(initializeCodeCache, [] {
+        // All pages share one VM, so a script already compiled for another
+        // page is a hit in its code cache as long as it was not pruned.
+        if (s_codeCacheReservedSize)
+            commonVM().codeCache()->setReservedCapacity(s_codeCacheReservedSize);
+    });
+
+    static std::once_flag initializeBackForwardCache;
+    std::call_once(initializeBackForwardCache, [] {
+        // Pages are only cached where the UsesBackForwardCache setting is on.
+        // Size the cache after the machine, PageCache can override both.
+        size_t memorySize = ramSize() / MB;
+        unsigned capacity = 0;
+        if (memorySize >= 4096)
+            capacity = 5;
+        else if (memorySize >= 2048)
+            capacity = 3;
+        else if (memorySize >= 1024)
+            capacity = 2;
+        else if (memorySize >= 512)
+            capacity = 1;
+        auto& backForwardCache = WebCore::BackForwardCache::singleton();
+        backForwardCache.setMaxSize(capacity);
+        backForwardCache.setMaxCost(ramSize() / 32);
+    });
+
+    static std::once_flag installMemoryPressureHandler;
+    std::call_once(installMemoryPressureHandler, [] {
+        auto& memoryPressureHandler = MemoryPressureHandler::singleton();
+        memoryPressureHandler.setLowMemoryHandler([] (Critical critical, Synchronous synchronous) {
+            trimBackForwardLists(critical);
+            WebCore::releaseMemory(critical, synchronous);
+        });
+        memoryPressureHandler.install();
     });
 
     JLObject jlself(self, true);
@@ -914,7 +1263,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
     pc.inspectorClient = makeUnique<InspectorClientJava>(jlself);
     pc.databaseProvider = &WebDatabaseProvider::singleton();
     pc.storageNamespaceProvider = adoptRef(new WebStorageNamespaceProviderJava());
-    pc.visitedLinkStore = VisitedLinkStoreJava::create();
+    pc.visitedLinkStore = &VisitedLinkStoreJava::shared();
 
     pc.clientForMainFrame = UniqueRef<LocalFrameLoaderClient>(makeUniqueRef<FrameLoaderClientJava>(jlself));
 
@@ -928,7 +1277,9 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
 #if ENABLE(GEOLOCATION)
     WebCore::provideGeolocationTo(page.get(), *new GeolocationClientMock());
 #endif
-    return ptr_to_jlong(new WebPage(WTFMove(page)));
+    auto* webPage = new WebPage(WTFMove(page));
+    updateMemoryCacheCapacity();
+    return ptr_to_jlong(webPage);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
@@ -963,6 +1314,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
 
     settings.setLinkPrefetchEnabled(true);
 
+    settings.setHiddenPageDOMTimerThrottlingEnabled(true);
+    settings.setHiddenPageCSSAnimationSuspensionEnabled(true);
+
         Frame* mainFrame = (Frame*)&page->mainFrame();
     auto* frame = dynamicDowncast<LocalFrame>(mainFrame);
     FrameLoaderClientJava& client =
@@ -993,6 +1347,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDestroyPage
     }
 
     delete webPage;
+    updateProcessActivity();
+    updateMemoryCacheCapacity();
+    scheduleScavengeAfterPageClose();
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkGetMainFrame
@@ -1103,6 +1460,34 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetInnerText
     return documentElement->innerText().toJavaString(env).releaseLocal();
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkBeginTextExtraction
+    (JNIEnv* env, jobject self, jlong pFrame, jboolean skipInvisible)
+{
+    auto* frame = dynamicDowncast<LocalFrame>(static_cast<Frame*>(jlong_to_ptr(pFrame)));
+    if (!frame || !frame->document()) {
+        return JNI_FALSE;
+    }
+    Document& document = *frame->document();
+    TextExtractorJava::from(document).begin(document, jbool_to_bool(skipInvisible));
+    return JNI_TRUE;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkExtractText
+    (JNIEnv* env, jobject self, jlong pFrame, jobject buffer, jint position, jint length)
+{
+    auto* frame = dynamicDowncast<LocalFrame>(static_cast<Frame*>(jlong_to_ptr(pFrame)));
+    if (!frame || !frame->document()) {
+        return -1;
+    }
+    auto* address = static_cast<uint8_t*>(env->GetDirectBufferAddress(buffer));
+    if (!address) {
+        return -1;
+    }
+    size_t written = TextExtractorJava::from(*frame->document()).read(
+        std::span<uint8_t>(address + position, length));
+    return written ? static_cast<jint>(written) : -1;
+}
+
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetRenderTree
     (JNIEnv* env, jobject self, jlong pFrame)
 {
@@ -1322,6 +1707,99 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkFindInFrame
     return JNI_FALSE;
 }
 
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkFindAllInFrame
+    (JNIEnv* env, jobject self, jlong pFrame,
+     jstring toFind, jboolean matchCase, jint maxMatches)
+{
+    auto* frame = dynamicDowncast<LocalFrame>(static_cast<Frame*>(jlong_to_ptr(pFrame)));
+    if (!frame || !frame->document()) {
+        return nullptr;
+    }
+
+    Vector<TextSearchIndexJava::Match> matches;
+    unsigned count = TextSearchIndexJava::from(*frame->document()).findAll(
+        *frame->document(), String(env, toFind), jbool_to_bool(matchCase),
+        std::max(maxMatches, 0), matches);
+
+    // The count, then an offset and a length for each match returned
+    Vector<jint> values;
+    values.reserveInitialCapacity(1 + 2 * matches.size());
+    values.append(count);
+    for (auto& match : matches) {
+        values.append(match.offset);
+        values.append(match.length);
+    }
+
+    jintArray result = env->NewIntArray(values.size());
+    if (WTF::CheckAndClearException(env) || !result) {
+        return nullptr;
+    }
+    env->SetIntArrayRegion(result, 0, values.size(), values.data());
+    return result;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkSelectFindMatch
+    (JNIEnv* env, jobject self, jlong pFrame, jint offset, jint length)
+{
+    auto* frame = dynamicDowncast<LocalFrame>(static_cast<Frame*>(jlong_to_ptr(pFrame)));
+    if (!frame || !frame->document() || offset < 0 || length <= 0) {
+        return JNI_FALSE;
+    }
+
+    Ref document = *frame->document();
+    auto range = TextSearchIndexJava::from(document).rangeOfMatch(
+        document, { static_cast<unsigned>(offset), static_cast<unsigned>(length) });
+    if (!range) {
+        return JNI_FALSE;
+    }
+    document->selection().setSelection(VisibleSelection(*range));
+    document->selection().revealSelection();
+    return JNI_TRUE;
+}
+
+JNIEXPORT jfloatArray JNICALL Java_com_sun_webkit_WebPage_twkGetBorderBoxes
+    (JNIEnv* env, jobject self, jlong pFrame, jstring selectors)
+{
+    auto* frame = dynamicDowncast<LocalFrame>(static_cast<Frame*>(jlong_to_ptr(pFrame)));
+    if (!frame || !frame->document() || !frame->view()) {
+        return nullptr;
+    }
+
+    Ref document = *frame->document();
+    auto queryResult = document->querySelectorAll(String(env, selectors));
+    if (queryResult.hasException()) {
+        return nullptr;
+    }
+    Ref nodes = queryResult.releaseReturnValue();
+
+    // A single layout for the whole batch; the rects below are then read
+    // without touching layout again.
+    document->updateLayoutIgnorePendingStylesheets({ LayoutOptions::ContentVisibilityForceLayout });
+    RefPtr frameView = frame->view();
+
+    // x, y, width and height of each element's border box in CSS pixels of
+    // document coordinates, NaN for elements that are not rendered.
+    Vector<jfloat> values;
+    values.reserveInitialCapacity(4 * nodes->length());
+    for (unsigned i = 0; i < nodes->length(); ++i) {
+        auto* element = dynamicDowncast<Element>(nodes->item(i));
+        auto pair = element ? element->boundingAbsoluteRectWithoutLayout() : std::nullopt;
+        if (!pair) {
+            values.appendList({ NAN, NAN, NAN, NAN });
+            continue;
+        }
+        FloatRect rect = frameView->absoluteToDocumentRect(pair->second, pair->first->style().effectiveZoom());
+        values.appendList({ rect.x(), rect.y(), rect.width(), rect.height() });
+    }
+
+    jfloatArray result = env->NewFloatArray(values.size());
+    if (WTF::CheckAndClearException(env) || !result) {
+        return nullptr;
+    }
+    env->SetFloatArrayRegion(result, 0, values.size(), values.data());
+    return result;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkOverridePreference
     (JNIEnv* env, jobject self, jlong pPage, jstring propertyName, jstring propertyValue)
 {
@@ -1541,6 +2019,24 @@ JNIEXPORT jobject JNICALL Java_com_sun_webkit_WebPage_twkExecuteScript
         script);
 }
 
+JNIEXPORT jobject JNICALL Java_com_sun_webkit_WebPage_twkExecuteScriptSnapshot
+    (JNIEnv* env, jobject self, jlong pFrame, jstring script)
+{
+    Frame* mainFrame = static_cast<Frame*>(jlong_to_ptr(pFrame));
+    auto* frame = dynamicDowncast<LocalFrame>(mainFrame);
+    if (!frame) {
+        return nullptr;
+    }
+    JSGlobalContextRef globalContext = getGlobalContext(&frame->script());
+    RefPtr<JSC::Bindings::RootObject> rootObject(frame->script().createRootObject(frame));
+    return WebCore::executeScriptSnapshot(
+        env,
+        nullptr,
+        globalContext,
+        rootObject.get(),
+        script);
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkAddJavaScriptBinding
     (JNIEnv* env, jobject self, jlong pFrame, jstring name, jobject value, jobject accessControlContext)
 {
@@ -1722,10 +2218,10 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBackgroundColor
     frame->view()->setBaseBackgroundColor(asSRGBA(WebCore::PackedColor::RGBA { static_cast<uint32_t>(backgroundColor) }));
 }
 
-JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPrePaint
-  (JNIEnv*, jobject, jlong pPage)
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkPrePaint
+  (JNIEnv*, jobject, jlong pPage, jboolean allowDefer)
 {
-    WebPage::webPageFromJLong(pPage)->prePaint();
+    return bool_to_jbool(WebPage::webPageFromJLong(pPage)->prePaint(jbool_to_bool(allowDefer)));
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateContent
@@ -1734,6 +2230,26 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateContent
     WebPage::webPageFromJLong(pPage)->paint(rq, x, y, w, h);
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetRetainedPaintEnabled
+    (JNIEnv*, jobject, jlong pPage, jboolean enabled)
+{
+    WebPage::webPageFromJLong(pPage)->setRetainedPaintEnabled(jbool_to_bool(enabled));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetProgressiveRendering
+    (JNIEnv*, jobject, jlong pPage, jint minLayoutInterval, jint firstPaintThreshold)
+{
+    WebPage::webPageFromJLong(pPage)->setProgressiveRendering(
+        Seconds::fromMilliseconds(std::max<jint>(minLayoutInterval, 0)),
+        std::max<jint>(firstPaintThreshold, 0));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLayoutOnly
+    (JNIEnv*, jobject, jlong pPage, jboolean layoutOnly)
+{
+    WebPage::webPageFromJLong(pPage)->setLayoutOnly(jbool_to_bool(layoutOnly));
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateRendering
     (JNIEnv*, jobject, jlong pPage)
 {
@@ -2396,6 +2912,33 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetHtml
     return documentElement->outerHTML().toJavaString(env).releaseLocal();
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetVisible
+    (JNIEnv*, jobject, jlong pPage, jboolean visible)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    if (page->isVisible() == jbool_to_bool(visible))
+        return;
+
+    // Hiding the page throttles its DOM timers and suspends
+    // requestAnimationFrame, CSS and SVG animations.
+    page->setIsVisible(jbool_to_bool(visible));
+    if (visible)
+        page->resumeAllMediaPlayback();
+    else {
+        page->suspendAllMediaPlayback();
+        WebCore::releaseMemory(Critical::No, Synchronous::No, MaintainBackForwardCache::Yes, MaintainMemoryCache::Yes);
+    }
+    updateProcessActivity();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkReleaseMemory
+  (JNIEnv*, jclass, jboolean critical)
+{
+    MemoryPressureHandler::singleton().releaseMemory(critical ? Critical::Yes : Critical::No, Synchronous::Yes);
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkGetUsePageCache
     (JNIEnv*, jobject, jlong pPage)
 {
@@ -2492,6 +3035,18 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageDatabasePat
         ->setLocalStorageDatabasePath(settings.localStorageDatabasePath());
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabasePath
+  (JNIEnv* env, jobject, jlong, jstring path)
+{
+    WebDatabaseProvider::setIndexedDatabaseDirectoryPath(String(env, path));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCachePath
+  (JNIEnv* env, jobject, jlong, jstring path)
+{
+    BytecodeCacheJava::setDirectory(String(env, path));
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
   (JNIEnv*, jobject, jlong pPage, jboolean enabled)
 {
@@ -2589,4 +3144,149 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
     GCController::singleton().garbageCollectNow();
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkShrinkJSCFootprint
+  (JNIEnv*, jclass)
+{
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    vm.shrinkFootprintWhenIdle();
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkStartSamplingProfiler
+  (JNIEnv*, jclass, jint intervalMicroseconds)
+{
+#if ENABLE(SAMPLING_PROFILER)
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    auto& profiler = vm.ensureSamplingProfiler(Stopwatch::create());
+    profiler.setTimingInterval(Seconds::fromMicroseconds(std::max(intervalMicroseconds, 100)));
+    profiler.noticeCurrentThreadAsJSCExecutionThread();
+    vm.enableSamplingProfiler();
+    return JNI_TRUE;
+#else
+    UNUSED_PARAM(intervalMicroseconds);
+    return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkStopSamplingProfiler
+  (JNIEnv* env, jclass)
+{
+#if ENABLE(SAMPLING_PROFILER)
+    JSC::VM& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    if (!vm.samplingProfiler())
+        return nullptr;
+    vm.disableSamplingProfiler();
+    RefPtr<JSON::Value> samples = vm.takeSamplingProfilerSamplesAsJSON();
+    RefPtr<JSON::Object> samplesObject = samples ? samples->asObject() : nullptr;
+    RefPtr<JSON::Array> traces = samplesObject ? samplesObject->getArray("traces"_s) : nullptr;
+    if (!traces)
+        return nullptr;
+
+    // Identical stacks are merged, the raw traces of a long running
+    // session would be far larger than anyone wants to look at.
+    HashMap<String, unsigned> stackIndices;
+    Vector<std::pair<Ref<JSON::Array>, unsigned>> stacks;
+    for (auto& trace : *traces) {
+        RefPtr<JSON::Object> traceObject = trace->asObject();
+        RefPtr<JSON::Array> frames = traceObject ? traceObject->getArray("frames"_s) : nullptr;
+        if (!frames)
+            continue;
+
+        StringBuilder key;
+        auto stackFrames = JSON::Array::create();
+        for (auto& frame : *frames) {
+            RefPtr<JSON::Object> frameObject = frame->asObject();
+            if (!frameObject)
+                continue;
+            String name = frameObject->getString("name"_s);
+            String location = frameObject->getString("location"_s);
+            String tier = frameObject->getString("category"_s);
+            key.append(name, '\t', location, '\t', tier, '\n');
+
+            auto stackFrame = JSON::Object::create();
+            stackFrame->setString("name"_s, name);
+            stackFrame->setString("location"_s, location);
+            stackFrame->setString("tier"_s, tier);
+            stackFrames->pushObject(WTFMove(stackFrame));
+        }
+
+        auto addResult = stackIndices.add(key.toString(), stacks.size());
+        if (addResult.isNewEntry)
+            stacks.append({ WTFMove(stackFrames), 0 });
+        stacks[addResult.iterator->value].second++;
+    }
+
+    auto result = JSON::Object::create();
+    result->setDouble("interval"_s, samplesObject->getDouble("interval"_s).value_or(0));
+    result->setInteger("sampleCount"_s, static_cast<int>(traces->length()));
+    auto stackArray = JSON::Array::create();
+    for (auto& [frames, count] : stacks) {
+        auto stackObject = JSON::Object::create();
+        stackObject->setInteger("count"_s, count);
+        stackObject->setArray("frames"_s, WTFMove(frames));
+        stackArray->pushObject(WTFMove(stackObject));
+    }
+    result->setArray("stacks"_s, WTFMove(stackArray));
+    return result->toJSONString().toJavaString(env).releaseLocal();
+#else
+    UNUSED_PARAM(env);
+    return nullptr;
+#endif
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetRenderingProfileEnabled
+  (JNIEnv*, jobject, jlong pPage, jboolean enabled, jboolean keepTrace)
+{
+    if (Page* page = WebPage::pageFromJLong(pPage))
+        RenderingProfileJava::setEnabled(*page, jbool_to_bool(enabled), jbool_to_bool(keepTrace));
+}
+
+JNIEXPORT jdoubleArray JNICALL Java_com_sun_webkit_WebPage_twkGetRenderingProfile
+  (JNIEnv* env, jobject, jlong pPage)
+{
+    RenderingProfileJava* profile = RenderingProfileJava::from(WebPage::pageFromJLong(pPage));
+    if (!profile)
+        return nullptr;
+
+    // Laid out as read by RenderingProfile.java
+    Vector<jdouble> values;
+    for (unsigned i = 0; i < RenderingProfileJava::phaseCount; ++i) {
+        auto& totals = profile->totals(static_cast<RenderingProfileJava::Phase>(i));
+        values.append(totals.count);
+        values.append(totals.time.milliseconds());
+        values.append(totals.longest.milliseconds());
+    }
+    values.append(profile->restyledElements());
+    values.append(profile->matchedDeclarationsHits());
+    values.append(profile->matchedDeclarationsMisses());
+    values.append(profile->styleSharingHits());
+    values.append(profile->styleSharingMisses());
+    values.append(profile->layoutsInRenderingUpdates());
+    values.append(profile->maxLayoutsPerRenderingUpdate());
+
+    jdoubleArray result = env->NewDoubleArray(values.size());
+    if (WTF::CheckAndClearException(env) || !result)
+        return nullptr;
+    env->SetDoubleArrayRegion(result, 0, values.size(), values.data());
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkResetRenderingProfile
+  (JNIEnv*, jobject, jlong pPage)
+{
+    if (RenderingProfileJava* profile = RenderingProfileJava::from(WebPage::pageFromJLong(pPage)))
+        profile->reset();
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetRenderingTrace
+  (JNIEnv* env, jobject, jlong pPage)
+{
+    RenderingProfileJava* profile = RenderingProfileJava::from(WebPage::pageFromJLong(pPage));
+    if (!profile)
+        return nullptr;
+    return profile->traceJSON().toJavaString(env).releaseLocal();
+}
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,8 +32,10 @@
 #include <WebCore/PrintContext.h>
 #include <WebCore/ScrollTypes.h>
 #include <WebCore/HandleUserInputEventResult.h>
+#include <WebCore/Timer.h>
 
 #include "MediaPlayerPrivateJava.h"
+#include "RetainedPaintCache.h"
 
 #include <jni.h> // todo tav remove when building w/ pch
 
@@ -44,6 +46,7 @@ class GraphicsContext;
 class GraphicsLayer;
 class IntRect;
 class IntSize;
+class LocalFrameView;
 class Node;
 class Page;
 class PlatformKeyboardEvent;
@@ -83,7 +86,8 @@ public:
     static JLObject jobjectFromPage(Page* page);
 
     void setSize(const IntSize&);
-    void prePaint();
+    // Returns false if the progressive rendering policy defers this paint.
+    bool prePaint(bool allowDefer);
     void paint(jobject, jint, jint, jint, jint);
     void postPaint(jobject, jint, jint, jint, jint);
     bool processKeyEvent(const PlatformKeyboardEvent& event);
@@ -104,12 +108,21 @@ public:
 
     RefPtr<RQRef> jRenderTheme();
 
+    void setRetainedPaintEnabled(bool);
+    void setProgressiveRendering(Seconds minLayoutInterval, size_t firstPaintThreshold);
+    // In the layout-only mode nothing is painted or composited, and no
+    // repaints are requested from Java; layout and rendering updates still run.
+    void setLayoutOnly(bool);
+
 private:
     void requestJavaRepaint(const IntRect&);
     void markForSync();
     void syncLayers();
     IntRect pageRect();
     void renderCompositedLayers(GraphicsContext&, const IntRect&);
+    void paintRetained(GraphicsContext&, LocalFrameView&, const IntRect&);
+    void retainedPrerenderTimerFired();
+    bool shouldDeferLayout(LocalFrame&, LocalFrameView&);
 
     // GraphicsLayerClient
     void notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/) override;
@@ -136,6 +149,21 @@ private:
     std::unique_ptr<TextureMapper> m_textureMapper;
     bool m_syncLayers { false };
 
+    // Set in the retained painting mode, see RetainedPaintCache.
+    std::unique_ptr<RetainedPaintCache> m_retainedPaintCache;
+    // Records the tiles around the viewport while idle after a scroll.
+    Timer m_retainedPrerenderTimer;
+
+    // Progressive rendering while the main document is parsed: layouts are
+    // at least [m_minLayoutInterval] apart, and nothing is painted before
+    // [m_firstPaintThreshold] bytes have arrived or the page qualifies as
+    // visually non-empty. Zero disables either.
+    Seconds m_minLayoutInterval;
+    size_t m_firstPaintThreshold { 0 };
+    MonotonicTime m_lastLayoutTime;
+
+    bool m_layoutOnly { false };
+
     // Webkit expects keyPress events to be suppressed if the associated keyDown
     // event was handled. Safari implements this behavior by peeking out the
     // associated WM_CHAR event if the keydown was handled. We emulate
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,27 @@
 
 #include "WebDatabaseProvider.h"
 
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/WTFString.h>
+
+static String& indexedDatabaseDirectory()
+{
+    static NeverDestroyed<String> directory;
+    return directory;
+}
+
+void WebDatabaseProvider::setIndexedDatabaseDirectoryPath(const String& path)
+{
+    ASSERT(isMainThread());
+    // All pages share the IDB server of the default session, the first
+    // WebEngine to apply its user data directory decides where it lives.
+    if (indexedDatabaseDirectory().isEmpty())
+        indexedDatabaseDirectory() = path;
+}
+
+// An empty path keeps the databases in memory.
 String WebDatabaseProvider::indexedDatabaseDirectoryPath()
 {
-    return ""_s;
+    return indexedDatabaseDirectory();
 }
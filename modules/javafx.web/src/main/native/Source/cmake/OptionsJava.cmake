@@ -78,6 +78,8 @@ else()
 endif()
 
 WEBKIT_OPTION_BEGIN()
+WEBKIT_OPTION_DEFINE(USE_JAVA_IMAGE_DECODERS "Whether to decode PNG, JPEG, GIF and WebP images in-process instead of through ImageIO." PRIVATE OFF)
+
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_DRAG_SUPPORT PUBLIC ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_TOUCH_EVENTS PUBLIC OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_VIDEO PUBLIC ON)
@@ -88,6 +90,12 @@ WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FULLSCREEN_API PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_INPUT_TYPE_COLOR PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_MHTML PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_NOTIFICATIONS PRIVATE ON)
+# WebGL needs a GraphicsContextGL for the port. The TextureMapper one in
+# platform/graphics/texmap is built on ANGLE and EGL, neither of which is
+# part of this tree, and TextureMapperJava composites through the Prism
+# render queue rather than GL textures. Until the Java port has a
+# GraphicsContextGL backed by the Prism ES2/D3D device, WebGL stays off and
+# pages see no WebGLRenderingContext, so they can detect that and fall back.
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBGL PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEB_CRYPTO PRIVATE OFF)
 
@@ -101,8 +109,13 @@ WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_REMOTE_INSPECTOR PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEB_AUDIO PRIVATE OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_PUBLIC_SUFFIX_LIST PRIVATE OFF)
 
-WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC OFF)
-WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE OFF)
+# B3 and the FTL are not supported on Windows.
+if (WIN32)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC OFF)
+else ()
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC ${ENABLE_FTL_DEFAULT})
+endif ()
+WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE ${ENABLE_WEBASSEMBLY_DEFAULT})
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_MODERN_MEDIA_CONTROLS PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_MEDIA_CONTROLS_CONTEXT_MENUS PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_AVIF PRIVATE OFF)
@@ -117,18 +130,19 @@ if (WIN32)
     endif ()
 endif ()
 
-#platform Java
-if (WIN32)
-    # Disable 64-bit JIT on Windows , temp fix
-    if (${WTF_CPU_X86_64})
-        WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_JIT PUBLIC OFF)
-    endif ()
-endif ()
-
 # Finalize the value for all options. Do not attempt to use an option before
 # this point, and do not attempt to change any option after this point.
 WEBKIT_OPTION_END()
 
+if (USE_JAVA_IMAGE_DECODERS)
+    find_package(JPEG REQUIRED)
+    find_package(PNG REQUIRED)
+    find_package(WebP COMPONENTS demux)
+    if (WebP_FOUND)
+        SET_AND_EXPOSE_TO_BUILD(USE_WEBP ON)
+    endif ()
+endif ()
+
 
 set(ENABLE_WEBKIT_LEGACY ON)
 set(ENABLE_WEBKIT OFF)
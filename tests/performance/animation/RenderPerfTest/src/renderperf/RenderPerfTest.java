@@ -23,9 +23,16 @@
 
 package renderperf;
 
+import java.io.BufferedReader;
+import java.io.FileReader;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.PrintWriter;
 import java.lang.reflect.Method;
 import java.lang.reflect.InvocationTargetException;
 import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.Locale;
 import java.util.Random;
 import java.util.concurrent.atomic.AtomicLong;
 import java.util.concurrent.atomic.AtomicInteger;
@@ -92,6 +99,9 @@ import javafx.stage.Stage;
  *  <ul>
  *      <li>test_name: Name of the test to be executed. If not specified, all tests are executed.</li>
  *      <li>number_of_objects: Number of objects to be rendered in the test. If not specified, default value is 1000.</li>
+ *      <li>-o results_file: appends the results to results_file as CSV lines of test name, objects, frames, time and FPS.</li>
+ *      <li>-b baseline_file: compares the results with a results_file of an earlier run and exits with status 1
+ *          if a test lost more than {@link #REGRESSION_THRESHOLD} of its FPS.</li>
  *      <li>-h: help: prints application usage.</li>
  *  </ul>
  * NOTE: Set JVM command line parameter -Djavafx.animation.fullspeed=true to run animation at full speed
@@ -119,6 +129,10 @@ public class RenderPerfTest {
     private static int objectCount = 0;
     private static long testDuration = DEFAULT_TEST_TIME_SECONDS;
     private static ArrayList<String> testList = null;
+    private static final double REGRESSION_THRESHOLD = 0.1;
+    private static String resultsFile = null;
+    private static HashMap<String, Double> baseline = null;
+    private static boolean regressed = false;
 
     interface Renderable {
         void addComponents(Group node);
@@ -2049,12 +2063,54 @@ public class RenderPerfTest {
                 double totalTestTimeSeconds = (double)totalTestTime / SECOND_IN_NANOS;
                 double frameRate = frames / totalTestTimeSeconds;
                 System.out.println(String.format("%s (Objects Frames Time FPS): %d, %d, %.2f, %.2f", name, objectCount, frames, totalTestTimeSeconds, frameRate));
+                recordResult(name, frames, totalTestTimeSeconds, frameRate);
             }
         }
     }
 
 
 
+    private static String resultKey(String name, int objects) {
+        return name + "," + objects;
+    }
+
+    private static void recordResult(String name, long frames, double seconds, double frameRate) {
+        if (resultsFile != null) {
+            try (PrintWriter out = new PrintWriter(new FileWriter(resultsFile, true))) {
+                out.println(String.format(Locale.ROOT, "%s,%d,%d,%.2f,%.2f", name, objectCount, frames, seconds, frameRate));
+            } catch (IOException e) {
+                System.out.println("Unable to write " + resultsFile + ": " + e.getMessage());
+            }
+        }
+        if (baseline != null) {
+            Double base = baseline.get(resultKey(name, objectCount));
+            if (base == null) {
+                System.out.println(String.format("%s: no baseline", name));
+            } else {
+                double change = (frameRate - base) / base;
+                boolean regression = change < -REGRESSION_THRESHOLD;
+                regressed |= regression;
+                System.out.println(String.format("%s: %.2f FPS, baseline %.2f FPS (%+.1f%%)%s",
+                        name, frameRate, base, change * 100, regression ? " REGRESSION" : ""));
+            }
+        }
+    }
+
+    private static HashMap<String, Double> readBaseline(String file) throws IOException {
+        HashMap<String, Double> results = new HashMap<>();
+        try (BufferedReader in = new BufferedReader(new FileReader(file))) {
+            String line;
+            while ((line = in.readLine()) != null) {
+                String[] fields = line.split(",");
+                if (fields.length == 5) {
+                    results.put(resultKey(fields[0], Integer.parseInt(fields[1].trim())),
+                            Double.parseDouble(fields[4].trim()));
+                }
+            }
+        }
+        return results;
+    }
+
     public void testArc() throws Exception {
         (new PerfMeter("Arc", testDuration)).exec(createPR(new ArcRenderer(objectCount, R)));
     }
@@ -2247,6 +2303,25 @@ public class RenderPerfTest {
                     return false;
                 }
                 break;
+            case "-o":
+                if (++i >= args.length) {
+                    System.out.println("\nresults_file not provided.");
+                    return false;
+                }
+                resultsFile = args[i];
+                break;
+            case "-b":
+                if (++i >= args.length) {
+                    System.out.println("\nbaseline_file not provided.");
+                    return false;
+                }
+                try {
+                    baseline = readBaseline(args[i]);
+                } catch (IOException | NumberFormatException e) {
+                    System.out.println("\nUnable to read " + args[i] + ": " + e.getMessage());
+                    return false;
+                }
+                break;
             case "-h":
             case "--help":
             default:
@@ -2267,11 +2342,13 @@ public class RenderPerfTest {
     }
 
     public static void printUsage() {
-        System.out.println("Usage: java @<path_to>/run.args RenderPerfTest [-t <test_name>...] [-n <number_of_objects>] [-d <test_duration_in_seconds>] [-h]");
+        System.out.println("Usage: java @<path_to>/run.args RenderPerfTest [-t <test_name>...] [-n <number_of_objects>] [-d <test_duration_in_seconds>] [-o <results_file>] [-b <baseline_file>] [-h]");
         System.out.println("       Where test_name: Name of the test (or tests) to be executed.");
         System.out.println("             number_of_objects: Number of objects to be rendered in the test(s)");
         System.out.println("             test_duration_in_seconds: How many seconds should each test take (default 10, set 0 for infinite run)");
         System.out.println("                                       NOTE: Tests have extra 5 seconds warmup time where performance is NOT measured.");
+        System.out.println("             results_file: File the results are appended to, as CSV lines of test name, objects, frames, time and FPS");
+        System.out.println("             baseline_file: results_file of an earlier run; exit with status 1 if a test lost more than " + (int) (REGRESSION_THRESHOLD * 100) + "% of its FPS");
         System.out.println("             -h: help: print application usage");
         System.out.println("NOTE: Set JVM command line parameter -Djavafx.animation.fullspeed=true to run animation at full speed");
 
@@ -2322,5 +2399,8 @@ public class RenderPerfTest {
             e.printStackTrace();
         }
         test.exitFxEnvironment();
+        if (regressed) {
+            System.exit(1);
+        }
     }
 }
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package renderperf;
+
+
+package mediaperf;
+
+import java.io.File;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.lang.management.ManagementFactory;
+import java.lang.management.OperatingSystemMXBean;
+import java.nio.file.Files;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.media.Media;
+import javafx.scene.media.MediaPlayer;
+import javafx.scene.media.MediaView;
+import javafx.stage.Stage;
+
+/**
+ * MediaPerfTest plays each of the given clips through a MediaPlayer shown in
+ * a MediaView and reports, for each clip:
+ * <ul>
+ *  <li>ready: time from creating the player until it is READY, which covers
+ *      opening the source, building the pipeline and prerolling.</li>
+ *  <li>start: time from play() until the player is PLAYING.</li>
+ *  <li>cpu: process CPU time per second of media played, in percent of one
+ *      core.  This covers demuxing, decoding, color conversion and frame
+ *      delivery through the platform backend in use.</li>
+ *  <li>rss: the peak resident set size of the process in MB, where the
+ *      platform reports it (Linux), otherwise -1.</li>
+ * </ul>
+ * No clips are included; any URI or file the platform can play can be used,
+ * so the same clips can be measured on every backend.
+ *
+ * <p>
+ * Steps to run the application:
+ * <ol>
+ *  <li>cd media/src</li>
+ *  <li>Command to compile the program: javac {@literal @}{@literal <}path_to{@literal >}/compile.args mediaperf/{@link MediaPerfTest}.java</li>
+ *  <li>Command to execute the program: java {@literal @}{@literal <}path_to{@literal >}/run.args mediaperf/{@link MediaPerfTest} -d {@literal <}seconds{@literal >} -o {@literal <}results_file{@literal >} {@literal <}clip{@literal >}...</li>
+ *  Where:
+ *  <ul>
+ *      <li>seconds: How long each clip is played. If not specified, default value is 20; 0 plays each clip to the end.</li>
+ *      <li>results_file: File the results are appended to, as CSV lines of clip, seconds played, ready ms, start ms, cpu % and rss MB.</li>
+ *      <li>clip: A file name or URI of the clip to play.</li>
+ *  </ul>
+ * </ol>
+ */
+public class MediaPerfTest {
+    private static final double WIDTH = 1280;
+    private static final double HEIGHT = 720;
+    private static final long TIMEOUT_SECONDS = 30;
+    private static final double NANOS_IN_MILLI = 1_000_000.0;
+
+    private static Stage stage;
+    private static MediaView mediaView;
+    private static long playSeconds = 20;
+    private static String resultsFile = null;
+    private static ArrayList<String> clipList = new ArrayList<>();
+
+    private static String toSource(String clip) {
+        if (clip.contains("://") || clip.startsWith("file:")) {
+            return clip;
+        }
+        return new File(clip).toURI().toString();
+    }
+
+    private static long getProcessCpuTime() {
+        OperatingSystemMXBean os = ManagementFactory.getOperatingSystemMXBean();
+        if (os instanceof com.sun.management.OperatingSystemMXBean) {
+            return ((com.sun.management.OperatingSystemMXBean) os).getProcessCpuTime();
+        }
+        return -1;
+    }
+
+    /* Peak resident set size in MB from /proc, or -1 where there is none. */
+    private static long getPeakRss() {
+        try {
+            for (String line : Files.readAllLines(Paths.get("/proc/self/status"))) {
+                if (line.startsWith("VmHWM:")) {
+                    return Long.parseLong(line.replaceAll("[^0-9]", "")) / 1024;
+                }
+            }
+        } catch (IOException | RuntimeException e) {
+            // not available on this platform
+        }
+        return -1;
+    }
+
+    private static void measure(String clip) throws Exception {
+        CountDownLatch ready = new CountDownLatch(1);
+        CountDownLatch playing = new CountDownLatch(1);
+        CountDownLatch done = new CountDownLatch(1);
+        MediaPlayer[] player = new MediaPlayer[1];
+        String[] error = new String[1];
+        // creation, ready, play() and playing time of the player
+        long[] times = new long[4];
+
+        Runnable fail = () -> {
+            ready.countDown();
+            playing.countDown();
+            done.countDown();
+        };
+
+        Platform.runLater(() -> {
+            times[0] = System.nanoTime();
+            try {
+                player[0] = new MediaPlayer(new Media(toSource(clip)));
+            } catch (RuntimeException e) {
+                error[0] = e.getMessage();
+                fail.run();
+                return;
+            }
+            player[0].setOnError(() -> {
+                error[0] = String.valueOf(player[0].getError());
+                fail.run();
+            });
+            player[0].setOnReady(() -> {
+                times[1] = System.nanoTime();
+                ready.countDown();
+            });
+            player[0].setOnPlaying(() -> {
+                times[3] = System.nanoTime();
+                playing.countDown();
+            });
+            player[0].setOnEndOfMedia(done::countDown);
+            mediaView.setMediaPlayer(player[0]);
+        });
+
+        if (!ready.await(TIMEOUT_SECONDS, TimeUnit.SECONDS)) {
+            throw new RuntimeException("Timeout waiting for " + clip + " to get ready.");
+        }
+        if (error[0] == null) {
+            Platform.runLater(() -> {
+                times[2] = System.nanoTime();
+                player[0].play();
+            });
+            if (!playing.await(TIMEOUT_SECONDS, TimeUnit.SECONDS)) {
+                throw new RuntimeException("Timeout waiting for " + clip + " to start playing.");
+            }
+        }
+
+        long cpuStart = getProcessCpuTime();
+        long wallStart = System.nanoTime();
+        if (error[0] == null) {
+            if (playSeconds > 0) {
+                done.await(playSeconds, TimeUnit.SECONDS);
+            } else {
+                done.await();
+            }
+        }
+        long wallTime = System.nanoTime() - wallStart;
+        long cpuTime = getProcessCpuTime() - cpuStart;
+
+        CountDownLatch disposed = new CountDownLatch(1);
+        Platform.runLater(() -> {
+            mediaView.setMediaPlayer(null);
+            if (player[0] != null) {
+                player[0].dispose();
+            }
+            disposed.countDown();
+        });
+        disposed.await(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+
+        if (error[0] != null) {
+            System.out.println(String.format("%s: playback failed: %s", clip, error[0]));
+            return;
+        }
+
+        double seconds = wallTime / 1e9;
+        double readyTime = (times[1] - times[0]) / NANOS_IN_MILLI;
+        double startTime = (times[3] - times[2]) / NANOS_IN_MILLI;
+        double cpu = cpuStart < 0 ? -1 : 100.0 * cpuTime / wallTime;
+        long rss = getPeakRss();
+
+        System.out.println(String.format("%s (Seconds, Ready Start ms, CPU %%, RSS MB): %.2f, %.2f, %.2f, %.1f, %d",
+                clip, seconds, readyTime, startTime, cpu, rss));
+
+        if (resultsFile != null) {
+            try (PrintWriter out = new PrintWriter(new FileWriter(resultsFile, true))) {
+                out.println(String.format(Locale.ROOT, "%s,%.2f,%.2f,%.2f,%.1f,%d",
+                        clip, seconds, readyTime, startTime, cpu, rss));
+            } catch (IOException e) {
+                System.out.println("Unable to write " + resultsFile + ": " + e.getMessage());
+            }
+        }
+    }
+
+    public static boolean parseCmdOptions(String[] args) {
+        for (int i = 0; i < args.length; i++) {
+            String arg = args[i];
+            switch(arg) {
+            case "-d":
+                try {
+                    playSeconds = Integer.parseInt(args[++i]);
+                }
+                catch (ArrayIndexOutOfBoundsException | NumberFormatException e) {
+                    System.out.println("\nseconds not provided.");
+                    return false;
+                }
+                break;
+            case "-o":
+                if (++i >= args.length) {
+                    System.out.println("\nresults_file not provided.");
+                    return false;
+                }
+                resultsFile = args[i];
+                break;
+            case "-h":
+            case "--help":
+                return false;
+            default:
+                if (arg.startsWith("-")) {
+                    return false;
+                }
+                clipList.add(arg);
+                break;
+            }
+        }
+        return !clipList.isEmpty();
+    }
+
+    public static void printUsage() {
+        System.out.println("Usage: java @<path_to>/run.args MediaPerfTest [-d <seconds>] [-o <results_file>] [-h] <clip>...");
+        System.out.println("       Where seconds: How long each clip is played (default 20, set 0 to play to the end)");
+        System.out.println("             results_file: File the results are appended to, as CSV lines of clip, seconds played, ready ms, start ms, cpu % and rss MB");
+        System.out.println("             clip: File name or URI of a clip to play");
+        System.out.println("             -h: help: print application usage");
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (!parseCmdOptions(args)) {
+            printUsage();
+            return;
+        }
+
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Platform.startup(() -> {
+            mediaView = new MediaView();
+            mediaView.setFitWidth(WIDTH);
+            mediaView.setFitHeight(HEIGHT);
+            mediaView.setPreserveRatio(true);
+            stage = new Stage();
+            stage.setScene(new Scene(new Group(mediaView), WIDTH, HEIGHT));
+            stage.setOnShown(e -> startupLatch.countDown());
+            stage.show();
+        });
+
+        try {
+            if (!startupLatch.await(20, TimeUnit.SECONDS)) {
+                throw new RuntimeException("Timeout waiting for stage to load.");
+            }
+            for (String clip : clipList) {
+                measure(clip);
+            }
+        } catch (Exception e) {
+            System.out.println("\nUnexpected error occurred");
+            e.printStackTrace();
+        }
+        Platform.exit();
+    }
+}
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package renderperf;
+
+
+package webperf;
+
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Supplier;
+import javafx.application.Platform;
+import javafx.beans.value.ChangeListener;
+import javafx.beans.value.ObservableValue;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * WebViewPerfTest loads a set of generated pages (a large table, an SVG
+ * heavy page, a canvas heavy page and a text heavy page) into a WebView
+ * and measures, for each page:
+ * <ul>
+ *  <li>load: from loadContent() to the load worker succeeding, which covers
+ *      parsing, style resolution, the first layout and the page scripts.</li>
+ *  <li>relayout: a change of the root font size followed by a read of the
+ *      body height, which forces style resolution and layout of the whole
+ *      page.</li>
+ *  <li>paint: a snapshot of the WebView, which paints the page, decodes the
+ *      rendering queue in Prism and reads the result back.</li>
+ * </ul>
+ * Each page is measured {@link #iterations} times after one warm-up run and
+ * the median of every phase is reported.
+ *
+ * <p>
+ * Steps to run the application:
+ * <ol>
+ *  <li>cd webView/src</li>
+ *  <li>Command to compile the program: javac {@literal @}{@literal <}path_to{@literal >}/compile.args webperf/{@link WebViewPerfTest}.java</li>
+ *  <li>Command to execute the program: java {@literal @}{@literal <}path_to{@literal >}/run.args webperf/{@link WebViewPerfTest} -p {@literal <}page_name{@literal >} -i {@literal <}iterations{@literal >} -o {@literal <}results_file{@literal >} -h</li>
+ *  Where:
+ *  <ul>
+ *      <li>page_name: Name of the page to be measured. If not specified, all pages are measured.</li>
+ *      <li>iterations: Number of measured runs per page. If not specified, default value is 5.</li>
+ *      <li>results_file: File the results are appended to, as CSV lines of page name, iterations, load, relayout and paint time in milliseconds.</li>
+ *      <li>-h: help: prints application usage.</li>
+ *  </ul>
+ * </ol>
+ */
+public class WebViewPerfTest {
+    private static final double WIDTH = 1000;
+    private static final double HEIGHT = 800;
+    private static final long TIMEOUT_SECONDS = 60;
+    private static final double NANOS_IN_MILLI = 1_000_000.0;
+
+    private static final Map<String, Supplier<String>> PAGES = new LinkedHashMap<>();
+    static {
+        PAGES.put("Table", WebViewPerfTest::tablePage);
+        PAGES.put("SVG", WebViewPerfTest::svgPage);
+        PAGES.put("Canvas", WebViewPerfTest::canvasPage);
+        PAGES.put("Text", WebViewPerfTest::textPage);
+    }
+
+    private static final String RELAYOUT_SCRIPT =
+            "var s = document.documentElement.style;" +
+            "s.fontSize = (s.fontSize == '17px') ? '16px' : '17px';" +
+            "document.body.offsetHeight;";
+
+    private static Stage stage;
+    private static WebView webView;
+    private static int iterations = 5;
+    private static String resultsFile = null;
+    private static ArrayList<String> pageList = new ArrayList<>();
+
+    private static String tablePage() {
+        StringBuilder sb = new StringBuilder("<html><body><table border='1'>");
+        for (int r = 0; r < 2000; r++) {
+            sb.append("<tr>");
+            for (int c = 0; c < 10; c++) {
+                sb.append("<td style='padding:").append(c % 3).append("px'>")
+                  .append(r).append(':').append(c).append("</td>");
+            }
+            sb.append("</tr>");
+        }
+        return sb.append("</table></body></html>").toString();
+    }
+
+    private static String svgPage() {
+        Random random = new Random(100);
+        StringBuilder sb = new StringBuilder("<html><body><svg width='1000' height='800'>");
+        for (int i = 0; i < 3000; i++) {
+            int x = random.nextInt(1000);
+            int y = random.nextInt(800);
+            String color = String.format("#%06x", random.nextInt(0x1000000));
+            if (i % 2 == 0) {
+                sb.append("<circle cx='").append(x).append("' cy='").append(y)
+                  .append("' r='").append(5 + random.nextInt(20))
+                  .append("' fill='").append(color).append("' fill-opacity='0.5'/>");
+            } else {
+                sb.append("<path d='M").append(x).append(' ').append(y)
+                  .append(" q 20 -40 40 0 t 40 0' stroke='").append(color)
+                  .append("' fill='none' stroke-width='2'/>");
+            }
+        }
+        return sb.append("</svg></body></html>").toString();
+    }
+
+    private static String canvasPage() {
+        return "<html><body><canvas id='c' width='1000' height='800'></canvas><script>" +
+               "var g = document.getElementById('c').getContext('2d');" +
+               "for (var i = 0; i < 5000; i++) {" +
+               "  var x = (i * 37) % 1000, y = (i * 53) % 800;" +
+               "  g.fillStyle = 'hsla(' + (i % 360) + ', 80%, 50%, 0.5)';" +
+               "  g.beginPath(); g.arc(x, y, 5 + i % 20, 0, 2 * Math.PI); g.fill();" +
+               "  if (i % 10 == 0) { g.fillStyle = 'black'; g.fillText('text ' + i, x, y); }" +
+               "}" +
+               "</script></body></html>";
+    }
+
+    private static String textPage() {
+        String words = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor " +
+                       "incididunt ut labore et dolore magna aliqua. ";
+        String[] fonts = { "serif", "sans-serif", "monospace" };
+        StringBuilder sb = new StringBuilder("<html><body>");
+        for (int p = 0; p < 300; p++) {
+            sb.append("<p style='font-family:").append(fonts[p % fonts.length])
+              .append(";font-size:").append(10 + p % 12).append("px'>");
+            for (int i = 0; i < 8; i++) {
+                sb.append(i % 3 == 0 ? "<b>" + words + "</b>" : words);
+            }
+            sb.append("</p>");
+        }
+        return sb.append("</body></html>").toString();
+    }
+
+    private static <T> T onFxThread(Callable<T> task) throws Exception {
+        FutureTask<T> future = new FutureTask<>(task);
+        Platform.runLater(future);
+        return future.get(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+    }
+
+    private static long load(String content) throws Exception {
+        CountDownLatch loaded = new CountDownLatch(1);
+        long[] time = new long[1];
+        Worker.State[] state = new Worker.State[1];
+
+        onFxThread(() -> {
+            WebEngine engine = webView.getEngine();
+            long start = System.nanoTime();
+            engine.getLoadWorker().stateProperty().addListener(new ChangeListener<Worker.State>() {
+                @Override
+                public void changed(ObservableValue<? extends Worker.State> ov,
+                                    Worker.State oldState, Worker.State newState) {
+                    if (newState == Worker.State.SUCCEEDED || newState == Worker.State.FAILED) {
+                        time[0] = System.nanoTime() - start;
+                        state[0] = newState;
+                        ov.removeListener(this);
+                        loaded.countDown();
+                    }
+                }
+            });
+            engine.loadContent(content);
+            return null;
+        });
+
+        if (!loaded.await(TIMEOUT_SECONDS, TimeUnit.SECONDS)) {
+            throw new RuntimeException("Timeout waiting for page to load.");
+        }
+        if (state[0] != Worker.State.SUCCEEDED) {
+            throw new RuntimeException("Page failed to load.");
+        }
+        return time[0];
+    }
+
+    private static long relayout() throws Exception {
+        return onFxThread(() -> {
+            long start = System.nanoTime();
+            webView.getEngine().executeScript(RELAYOUT_SCRIPT);
+            return System.nanoTime() - start;
+        });
+    }
+
+    private static long paint() throws Exception {
+        return onFxThread(() -> {
+            long start = System.nanoTime();
+            webView.snapshot(null, null);
+            return System.nanoTime() - start;
+        });
+    }
+
+    private static double median(long[] values) {
+        long[] sorted = values.clone();
+        Arrays.sort(sorted);
+        int n = sorted.length;
+        double median = (n % 2 == 1) ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+        return median / NANOS_IN_MILLI;
+    }
+
+    private static void measure(String name, String content) throws Exception {
+        long[] loadTimes = new long[iterations];
+        long[] relayoutTimes = new long[iterations];
+        long[] paintTimes = new long[iterations];
+
+        // warm-up run, not measured
+        load(content);
+        relayout();
+        paint();
+
+        for (int i = 0; i < iterations; i++) {
+            loadTimes[i] = load(content);
+            paintTimes[i] = paint();
+            relayoutTimes[i] = relayout();
+        }
+
+        double loadTime = median(loadTimes);
+        double relayoutTime = median(relayoutTimes);
+        double paintTime = median(paintTimes);
+        System.out.println(String.format("%s (Iterations Load Relayout Paint ms): %d, %.2f, %.2f, %.2f",
+                name, iterations, loadTime, relayoutTime, paintTime));
+
+        if (resultsFile != null) {
+            try (PrintWriter out = new PrintWriter(new FileWriter(resultsFile, true))) {
+                out.println(String.format(Locale.ROOT, "%s,%d,%.2f,%.2f,%.2f",
+                        name, iterations, loadTime, relayoutTime, paintTime));
+            } catch (IOException e) {
+                System.out.println("Unable to write " + resultsFile + ": " + e.getMessage());
+            }
+        }
+    }
+
+    public static boolean parseCmdOptions(String[] args) {
+        for (int i = 0; i < args.length; i++) {
+            String arg = args[i];
+            switch(arg) {
+            case "-p":
+                while ((i + 1) < args.length && args[i + 1].charAt(0) != '-') {
+                    pageList.add(args[++i]);
+                }
+                if (pageList.size() == 0) return false;
+                break;
+            case "-i":
+                try {
+                    iterations = Integer.parseInt(args[++i]);
+                }
+                catch (ArrayIndexOutOfBoundsException | NumberFormatException e) {
+                    System.out.println("\niterations not provided.");
+                    return false;
+                }
+                if (iterations < 1) return false;
+                break;
+            case "-o":
+                if (++i >= args.length) {
+                    System.out.println("\nresults_file not provided.");
+                    return false;
+                }
+                resultsFile = args[i];
+                break;
+            case "-h":
+            case "--help":
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    public static void printUsage() {
+        System.out.println("Usage: java @<path_to>/run.args WebViewPerfTest [-p <page_name>...] [-i <iterations>] [-o <results_file>] [-h]");
+        System.out.println("       Where page_name: Name of the page (or pages) to be measured.");
+        System.out.println("             iterations: Number of measured runs per page (default 5)");
+        System.out.println("             results_file: File the results are appended to, as CSV lines of page name, iterations, load, relayout and paint time in milliseconds");
+        System.out.println("             -h: help: print application usage");
+        System.out.println("\nSupported pages:");
+        for (String name : PAGES.keySet()) {
+            System.out.println(name);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (!parseCmdOptions(args)) {
+            printUsage();
+            return;
+        }
+        if (pageList.isEmpty()) {
+            pageList.addAll(PAGES.keySet());
+        }
+
+        CountDownLatch startupLatch = new CountDownLatch(1);
+        Platform.startup(() -> {
+            webView = new WebView();
+            stage = new Stage();
+            stage.setScene(new Scene(webView, WIDTH, HEIGHT));
+            stage.setOnShown(e -> startupLatch.countDown());
+            stage.show();
+        });
+
+        try {
+            if (!startupLatch.await(20, TimeUnit.SECONDS)) {
+                throw new RuntimeException("Timeout waiting for stage to load.");
+            }
+            for (String name : pageList) {
+                Supplier<String> page = PAGES.get(name);
+                if (page == null) {
+                    System.out.println("\nIncorrect Page Name!");
+                    printUsage();
+                    break;
+                }
+                measure(name, page.get());
+            }
+        } catch (Exception e) {
+            System.out.println("\nUnexpected error occurred");
+            e.printStackTrace();
+        }
+        Platform.exit();
+    }
+}
@@ -43,6 +43,7 @@ public class EPDSettingsTest {
     private static final String FLAG_FORCE_MONOCHROME = "monocle.epd.forceMonochrome";
     private static final String FLAG_USE_DITHERING_Y1 = "monocle.epd.useDitheringY1";
     private static final String FLAG_USE_DITHERING_Y4 = "monocle.epd.useDitheringY4";
+    private static final String REGION_UPDATES = "monocle.epd.regionUpdates";
 
     private static final String VERIFY_ERROR = "Verify the error log message for %s=%d.";
 
@@ -63,6 +64,7 @@ public class EPDSettingsTest {
         System.clearProperty(FLAG_FORCE_MONOCHROME);
         System.clearProperty(FLAG_USE_DITHERING_Y1);
         System.clearProperty(FLAG_USE_DITHERING_Y4);
+        System.clearProperty(REGION_UPDATES);
     }
 
     /**
@@ -156,6 +158,20 @@ public class EPDSettingsTest {
         assertEquals(true, settings.noWait);
     }
 
+    /**
+     * Tests the EPD system property for whether to update only the region
+     * that changed since the previous update.
+     */
+    @Test
+    public void testRegionUpdates() {
+        settings = EPDSettingsShim.newInstance();
+        assertEquals(false, settings.regionUpdates);
+
+        System.setProperty(REGION_UPDATES, "true");
+        settings = EPDSettingsShim.newInstance();
+        assertEquals(true, settings.regionUpdates);
+    }
+
     /**
      * Tests the EPD system property for the update waveform mode.
      */